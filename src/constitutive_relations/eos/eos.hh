@@ -44,6 +44,23 @@ class EOS {
   virtual bool IsTemperature() = 0;
   virtual bool IsPressure() = 0;
   virtual bool IsConcentration() = 0;
+
+  // Array evaluation over count points, with params[k][i] the k-th
+  // dependency (concentration, temperature, pressure, as used) of point i.
+  // Density and its derivatives are computed in one pass, divided by M (1 for
+  // mass density, MolarMass() for molar density); null outputs are skipped.
+  // Returns false if the model has no array kernel, in which case the scalar
+  // methods must be used.
+  virtual bool EvaluateDensity(int count,
+                               const std::vector<const double*>& params,
+                               double M,
+                               double* rho,
+                               double* drho_dC,
+                               double* drho_dT,
+                               double* drho_dp)
+  {
+    return false;
+  }
 };
 
 } // namespace Relations
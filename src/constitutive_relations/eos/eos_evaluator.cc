@@ -12,6 +12,8 @@
 
 */
 
+#include <algorithm>
+
 #include "eos_factory.hh"
 #include "eos_evaluator.hh"
 
@@ -171,6 +173,10 @@ EOSEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& res
     mass_dens = results[1];
   }
 
+  // the cache is valid only if every component is found through the kernel
+  deriv_cache_valid_ = false;
+  bool cached = derivs_requested_;
+
   if (molar_dens != nullptr) {
     // evaluate MolarDensity()
     for (CompositeVector::name_iterator comp = molar_dens->begin(); comp != molar_dens->end();
@@ -181,6 +187,13 @@ EOSEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& res
 
       auto& dens_v = *(molar_dens->ViewComponent(*comp, false));
       int count = dens_v.MyLength();
+      if (derivs_requested_) {
+        if (EvaluateKernelAndCache_(true, *comp, count, dep_vec, dens_v[0])) continue;
+        cached = false;
+      } else if (EvaluateKernel_(true, count, dep_vec, dens_v[0], nullptr, nullptr, nullptr)) {
+        continue;
+      }
+
       for (int id = 0; id != count; ++id) {
         for (int k = 0; k < num_dep; k++) { eos_params[k] = (*dep_vec[k])[0][id]; }
         dens_v[0][id] = eos_->MolarDensity(eos_params);
@@ -206,6 +219,13 @@ EOSEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& res
 
         auto& dens_v = *(mass_dens->ViewComponent(*comp, false));
         int count = dens_v.MyLength();
+        if (derivs_requested_) {
+          if (EvaluateKernelAndCache_(false, *comp, count, dep_vec, dens_v[0])) continue;
+          cached = false;
+        } else if (EvaluateKernel_(false, count, dep_vec, dens_v[0], nullptr, nullptr, nullptr)) {
+          continue;
+        }
+
         for (int id = 0; id != count; ++id) {
           for (int k = 0; k < num_dep; k++) eos_params[k] = (*dep_vec[k])[0][id];
           dens_v[0][id] = eos_->MassDensity(eos_params);
@@ -214,6 +234,7 @@ EOSEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& res
       }
     }
   }
+  deriv_cache_valid_ = cached;
 
 #ifdef ENABLE_DBC
   for (const auto& vec : results) {
@@ -237,6 +258,8 @@ EOSEvaluator::EvaluatePartialDerivative_(const State& S,
                                          const Tag& wrt_tag,
                                          const std::vector<CompositeVector*>& results)
 {
+  AMANZI_ASSERT(wrt_key == conc_key_ || wrt_key == temp_key_ || wrt_key == pres_key_);
+  derivs_requested_ = true;
   int num_dep = dependencies_.size();
   std::vector<double> eos_params(num_dep);
   std::vector<const CompositeVector*> dep_cv;
@@ -269,6 +292,15 @@ EOSEvaluator::EvaluatePartialDerivative_(const State& S,
 
       auto& dens_v = *(molar_dens->ViewComponent(*comp, false));
       int count = dens_v.MyLength();
+      if (CopyCachedDerivative_(true, *comp, wrt_key, count, dens_v[0])) continue;
+      if (EvaluateKernel_(true,
+                          count,
+                          dep_vec,
+                          nullptr,
+                          wrt_key == conc_key_ ? dens_v[0] : nullptr,
+                          wrt_key == temp_key_ ? dens_v[0] : nullptr,
+                          wrt_key == pres_key_ ? dens_v[0] : nullptr))
+        continue;
 
       if (wrt_key == conc_key_) {
         for (int id = 0; id != count; ++id) {
@@ -308,6 +340,15 @@ EOSEvaluator::EvaluatePartialDerivative_(const State& S,
 
         auto& dens_v = *(mass_dens->ViewComponent(*comp, false));
         int count = dens_v.MyLength();
+        if (CopyCachedDerivative_(false, *comp, wrt_key, count, dens_v[0])) continue;
+        if (EvaluateKernel_(false,
+                            count,
+                            dep_vec,
+                            nullptr,
+                            wrt_key == conc_key_ ? dens_v[0] : nullptr,
+                            wrt_key == temp_key_ ? dens_v[0] : nullptr,
+                            wrt_key == pres_key_ ? dens_v[0] : nullptr))
+          continue;
 
         if (wrt_key == conc_key_) {
           for (int id = 0; id != count; ++id) {
@@ -333,5 +374,65 @@ EOSEvaluator::EvaluatePartialDerivative_(const State& S,
 }
 
 
+// Evaluate through the model's array kernel, if it has one, over a component
+// whose dependencies are dep_vec.  Returns false if the scalar path must be
+// used instead.
+bool
+EOSEvaluator::EvaluateKernel_(bool molar,
+                              int count,
+                              const std::vector<const Epetra_MultiVector*>& dep_vec,
+                              double* rho,
+                              double* drho_dC,
+                              double* drho_dT,
+                              double* drho_dp)
+{
+  if (molar && !eos_->IsConstantMolarMass()) return false;
+
+  std::vector<const double*> params(dep_vec.size());
+  for (int k = 0; k != dep_vec.size(); ++k) params[k] = (*dep_vec[k])[0];
+  return eos_->EvaluateDensity(
+    count, params, molar ? eos_->MolarMass() : 1.0, rho, drho_dC, drho_dT, drho_dp);
+}
+
+
+// Evaluate the density and all of its derivatives in one pass of the array
+// kernel, keeping the derivatives for EvaluatePartialDerivative_().
+bool
+EOSEvaluator::EvaluateKernelAndCache_(bool molar,
+                                      const std::string& comp,
+                                      int count,
+                                      const std::vector<const Epetra_MultiVector*>& dep_vec,
+                                      double* rho)
+{
+  auto& derivs = deriv_cache_[std::make_pair(molar, comp)];
+  bool has_dep[3] = { eos_->IsConcentration(), eos_->IsTemperature(), eos_->IsPressure() };
+  double* drho[3];
+  for (int i = 0; i != 3; ++i) {
+    derivs[i].resize(has_dep[i] ? count : 0);
+    drho[i] = has_dep[i] ? derivs[i].data() : nullptr;
+  }
+  return EvaluateKernel_(molar, count, dep_vec, rho, drho[0], drho[1], drho[2]);
+}
+
+
+// Copy a derivative kept by the last Evaluate_(), if there is one.
+bool
+EOSEvaluator::CopyCachedDerivative_(bool molar,
+                                    const std::string& comp,
+                                    const Key& wrt_key,
+                                    int count,
+                                    double* drho)
+{
+  if (!deriv_cache_valid_) return false;
+  auto entry = deriv_cache_.find(std::make_pair(molar, comp));
+  if (entry == deriv_cache_.end()) return false;
+
+  int i = wrt_key == conc_key_ ? 0 : wrt_key == temp_key_ ? 1 : 2;
+  const auto& deriv = entry->second[i];
+  if (deriv.size() != count) return false;
+  std::copy(deriv.begin(), deriv.end(), drho);
+  return true;
+}
+
 } // namespace Relations
 } // namespace Amanzi
@@ -11,6 +11,11 @@
 #ifndef AMANZI_RELATIONS_EOS_EVALUATOR_HH_
 #define AMANZI_RELATIONS_EOS_EVALUATOR_HH_
 
+#include <array>
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "eos.hh"
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
@@ -50,6 +55,24 @@ class EOSEvaluator : public EvaluatorSecondaryMonotypeCV {
   void ParsePlistPres_();
   void ParsePlistConc_();
 
+  bool EvaluateKernel_(bool molar,
+                       int count,
+                       const std::vector<const Epetra_MultiVector*>& dep_vec,
+                       double* rho,
+                       double* drho_dC,
+                       double* drho_dT,
+                       double* drho_dp);
+  bool EvaluateKernelAndCache_(bool molar,
+                               const std::string& comp,
+                               int count,
+                               const std::vector<const Epetra_MultiVector*>& dep_vec,
+                               double* rho);
+  bool CopyCachedDerivative_(bool molar,
+                             const std::string& comp,
+                             const Key& wrt_key,
+                             int count,
+                             double* drho);
+
  protected:
   // the actual model
   Teuchos::RCP<EOS> eos_;
@@ -58,6 +81,14 @@ class EOSEvaluator : public EvaluatorSecondaryMonotypeCV {
   EOSMode mode_;
   bool updated_once_;
 
+  // Once any derivative has been requested, Evaluate_() finds the density and
+  // all of its derivatives in one pass of the array kernel, and keeps the
+  // derivatives, by (molar, component), in the order C, T, p, for the
+  // requests that follow.  They are valid until the next Evaluate_().
+  bool derivs_requested_ = false;
+  bool deriv_cache_valid_ = false;
+  std::map<std::pair<bool, std::string>, std::array<std::vector<double>, 3>> deriv_cache_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, EOSEvaluator> fac_;
 };
@@ -31,47 +31,6 @@ EOSIce::EOSIce(Teuchos::ParameterList& eos_plist)
   InitializeFromPlist_();
 };
 
-double
-EOSIce::MassDensity(std::vector<double>& params)
-{
-  double T = params[0];
-  double p = std::max(params[1], 101325.);
-
-  double dT = T - kT0_;
-  double rho1bar = ka_ + (kb_ + kc_ * dT) * dT;
-  return rho1bar * (1.0 + kalpha_ * (p - kp0_));
-};
-
-
-double
-EOSIce::DMassDensityDT(std::vector<double>& params)
-{
-  double T = params[0];
-  double p = std::max(params[1], 101325.);
-
-  double dT = T - kT0_;
-  double rho1bar = kb_ + 2.0 * kc_ * dT;
-  return rho1bar * (1.0 + kalpha_ * (p - kp0_));
-};
-
-
-double
-EOSIce::DMassDensityDp(std::vector<double>& params)
-{
-  double T = params[0];
-  double p = params[1];
-
-  if (p < 101325.) {
-    return 0.;
-  } else {
-    double T = params[0];
-    double p = params[1];
-    double dT = T - kT0_;
-    double rho1bar = ka_ + (kb_ + kc_ * dT) * dT;
-    return rho1bar * kalpha_;
-  }
-};
-
 
 void
 EOSIce::InitializeFromPlist_()
@@ -0,0 +1,129 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  EOSKernelTP -- intermediate class for EOS with constant molar mass whose
+  density is a function of temperature and pressure only.
+
+  The model inherits from EOSKernelTP<Model> and provides inline,
+  non-virtual
+
+    double MassDensityTP(double T, double p) const;
+    double DMassDensityDTTP(double T, double p) const;
+    double DMassDensityDpTP(double T, double p) const;
+
+  From these, this class implements the scalar virtual interface of EOS and
+  an array kernel, EvaluateDensity(), which is a single loop over the
+  component with the model inlined, free of virtual calls and parameter
+  packing, and so can be vectorized.  Any combination of the density and its
+  derivatives is computed in one loop, so that terms common to them are
+  found once per point.
+
+*/
+
+#ifndef AMANZI_RELATIONS_EOS_KERNEL_TP_HH_
+#define AMANZI_RELATIONS_EOS_KERNEL_TP_HH_
+
+#include "dbc.hh"
+#include "eos_constant_molar_mass.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+template <class Model>
+class EOSKernelTP : public EOSConstantMolarMass {
+ public:
+  using EOSConstantMolarMass::EOSConstantMolarMass;
+
+  virtual double MassDensity(std::vector<double>& params) override
+  {
+    return model_().MassDensityTP(params[0], params[1]);
+  }
+  virtual double DMassDensityDT(std::vector<double>& params) override
+  {
+    return model_().DMassDensityDTTP(params[0], params[1]);
+  }
+  virtual double DMassDensityDp(std::vector<double>& params) override
+  {
+    return model_().DMassDensityDpTP(params[0], params[1]);
+  }
+  virtual double DMassDensityDC(std::vector<double>& params) override { return 0; }
+
+  virtual bool IsConcentration() override { return false; }
+  virtual bool IsTemperature() override { return true; }
+  virtual bool IsPressure() override { return true; }
+
+  virtual bool EvaluateDensity(int count,
+                               const std::vector<const double*>& params,
+                               double M,
+                               double* rho,
+                               double* drho_dC,
+                               double* drho_dT,
+                               double* drho_dp) override
+  {
+    AMANZI_ASSERT(params.size() == 2);
+    const double* T = params[0];
+    const double* p = params[1];
+    if (drho_dC)
+      for (int i = 0; i != count; ++i) drho_dC[i] = 0.;
+
+    // dispatch once on the requested outputs
+    switch ((rho ? 4 : 0) + (drho_dT ? 2 : 0) + (drho_dp ? 1 : 0)) {
+    case 7:
+      Loop_<true, true, true>(count, T, p, M, rho, drho_dT, drho_dp);
+      break;
+    case 6:
+      Loop_<true, true, false>(count, T, p, M, rho, drho_dT, drho_dp);
+      break;
+    case 5:
+      Loop_<true, false, true>(count, T, p, M, rho, drho_dT, drho_dp);
+      break;
+    case 4:
+      Loop_<true, false, false>(count, T, p, M, rho, drho_dT, drho_dp);
+      break;
+    case 3:
+      Loop_<false, true, true>(count, T, p, M, rho, drho_dT, drho_dp);
+      break;
+    case 2:
+      Loop_<false, true, false>(count, T, p, M, rho, drho_dT, drho_dp);
+      break;
+    case 1:
+      Loop_<false, false, true>(count, T, p, M, rho, drho_dT, drho_dp);
+      break;
+    default:
+      break;
+    }
+    return true;
+  }
+
+ private:
+  const Model& model_() const { return static_cast<const Model&>(*this); }
+
+  template <bool VAL, bool DT, bool DP>
+  void Loop_(int count,
+             const double* T,
+             const double* p,
+             double M,
+             double* rho,
+             double* drho_dT,
+             double* drho_dp) const
+  {
+    const Model& model = model_();
+    for (int i = 0; i != count; ++i) {
+      if (VAL) rho[i] = model.MassDensityTP(T[i], p[i]) / M;
+      if (DT) drho_dT[i] = model.DMassDensityDTTP(T[i], p[i]) / M;
+      if (DP) drho_dp[i] = model.DMassDensityDpTP(T[i], p[i]) / M;
+    }
+  }
+};
+
+} // namespace Relations
+} // namespace Amanzi
+
+#endif
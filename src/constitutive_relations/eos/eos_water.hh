@@ -20,27 +20,42 @@
 #ifndef AMANZI_RELATIONS_EOS_WATER_HH_
 #define AMANZI_RELATIONS_EOS_WATER_HH_
 
+#include <algorithm>
+
 #include "Teuchos_ParameterList.hpp"
 
 #include "Factory.hh"
-#include "eos_constant_molar_mass.hh"
+#include "eos_kernel_tp.hh"
 
 namespace Amanzi {
 namespace Relations {
 
 // Equation of State model
-class EOSWater : public EOSConstantMolarMass {
+class EOSWater : public EOSKernelTP<EOSWater> {
  public:
   explicit EOSWater(Teuchos::ParameterList& eos_plist);
 
-  virtual double MassDensity(std::vector<double>& params) override;
-  virtual double DMassDensityDT(std::vector<double>& params) override;
-  virtual double DMassDensityDp(std::vector<double>& params) override;
-  virtual double DMassDensityDC(std::vector<double>& params) override { return 0; }
-
-  virtual bool IsConcentration() override { return false; }
-  virtual bool IsTemperature() override { return true; }
-  virtual bool IsPressure() override { return true; }
+  // inlined into the array kernel of EOSKernelTP
+  double MassDensityTP(double T, double p) const
+  {
+    double dT = T - kT0_;
+    double rho1bar = ka_ + (kb_ + (kc_ + kd_ * dT) * dT) * dT;
+    return rho1bar * (1.0 + kalpha_ * (std::max(p, 101325.) - kp0_));
+  }
+
+  double DMassDensityDTTP(double T, double p) const
+  {
+    double dT = T - kT0_;
+    double rho1bar = kb_ + (2.0 * kc_ + 3.0 * kd_ * dT) * dT;
+    return rho1bar * (1.0 + kalpha_ * (std::max(p, 101325.) - kp0_));
+  }
+
+  double DMassDensityDpTP(double T, double p) const
+  {
+    double dT = T - kT0_;
+    double rho1bar = ka_ + (kb_ + (kc_ + kd_ * dT) * dT) * dT;
+    return p < 101325. ? 0. : rho1bar * kalpha_;
+  }
 
  private:
   Teuchos::ParameterList eos_plist_;
@@ -0,0 +1,91 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "eos_ice.hh"
+#include "eos_water.hh"
+
+using namespace Amanzi::Relations;
+
+namespace {
+
+// Every combination of outputs of the array kernel matches the scalar
+// interface, for mass and molar density, at temperatures on both sides of
+// freezing and pressures on both sides of the atmospheric cutoff.
+void
+checkKernelMatchesScalar(EOS& eos)
+{
+  std::vector<double> T, p;
+  for (int i = 0; i != 7; ++i) {
+    for (int j = 0; j != 5; ++j) {
+      T.push_back(255. + 7. * i);
+      p.push_back(6.e4 + 3.e4 * j);
+    }
+  }
+  int count = T.size();
+  std::vector<const double*> params = { T.data(), p.data() };
+
+  for (bool molar : { false, true }) {
+    double M = molar ? eos.MolarMass() : 1.;
+    for (int outputs = 1; outputs != 8; ++outputs) {
+      std::vector<double> rho(count, -1.), drho_dC(count, -1.), drho_dT(count, -1.),
+        drho_dp(count, -1.);
+      bool has_rho = outputs & 4, has_dT = outputs & 2, has_dp = outputs & 1;
+      CHECK(eos.EvaluateDensity(count,
+                                params,
+                                M,
+                                has_rho ? rho.data() : nullptr,
+                                drho_dC.data(),
+                                has_dT ? drho_dT.data() : nullptr,
+                                has_dp ? drho_dp.data() : nullptr));
+
+      for (int i = 0; i != count; ++i) {
+        std::vector<double> point = { T[i], p[i] };
+        double rho_ex = molar ? eos.MolarDensity(point) : eos.MassDensity(point);
+        double dT_ex = molar ? eos.DMolarDensityDT(point) : eos.DMassDensityDT(point);
+        double dp_ex = molar ? eos.DMolarDensityDp(point) : eos.DMassDensityDp(point);
+
+        CHECK_CLOSE(has_rho ? rho_ex : -1., rho[i], 1.e-12 * std::abs(rho_ex));
+        CHECK_CLOSE(has_dT ? dT_ex : -1., drho_dT[i], 1.e-12 * std::abs(dT_ex));
+        CHECK_CLOSE(has_dp ? dp_ex : -1., drho_dp[i], 1.e-12 * std::abs(dp_ex));
+        CHECK_EQUAL(0., drho_dC[i]);
+      }
+    }
+  }
+}
+
+} // namespace
+
+
+TEST(EOS_KERNEL_WATER)
+{
+  Teuchos::ParameterList plist;
+  EOSWater eos(plist);
+  checkKernelMatchesScalar(eos);
+
+  // the scalar interface is callable on the model itself
+  std::vector<double> point = { 280., 2.e5 };
+  CHECK_CLOSE(eos.MassDensityTP(280., 2.e5), eos.MassDensity(point), 1.e-12);
+}
+
+
+TEST(EOS_KERNEL_ICE)
+{
+  Teuchos::ParameterList plist;
+  EOSIce eos(plist);
+  checkKernelMatchesScalar(eos);
+
+  std::vector<double> point = { 260., 2.e5 };
+  CHECK_CLOSE(eos.MassDensityTP(260., 2.e5), eos.MassDensity(point), 1.e-12);
+}
@@ -62,6 +62,11 @@ simulation, including starting and ending times and restart options.
       specifies a path to the checkpoint file to continue a stopped simulation.
     * `"wallclock duration [hrs]`" ``[double]`` **optional** After this time, the
       simulation will checkpoint and end.
+    * `"profile filename`" ``[string]`` **optional** If provided, wallclock time
+      is accumulated per PK method (advance, residual, preconditioner update and
+      application, error norm, commit), nested as the PKs call each other, and
+      the min/mean/max over ranks is written to this file at the end of the
+      run.  The file is CSV if the name ends in `".csv`", and JSON otherwise.
     * `"required times`" ``[io-event-spec]`` **optional** An IOEvent_ spec that
       sets a collection of times/cycles at which the simulation is guaranteed to
       hit exactly.  This is useful for situations such as where data is provided at
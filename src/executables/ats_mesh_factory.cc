@@ -8,6 +8,10 @@
 */
 
 //! Simple wrapper that takes a ParameterList and generates all needed meshes.
+#include <algorithm>
+#include <map>
+#include <numeric>
+
 #include "Epetra_MpiComm.h"
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_TimeMonitor.hpp"
@@ -22,6 +26,7 @@
 #include "MeshColumn.hh"
 #include "MeshSurfaceCell.hh"
 #include "GeometricModel.hh"
+#include "subdomain_costs.hh"
 
 #include "ats_mesh_factory.hh"
 
@@ -473,6 +478,123 @@ createMeshColumnSurface(const std::string& mesh_name,
 }
 
 
+//
+// Assign the entities indexing a domain set to ranks by the per-subdomain
+// costs in a subdomain cost file, returning the local IDs, which may be
+// ghosted, of those assigned to this rank.
+//
+// Collective on the parent mesh's comm
+AmanziMesh::Entity_ID_List
+assignIndexedEntitiesByCost(const std::string& mesh_name,
+                            const AmanziMesh::Mesh& parent,
+                            const std::vector<std::string>& regions,
+                            AmanziMesh::Entity_kind entity_kind,
+                            const std::string& cost_filename,
+                            VerboseObject& vo)
+{
+  const auto& map = parent.map(entity_kind, true);
+  int n_owned = parent.num_entities(entity_kind, AmanziMesh::Parallel_type::OWNED);
+
+  // GIDs of the entities present on this rank, encoded as -GID-1 if ghosted
+  std::vector<int> local_gids;
+  for (const auto& region : regions) {
+    AmanziMesh::Entity_ID_List region_ents;
+    parent.get_set_entities(region, entity_kind, AmanziMesh::Parallel_type::ALL, &region_ents);
+    for (const AmanziMesh::Entity_ID& lid : region_ents) {
+      local_gids.push_back(lid < n_owned ? map.GID(lid) : -map.GID(lid) - 1);
+    }
+  }
+
+  // gather them on all ranks
+  auto comm = parent.get_comm();
+  int n_ranks = comm->NumProc();
+  int local_size = local_gids.size();
+  std::vector<int> sizes(n_ranks, local_size), offsets(n_ranks + 1, 0);
+  std::vector<int> global_gids(local_gids);
+  auto mpi_comm = dynamic_cast<const MpiComm_type*>(comm.get());
+  if (mpi_comm != nullptr) {
+    MPI_Allgather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, mpi_comm->Comm());
+    for (int p = 0; p != n_ranks; ++p) offsets[p + 1] = offsets[p] + sizes[p];
+    global_gids.resize(offsets[n_ranks]);
+    MPI_Allgatherv(local_gids.data(),
+                   local_size,
+                   MPI_INT,
+                   global_gids.data(),
+                   sizes.data(),
+                   offsets.data(),
+                   MPI_INT,
+                   mpi_comm->Comm());
+  } else {
+    AMANZI_ASSERT(n_ranks == 1);
+    offsets[1] = local_size;
+  }
+
+  // each entity may be placed on any rank on which it is present
+  std::map<int, int> owners;
+  std::map<int, std::vector<int>> candidates;
+  for (int p = 0; p != n_ranks; ++p) {
+    for (int k = offsets[p]; k != offsets[p + 1]; ++k) {
+      int gid = global_gids[k];
+      if (gid >= 0) {
+        owners[gid] = p;
+      } else {
+        gid = -gid - 1;
+      }
+      auto& gid_candidates = candidates[gid];
+      if (gid_candidates.empty() || gid_candidates.back() != p) gid_candidates.push_back(p);
+    }
+  }
+
+  // subdomains missing from the file cost the mean of those present
+  auto file_costs = Utils::readSubdomainCosts(cost_filename);
+  std::vector<int> gids, owner_ranks;
+  std::vector<double> costs;
+  std::vector<bool> known;
+  std::vector<std::vector<int>> candidate_ranks;
+  double known_total = 0.;
+  int n_known = 0;
+  for (const auto& gid_owner : owners) {
+    gids.push_back(gid_owner.first);
+    owner_ranks.push_back(gid_owner.second);
+    candidate_ranks.push_back(candidates[gid_owner.first]);
+
+    auto cost = file_costs.find(Keys::getDomainInSet(mesh_name, std::to_string(gid_owner.first)));
+    known.push_back(cost != file_costs.end());
+    costs.push_back(known.back() ? cost->second : 0.);
+    if (known.back()) {
+      known_total += cost->second;
+      ++n_known;
+    }
+  }
+  double default_cost = n_known > 0 ? known_total / n_known : 1.;
+  for (int i = 0; i != costs.size(); ++i) {
+    if (!known[i]) costs[i] = default_cost;
+  }
+
+  auto ranks = Utils::assignByCost(costs, owner_ranks, candidate_ranks, n_ranks);
+
+  AmanziMesh::Entity_ID_List ents;
+  std::vector<double> load(n_ranks, 0.);
+  int n_moved = 0;
+  for (int i = 0; i != gids.size(); ++i) {
+    if (ranks[i] == comm->MyPID()) ents.push_back(map.LID(gids[i]));
+    load[ranks[i]] += costs[i];
+    if (ranks[i] != owner_ranks[i]) ++n_moved;
+  }
+  std::sort(ents.begin(), ents.end());
+
+  if (vo.os_OK(Teuchos::VERB_MEDIUM)) {
+    double load_max = *std::max_element(load.begin(), load.end());
+    double load_mean = std::accumulate(load.begin(), load.end(), 0.) / n_ranks;
+    *vo.os() << "  Domain set \"" << mesh_name << "\": assigned " << gids.size()
+             << " subdomains by cost (" << n_known << " in \"" << cost_filename << "\"), moving "
+             << n_moved << " off their owning rank; imbalance = "
+             << (load_mean > 0. ? load_max / load_mean : 1.) << std::endl;
+  }
+  return ents;
+}
+
+
 //
 // Create a collection of meshes indexed over a domain set.
 //
@@ -552,67 +674,87 @@ createDomainSetIndexed(const std::string& mesh_name_pristine,
     // if aliased, we deal with domain sets specially
     std::string alias_target;
 
+    // the entities indexing subdomains on this rank: by default those it
+    // owns, else those assigned to it by cost
+    AmanziMesh::Entity_ID_List ds_ents;
+    if (ds_list.isParameter("subdomain cost input file")) {
+      if (is_reference_mesh) {
+        Errors::Message msg;
+        msg << "Mesh \"" << mesh_name
+            << "\" domain set cannot both use a \"subdomain cost input file\" and a "
+            << "\"referencing parent domain\", as reference maps require subdomains to be "
+            << "indexed by owned entities.";
+        Exceptions::amanzi_throw(msg);
+      }
+      ds_ents = assignIndexedEntitiesByCost(mesh_name,
+                                            *indexing_parent_mesh,
+                                            regions,
+                                            entity_kind,
+                                            ds_list.get<std::string>("subdomain cost input file"),
+                                            vo);
+    } else {
+      for (const auto& region : regions) {
+        AmanziMesh::Entity_ID_List region_ents;
+        indexing_parent_mesh->get_set_entities(
+          region, entity_kind, AmanziMesh::Parallel_type::OWNED, &region_ents);
+        ds_ents.insert(ds_ents.end(), region_ents.begin(), region_ents.end());
+      }
+    }
+    const auto& map = indexing_parent_mesh->map(entity_kind, true);
+
     // create the subdomains, indexed over entities
-    for (const auto& region : regions) {
-      AmanziMesh::Entity_ID_List region_ents;
-      indexing_parent_mesh->get_set_entities(
-        region, entity_kind, AmanziMesh::Parallel_type::OWNED, &region_ents);
-      const auto& map = indexing_parent_mesh->map(entity_kind, false);
-
-      for (const AmanziMesh::Entity_ID& lid : region_ents) {
-        // subdomain name
-        AmanziMesh::Entity_ID gid = map.GID(lid);
-        std::string subdomain = std::to_string(gid);
-        subdomains.push_back(subdomain);
-        std::string full_subdomain_name = Keys::getDomainInSet(mesh_name, subdomain);
+    for (const AmanziMesh::Entity_ID& lid : ds_ents) {
+      // subdomain name
+      AmanziMesh::Entity_ID gid = map.GID(lid);
+      std::string subdomain = std::to_string(gid);
+      subdomains.push_back(subdomain);
+      std::string full_subdomain_name = Keys::getDomainInSet(mesh_name, subdomain);
 
-        // set up the parameter list
-        Teuchos::ParameterList subdomain_list;
-        if (ds_list.isSublist(full_subdomain_name)) {
-          subdomain_list = ds_list.sublist(full_subdomain_name);
-        } else {
-          subdomain_list = ds_list.sublist(Keys::getDomainInSet(mesh_name, "*"));
-        }
-        subdomain_list.setName(full_subdomain_name);
+      // set up the parameter list
+      Teuchos::ParameterList subdomain_list;
+      if (ds_list.isSublist(full_subdomain_name)) {
+        subdomain_list = ds_list.sublist(full_subdomain_name);
+      } else {
+        subdomain_list = ds_list.sublist(Keys::getDomainInSet(mesh_name, "*"));
+      }
+      subdomain_list.setName(full_subdomain_name);
 
-        auto subdomain_mesh_type = subdomain_list.get<std::string>("mesh type");
-        auto& subdomain_param_list = subdomain_list.sublist(subdomain_mesh_type + " parameters");
+      auto subdomain_mesh_type = subdomain_list.get<std::string>("mesh type");
+      auto& subdomain_param_list = subdomain_list.sublist(subdomain_mesh_type + " parameters");
 
-        if (!subdomain_param_list.isParameter("entity GID"))
-          subdomain_param_list.set("entity GID", gid);
-        if (!subdomain_param_list.isParameter("entity LID"))
-          subdomain_param_list.set("entity LID", lid);
-        if (!subdomain_param_list.isParameter("entity kind"))
-          subdomain_param_list.set("entity kind", AmanziMesh::entity_kind_string(entity_kind));
-        if (!subdomain_param_list.isParameter("parent domain"))
-          subdomain_param_list.set("parent domain", indexing_parent_name);
+      if (!subdomain_param_list.isParameter("entity GID"))
+        subdomain_param_list.set("entity GID", gid);
+      if (!subdomain_param_list.isParameter("entity LID"))
+        subdomain_param_list.set("entity LID", lid);
+      if (!subdomain_param_list.isParameter("entity kind"))
+        subdomain_param_list.set("entity kind", AmanziMesh::entity_kind_string(entity_kind));
+      if (!subdomain_param_list.isParameter("parent domain"))
+        subdomain_param_list.set("parent domain", indexing_parent_name);
 
-        // construct
-        auto subdomain_mesh =
-          createMesh(subdomain_list, indexing_parent_mesh->get_comm(), gm, S, vo);
+      // construct
+      auto subdomain_mesh = createMesh(subdomain_list, indexing_parent_mesh->get_comm(), gm, S, vo);
 
-        // create maps to the reference mesh
-        if (is_reference_mesh) {
-          // construct map into the reference mesh
-          if (subdomain_mesh_type == "extracted" || subdomain_mesh_type == "column") {
-            reference_maps[full_subdomain_name] = AmanziMesh::createMapToParent(*subdomain_mesh);
-          } else if (subdomain_mesh_type == "surface" || subdomain_mesh_type == "column surface") {
-            AMANZI_ASSERT(reference_mesh != Teuchos::null);
-            reference_maps[full_subdomain_name] =
-              AmanziMesh::createMapSurfaceToSurface(*subdomain_mesh, *reference_mesh);
-          } else if (subdomain_mesh_type == "aliased") {
-            // use the reference map from the target mesh, but first we have to determine the target mesh name
-            alias_target = subdomain_param_list.get<std::string>("target");
-            KeyTriple dset;
-            bool is_ds = Keys::splitDomainSet(alias_target, dset);
-            if (is_ds) alias_target = std::get<0>(dset);
-          } else {
-            Errors::Message msg;
-            msg << "Mesh \"" << mesh_name
-                << "\" domain set cannot create reference map to mesh of type \""
-                << subdomain_mesh_type << "\".";
-            Exceptions::amanzi_throw(msg);
-          }
+      // create maps to the reference mesh
+      if (is_reference_mesh) {
+        // construct map into the reference mesh
+        if (subdomain_mesh_type == "extracted" || subdomain_mesh_type == "column") {
+          reference_maps[full_subdomain_name] = AmanziMesh::createMapToParent(*subdomain_mesh);
+        } else if (subdomain_mesh_type == "surface" || subdomain_mesh_type == "column surface") {
+          AMANZI_ASSERT(reference_mesh != Teuchos::null);
+          reference_maps[full_subdomain_name] =
+            AmanziMesh::createMapSurfaceToSurface(*subdomain_mesh, *reference_mesh);
+        } else if (subdomain_mesh_type == "aliased") {
+          // use the reference map from the target mesh, but first we have to determine the target mesh name
+          alias_target = subdomain_param_list.get<std::string>("target");
+          KeyTriple dset;
+          bool is_ds = Keys::splitDomainSet(alias_target, dset);
+          if (is_ds) alias_target = std::get<0>(dset);
+        } else {
+          Errors::Message msg;
+          msg << "Mesh \"" << mesh_name
+              << "\" domain set cannot create reference map to mesh of type \""
+              << subdomain_mesh_type << "\".";
+          Exceptions::amanzi_throw(msg);
         }
       }
     }
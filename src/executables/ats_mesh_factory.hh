@@ -247,6 +247,26 @@ Specified by `"mesh type`" of `"subgrid`".
 .. todo::
    WIP: Add examples (intermediate scale model, transport subgrid model)
 
+By default each subdomain of a `"domain set indexed`" lives on the rank that
+owns its indexing entity.  Its `"domain set indexed parameters`" list may
+instead set:
+
+* `"subdomain cost input file`" ``[string]`` **optional** A subdomain cost
+  file, e.g. the `"subdomain cost output file`" of a weak subdomain MPC from a
+  previous run.  Subdomains are assigned to ranks by greedy
+  longest-processing-time bin packing over these costs, so that ranks finish
+  their subdomains at about the same time.  Subdomains missing from the file
+  cost the mean of those present.
+
+.. note::
+
+   A subdomain may only move to a rank on which its indexing entity is
+   ghosted, as its mesh is extracted from the rank-local parent, so balancing
+   is limited to neighbouring ranks.  This cannot be combined with a
+   `"referencing parent domain`", and suits only domain sets not coupled
+   entity-by-entity to their parent, e.g. columns that are not coupled to a
+   star surface system or integrated by column evaluators on the parent.
+
 
 Column Meshes
 =============
@@ -50,6 +50,7 @@ actual work.
 #include "TreeVector.hh"
 #include "PK_Factory.hh"
 #include "pk_helpers.hh"
+#include "pk_profiler.hh"
 
 #include "ats_mesh_factory.hh"
 
@@ -85,6 +86,10 @@ Coordinator::Coordinator(const Teuchos::RCP<Teuchos::ParameterList>& plist,
   timers_["4d: checkpoint"] = Teuchos::TimeMonitor::getNewCounter("4d: checkpoint");
   timers_["5: finalize"] = Teuchos::TimeMonitor::getNewCounter("5: finalize");
 
+  // per-PK timers, off unless a report is requested
+  profile_filename_ = coordinator_list_->get<std::string>("profile filename", "");
+  Amanzi::PKProfiler::setEnabled(!profile_filename_.empty());
+
   // print header material
   if (vo_->os_OK(Teuchos::VERB_LOW)) {
     *vo_->os() << "Writing input file ..." << std::endl << std::endl;
@@ -372,6 +377,14 @@ Coordinator::finalize()
   // report out
   WriteStateStatistics(*S_, *vo_);
   report_memory();
+
+  if (!profile_filename_.empty()) {
+    Amanzi::PKProfiler::Write(*comm_, profile_filename_);
+    if (vo_->os_OK(Teuchos::VERB_LOW)) {
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "Wrote PK timers to \"" << profile_filename_ << "\"" << std::endl;
+    }
+  }
 }
 
 
@@ -558,7 +571,10 @@ Coordinator::advance()
     // copy from old time into new time to reset the timestep
     pk_->FailStep(t_old, t_new, Amanzi::Tags::NEXT);
 
-    // check whether meshes are deformable, and if so, recover the old coordinates
+    // check whether meshes are deformable, and if so, recover the old
+    // coordinates.  Only nodes that moved are reset, and a mesh whose nodes
+    // did not move (most steps, or the deforming PK already reset it) is not
+    // touched at all.
     for (Amanzi::State::mesh_iterator mesh = S_->mesh_begin(); mesh != S_->mesh_end(); ++mesh) {
       if (S_->IsDeformableMesh(mesh->first) && !S_->IsAliasedMesh(mesh->first)) {
         // collect the old coordinates
@@ -566,22 +582,9 @@ Coordinator::advance()
         Teuchos::RCP<const Amanzi::CompositeVector> vc_vec =
           S_->GetPtr<Amanzi::CompositeVector>(node_key, Amanzi::Tags::DEFAULT);
         vc_vec->ScatterMasterToGhosted();
-        const Epetra_MultiVector& vc = *vc_vec->ViewComponent("node", true);
-
-        std::vector<int> node_ids(vc.MyLength());
-        Amanzi::AmanziGeometry::Point_List old_positions(vc.MyLength());
-        for (int n = 0; n != vc.MyLength(); ++n) {
-          node_ids[n] = n;
-          if (mesh->second.first->space_dimension() == 2) {
-            old_positions[n] = Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n]);
-          } else {
-            old_positions[n] = Amanzi::AmanziGeometry::Point(vc[0][n], vc[1][n], vc[2][n]);
-          }
-        }
 
         // undeform the mesh
-        Amanzi::AmanziGeometry::Point_List final_positions;
-        mesh->second.first->deform(node_ids, old_positions, false, &final_positions);
+        Amanzi::copyChangedVectorToMeshCoordinates(*vc_vec, *mesh->second.first);
       }
     }
   }
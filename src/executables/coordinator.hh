@@ -97,6 +97,7 @@ class Coordinator {
   Teuchos::TimeMonitor wallclock_monitor_;
   double duration_;
   bool subcycled_ts_;
+  std::string profile_filename_;
 
   // fancy OS
   Teuchos::RCP<Amanzi::VerboseObject> vo_;
@@ -0,0 +1,97 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Least-squares reconstruction of cell vectors from face fluxes.
+#include "Teuchos_LAPACK.hpp"
+#include "Teuchos_SerialDenseMatrix.hpp"
+
+#include "thread_pool.hh"
+#include "velocity_reconstruction.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+VelocityReconstruction::VelocityReconstruction(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+  : mesh_(mesh), d_(mesh->space_dimension())
+{
+  Init();
+}
+
+
+void
+VelocityReconstruction::Init()
+{
+  int ncells_owned = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  offsets_.assign(ncells_owned + 1, 0);
+  faces_.clear();
+  coefs_.clear();
+
+  Teuchos::LAPACK<int, double> lapack;
+  Teuchos::SerialDenseMatrix<int, double> matrix(d_, d_);
+  AmanziMesh::Entity_ID_List faces;
+  for (int c = 0; c != ncells_owned; ++c) {
+    mesh_->cell_get_faces(c, &faces);
+    int nfaces = faces.size();
+
+    // normals, one column per face, are overwritten by the operator
+    Teuchos::SerialDenseMatrix<int, double> normals(d_, nfaces);
+    matrix.putScalar(0.0);
+    for (int n = 0; n != nfaces; ++n) { // populate least-square matrix
+      const AmanziGeometry::Point& normal = mesh_->face_normal(faces[n]);
+      for (int i = 0; i != d_; ++i) {
+        normals(i, n) = normal[i];
+        matrix(i, i) += normal[i] * normal[i];
+        for (int j = i + 1; j < d_; ++j) { matrix(j, i) = matrix(i, j) += normal[i] * normal[j]; }
+      }
+    }
+
+    int info;
+    lapack.POSV('U', d_, nfaces, matrix.values(), d_, normals.values(), d_, &info);
+
+    offsets_[c + 1] = offsets_[c] + nfaces;
+    faces_.insert(faces_.end(), faces.begin(), faces.end());
+    for (int i = 0; i != d_; ++i)
+      for (int n = 0; n != nfaces; ++n) coefs_.push_back(normals(i, n));
+  }
+}
+
+
+void
+VelocityReconstruction::Apply(const Epetra_MultiVector& flux,
+                              Epetra_MultiVector& velocity,
+                              int nthreads) const
+{
+  int ncells_owned = offsets_.size() - 1;
+  Utils::forEachBlock(nthreads, ncells_owned, [&](int, int c_begin, int c_end) {
+    Apply_(flux, velocity, c_begin, c_end);
+  });
+}
+
+
+void
+VelocityReconstruction::Apply_(const Epetra_MultiVector& flux,
+                               Epetra_MultiVector& velocity,
+                               int c_begin,
+                               int c_end) const
+{
+  const double* flux_f = flux[0];
+  for (int c = c_begin; c != c_end; ++c) {
+    int nfaces = offsets_[c + 1] - offsets_[c];
+    const int* faces = &faces_[offsets_[c]];
+    const double* coefs = &coefs_[d_ * offsets_[c]];
+    for (int i = 0; i != d_; ++i) {
+      double v = 0.;
+      for (int n = 0; n != nfaces; ++n) v += coefs[i * nfaces + n] * flux_f[faces[n]];
+      velocity[i][c] = v;
+    }
+  }
+}
+
+} // namespace Operators
+} // namespace Amanzi
@@ -0,0 +1,71 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Least-squares reconstruction of cell vectors from face fluxes.
+/*!
+
+A cell velocity v is reconstructed from the fluxes q_f on the faces of the
+cell as the least-squares solution of n_f . v = q_f, where n_f is the
+(area-weighted) face normal, i.e.
+
+   v = (sum_f n_f n_f^T)^{-1} sum_f n_f q_f.
+
+The operator (sum_f n_f n_f^T)^{-1} n_f depends only on the geometry, so it
+is computed once and stored, for each owned cell, as d coefficients per face.
+Reconstruction is then a sparse mat-vec over the face flux.  Init() must be
+called again when the mesh deforms.
+
+*/
+
+#ifndef AMANZI_OPERATORS_VELOCITY_RECONSTRUCTION_HH_
+#define AMANZI_OPERATORS_VELOCITY_RECONSTRUCTION_HH_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_MultiVector.h"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class VelocityReconstruction {
+ public:
+  explicit VelocityReconstruction(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  // (Re)compute the operator from the current mesh geometry.
+  void Init();
+
+  // Reconstruct d vector components on owned cells from a ghosted face flux,
+  // splitting the cells into contiguous blocks over nthreads threads of the
+  // shared pool.
+  void Apply(const Epetra_MultiVector& flux, Epetra_MultiVector& velocity, int nthreads = 1) const;
+
+ private:
+  void Apply_(const Epetra_MultiVector& flux,
+              Epetra_MultiVector& velocity,
+              int c_begin,
+              int c_end) const;
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
+  int d_;
+
+  // faces of cell c are faces_[offsets_[c]:offsets_[c+1]], and component i
+  // of its operator is coefs_[d*offsets_[c] + i*nfaces + n], n < nfaces
+  std::vector<int> offsets_;
+  std::vector<int> faces_;
+  std::vector<double> coefs_;
+};
+
+} // namespace Operators
+} // namespace Amanzi
+
+#endif
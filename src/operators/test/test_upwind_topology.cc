@@ -0,0 +1,80 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "Mesh.hh"
+#include "MeshFactory.hh"
+
+#include "upwind_topology.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+Teuchos::RCP<const AmanziMesh::Mesh>
+createBox(int nx)
+{
+  auto comm = getDefaultComm();
+  AmanziMesh::MeshFactory factory(comm);
+  return factory.create(0.0, 0.0, 0.0, 3.0, 2.0, 1.0, nx, 4, 3);
+}
+
+} // namespace
+
+
+// the cells of each face are those of face_get_cells(), and the orientation
+// is that of the face relative to the first
+TEST(UPWIND_TOPOLOGY_MATCHES_MESH)
+{
+  auto mesh = createBox(5);
+  const auto& topology = Operators::getUpwindTopology(mesh);
+
+  int nfaces = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+  CHECK_EQUAL(2 * nfaces, topology.face_cells.size());
+
+  AmanziMesh::Entity_ID_List cells;
+  for (int f = 0; f != nfaces; ++f) {
+    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    CHECK_EQUAL(cells.size(), topology.ncells(f));
+    CHECK_EQUAL(cells[0], topology.face_cells[2 * f]);
+    CHECK_EQUAL(cells.size() == 2 ? cells[1] : -1, topology.face_cells[2 * f + 1]);
+
+    int dir = 0;
+    mesh->face_normal(f, false, cells[0], &dir);
+    CHECK_EQUAL(dir, topology.face_dirs[f]);
+  }
+}
+
+
+// a mesh has one topology while it exists, and does not share it with
+// another mesh, even one allocated at the same address
+TEST(UPWIND_TOPOLOGY_CACHE)
+{
+  auto mesh = createBox(5);
+  const auto* topology = &Operators::getUpwindTopology(mesh);
+  CHECK(topology == &Operators::getUpwindTopology(mesh));
+
+  // the cache does not keep the mesh alive
+  CHECK_EQUAL(1, mesh.strong_count());
+
+  auto other = createBox(6);
+  CHECK(topology != &Operators::getUpwindTopology(other));
+
+  mesh = Teuchos::null;
+  for (int i = 0; i != 4; ++i) {
+    auto next = createBox(7);
+    int nfaces = next->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+    CHECK_EQUAL(2 * nfaces, Operators::getUpwindTopology(next).face_cells.size());
+  }
+}
@@ -0,0 +1,89 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Epetra_MultiVector.h"
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "Mesh.hh"
+#include "MeshFactory.hh"
+
+#include "velocity_reconstruction.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+Teuchos::RCP<const AmanziMesh::Mesh>
+createBox()
+{
+  auto comm = getDefaultComm();
+  AmanziMesh::MeshFactory factory(comm);
+  return factory.create(0.0, 0.0, 0.0, 3.0, 2.0, 1.0, 12, 7, 5);
+}
+
+// flux of a uniform velocity through every owned and ghost face
+void
+uniformFlux(const AmanziMesh::Mesh& mesh, const AmanziGeometry::Point& v, Epetra_MultiVector& flux)
+{
+  int nfaces = mesh.num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+  for (int f = 0; f != nfaces; ++f) flux[0][f] = mesh.face_normal(f) * v;
+}
+
+} // namespace
+
+
+// a uniform velocity is reconstructed exactly
+TEST(VELOCITY_RECONSTRUCTION_UNIFORM)
+{
+  auto mesh = createBox();
+  AmanziGeometry::Point v0(0.3, -1.2, 0.05);
+
+  Epetra_MultiVector flux(mesh->face_map(true), 1);
+  uniformFlux(*mesh, v0, flux);
+
+  Operators::VelocityReconstruction recon(mesh);
+  Epetra_MultiVector velocity(mesh->cell_map(false), 3);
+  recon.Apply(flux, velocity);
+
+  for (int c = 0; c != velocity.MyLength(); ++c) {
+    for (int i = 0; i != 3; ++i) CHECK_CLOSE(v0[i], velocity[i][c], 1.e-10);
+  }
+}
+
+
+// reconstruction split over threads of the pool matches the serial one bit
+// for bit, for any number of threads
+TEST(VELOCITY_RECONSTRUCTION_THREADED_MATCHES_SERIAL)
+{
+  auto mesh = createBox();
+  int nfaces = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+
+  // an arbitrary, non-uniform flux
+  Epetra_MultiVector flux(mesh->face_map(true), 1);
+  for (int f = 0; f != nfaces; ++f) {
+    const auto& xf = mesh->face_centroid(f);
+    flux[0][f] = std::sin(xf[0]) * mesh->face_area(f) + xf[1] * xf[2];
+  }
+
+  Operators::VelocityReconstruction recon(mesh);
+  Epetra_MultiVector serial(mesh->cell_map(false), 3);
+  recon.Apply(flux, serial, 1);
+
+  for (int nthreads : { 2, 3, 8 }) {
+    Epetra_MultiVector threaded(mesh->cell_map(false), 3);
+    recon.Apply(flux, threaded, nthreads);
+    for (int c = 0; c != serial.MyLength(); ++c) {
+      for (int i = 0; i != 3; ++i) CHECK_EQUAL(serial[i][c], threaded[i][c]);
+    }
+  }
+}
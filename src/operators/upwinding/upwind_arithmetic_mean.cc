@@ -17,6 +17,7 @@
 #include "CompositeVector.hh"
 #include "State.hh"
 #include "upwind_arithmetic_mean.hh"
+#include "upwind_topology.hh"
 
 namespace Amanzi {
 namespace Operators {
@@ -53,7 +54,6 @@ UpwindArithmeticMean::CalculateCoefficientsOnFaces(const CompositeVector& cell_c
                                                    const std::string face_component) const
 {
   Teuchos::RCP<const AmanziMesh::Mesh> mesh = face_coef.Mesh();
-  AmanziMesh::Entity_ID_List faces;
 
   // initialize the face coefficients
   face_coef.ViewComponent(face_component, true)->PutScalar(0.0);
@@ -71,22 +71,18 @@ UpwindArithmeticMean::CalculateCoefficientsOnFaces(const CompositeVector& cell_c
   Epetra_MultiVector& face_coef_f = *face_coef.ViewComponent(face_component, true);
   const Epetra_MultiVector& cell_coef_c = *cell_coef.ViewComponent(cell_component, true);
 
-  int c_used = cell_coef.size(cell_component, true);
-  for (int c = 0; c != c_used; ++c) {
-    mesh->cell_get_faces(c, &faces);
-
-    for (unsigned int n = 0; n != faces.size(); ++n) {
-      int f = faces[n];
-      face_coef_f[0][f] += cell_coef_c[0][c] / 2.0;
+  const UpwindTopology& topology = getUpwindTopology(mesh);
+  int nfaces = face_coef.size(face_component, true);
+  for (int f = 0; f != nfaces; ++f) {
+    for (int n = 0; n != topology.ncells(f); ++n) {
+      face_coef_f[0][f] += cell_coef_c[0][topology.face_cells[2 * f + n]] / 2.0;
     }
   }
 
   // rescale boundary faces, as these had only one cell neighbor
   unsigned int f_owned = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
   for (unsigned int f = 0; f != f_owned; ++f) {
-    AmanziMesh::Entity_ID_List cells;
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    if (cells.size() == 1) { face_coef_f[0][f] *= 2.; }
+    if (topology.ncells(f) == 1) { face_coef_f[0][f] *= 2.; }
   }
 };
 
@@ -120,11 +116,11 @@ UpwindArithmeticMean::UpdateDerivatives(
   double dK_dp[2];
   double p[2];
 
+  const UpwindTopology& topology = getUpwindTopology(mesh);
   for (unsigned int f = 0; f != nfaces_owned; ++f) {
     // get neighboring cells
-    AmanziMesh::Entity_ID_List cells;
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int mcells = cells.size();
+    const int* cells = &topology.face_cells[2 * f];
+    int mcells = topology.ncells(f);
 
     // create the local matrix
     Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double>> Jpp =
@@ -20,7 +20,7 @@
 #include "Debugger.hh"
 #include "VerboseObject.hh"
 #include "upwind_elevation_stabilized.hh"
-#include "Epetra_IntVector.h"
+#include "upwind_topology.hh"
 
 namespace Amanzi {
 namespace Operators {
@@ -107,11 +107,11 @@ UpwindElevationStabilized::CalculateCoefficientsOnFaces(const CompositeVector& s
   //
   // Note that the upwind value here is assumed to be the max of h+z.  This is
   // always true for FV, maybe not for MFD.
+  const UpwindTopology& topology = getUpwindTopology(mesh);
   int nfaces = face_coef.size("face", false);
   for (int f = 0; f != nfaces; ++f) {
-    AmanziMesh::Entity_ID_List fcells;
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &fcells);
-    AMANZI_ASSERT(fcells.size() > 0);
+    const int* fcells = &topology.face_cells[2 * f];
+    AMANZI_ASSERT(fcells[0] >= 0);
 
     double denom[2] = { 0., 0. };
     double weight[2] = { 0., 0. };
@@ -126,7 +126,7 @@ UpwindElevationStabilized::CalculateCoefficientsOnFaces(const CompositeVector& s
     elev[0] = elev_v[0][fcells[0]];
     dens[0] = dens_v[0][fcells[0]];
 
-    if (fcells.size() > 1) {
+    if (topology.ncells(f) > 1) {
       weight[1] = AmanziGeometry::norm(mesh->face_centroid(f) - mesh->cell_centroid(fcells[1]));
       denom[1] = manning_coef_v[0][fcells[1]] *
                  std::sqrt(std::max(slope_v[0][fcells[1]], slope_regularization));
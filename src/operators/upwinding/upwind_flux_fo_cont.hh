@@ -61,6 +61,9 @@ class UpwindFluxFOCont : public Upwinding {
   std::string elevation_;
   double slope_regularization_;
   double manning_exp_;
+
+  // workspace, reused across calls
+  mutable std::vector<int> upwind_cell_, downwind_cell_;
 };
 
 } // namespace Operators
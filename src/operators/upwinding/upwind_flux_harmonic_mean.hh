@@ -58,6 +58,9 @@ class UpwindFluxHarmonicMean : public Upwinding {
   std::string pkname_;
   Key flux_;
   double flux_eps_;
+
+  // workspace, reused across calls
+  mutable std::vector<int> upwind_cell_, downwind_cell_;
 };
 
 } // namespace Operators
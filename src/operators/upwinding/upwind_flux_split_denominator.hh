@@ -60,6 +60,9 @@ class UpwindFluxSplitDenominator : public Upwinding {
   double flux_eps_;
   double slope_regularization_;
   std::string ponded_depth_;
+
+  // workspace, reused across calls
+  mutable std::vector<int> upwind_cell_, downwind_cell_;
 };
 
 } // namespace Operators
@@ -18,6 +18,7 @@
 #include "CompositeVector.hh"
 #include "State.hh"
 #include "upwind_potential_difference.hh"
+#include "upwind_topology.hh"
 
 namespace Amanzi {
 namespace Operators {
@@ -57,8 +58,7 @@ UpwindPotentialDifference::CalculateCoefficientsOnFaces(const CompositeVector& c
   if (face_coef.HasComponent("cell")) { face_coef.ViewComponent("cell", true)->PutScalar(1.0); }
 
   Teuchos::RCP<const AmanziMesh::Mesh> mesh = face_coef.Mesh();
-  AmanziMesh::Entity_ID_List cells;
-  std::vector<int> dirs;
+  const UpwindTopology& topology = getUpwindTopology(mesh);
   double eps = 1.e-16;
 
   // communicate ghosted cells
@@ -75,9 +75,9 @@ UpwindPotentialDifference::CalculateCoefficientsOnFaces(const CompositeVector& c
 
   int nfaces = face_coef.size("face", false);
   for (unsigned int f = 0; f != nfaces; ++f) {
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    const int* cells = &topology.face_cells[2 * f];
 
-    if (cells.size() == 1) {
+    if (topology.ncells(f) == 1) {
       if (potential_f != Teuchos::null) {
         if (potential_c[0][cells[0]] >= (*potential_f)[0][f]) {
           face_coef_f[0][f] = cell_coef_c[0][cells[0]];
@@ -156,10 +156,10 @@ UpwindPotentialDifference::UpdateDerivatives(
   double dK_dp[2];
   double p[2];
 
+  const UpwindTopology& topology = getUpwindTopology(mesh);
   for (unsigned int f = 0; f != nfaces_owned; ++f) {
-    AmanziMesh::Entity_ID_List cells;
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int mcells = cells.size();
+    const int* cells = &topology.face_cells[2 * f];
+    int mcells = topology.ncells(f);
 
     // create the local matrix
     Teuchos::RCP<Teuchos::SerialDenseMatrix<int, double>> Jpp =
@@ -0,0 +1,88 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Face to cell connectivity shared by all upwinding schemes on a mesh.
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "upwind_topology.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+UpwindTopology::UpwindTopology(const AmanziMesh::Mesh& mesh)
+{
+  int nfaces = mesh.num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+  int ncells = mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL);
+  face_cells.assign(2 * nfaces, -1);
+  face_dirs.assign(nfaces, 0);
+
+  AmanziMesh::Entity_ID_List cells;
+  for (int f = 0; f != nfaces; ++f) {
+    mesh.face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    AMANZI_ASSERT(cells.size() <= 2);
+    for (int n = 0; n != cells.size(); ++n) face_cells[2 * f + n] = cells[n];
+  }
+
+  AmanziMesh::Entity_ID_List faces;
+  std::vector<int> dirs;
+  for (int c = 0; c != ncells; ++c) {
+    mesh.cell_get_faces_and_dirs(c, &faces, &dirs);
+    for (int n = 0; n != faces.size(); ++n) {
+      if (face_cells[2 * faces[n]] == c) face_dirs[faces[n]] = dirs[n];
+    }
+  }
+}
+
+
+void
+UpwindTopology::IdentifyUpwindCells(const double* flux,
+                                    int nfaces,
+                                    int* upwind,
+                                    int* downwind) const
+{
+  for (int f = 0; f != nfaces; ++f) {
+    int c0 = face_cells[2 * f];
+    int c1 = face_cells[2 * f + 1];
+    double flux_out = flux[f] * face_dirs[f];
+    bool c0_upwind = flux_out > 0 || (!(flux_out < 0) && (c1 < 0 || c0 < c1));
+    upwind[f] = c0_upwind ? c0 : c1;
+    downwind[f] = c0_upwind ? c1 : c0;
+  }
+}
+
+
+const UpwindTopology&
+getUpwindTopology(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  // Meshes are held by weak references, which neither keep a mesh alive nor
+  // match a later mesh allocated at the same address.  Entries of destroyed
+  // meshes are dropped here, so that only weak references, which touch no
+  // mesh or communicator, remain when the cache itself is destroyed.
+  static std::vector<std::pair<Teuchos::RCP<const AmanziMesh::Mesh>,
+                               std::unique_ptr<const UpwindTopology>>>
+    cache;
+  static std::mutex cache_mutex;
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  cache.erase(std::remove_if(cache.begin(),
+                             cache.end(),
+                             [](const auto& entry) { return !entry.first.is_valid_ptr(); }),
+              cache.end());
+  for (const auto& entry : cache) {
+    if (entry.first.shares_resource(mesh)) return *entry.second;
+  }
+  cache.emplace_back(mesh.create_weak(), std::make_unique<const UpwindTopology>(*mesh));
+  return *cache.back().second;
+}
+
+} // namespace Operators
+} // namespace Amanzi
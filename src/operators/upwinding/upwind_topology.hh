@@ -0,0 +1,73 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Face to cell connectivity shared by all upwinding schemes on a mesh.
+/*!
+
+Upwinding schemes are called in every residual and preconditioner update, and
+each needs the cells on either side of every face and the orientation of the
+face relative to them.  These depend only on the mesh topology, so they are
+found once per mesh and stored as flat arrays, shared by all schemes, and by
+PKs that loop over faces, through getUpwindTopology().  The cache refers to
+each mesh weakly: it never keeps a mesh alive, and the topology of a mesh is
+dropped once the mesh is destroyed.
+
+The cells of face f are `face_cells[2*f]` and `face_cells[2*f+1]`, in the
+order of `face_get_cells()`, with -1 for the second cell of a face with only
+one.  `face_dirs[f]` is the orientation of f relative to its first cell; it
+is opposite relative to the second.
+
+*/
+
+#ifndef AMANZI_UPWINDING_TOPOLOGY_HH_
+#define AMANZI_UPWINDING_TOPOLOGY_HH_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+struct UpwindTopology {
+  explicit UpwindTopology(const AmanziMesh::Mesh& mesh);
+
+  int ncells(int f) const { return face_cells[2 * f + 1] < 0 ? 1 : 2; }
+
+  // Upwind and downwind cells of the first nfaces faces given the flux on
+  // each, -1 on the boundary.  On a face with no flux, the cell with the
+  // lower index is taken as upwind.
+  void IdentifyUpwindCells(const double* flux, int nfaces, int* upwind, int* downwind) const;
+
+  // The cells of face f that are owned, with c1 equal to c0 if only one is.
+  // At least one cell of an owned face is owned.
+  void OwnedCells(int f, int ncells_owned, int& c0, int& c1) const
+  {
+    c0 = face_cells[2 * f];
+    c1 = face_cells[2 * f + 1];
+    if (c1 < 0 || c1 >= ncells_owned) c1 = c0;
+    if (c0 >= ncells_owned) c0 = c1;
+  }
+
+  std::vector<int> face_cells;
+  std::vector<int> face_dirs;
+};
+
+
+// The topology of mesh, built on first use and shared by every caller while
+// the mesh exists.
+const UpwindTopology&
+getUpwindTopology(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+} // namespace Operators
+} // namespace Amanzi
+
+#endif
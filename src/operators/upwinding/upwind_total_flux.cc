@@ -20,7 +20,7 @@
 #include "Debugger.hh"
 #include "VerboseObject.hh"
 #include "upwind_total_flux.hh"
-#include "Epetra_IntVector.h"
+#include "upwind_topology.hh"
 
 namespace Amanzi {
 namespace Operators {
@@ -55,6 +55,17 @@ UpwindTotalFlux::Update(const CompositeVector& cells,
 };
 
 
+void
+UpwindTotalFlux::UpdateBatched(const std::vector<const CompositeVector*>& cells,
+                               const std::vector<CompositeVector*>& faces,
+                               const State& S,
+                               const Teuchos::Ptr<Debugger>& db) const
+{
+  Teuchos::RCP<const CompositeVector> flux = S.GetPtr<CompositeVector>(flux_, tag_);
+  CalculateCoefficientsOnFaces(cells, "cell", *flux, faces, "face", db);
+};
+
+
 void
 UpwindTotalFlux::CalculateCoefficientsOnFaces(const CompositeVector& cell_coef,
                                               const std::string cell_component,
@@ -63,87 +74,63 @@ UpwindTotalFlux::CalculateCoefficientsOnFaces(const CompositeVector& cell_coef,
                                               const std::string face_component,
                                               const Teuchos::Ptr<Debugger>& db) const
 {
-  Teuchos::RCP<const AmanziMesh::Mesh> mesh = face_coef.Mesh();
+  CalculateCoefficientsOnFaces(
+    { &cell_coef }, cell_component, flux, { &face_coef }, face_component, db);
+};
 
-  // initialize the face coefficients
-  if (face_coef.HasComponent("cell")) { face_coef.ViewComponent("cell", true)->PutScalar(1.0); }
 
-  // communicate needed ghost values
-  cell_coef.ScatterMasterToGhosted(cell_component);
+void
+UpwindTotalFlux::CalculateCoefficientsOnFaces(const std::vector<const CompositeVector*>& cell_coef,
+                                              const std::string cell_component,
+                                              const CompositeVector& flux,
+                                              const std::vector<CompositeVector*>& face_coef,
+                                              const std::string face_component,
+                                              const Teuchos::Ptr<Debugger>& db) const
+{
+  int ncoefs = cell_coef.size();
+  AMANZI_ASSERT(face_coef.size() == ncoefs && ncoefs > 0);
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh = face_coef[0]->Mesh();
 
-  // pull out vectors
+  // pull out vectors, communicating needed ghost values
   const Epetra_MultiVector& flux_v = *flux.ViewComponent("face", false);
-  Epetra_MultiVector& coef_faces = *face_coef.ViewComponent(face_component, false);
-  const Epetra_MultiVector& coef_cells = *cell_coef.ViewComponent(cell_component, true);
-
-  // Identify upwind/downwind cells for each local face.  Note upwind/downwind
-  // may be a ghost cell.
-  Epetra_IntVector upwind_cell(*face_coef.ComponentMap(face_component, true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(*face_coef.ComponentMap(face_component, true));
-  downwind_cell.PutValue(-1);
-
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
-  int nfaces_local = flux.size("face", false);
-
-  bool has_cells = face_coef.HasComponent("cell");
-  Teuchos::RCP<Epetra_MultiVector> face_cell_coef;
-  if (has_cells) face_cell_coef = face_coef.ViewComponent("cell", true);
-
-  int ncells = cell_coef.size(cell_component, true);
-  for (int c = 0; c != ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);
-
-    for (unsigned int n = 0; n != faces.size(); ++n) {
-      int f = faces[n];
-
-      if (has_cells) (*face_cell_coef)[0][c] = coef_cells[0][c];
-
-      if (f < nfaces_local) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
+  std::vector<Epetra_MultiVector*> coef_faces(ncoefs);
+  std::vector<const Epetra_MultiVector*> coef_cells(ncoefs);
+  for (int k = 0; k != ncoefs; ++k) {
+    cell_coef[k]->ScatterMasterToGhosted(cell_component);
+    coef_faces[k] = face_coef[k]->ViewComponent(face_component, false).get();
+    coef_cells[k] = cell_coef[k]->ViewComponent(cell_component, true).get();
+
+    // initialize the face coefficients
+    if (face_coef[k]->HasComponent("cell")) {
+      Epetra_MultiVector& face_cell_coef = *face_coef[k]->ViewComponent("cell", true);
+      int ncells = cell_coef[k]->size(cell_component, true);
+      for (int c = 0; c != ncells; ++c) face_cell_coef[0][c] = (*coef_cells[k])[0][c];
     }
   }
 
+  // Identify upwind/downwind cells for each local face, once for all
+  // coefficients.  Note upwind/downwind may be a ghost cell.
+  int nfaces_local = flux.size("face", false);
+  std::vector<int>& upwind_cell = upwind_cell_;
+  std::vector<int>& downwind_cell = downwind_cell_;
+  upwind_cell.resize(nfaces_local);
+  downwind_cell.resize(nfaces_local);
+  getUpwindTopology(mesh).IdentifyUpwindCells(
+    flux_v[0], nfaces_local, upwind_cell.data(), downwind_cell.data());
+
   // Determine the face coefficient of local faces.
   // These parameters may be key to a smooth convergence rate near zero flux.
   //  double flow_eps_factor = 1.;
   //  double min_flow_eps = 1.e-8;
   double coefs[2];
 
-  int nfaces = face_coef.size(face_component, false);
+  int nfaces = face_coef[0]->size(face_component, false);
+  AMANZI_ASSERT(nfaces <= nfaces_local);
   for (int f = 0; f != nfaces; ++f) {
     int uw = upwind_cell[f];
     int dw = downwind_cell[f];
     AMANZI_ASSERT(!((uw == -1) && (dw == -1)));
 
-    // uw coef
-    if (uw == -1) {
-      coefs[0] = coef_faces[0][f];
-    } else {
-      coefs[0] = coef_cells[0][uw];
-    }
-
-    // dw coef
-    if (dw == -1) {
-      coefs[1] = coef_faces[0][f];
-    } else {
-      coefs[1] = coef_cells[0][dw];
-    }
-
     // Determine the size of the overlap region, a smooth transition region
     // near zero flux
     // double flow_eps = std::max(( 1.0 - std::abs(coefs[0] - coefs[1]) )
@@ -151,28 +138,34 @@ UpwindTotalFlux::CalculateCoefficientsOnFaces(const CompositeVector& cell_coef,
     //         min_flow_eps);
     double flow_eps = flux_eps_;
 
-    // Determine the coefficient
-    if (std::abs(flux_v[0][f]) >= flow_eps) {
-      coef_faces[0][f] = coefs[0];
-    } else {
-      // Parameterization of a linear scaling between upwind and downwind.
-      double param = std::abs(flux_v[0][f]) / (2 * flow_eps) + 0.5;
+    // Parameterization of a linear scaling between upwind and downwind.
+    double param = 1.0;
+    if (std::abs(flux_v[0][f]) < flow_eps) {
+      param = std::abs(flux_v[0][f]) / (2 * flow_eps) + 0.5;
       if (!(param >= 0.5) || !(param <= 1.0)) {
         std::cout << "BAD FLUX! on face " << f << std::endl;
         std::cout << "  flux = " << flux_v[0][f] << std::endl;
         std::cout << "  param = " << param << std::endl;
         std::cout << "  flow_eps = " << flow_eps << std::endl;
       }
-
-      // if (dcvo_uw != Teuchos::null)
-      //   *dcvo_uw->os() << "  AVG param = " << param << std::endl;
-      // if (dcvo_dw != Teuchos::null)
-      //   *dcvo_dw->os() << "  AVG param = " << param << std::endl;
-
       AMANZI_ASSERT(param >= 0.5);
       AMANZI_ASSERT(param <= 1.0);
+    }
+
+    for (int k = 0; k != ncoefs; ++k) {
+      Epetra_MultiVector& coef_faces_k = *coef_faces[k];
+      const Epetra_MultiVector& coef_cells_k = *coef_cells[k];
 
-      coef_faces[0][f] = coefs[0] * param + coefs[1] * (1. - param);
+      // uw and dw coefs
+      coefs[0] = uw == -1 ? coef_faces_k[0][f] : coef_cells_k[0][uw];
+      coefs[1] = dw == -1 ? coef_faces_k[0][f] : coef_cells_k[0][dw];
+
+      // Determine the coefficient
+      if (param == 1.0 && std::abs(flux_v[0][f]) >= flow_eps) {
+        coef_faces_k[0][f] = coefs[0];
+      } else {
+        coef_faces_k[0][f] = coefs[0] * param + coefs[1] * (1. - param);
+      }
     }
   }
 };
@@ -213,48 +206,20 @@ UpwindTotalFlux::UpdateDerivatives(
 
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(mesh->face_map(true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(mesh->face_map(true));
-  downwind_cell.PutValue(-1);
-
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
-
-  int ncells = dcell_v.MyLength();
-  for (int c = 0; c != ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);
-
-    for (unsigned int n = 0; n != faces.size(); ++n) {
-      int f = faces[n];
-
-      if (f < nfaces_owned) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
-  }
-
+  const UpwindTopology& topology = getUpwindTopology(mesh);
+  std::vector<int>& upwind_cell = upwind_cell_;
+  std::vector<int>& downwind_cell = downwind_cell_;
+  upwind_cell.resize(nfaces_owned);
+  downwind_cell.resize(nfaces_owned);
+  topology.IdentifyUpwindCells(flux_v[0], nfaces_owned, upwind_cell.data(), downwind_cell.data());
 
   for (unsigned int f = 0; f != nfaces_owned; ++f) {
     int uw = upwind_cell[f];
     int dw = downwind_cell[f];
     AMANZI_ASSERT(!((uw == -1) && (dw == -1)));
 
-    AmanziMesh::Entity_ID_List cells;
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int mcells = cells.size();
+    const int* cells = &topology.face_cells[2 * f];
+    int mcells = topology.ncells(f);
 
     // uw coef
     if (uw == -1) {
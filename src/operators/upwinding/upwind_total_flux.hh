@@ -45,6 +45,11 @@ class UpwindTotalFlux : public Upwinding {
                       const State& S,
                       const Teuchos::Ptr<Debugger>& db = Teuchos::null) const override;
 
+  virtual void UpdateBatched(const std::vector<const CompositeVector*>& cells,
+                             const std::vector<CompositeVector*>& faces,
+                             const State& S,
+                             const Teuchos::Ptr<Debugger>& db = Teuchos::null) const override;
+
   void CalculateCoefficientsOnFaces(const CompositeVector& cell_coef,
                                     const std::string cell_component,
                                     const CompositeVector& flux,
@@ -52,6 +57,15 @@ class UpwindTotalFlux : public Upwinding {
                                     const std::string face_component,
                                     const Teuchos::Ptr<Debugger>& db) const;
 
+  // Fused version: one face pass for all coefficients, which share the flux
+  // and therefore the upwind direction and blending parameter.
+  void CalculateCoefficientsOnFaces(const std::vector<const CompositeVector*>& cell_coef,
+                                    const std::string cell_component,
+                                    const CompositeVector& flux,
+                                    const std::vector<CompositeVector*>& face_coef,
+                                    const std::string face_component,
+                                    const Teuchos::Ptr<Debugger>& db) const;
+
   virtual void UpdateDerivatives(
     const Teuchos::Ptr<State>& S,
     std::string potential_key,
@@ -67,6 +81,9 @@ class UpwindTotalFlux : public Upwinding {
   Tag tag_;
   std::string flux_;
   double flux_eps_;
+
+  // workspace, reused across calls
+  mutable std::vector<int> upwind_cell_, downwind_cell_;
 };
 
 } // namespace Operators
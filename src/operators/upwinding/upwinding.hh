@@ -17,6 +17,8 @@
 #ifndef AMANZI_UPWINDING_SCHEME_
 #define AMANZI_UPWINDING_SCHEME_
 
+#include <vector>
+
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_SerialDenseMatrix.hpp"
 
@@ -61,6 +63,18 @@ class Upwinding {
     AMANZI_ASSERT(0);
   }
 
+  // Upwind several cell coefficients onto faces in one pass.  Schemes whose
+  // upwind decision does not depend on the coefficient may override this to
+  // share the ghost scatter and the upwind identification across all of them.
+  virtual void UpdateBatched(const std::vector<const CompositeVector*>& cells,
+                             const std::vector<CompositeVector*>& faces,
+                             const State& S,
+                             const Teuchos::Ptr<Debugger>& db = Teuchos::null) const
+  {
+    AMANZI_ASSERT(cells.size() == faces.size());
+    for (int k = 0; k != cells.size(); ++k) Update(*cells[k], *faces[k], S, db);
+  }
+
   virtual void UpdateDerivatives(
     const Teuchos::Ptr<State>& S,
     std::string potential_key,
@@ -21,6 +21,7 @@
 
 #include "MeshPartition.hh"
 #include "pk_helpers.hh"
+#include "thread_pool.hh"
 #include "bgc_simple_funcs.hh"
 
 #include "bgc_simple.hh"
@@ -62,6 +63,17 @@ BGCSimple::BGCSimple(Teuchos::ParameterList& pk_tree,
   wind_speed_ref_ht_ = plist_->get<double>("wind speed reference height [m]", 2.0);
   cryoturbation_coef_ = plist_->get<double>("cryoturbation mixing coefficient [cm^2/yr]", 5.0);
   cryoturbation_coef_ /= 365.25e4; // convert to m^2/day
+
+  n_threads_ = plist_->get<int>("column threads", 1);
+  if (n_threads_ < 1) {
+    Errors::Message msg;
+    msg << "BGCSimple: \"column threads\" must be a positive integer.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // column geometry must be recomputed if the mesh deforms
+  if (S_->IsDeformableMesh(domain_))
+    deform_key_ = Keys::readKey(*plist_, domain_, "deformation indicator", "base_porosity");
 }
 
 // is a PK
@@ -242,6 +254,8 @@ BGCSimple::Setup()
   S_->Require<CompositeVector, CompositeVectorSpace>("surface-co2_concentration", tag_next_)
     .SetMesh(mesh_surf_)
     ->AddComponent("cell", AmanziMesh::CELL, 1);
+
+  if (!deform_key_.empty()) S_->RequireEvaluator(deform_key_, tag_next_);
 }
 
 // -- Initialize owned (dependent) variables.
@@ -298,21 +312,19 @@ BGCSimple::Initialize()
   }
 
   // init root carbon
+  InitializeColumnGeometry_();
   auto col_temp = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto col_depth = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto col_dz = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
 
-  S_->GetEvaluator("temperature", tag_next_).Update(*S_, name_);
+  updateEvaluator("temperature", tag_next_, *S_, name_);
   const Epetra_Vector& temp =
     *(*S_->Get<CompositeVector>("temperature", tag_next_).ViewComponent("cell", false))(0);
 
   int num_cols_ = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
   for (int col = 0; col != num_cols_; ++col) {
     FieldToColumn_(col, temp, col_temp.ptr());
-    ColDepthDz_(col, col_depth.ptr(), col_dz.ptr());
 
     for (int i = 0; i != num_pfts_; ++i) {
-      pfts_old_[col][i]->InitRoots(*col_temp, *col_depth, *col_dz);
+      pfts_old_[col][i]->InitRoots(*col_temp, col_depth_[col], col_dz_[col]);
     }
   }
 
@@ -385,32 +397,32 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
     *S_->GetW<CompositeVector>("surface-veg_total_transpiration", tag_next_, name_)
        .ViewComponent("cell", false);
 
-  S_->GetEvaluator("temperature", tag_next_).Update(*S_, name_);
+  updateEvaluator("temperature", tag_next_, *S_, name_);
   const Epetra_MultiVector& temp =
     *S_->Get<CompositeVector>("temperature", tag_next_).ViewComponent("cell", false);
 
-  S_->GetEvaluator("pressure", tag_next_).Update(*S_, name_);
+  updateEvaluator("pressure", tag_next_, *S_, name_);
   const Epetra_MultiVector& pres =
     *S_->Get<CompositeVector>("pressure", tag_next_).ViewComponent("cell", false);
 
-  S_->GetEvaluator("surface-incoming_shortwave_radiation", tag_next_).Update(*S_, name_);
+  updateEvaluator("surface-incoming_shortwave_radiation", tag_next_, *S_, name_);
   const Epetra_MultiVector& qSWin =
     *S_->Get<CompositeVector>("surface-incoming_shortwave_radiation", tag_next_)
        .ViewComponent("cell", false);
 
-  S_->GetEvaluator("surface-air_temperature", tag_next_).Update(*S_, name_);
+  updateEvaluator("surface-air_temperature", tag_next_, *S_, name_);
   const Epetra_MultiVector& air_temp =
     *S_->Get<CompositeVector>("surface-air_temperature", tag_next_).ViewComponent("cell", false);
 
-  S_->GetEvaluator("surface-vapor_pressure_air", tag_next_).Update(*S_, name_);
+  updateEvaluator("surface-vapor_pressure_air", tag_next_, *S_, name_);
   const Epetra_MultiVector& vp_air =
     *S_->Get<CompositeVector>("surface-vapor_pressure_air", tag_next_).ViewComponent("cell", false);
 
-  S_->GetEvaluator("surface-wind_speed", tag_next_).Update(*S_, name_);
+  updateEvaluator("surface-wind_speed", tag_next_, *S_, name_);
   const Epetra_MultiVector& wind_speed =
     *S_->Get<CompositeVector>("surface-wind_speed", tag_next_).ViewComponent("cell", false);
 
-  S_->GetEvaluator("surface-co2_concentration", tag_next_).Update(*S_, name_);
+  updateEvaluator("surface-co2_concentration", tag_next_, *S_, name_);
   const Epetra_MultiVector& co2 =
     *S_->Get<CompositeVector>("surface-co2_concentration", tag_next_).ViewComponent("cell", false);
 
@@ -418,97 +430,88 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
   // right.  Likely correct for soil carbon calculations and incorrect for
   // surface vegetation calculations (where the subsurface's face area is more
   // correct?)
-  S_->GetEvaluator("surface-cell_volume", tag_next_).Update(*S_, name_);
+  updateEvaluator("surface-cell_volume", tag_next_, *S_, name_);
   const Epetra_MultiVector& scv =
     *S_->Get<CompositeVector>("surface-cell_volume", tag_next_).ViewComponent("cell", false);
 
-  // Create workspace arrays (these should be removed when data is correctly oriented).
-  auto temp_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto pres_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto dz_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  auto depth_c = Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-
-  // Create a workspace array for the result
-  Epetra_SerialDenseVector co2_decomp_c(ncells_per_col_);
-  Epetra_SerialDenseVector trans_c(ncells_per_col_);
-  double sw_c(0.);
+  // column geometry is cached, and only recomputed if the mesh has deformed
+  if (col_depth_.empty() ||
+      (!deform_key_.empty() &&
+       updateEvaluator(deform_key_, tag_next_, *S_, name_ + " column geometry")))
+    InitializeColumnGeometry_();
 
   total_lai.PutScalar(0.);
+  double t_current = S_->get_time(tag_current_);
 
   // loop over columns and apply the model
-  for (AmanziMesh::Entity_ID col = 0; col != num_cols_; ++col) {
-    // update the various soil arrays
-    FieldToColumn_(col, *temp(0), temp_c.ptr());
-    FieldToColumn_(col, *pres(0), pres_c.ptr());
-    ColDepthDz_(col, depth_c.ptr(), dz_c.ptr());
-
-    // copy over the soil carbon arrays
-    auto& col_iter = mesh_->cells_of_column(col);
-    ncells_per_col_ = col_iter.size();
-
-    // -- serious cache thrash... --etc
-    for (std::size_t i = 0; i != col_iter.size(); ++i) {
-      AmanziGeometry::Point centroid = mesh_->cell_centroid(col_iter[i]);
-      //      std::cout << "Col iter col=" << col << ", index i=" << i << ", cell=" << col_iter[i] << " at " << centroid << std::endl;
-      for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
-        soil_carbon_pools_[col][i]->SOM[p] = sc_pools[p][col_iter[i]];
-      }
-    }
-
-    // Create the Met data struct
-    MetData met;
-    met.qSWin = qSWin[0][col];
-    met.tair = air_temp[0][col];
-    met.windv = wind_speed[0][col];
-    met.wind_ref_ht = wind_speed_ref_ht_;
-    met.vp_air = vp_air[0][col];
-    met.CO2a = co2[0][col];
-    met.lat = lat_;
-    sw_c = met.qSWin;
-
-    // call the model
-    BGCAdvance(S_->get_time(tag_current_),
-               dt,
-               scv[0][col],
-               cryoturbation_coef_,
-               met,
-               *temp_c,
-               *pres_c,
-               *depth_c,
-               *dz_c,
-               pfts_[col],
-               soil_carbon_pools_[col],
-               co2_decomp_c,
-               trans_c,
-               sw_c);
-
-    // copy back
-    // -- serious cache thrash... --etc
-    for (std::size_t i = 0; i != col_iter.size(); ++i) {
-      for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
-        sc_pools[p][col_iter[i]] = soil_carbon_pools_[col][i]->SOM[p];
+  Utils::forEachBlock(n_threads_, num_cols_, [&](int thread, int col_begin, int col_end) {
+    ColumnWorkspace& ws = workspaces_[thread];
+
+    for (AmanziMesh::Entity_ID col = col_begin; col != col_end; ++col) {
+      // update the various soil arrays
+      FieldToColumn_(col, *temp(0), ws.temp.A(), ncells_per_col_);
+      FieldToColumn_(col, *pres(0), ws.pres.A(), ncells_per_col_);
+
+      // copy over the soil carbon arrays
+      auto& col_iter = mesh_->cells_of_column(col);
+      for (std::size_t i = 0; i != col_iter.size(); ++i) {
+        for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
+          soil_carbon_pools_[col][i]->SOM[p] = sc_pools[p][col_iter[i]];
+        }
       }
 
-      // and integrate the decomp
-      co2_decomp[0][col_iter[i]] += co2_decomp_c[i];
+      // Create the Met data struct
+      MetData met;
+      met.qSWin = qSWin[0][col];
+      met.tair = air_temp[0][col];
+      met.windv = wind_speed[0][col];
+      met.wind_ref_ht = wind_speed_ref_ht_;
+      met.vp_air = vp_air[0][col];
+      met.CO2a = co2[0][col];
+      met.lat = lat_;
+      double sw_c = met.qSWin;
+
+      // call the model
+      BGCAdvance(t_current,
+                 dt,
+                 scv[0][col],
+                 cryoturbation_coef_,
+                 met,
+                 ws.temp,
+                 ws.pres,
+                 col_depth_[col],
+                 col_dz_[col],
+                 pfts_[col],
+                 soil_carbon_pools_[col],
+                 ws.co2_decomp,
+                 ws.trans,
+                 sw_c);
+
+      // copy back
+      for (std::size_t i = 0; i != col_iter.size(); ++i) {
+        for (int p = 0; p != soil_carbon_pools_[col][i]->nPools; ++p) {
+          sc_pools[p][col_iter[i]] = soil_carbon_pools_[col][i]->SOM[p];
+        }
 
+        // and integrate the decomp
+        co2_decomp[0][col_iter[i]] += ws.co2_decomp[i];
 
-      // and pull in the transpiration, converting to mol/m^3/s, as a sink
-      trans[0][col_iter[i]] = trans_c[i] / .01801528;
+        // and pull in the transpiration, converting to mol/m^3/s, as a sink
+        trans[0][col_iter[i]] = ws.trans[i] / .01801528;
+      }
       sw[0][col] = sw_c;
-    }
 
-    for (int lcv_pft = 0; lcv_pft != pfts_[col].size(); ++lcv_pft) {
-      biomass[lcv_pft][col] = pfts_[col][lcv_pft]->totalBiomass;
-      leafbiomass[lcv_pft][col] = pfts_[col][lcv_pft]->Bleaf;
-      csink[lcv_pft][col] = pfts_[col][lcv_pft]->CSinkLimit;
-      lai[lcv_pft][col] = pfts_[col][lcv_pft]->lai;
+      for (int lcv_pft = 0; lcv_pft != pfts_[col].size(); ++lcv_pft) {
+        biomass[lcv_pft][col] = pfts_[col][lcv_pft]->totalBiomass;
+        leafbiomass[lcv_pft][col] = pfts_[col][lcv_pft]->Bleaf;
+        csink[lcv_pft][col] = pfts_[col][lcv_pft]->CSinkLimit;
+        lai[lcv_pft][col] = pfts_[col][lcv_pft]->lai;
 
-      total_transpiration[lcv_pft][col] = pfts_[col][lcv_pft]->ET / 0.01801528;
-      total_lai[0][col] += pfts_[col][lcv_pft]->lai;
+        total_transpiration[lcv_pft][col] = pfts_[col][lcv_pft]->ET / 0.01801528;
+        total_lai[0][col] += pfts_[col][lcv_pft]->lai;
+      }
     }
-
-  } // end loop over columns
+  }); // end loop over columns
 
   // mark primaries as changed
   changedEvaluatorPrimary(trans_key_, tag_next_, *S_);
@@ -518,6 +521,33 @@ BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit)
 }
 
 
+// Compute and store depth and dz of each column, and size the per-thread
+// workspaces.
+void
+BGCSimple::InitializeColumnGeometry_()
+{
+  if (!deform_key_.empty())
+    updateEvaluator(deform_key_, tag_next_, *S_, name_ + " column geometry");
+
+  int num_cols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  col_depth_.resize(num_cols);
+  col_dz_.resize(num_cols);
+  for (int col = 0; col != num_cols; ++col) {
+    col_depth_[col].Size(ncells_per_col_);
+    col_dz_[col].Size(ncells_per_col_);
+    ColDepthDz_(col, Teuchos::ptr(&col_depth_[col]), Teuchos::ptr(&col_dz_[col]));
+  }
+
+  workspaces_.resize(n_threads_);
+  for (auto& ws : workspaces_) {
+    ws.temp.Size(ncells_per_col_);
+    ws.pres.Size(ncells_per_col_);
+    ws.co2_decomp.Size(ncells_per_col_);
+    ws.trans.Size(ncells_per_col_);
+  }
+}
+
+
 // helper function for pushing field to column
 void
 BGCSimple::FieldToColumn_(AmanziMesh::Entity_ID col,
@@ -52,6 +52,11 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"leaf biomass initial condition`" ``[initial-conditions-spec]`` Sets the leaf biomass IC.
 
+  * `"column threads`" ``[int]`` **1** Number of threads used to advance the
+    columns on each rank.  Columns are independent, so they are split into
+    contiguous blocks, one per thread, each with its own workspace.  Threads
+    are taken from the process-wide pool shared by all threaded kernels.
+
   * `"domain name`" ``[string]`` **domain**
 
   * `"surface domain name`" ``[string]`` **surface**
@@ -137,6 +142,10 @@ class BGCSimple : public PK_Physical_Default {
                    Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                    Teuchos::Ptr<Epetra_SerialDenseVector> dz);
 
+  // depth and dz of every column, computed once and again only if the mesh
+  // deforms
+  void InitializeColumnGeometry_();
+
  protected:
   double dt_;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_surf_;
@@ -158,6 +167,17 @@ class BGCSimple : public PK_Physical_Default {
   int ncells_per_col_;
   std::string soil_part_name_;
 
+  // column geometry cache
+  std::vector<Epetra_SerialDenseVector> col_depth_, col_dz_;
+  Key deform_key_;
+
+  // per-thread workspace, reused across steps
+  struct ColumnWorkspace {
+    Epetra_SerialDenseVector temp, pres, co2_decomp, trans;
+  };
+  std::vector<ColumnWorkspace> workspaces_;
+  int n_threads_;
+
   // keys
   Key trans_key_;
   Key shaded_sw_key_;
@@ -0,0 +1,17 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <UnitTest++.h>
+#include <TestReporterStdout.h>
+
+int
+main(int argc, char* argv[])
+{
+  return UnitTest::RunAllTests();
+}
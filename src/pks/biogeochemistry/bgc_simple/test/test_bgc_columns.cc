@@ -0,0 +1,143 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Epetra_SerialDenseVector.h"
+#include "Teuchos_RCP.hpp"
+
+#include "bgc_simple_funcs.hh"
+#include "thread_pool.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::BGC;
+
+namespace {
+
+// Synthetic columns with the inputs and state BGCSimple keeps per column.
+struct Columns {
+  Columns(int ncols, int ncells) : ncols(ncols), ncells(ncells)
+  {
+    auto params = Teuchos::rcp(new SoilCarbonParameters(7, 40.));
+    for (int col = 0; col != ncols; ++col) {
+      temp.emplace_back(ncells);
+      pres.emplace_back(ncells);
+      depth.emplace_back(ncells);
+      dz.emplace_back(ncells);
+      for (int i = 0; i != ncells; ++i) {
+        dz[col][i] = 0.05 + 0.01 * i;
+        depth[col][i] = 0.5 * dz[col][i];
+        if (i > 0) depth[col][i] += depth[col][i - 1] + 0.5 * dz[col][i - 1];
+        temp[col][i] = 276. + 4. * std::sin(0.3 * col) - 0.5 * i;
+        pres[col][i] = 101325. - 2000. * std::cos(0.2 * col + 0.1 * i);
+      }
+
+      auto pft = Teuchos::rcp(new PFT("sedge", ncells));
+      pft->Init(1.0);
+      pft->Bleaf = 0.1 + 0.01 * col;
+      pft->Broot = pft->Bleaf;
+      pft->Bstem = 0.2 * pft->Bleaf;
+      pft->Bstore = 0.5 * pft->Bleaf;
+      pft->lai = pft->Bleaf * pft->SLA;
+      pft->InitRoots(temp[col], depth[col], dz[col]);
+      pfts.emplace_back(1, pft);
+
+      soil_carbon.emplace_back();
+      for (int i = 0; i != ncells; ++i) {
+        auto sc = Teuchos::rcp(new SoilCarbon(params));
+        for (int p = 0; p != sc->nPools; ++p) sc->SOM[p] = 1. + 0.1 * p + 0.01 * i;
+        soil_carbon[col].push_back(sc);
+      }
+    }
+    co2.resize(ncols * ncells, 0.);
+    trans.resize(ncols * ncells, 0.);
+    sw.resize(ncols, 0.);
+  }
+
+  // advances the columns in [col_begin, col_end) with the given workspace,
+  // as BGCSimple::AdvanceStep does
+  void advance(double t,
+               double dt,
+               int col_begin,
+               int col_end,
+               Epetra_SerialDenseVector& ws_co2,
+               Epetra_SerialDenseVector& ws_trans)
+  {
+    for (int col = col_begin; col != col_end; ++col) {
+      MetData met;
+      met.qSWin = 200. + 10. * col;
+      met.tair = 283.;
+      met.windv = 2.;
+      met.wind_ref_ht = 2.;
+      met.vp_air = 800.;
+      met.CO2a = 400.;
+      met.lat = 68.;
+      double sw_c = met.qSWin;
+
+      BGCAdvance(t, dt, 1.0, 5.0 / 365.25e4, met, temp[col], pres[col], depth[col], dz[col],
+                 pfts[col], soil_carbon[col], ws_co2, ws_trans, sw_c);
+
+      for (int i = 0; i != ncells; ++i) {
+        co2[col * ncells + i] += ws_co2[i];
+        trans[col * ncells + i] = ws_trans[i];
+      }
+      sw[col] = sw_c;
+    }
+  }
+
+  int ncols, ncells;
+  std::vector<Epetra_SerialDenseVector> temp, pres, depth, dz;
+  std::vector<std::vector<Teuchos::RCP<PFT>>> pfts;
+  std::vector<std::vector<Teuchos::RCP<SoilCarbon>>> soil_carbon;
+  std::vector<double> co2, trans, sw;
+};
+
+} // namespace
+
+
+// columns advanced in blocks on the thread pool, each block with its own
+// workspace, match columns advanced one after another bit for bit
+TEST(BGC_COLUMNS_THREADED_MATCHES_SERIAL)
+{
+  int ncols = 23;
+  int ncells = 10;
+  int n_threads = 4;
+
+  Columns serial(ncols, ncells);
+  Columns threaded(ncols, ncells);
+
+  Epetra_SerialDenseVector ws_co2(ncells), ws_trans(ncells);
+  std::vector<Epetra_SerialDenseVector> ws_co2_t(n_threads, ws_co2);
+  std::vector<Epetra_SerialDenseVector> ws_trans_t(n_threads, ws_trans);
+
+  for (int step = 0; step != 5; ++step) {
+    double t = 180. + step;
+    serial.advance(t, 1., 0, ncols, ws_co2, ws_trans);
+    Utils::forEachBlock(n_threads, ncols, [&](int thread, int col_begin, int col_end) {
+      threaded.advance(t, 1., col_begin, col_end, ws_co2_t[thread], ws_trans_t[thread]);
+    });
+  }
+
+  for (int k = 0; k != ncols * ncells; ++k) {
+    CHECK_EQUAL(serial.co2[k], threaded.co2[k]);
+    CHECK_EQUAL(serial.trans[k], threaded.trans[k]);
+  }
+  for (int col = 0; col != ncols; ++col) {
+    CHECK_EQUAL(serial.sw[col], threaded.sw[col]);
+    CHECK_EQUAL(serial.pfts[col][0]->totalBiomass, threaded.pfts[col][0]->totalBiomass);
+    CHECK_EQUAL(serial.pfts[col][0]->lai, threaded.pfts[col][0]->lai);
+    for (int i = 0; i != ncells; ++i) {
+      for (int p = 0; p != serial.soil_carbon[col][i]->nPools; ++p) {
+        CHECK_EQUAL(serial.soil_carbon[col][i]->SOM[p], threaded.soil_carbon[col][i]->SOM[p]);
+      }
+    }
+  }
+}
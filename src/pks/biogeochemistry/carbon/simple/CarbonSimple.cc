@@ -7,6 +7,7 @@
   Authors: Ethan Coon
 */
 
+#include "pk_helpers.hh"
 #include "CarbonSimple.hh"
 
 namespace Amanzi {
@@ -114,7 +115,7 @@ CarbonSimple::FunctionalTimeDerivative(const double t, const TreeVector& u, Tree
   AddDecomposition_(dudt.ptr());
 
   // scale all by cell volume
-  S_->GetEvaluator(cell_vol_key_, tag_current_).Update(*S_, name_);
+  updateEvaluator(cell_vol_key_, tag_current_, *S_, name_);
   const Epetra_MultiVector& cv =
     *S_->Get<CompositeVector>(cell_vol_key_, tag_current_).ViewComponent("cell", false);
   Epetra_MultiVector& dudt_c = *dudt->ViewComponent("cell", false);
@@ -138,7 +139,7 @@ void
 CarbonSimple::ApplyDiffusion_(const Teuchos::Ptr<CompositeVector>& g)
 {
   if (is_diffusion_) {
-    S_->GetEvaluator(div_diff_flux_key_, tag_current_).Update(*S_, name_);
+    updateEvaluator(div_diff_flux_key_, tag_current_, *S_, name_);
     auto diff = S_->GetPtr<CompositeVector>(div_diff_flux_key_, tag_current_);
     g->Update(1., *diff, 0.);
     db_->WriteVector(" turbation rate", diff.ptr(), true);
@@ -152,7 +153,7 @@ void
 CarbonSimple::AddSources_(const Teuchos::Ptr<CompositeVector>& g)
 {
   if (is_source_) {
-    S_->GetEvaluator(source_key_, tag_current_).Update(*S_, name_);
+    updateEvaluator(source_key_, tag_current_, *S_, name_);
     auto src = S_->GetPtr<CompositeVector>(source_key_, tag_current_);
     g->Update(1., *src, 1.);
     db_->WriteVector(" source", src.ptr(), true);
@@ -164,7 +165,7 @@ void
 CarbonSimple::AddDecomposition_(const Teuchos::Ptr<CompositeVector>& g)
 {
   if (is_decomp_) {
-    S_->GetEvaluator(decomp_key_, tag_current_).Update(*S_, name_);
+    updateEvaluator(decomp_key_, tag_current_, *S_, name_);
     auto src = S_->GetPtr<CompositeVector>(decomp_key_, tag_current_);
     g->Update(1., *src, 1.);
     db_->WriteVector(" decomp", src.ptr(), true);
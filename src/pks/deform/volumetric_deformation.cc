@@ -341,15 +341,15 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
 
   case (DEFORM_MODE_SATURATION): {
     if (S_->HasEvaluator(cv_key_, tag_current_))
-      S_->GetEvaluator(cv_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(cv_key_, tag_current_, *S_, name_);
     if (S_->HasEvaluator(sat_liq_key_, tag_current_))
-      S_->GetEvaluator(sat_liq_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(sat_liq_key_, tag_current_, *S_, name_);
     if (S_->HasEvaluator(sat_gas_key_, tag_current_))
-      S_->GetEvaluator(sat_gas_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(sat_gas_key_, tag_current_, *S_, name_);
     if (S_->HasEvaluator(sat_ice_key_, tag_current_))
-      S_->GetEvaluator(sat_ice_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(sat_ice_key_, tag_current_, *S_, name_);
     if (S_->HasEvaluator(poro_key_, tag_current_))
-      S_->GetEvaluator(poro_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(poro_key_, tag_current_, *S_, name_);
 
     const Epetra_MultiVector& cv =
       *S_->Get<CompositeVector>(cv_key_, tag_current_).ViewComponent("cell", true);
@@ -396,15 +396,15 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
 
   case (DEFORM_MODE_STRUCTURAL): {
     if (S_->HasEvaluator(cv_key_, tag_current_))
-      S_->GetEvaluator(cv_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(cv_key_, tag_current_, *S_, name_);
     if (S_->HasEvaluator(sat_liq_key_, tag_current_))
-      S_->GetEvaluator(sat_liq_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(sat_liq_key_, tag_current_, *S_, name_);
     if (S_->HasEvaluator(sat_gas_key_, tag_current_))
-      S_->GetEvaluator(sat_gas_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(sat_gas_key_, tag_current_, *S_, name_);
     if (S_->HasEvaluator(sat_ice_key_, tag_current_))
-      S_->GetEvaluator(sat_ice_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(sat_ice_key_, tag_current_, *S_, name_);
     if (S_->HasEvaluator(poro_key_, tag_current_))
-      S_->GetEvaluator(poro_key_, tag_current_).Update(*S_, name_);
+      updateEvaluator(poro_key_, tag_current_, *S_, name_);
 
     const Epetra_MultiVector& cv =
       *S_->Get<CompositeVector>(cv_key_, tag_current_).ViewComponent("cell", true);
@@ -588,20 +588,28 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
         }
       }
 
-      // deform the mesh
-      Entity_ID_List node_ids(nodal_dz.MyLength());
-      AmanziGeometry::Point_List new_positions(nodal_dz.MyLength());
+      // deform the mesh, moving only the nodes of subsiding columns
+      Entity_ID_List node_ids;
+      AmanziGeometry::Point_List new_positions;
       for (int n = 0; n != nodal_dz.MyLength(); ++n) {
-        node_ids[n] = n;
-        mesh_->node_get_coordinates(n, &new_positions[n]);
         AMANZI_ASSERT(nodal_dz[0][n] >= 0.);
-        new_positions[n][2] -= nodal_dz[0][n];
-      }
+        if (nodal_dz[0][n] == 0.) continue;
 
-      AmanziGeometry::Point_List final_positions;
-      for (auto& p : new_positions) { AMANZI_ASSERT(AmanziGeometry::norm(p) >= 0.); }
-      mesh_nc_->deform(node_ids, new_positions, true, &final_positions);
-      deformed_this_step_ = true;
+        AmanziGeometry::Point nc;
+        mesh_->node_get_coordinates(n, &nc);
+        nc[2] -= nodal_dz[0][n];
+        node_ids.push_back(n);
+        new_positions.push_back(nc);
+      }
+      if (vo_->os_OK(Teuchos::VERB_HIGH))
+        *vo_->os() << "Moving " << node_ids.size() << " of " << nodal_dz.MyLength() << " nodes."
+                   << std::endl;
+
+      if (node_ids.size() > 0) {
+        AmanziGeometry::Point_List final_positions;
+        mesh_nc_->deform(node_ids, new_positions, true, &final_positions);
+        deformed_this_step_ = true;
+      }
       // INSERT EXTRA CODE TO UNDEFORM THE MESH FOR MIN_VOLS!
       break;
     }
@@ -620,18 +628,22 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
       Entity_ID_List surface_nodeids;
       AmanziGeometry::Point_List surface_newpos;
 
+      int dim = mesh_->space_dimension();
+      AmanziGeometry::Point coord_domain(dim), coord_surf(dim);
       for (int i = 0; i != nsurfnodes; ++i) {
-        // get the coords of the node
+        // get the coords of the node, and move it only if its parent moved
         AmanziMesh::Entity_ID pnode = surf3d_mesh_nc_->entity_get_parent(AmanziMesh::NODE, i);
-        int dim = mesh_->space_dimension();
-        AmanziGeometry::Point coord_domain(dim);
         mesh_->node_get_coordinates(pnode, &coord_domain);
+        surf3d_mesh_nc_->node_get_coordinates(i, &coord_surf);
+        if (AmanziGeometry::norm(coord_domain - coord_surf) == 0.) continue;
 
         surface_nodeids.push_back(i);
         surface_newpos.push_back(coord_domain);
       }
-      AmanziGeometry::Point_List surface_finpos;
-      surf3d_mesh_nc_->deform(surface_nodeids, surface_newpos, false, &surface_finpos);
+      if (surface_nodeids.size() > 0) {
+        AmanziGeometry::Point_List surface_finpos;
+        surf3d_mesh_nc_->deform(surface_nodeids, surface_newpos, false, &surface_finpos);
+      }
     }
 
     // Note, this order is intentionally odd.  The deforming cell volume
@@ -644,7 +656,7 @@ VolumetricDeformation::AdvanceStep(double t_old, double t_new, bool reinit)
     ChangedSolutionPK(tag_next_);
 
     // update cell volumes
-    S_->GetEvaluator(cv_key_, tag_next_).Update(*S_, name_);
+    updateEvaluator(cv_key_, tag_next_, *S_, name_);
     const CompositeVector& cv_vec_new = S_->Get<CompositeVector>(cv_key_, tag_next_);
     // unclear why to scatter here, maybe to pre-scatter? --ETC
     cv_vec_new.ScatterMasterToGhosted("cell");
@@ -728,11 +740,12 @@ VolumetricDeformation::FailStep(double t_old, double t_new, const Tag& tag)
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Failing step." << std::endl;
 
+  // roll back only the nodes that moved
   if (deformed_this_step_) {
-    copyVectorToMeshCoordinates(S_->Get<CompositeVector>(vertex_loc_key_, tag), *mesh_nc_);
+    copyChangedVectorToMeshCoordinates(S_->Get<CompositeVector>(vertex_loc_key_, tag), *mesh_nc_);
     if (surf3d_mesh_ != Teuchos::null) {
-      copyVectorToMeshCoordinates(S_->Get<CompositeVector>(vertex_loc_surf3d_key_, tag),
-                                  *surf3d_mesh_nc_);
+      copyChangedVectorToMeshCoordinates(S_->Get<CompositeVector>(vertex_loc_surf3d_key_, tag),
+                                         *surf3d_mesh_nc_);
     }
   }
 }
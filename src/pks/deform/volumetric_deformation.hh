@@ -57,7 +57,9 @@ node coordinate changes.  Three options are available:
   horizontal are not zero, as it may result in the loss of volume in a fully
   frozen cell, blowing up the pressure and breaking the code.  This is great
   when it works, but it almost never works in real problems, except in
-  column-based models, where it is perfect.
+  column-based models, where it is perfect.  Only the nodes of columns that
+  subside are passed to the mesh, so the cost of moving nodes scales with the
+  subsiding region.
 
 - "mstk implementation" MSTK implements an iterated, local optimization method
   that, one-at-a-time, moves nodes to try and match the volumes.  This has
@@ -73,6 +75,9 @@ node coordinate changes.  Three options are available:
 NOTE: all deformation options are treated EXPLICITLY, and depend only upon
 values from the old time.
 
+On a failed step, only the nodes that moved are reset to their old
+positions, and a mesh with no moved nodes is left untouched.
+
 .. _volumetric-deformation-pk-spec:
 .. admonition:: volumetric-deformation-pk-spec
 
@@ -10,6 +10,7 @@
 #include "Epetra_Vector.h"
 #include "advection_diffusion.hh"
 #include "Op.hh"
+#include "pk_profiler.hh"
 #include "EpetraExt_RowMatrixOut.h"
 
 namespace Amanzi {
@@ -24,6 +25,7 @@ AdvectionDiffusion::FunctionalResidual(double t_old,
                                        Teuchos::RCP<TreeVector> u_new,
                                        Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // pointer-copy temperature into states and update any auxilary data
   Solution_to_State(*u_new, S_next_);
 
@@ -69,6 +71,7 @@ int
 AdvectionDiffusion::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                         Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
     *vo_->os() << "Precon application:" << std::endl;
     *vo_->os() << "  u: " << (*u->Data())("cell", 0);
@@ -76,7 +79,11 @@ AdvectionDiffusion::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
     *vo_->os() << std::endl;
   }
 
-  int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  }
 
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
     *vo_->os() << "  Pu: " << (*Pu->Data())("cell", 0);
@@ -92,6 +99,7 @@ AdvectionDiffusion::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
 void
 AdvectionDiffusion::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   AMANZI_ASSERT(std::abs(S_next_->time() - t) <= 1.e-4 * t);
   PK_PhysicalBDF_Default::Solution_to_State(*up, S_next_);
 
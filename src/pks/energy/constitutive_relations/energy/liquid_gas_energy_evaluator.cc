@@ -13,6 +13,8 @@ Energy for a two-phase, liquid+water vapor evaluator.
   Generated via evaluator_generator.
 */
 
+#include <algorithm>
+
 #include "liquid_gas_energy_evaluator.hh"
 #include "liquid_gas_energy_model.hh"
 
@@ -97,6 +99,7 @@ LiquidGasEnergyEvaluator::InitializeFromPlist_()
 void
 LiquidGasEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  derivs_valid_ = false;
   auto tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
@@ -125,19 +128,19 @@ LiquidGasEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
     int ncomp = result[0]->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->Energy(phi_v[0][i],
-                                      phi0_v[0][i],
-                                      sl_v[0][i],
-                                      nl_v[0][i],
-                                      ul_v[0][i],
-                                      sg_v[0][i],
-                                      ng_v[0][i],
-                                      ug_v[0][i],
-                                      rho_r_v[0][i],
-                                      ur_v[0][i],
-                                      cv_v[0][i]);
-    }
+    model_->Energy(ncomp,
+                   phi_v[0],
+                   phi0_v[0],
+                   sl_v[0],
+                   nl_v[0],
+                   ul_v[0],
+                   sg_v[0],
+                   ng_v[0],
+                   ug_v[0],
+                   rho_r_v[0],
+                   ur_v[0],
+                   cv_v[0],
+                   result_v[0]);
   }
 }
 
@@ -161,7 +164,8 @@ LiquidGasEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
   Teuchos::RCP<const CompositeVector> ur = S.GetPtr<CompositeVector>(ur_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
-  if (wrt_key == phi_key_) {
+  // the fused kernel finds all derivatives in one pass over the dependencies
+  if (!derivs_valid_) {
     for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
          ++comp) {
       const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
@@ -175,347 +179,71 @@ LiquidGasEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
       const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
       const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
       const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPorosity(phi_v[0][i],
-                                                  phi0_v[0][i],
-                                                  sl_v[0][i],
-                                                  nl_v[0][i],
-                                                  ul_v[0][i],
-                                                  sg_v[0][i],
-                                                  ng_v[0][i],
-                                                  ug_v[0][i],
-                                                  rho_r_v[0][i],
-                                                  ur_v[0][i],
-                                                  cv_v[0][i]);
-      }
+      auto& derivs = derivs_[*comp];
+      derivs.resize(11);
+      for (auto& deriv : derivs) deriv.resize(ncomp);
+      model_->EnergyAndDerivatives(ncomp,
+                                   phi_v[0],
+                                   phi0_v[0],
+                                   sl_v[0],
+                                   nl_v[0],
+                                   ul_v[0],
+                                   sg_v[0],
+                                   ng_v[0],
+                                   ug_v[0],
+                                   rho_r_v[0],
+                                   ur_v[0],
+                                   cv_v[0],
+                                   nullptr,
+                                   derivs[0].data(),
+                                   derivs[1].data(),
+                                   derivs[2].data(),
+                                   derivs[3].data(),
+                                   derivs[4].data(),
+                                   derivs[5].data(),
+                                   derivs[6].data(),
+                                   derivs[7].data(),
+                                   derivs[8].data(),
+                                   derivs[9].data(),
+                                   derivs[10].data());
     }
+    derivs_valid_ = true;
+  }
 
+  int wrt_index = -1;
+  if (wrt_key == phi_key_) {
+    wrt_index = 0;
   } else if (wrt_key == phi0_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDBasePorosity(phi_v[0][i],
-                                                      phi0_v[0][i],
-                                                      sl_v[0][i],
-                                                      nl_v[0][i],
-                                                      ul_v[0][i],
-                                                      sg_v[0][i],
-                                                      ng_v[0][i],
-                                                      ug_v[0][i],
-                                                      rho_r_v[0][i],
-                                                      ur_v[0][i],
-                                                      cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 1;
   } else if (wrt_key == sl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationLiquid(phi_v[0][i],
-                                                          phi0_v[0][i],
-                                                          sl_v[0][i],
-                                                          nl_v[0][i],
-                                                          ul_v[0][i],
-                                                          sg_v[0][i],
-                                                          ng_v[0][i],
-                                                          ug_v[0][i],
-                                                          rho_r_v[0][i],
-                                                          ur_v[0][i],
-                                                          cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 2;
   } else if (wrt_key == nl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(phi_v[0][i],
-                                                            phi0_v[0][i],
-                                                            sl_v[0][i],
-                                                            nl_v[0][i],
-                                                            ul_v[0][i],
-                                                            sg_v[0][i],
-                                                            ng_v[0][i],
-                                                            ug_v[0][i],
-                                                            rho_r_v[0][i],
-                                                            ur_v[0][i],
-                                                            cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 3;
   } else if (wrt_key == ul_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(phi_v[0][i],
-                                                              phi0_v[0][i],
-                                                              sl_v[0][i],
-                                                              nl_v[0][i],
-                                                              ul_v[0][i],
-                                                              sg_v[0][i],
-                                                              ng_v[0][i],
-                                                              ug_v[0][i],
-                                                              rho_r_v[0][i],
-                                                              ur_v[0][i],
-                                                              cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 4;
   } else if (wrt_key == sg_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationGas(phi_v[0][i],
-                                                       phi0_v[0][i],
-                                                       sl_v[0][i],
-                                                       nl_v[0][i],
-                                                       ul_v[0][i],
-                                                       sg_v[0][i],
-                                                       ng_v[0][i],
-                                                       ug_v[0][i],
-                                                       rho_r_v[0][i],
-                                                       ur_v[0][i],
-                                                       cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 5;
   } else if (wrt_key == ng_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityGas(phi_v[0][i],
-                                                         phi0_v[0][i],
-                                                         sl_v[0][i],
-                                                         nl_v[0][i],
-                                                         ul_v[0][i],
-                                                         sg_v[0][i],
-                                                         ng_v[0][i],
-                                                         ug_v[0][i],
-                                                         rho_r_v[0][i],
-                                                         ur_v[0][i],
-                                                         cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 6;
   } else if (wrt_key == ug_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyGas(phi_v[0][i],
-                                                           phi0_v[0][i],
-                                                           sl_v[0][i],
-                                                           nl_v[0][i],
-                                                           ul_v[0][i],
-                                                           sg_v[0][i],
-                                                           ng_v[0][i],
-                                                           ug_v[0][i],
-                                                           rho_r_v[0][i],
-                                                           ur_v[0][i],
-                                                           cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 7;
   } else if (wrt_key == rho_r_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDDensityRock(phi_v[0][i],
-                                                     phi0_v[0][i],
-                                                     sl_v[0][i],
-                                                     nl_v[0][i],
-                                                     ul_v[0][i],
-                                                     sg_v[0][i],
-                                                     ng_v[0][i],
-                                                     ug_v[0][i],
-                                                     rho_r_v[0][i],
-                                                     ur_v[0][i],
-                                                     cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 8;
   } else if (wrt_key == ur_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyRock(phi_v[0][i],
-                                                            phi0_v[0][i],
-                                                            sl_v[0][i],
-                                                            nl_v[0][i],
-                                                            ul_v[0][i],
-                                                            sg_v[0][i],
-                                                            ng_v[0][i],
-                                                            ug_v[0][i],
-                                                            rho_r_v[0][i],
-                                                            ur_v[0][i],
-                                                            cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 9;
   } else if (wrt_key == cv_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(phi_v[0][i],
-                                                    phi0_v[0][i],
-                                                    sl_v[0][i],
-                                                    nl_v[0][i],
-                                                    ul_v[0][i],
-                                                    sg_v[0][i],
-                                                    ng_v[0][i],
-                                                    ug_v[0][i],
-                                                    rho_r_v[0][i],
-                                                    ur_v[0][i],
-                                                    cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 10;
   } else {
     AMANZI_ASSERT(0);
   }
+
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    const std::vector<double>& deriv = derivs_.at(*comp)[wrt_index];
+    std::copy(deriv.begin(), deriv.end(), result_v[0]);
+  }
 }
 
 
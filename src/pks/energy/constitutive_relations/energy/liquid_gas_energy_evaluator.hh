@@ -45,6 +45,10 @@ the larger, compressible value when used with the energy in the water.
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -88,6 +92,11 @@ class LiquidGasEnergyEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<LiquidGasEnergyModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, LiquidGasEnergyEvaluator> reg_;
 };
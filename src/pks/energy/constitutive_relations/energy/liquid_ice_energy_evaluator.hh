@@ -47,6 +47,10 @@ Note that this ignores energy in the gas phase.
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -89,6 +93,11 @@ class LiquidIceEnergyEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<LiquidIceEnergyModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, LiquidIceEnergyEvaluator> reg_;
 };
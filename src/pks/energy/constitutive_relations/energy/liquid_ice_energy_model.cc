@@ -50,7 +50,7 @@ LiquidIceEnergyModel::Energy(double phi,
                              double ur,
                              double cv) const
 {
-  return cv * (phi * (ni * si * ui + nl * sl * ul) + rho_r * ur * (-phi0 + 1));
+  return cv * (phi * (ni * si * ui + nl * sl * ul) + rho_r * ur * (1 - phi0));
 }
 
 double
@@ -194,7 +194,7 @@ LiquidIceEnergyModel::DEnergyDDensityRock(double phi,
                                           double ur,
                                           double cv) const
 {
-  return cv * ur * (-phi0 + 1);
+  return cv * ur * (1 - phi0);
 }
 
 double
@@ -210,7 +210,7 @@ LiquidIceEnergyModel::DEnergyDInternalEnergyRock(double phi,
                                                  double ur,
                                                  double cv) const
 {
-  return cv * rho_r * (-phi0 + 1);
+  return cv * rho_r * (1 - phi0);
 }
 
 double
@@ -226,7 +226,409 @@ LiquidIceEnergyModel::DEnergyDCellVolume(double phi,
                                          double ur,
                                          double cv) const
 {
-  return phi * (ni * si * ui + nl * sl * ul) + rho_r * ur * (-phi0 + 1);
+  return phi * (ni * si * ui + nl * sl * ul) + rho_r * ur * (1 - phi0);
+}
+
+
+// batched methods
+void
+LiquidIceEnergyModel::Energy(int n,
+                             const double* phi,
+                             const double* phi0,
+                             const double* sl,
+                             const double* nl,
+                             const double* ul,
+                             const double* si,
+                             const double* ni,
+                             const double* ui,
+                             const double* rho_r,
+                             const double* ur,
+                             const double* cv,
+                             double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = Energy(phi[i],
+                       phi0[i],
+                       sl[i],
+                       nl[i],
+                       ul[i],
+                       si[i],
+                       ni[i],
+                       ui[i],
+                       rho_r[i],
+                       ur[i],
+                       cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDPorosity(int n,
+                                       const double* phi,
+                                       const double* phi0,
+                                       const double* sl,
+                                       const double* nl,
+                                       const double* ul,
+                                       const double* si,
+                                       const double* ni,
+                                       const double* ui,
+                                       const double* rho_r,
+                                       const double* ur,
+                                       const double* cv,
+                                       double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDPorosity(phi[i],
+                                 phi0[i],
+                                 sl[i],
+                                 nl[i],
+                                 ul[i],
+                                 si[i],
+                                 ni[i],
+                                 ui[i],
+                                 rho_r[i],
+                                 ur[i],
+                                 cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDBasePorosity(int n,
+                                           const double* phi,
+                                           const double* phi0,
+                                           const double* sl,
+                                           const double* nl,
+                                           const double* ul,
+                                           const double* si,
+                                           const double* ni,
+                                           const double* ui,
+                                           const double* rho_r,
+                                           const double* ur,
+                                           const double* cv,
+                                           double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDBasePorosity(phi[i],
+                                     phi0[i],
+                                     sl[i],
+                                     nl[i],
+                                     ul[i],
+                                     si[i],
+                                     ni[i],
+                                     ui[i],
+                                     rho_r[i],
+                                     ur[i],
+                                     cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDSaturationLiquid(int n,
+                                               const double* phi,
+                                               const double* phi0,
+                                               const double* sl,
+                                               const double* nl,
+                                               const double* ul,
+                                               const double* si,
+                                               const double* ni,
+                                               const double* ui,
+                                               const double* rho_r,
+                                               const double* ur,
+                                               const double* cv,
+                                               double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDSaturationLiquid(phi[i],
+                                         phi0[i],
+                                         sl[i],
+                                         nl[i],
+                                         ul[i],
+                                         si[i],
+                                         ni[i],
+                                         ui[i],
+                                         rho_r[i],
+                                         ur[i],
+                                         cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDMolarDensityLiquid(int n,
+                                                 const double* phi,
+                                                 const double* phi0,
+                                                 const double* sl,
+                                                 const double* nl,
+                                                 const double* ul,
+                                                 const double* si,
+                                                 const double* ni,
+                                                 const double* ui,
+                                                 const double* rho_r,
+                                                 const double* ur,
+                                                 const double* cv,
+                                                 double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDMolarDensityLiquid(phi[i],
+                                           phi0[i],
+                                           sl[i],
+                                           nl[i],
+                                           ul[i],
+                                           si[i],
+                                           ni[i],
+                                           ui[i],
+                                           rho_r[i],
+                                           ur[i],
+                                           cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDInternalEnergyLiquid(int n,
+                                                   const double* phi,
+                                                   const double* phi0,
+                                                   const double* sl,
+                                                   const double* nl,
+                                                   const double* ul,
+                                                   const double* si,
+                                                   const double* ni,
+                                                   const double* ui,
+                                                   const double* rho_r,
+                                                   const double* ur,
+                                                   const double* cv,
+                                                   double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyLiquid(phi[i],
+                                             phi0[i],
+                                             sl[i],
+                                             nl[i],
+                                             ul[i],
+                                             si[i],
+                                             ni[i],
+                                             ui[i],
+                                             rho_r[i],
+                                             ur[i],
+                                             cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDSaturationIce(int n,
+                                            const double* phi,
+                                            const double* phi0,
+                                            const double* sl,
+                                            const double* nl,
+                                            const double* ul,
+                                            const double* si,
+                                            const double* ni,
+                                            const double* ui,
+                                            const double* rho_r,
+                                            const double* ur,
+                                            const double* cv,
+                                            double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDSaturationIce(phi[i],
+                                      phi0[i],
+                                      sl[i],
+                                      nl[i],
+                                      ul[i],
+                                      si[i],
+                                      ni[i],
+                                      ui[i],
+                                      rho_r[i],
+                                      ur[i],
+                                      cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDMolarDensityIce(int n,
+                                              const double* phi,
+                                              const double* phi0,
+                                              const double* sl,
+                                              const double* nl,
+                                              const double* ul,
+                                              const double* si,
+                                              const double* ni,
+                                              const double* ui,
+                                              const double* rho_r,
+                                              const double* ur,
+                                              const double* cv,
+                                              double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDMolarDensityIce(phi[i],
+                                        phi0[i],
+                                        sl[i],
+                                        nl[i],
+                                        ul[i],
+                                        si[i],
+                                        ni[i],
+                                        ui[i],
+                                        rho_r[i],
+                                        ur[i],
+                                        cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDInternalEnergyIce(int n,
+                                                const double* phi,
+                                                const double* phi0,
+                                                const double* sl,
+                                                const double* nl,
+                                                const double* ul,
+                                                const double* si,
+                                                const double* ni,
+                                                const double* ui,
+                                                const double* rho_r,
+                                                const double* ur,
+                                                const double* cv,
+                                                double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyIce(phi[i],
+                                          phi0[i],
+                                          sl[i],
+                                          nl[i],
+                                          ul[i],
+                                          si[i],
+                                          ni[i],
+                                          ui[i],
+                                          rho_r[i],
+                                          ur[i],
+                                          cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDDensityRock(int n,
+                                          const double* phi,
+                                          const double* phi0,
+                                          const double* sl,
+                                          const double* nl,
+                                          const double* ul,
+                                          const double* si,
+                                          const double* ni,
+                                          const double* ui,
+                                          const double* rho_r,
+                                          const double* ur,
+                                          const double* cv,
+                                          double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDDensityRock(phi[i],
+                                    phi0[i],
+                                    sl[i],
+                                    nl[i],
+                                    ul[i],
+                                    si[i],
+                                    ni[i],
+                                    ui[i],
+                                    rho_r[i],
+                                    ur[i],
+                                    cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDInternalEnergyRock(int n,
+                                                 const double* phi,
+                                                 const double* phi0,
+                                                 const double* sl,
+                                                 const double* nl,
+                                                 const double* ul,
+                                                 const double* si,
+                                                 const double* ni,
+                                                 const double* ui,
+                                                 const double* rho_r,
+                                                 const double* ur,
+                                                 const double* cv,
+                                                 double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyRock(phi[i],
+                                           phi0[i],
+                                           sl[i],
+                                           nl[i],
+                                           ul[i],
+                                           si[i],
+                                           ni[i],
+                                           ui[i],
+                                           rho_r[i],
+                                           ur[i],
+                                           cv[i]);
+}
+
+void
+LiquidIceEnergyModel::DEnergyDCellVolume(int n,
+                                         const double* phi,
+                                         const double* phi0,
+                                         const double* sl,
+                                         const double* nl,
+                                         const double* ul,
+                                         const double* si,
+                                         const double* ni,
+                                         const double* ui,
+                                         const double* rho_r,
+                                         const double* ur,
+                                         const double* cv,
+                                         double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDCellVolume(phi[i],
+                                   phi0[i],
+                                   sl[i],
+                                   nl[i],
+                                   ul[i],
+                                   si[i],
+                                   ni[i],
+                                   ui[i],
+                                   rho_r[i],
+                                   ur[i],
+                                   cv[i]);
+}
+
+void
+LiquidIceEnergyModel::EnergyAndDerivatives(int n,
+                                           const double* phi,
+                                           const double* phi0,
+                                           const double* sl,
+                                           const double* nl,
+                                           const double* ul,
+                                           const double* si,
+                                           const double* ni,
+                                           const double* ui,
+                                           const double* rho_r,
+                                           const double* ur,
+                                           const double* cv,
+                                           double* result,
+                                           double* dresult_dphi,
+                                           double* dresult_dphi0,
+                                           double* dresult_dsl,
+                                           double* dresult_dnl,
+                                           double* dresult_dul,
+                                           double* dresult_dsi,
+                                           double* dresult_dni,
+                                           double* dresult_dui,
+                                           double* dresult_drho_r,
+                                           double* dresult_dur,
+                                           double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = 1 - phi0[i];
+    const double x1 = rho_r[i] * ur[i];
+    const double x2 = ni[i] * ui[i];
+    const double x3 = nl[i] * ul[i];
+    const double x4 = si[i] * x2 + sl[i] * x3;
+    const double x5 = phi[i] * x4 + x0 * x1;
+    const double x6 = cv[i] * phi[i];
+    const double x7 = sl[i] * x6;
+    const double x8 = si[i] * x6;
+    const double x9 = cv[i] * x0;
+    if (result) result[i] = cv[i] * x5;
+    if (dresult_dphi) dresult_dphi[i] = cv[i] * x4;
+    if (dresult_dphi0) dresult_dphi0[i] = -cv[i] * x1;
+    if (dresult_dsl) dresult_dsl[i] = x3 * x6;
+    if (dresult_dnl) dresult_dnl[i] = ul[i] * x7;
+    if (dresult_dul) dresult_dul[i] = nl[i] * x7;
+    if (dresult_dsi) dresult_dsi[i] = x2 * x6;
+    if (dresult_dni) dresult_dni[i] = ui[i] * x8;
+    if (dresult_dui) dresult_dui[i] = ni[i] * x8;
+    if (dresult_drho_r) dresult_drho_r[i] = ur[i] * x9;
+    if (dresult_dur) dresult_dur[i] = rho_r[i] * x9;
+    if (dresult_dcv) dresult_dcv[i] = x5;
+  }
 }
 
 } // namespace Relations
@@ -13,6 +13,8 @@ Richards energy: the standard form as a function of liquid saturation and specif
   Generated via evaluator_generator.
 */
 
+#include <algorithm>
+
 #include "richards_energy_evaluator.hh"
 #include "richards_energy_model.hh"
 
@@ -100,6 +102,7 @@ RichardsEnergyEvaluator::InitializeFromPlist_()
 void
 RichardsEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  derivs_valid_ = false;
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> phi0 = S.GetPtr<CompositeVector>(phi0_key_, tag);
@@ -122,16 +125,16 @@ RichardsEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVe
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
     int ncomp = result[0]->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->Energy(phi_v[0][i],
-                                      phi0_v[0][i],
-                                      sl_v[0][i],
-                                      nl_v[0][i],
-                                      ul_v[0][i],
-                                      rho_r_v[0][i],
-                                      ur_v[0][i],
-                                      cv_v[0][i]);
-    }
+    model_->Energy(ncomp,
+                   phi_v[0],
+                   phi0_v[0],
+                   sl_v[0],
+                   nl_v[0],
+                   ul_v[0],
+                   rho_r_v[0],
+                   ur_v[0],
+                   cv_v[0],
+                   result_v[0]);
   }
 }
 
@@ -152,7 +155,8 @@ RichardsEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
   Teuchos::RCP<const CompositeVector> ur = S.GetPtr<CompositeVector>(ur_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
-  if (wrt_key == phi_key_) {
+  // the fused kernel finds all derivatives in one pass over the dependencies
+  if (!derivs_valid_) {
     for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
          ++comp) {
       const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
@@ -163,206 +167,59 @@ RichardsEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
       const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
       const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
       const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPorosity(phi_v[0][i],
-                                                  phi0_v[0][i],
-                                                  sl_v[0][i],
-                                                  nl_v[0][i],
-                                                  ul_v[0][i],
-                                                  rho_r_v[0][i],
-                                                  ur_v[0][i],
-                                                  cv_v[0][i]);
-      }
+      auto& derivs = derivs_[*comp];
+      derivs.resize(8);
+      for (auto& deriv : derivs) deriv.resize(ncomp);
+      model_->EnergyAndDerivatives(ncomp,
+                                   phi_v[0],
+                                   phi0_v[0],
+                                   sl_v[0],
+                                   nl_v[0],
+                                   ul_v[0],
+                                   rho_r_v[0],
+                                   ur_v[0],
+                                   cv_v[0],
+                                   nullptr,
+                                   derivs[0].data(),
+                                   derivs[1].data(),
+                                   derivs[2].data(),
+                                   derivs[3].data(),
+                                   derivs[4].data(),
+                                   derivs[5].data(),
+                                   derivs[6].data(),
+                                   derivs[7].data());
     }
+    derivs_valid_ = true;
+  }
 
+  int wrt_index = -1;
+  if (wrt_key == phi_key_) {
+    wrt_index = 0;
   } else if (wrt_key == phi0_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDBasePorosity(phi_v[0][i],
-                                                      phi0_v[0][i],
-                                                      sl_v[0][i],
-                                                      nl_v[0][i],
-                                                      ul_v[0][i],
-                                                      rho_r_v[0][i],
-                                                      ur_v[0][i],
-                                                      cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 1;
   } else if (wrt_key == sl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationLiquid(phi_v[0][i],
-                                                          phi0_v[0][i],
-                                                          sl_v[0][i],
-                                                          nl_v[0][i],
-                                                          ul_v[0][i],
-                                                          rho_r_v[0][i],
-                                                          ur_v[0][i],
-                                                          cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 2;
   } else if (wrt_key == nl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(phi_v[0][i],
-                                                            phi0_v[0][i],
-                                                            sl_v[0][i],
-                                                            nl_v[0][i],
-                                                            ul_v[0][i],
-                                                            rho_r_v[0][i],
-                                                            ur_v[0][i],
-                                                            cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 3;
   } else if (wrt_key == ul_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(phi_v[0][i],
-                                                              phi0_v[0][i],
-                                                              sl_v[0][i],
-                                                              nl_v[0][i],
-                                                              ul_v[0][i],
-                                                              rho_r_v[0][i],
-                                                              ur_v[0][i],
-                                                              cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 4;
   } else if (wrt_key == rho_r_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDDensityRock(phi_v[0][i],
-                                                     phi0_v[0][i],
-                                                     sl_v[0][i],
-                                                     nl_v[0][i],
-                                                     ul_v[0][i],
-                                                     rho_r_v[0][i],
-                                                     ur_v[0][i],
-                                                     cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 5;
   } else if (wrt_key == ur_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyRock(phi_v[0][i],
-                                                            phi0_v[0][i],
-                                                            sl_v[0][i],
-                                                            nl_v[0][i],
-                                                            ul_v[0][i],
-                                                            rho_r_v[0][i],
-                                                            ur_v[0][i],
-                                                            cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 6;
   } else if (wrt_key == cv_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(phi_v[0][i],
-                                                    phi0_v[0][i],
-                                                    sl_v[0][i],
-                                                    nl_v[0][i],
-                                                    ul_v[0][i],
-                                                    rho_r_v[0][i],
-                                                    ur_v[0][i],
-                                                    cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 7;
   } else {
     AMANZI_ASSERT(0);
   }
+
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    const std::vector<double>& deriv = derivs_.at(*comp)[wrt_index];
+    std::copy(deriv.begin(), deriv.end(), result_v[0]);
+  }
 }
 
 } // namespace Relations
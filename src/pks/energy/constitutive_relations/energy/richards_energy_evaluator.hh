@@ -44,6 +44,10 @@ Note that this ignores energy in the gas phase.
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -83,6 +87,11 @@ class RichardsEnergyEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<RichardsEnergyModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, RichardsEnergyEvaluator> reg_;
 };
@@ -47,7 +47,7 @@ RichardsEnergyModel::Energy(double phi,
                             double ur,
                             double cv) const
 {
-  return cv * (nl * phi * sl * ul + rho_r * ur * (-phi0 + 1));
+  return cv * (nl * phi * sl * ul + rho_r * ur * (1 - phi0));
 }
 
 double
@@ -125,7 +125,7 @@ RichardsEnergyModel::DEnergyDDensityRock(double phi,
                                          double ur,
                                          double cv) const
 {
-  return cv * ur * (-phi0 + 1);
+  return cv * ur * (1 - phi0);
 }
 
 double
@@ -138,7 +138,7 @@ RichardsEnergyModel::DEnergyDInternalEnergyRock(double phi,
                                                 double ur,
                                                 double cv) const
 {
-  return cv * rho_r * (-phi0 + 1);
+  return cv * rho_r * (1 - phi0);
 }
 
 double
@@ -151,7 +151,220 @@ RichardsEnergyModel::DEnergyDCellVolume(double phi,
                                         double ur,
                                         double cv) const
 {
-  return nl * phi * sl * ul + rho_r * ur * (-phi0 + 1);
+  return nl * phi * sl * ul + rho_r * ur * (1 - phi0);
+}
+
+
+// batched methods
+void
+RichardsEnergyModel::Energy(int n,
+                            const double* phi,
+                            const double* phi0,
+                            const double* sl,
+                            const double* nl,
+                            const double* ul,
+                            const double* rho_r,
+                            const double* ur,
+                            const double* cv,
+                            double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = Energy(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+}
+
+void
+RichardsEnergyModel::DEnergyDPorosity(int n,
+                                      const double* phi,
+                                      const double* phi0,
+                                      const double* sl,
+                                      const double* nl,
+                                      const double* ul,
+                                      const double* rho_r,
+                                      const double* ur,
+                                      const double* cv,
+                                      double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDPorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+}
+
+void
+RichardsEnergyModel::DEnergyDBasePorosity(int n,
+                                          const double* phi,
+                                          const double* phi0,
+                                          const double* sl,
+                                          const double* nl,
+                                          const double* ul,
+                                          const double* rho_r,
+                                          const double* ur,
+                                          const double* cv,
+                                          double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDBasePorosity(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+}
+
+void
+RichardsEnergyModel::DEnergyDSaturationLiquid(int n,
+                                              const double* phi,
+                                              const double* phi0,
+                                              const double* sl,
+                                              const double* nl,
+                                              const double* ul,
+                                              const double* rho_r,
+                                              const double* ur,
+                                              const double* cv,
+                                              double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDSaturationLiquid(phi[i],
+                                         phi0[i],
+                                         sl[i],
+                                         nl[i],
+                                         ul[i],
+                                         rho_r[i],
+                                         ur[i],
+                                         cv[i]);
+}
+
+void
+RichardsEnergyModel::DEnergyDMolarDensityLiquid(int n,
+                                                const double* phi,
+                                                const double* phi0,
+                                                const double* sl,
+                                                const double* nl,
+                                                const double* ul,
+                                                const double* rho_r,
+                                                const double* ur,
+                                                const double* cv,
+                                                double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDMolarDensityLiquid(phi[i],
+                                           phi0[i],
+                                           sl[i],
+                                           nl[i],
+                                           ul[i],
+                                           rho_r[i],
+                                           ur[i],
+                                           cv[i]);
+}
+
+void
+RichardsEnergyModel::DEnergyDInternalEnergyLiquid(int n,
+                                                  const double* phi,
+                                                  const double* phi0,
+                                                  const double* sl,
+                                                  const double* nl,
+                                                  const double* ul,
+                                                  const double* rho_r,
+                                                  const double* ur,
+                                                  const double* cv,
+                                                  double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyLiquid(phi[i],
+                                             phi0[i],
+                                             sl[i],
+                                             nl[i],
+                                             ul[i],
+                                             rho_r[i],
+                                             ur[i],
+                                             cv[i]);
+}
+
+void
+RichardsEnergyModel::DEnergyDDensityRock(int n,
+                                         const double* phi,
+                                         const double* phi0,
+                                         const double* sl,
+                                         const double* nl,
+                                         const double* ul,
+                                         const double* rho_r,
+                                         const double* ur,
+                                         const double* cv,
+                                         double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDDensityRock(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+}
+
+void
+RichardsEnergyModel::DEnergyDInternalEnergyRock(int n,
+                                                const double* phi,
+                                                const double* phi0,
+                                                const double* sl,
+                                                const double* nl,
+                                                const double* ul,
+                                                const double* rho_r,
+                                                const double* ur,
+                                                const double* cv,
+                                                double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyRock(phi[i],
+                                           phi0[i],
+                                           sl[i],
+                                           nl[i],
+                                           ul[i],
+                                           rho_r[i],
+                                           ur[i],
+                                           cv[i]);
+}
+
+void
+RichardsEnergyModel::DEnergyDCellVolume(int n,
+                                        const double* phi,
+                                        const double* phi0,
+                                        const double* sl,
+                                        const double* nl,
+                                        const double* ul,
+                                        const double* rho_r,
+                                        const double* ur,
+                                        const double* cv,
+                                        double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDCellVolume(phi[i], phi0[i], sl[i], nl[i], ul[i], rho_r[i], ur[i], cv[i]);
+}
+
+void
+RichardsEnergyModel::EnergyAndDerivatives(int n,
+                                          const double* phi,
+                                          const double* phi0,
+                                          const double* sl,
+                                          const double* nl,
+                                          const double* ul,
+                                          const double* rho_r,
+                                          const double* ur,
+                                          const double* cv,
+                                          double* result,
+                                          double* dresult_dphi,
+                                          double* dresult_dphi0,
+                                          double* dresult_dsl,
+                                          double* dresult_dnl,
+                                          double* dresult_dul,
+                                          double* dresult_drho_r,
+                                          double* dresult_dur,
+                                          double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = nl[i] * sl[i] * ul[i];
+    const double x1 = 1 - phi0[i];
+    const double x2 = rho_r[i] * ur[i];
+    const double x3 = phi[i] * x0 + x1 * x2;
+    const double x4 = cv[i] * phi[i] * ul[i];
+    const double x5 = cv[i] * x1;
+    if (result) result[i] = cv[i] * x3;
+    if (dresult_dphi) dresult_dphi[i] = cv[i] * x0;
+    if (dresult_dphi0) dresult_dphi0[i] = -cv[i] * x2;
+    if (dresult_dsl) dresult_dsl[i] = nl[i] * x4;
+    if (dresult_dnl) dresult_dnl[i] = sl[i] * x4;
+    if (dresult_dul) dresult_dul[i] = cv[i] * nl[i] * phi[i] * sl[i];
+    if (dresult_drho_r) dresult_drho_r[i] = ur[i] * x5;
+    if (dresult_dur) dresult_dur[i] = rho_r[i] * x5;
+    if (dresult_dcv) dresult_dcv[i] = x3;
+  }
 }
 
 } // namespace Relations
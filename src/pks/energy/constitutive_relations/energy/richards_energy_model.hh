@@ -100,6 +100,118 @@ class RichardsEnergyModel {
                             double ur,
                             double cv) const;
 
+  void Energy(int n,
+              const double* phi,
+              const double* phi0,
+              const double* sl,
+              const double* nl,
+              const double* ul,
+              const double* rho_r,
+              const double* ur,
+              const double* cv,
+              double* result) const;
+  void DEnergyDPorosity(int n,
+                        const double* phi,
+                        const double* phi0,
+                        const double* sl,
+                        const double* nl,
+                        const double* ul,
+                        const double* rho_r,
+                        const double* ur,
+                        const double* cv,
+                        double* result) const;
+  void DEnergyDBasePorosity(int n,
+                            const double* phi,
+                            const double* phi0,
+                            const double* sl,
+                            const double* nl,
+                            const double* ul,
+                            const double* rho_r,
+                            const double* ur,
+                            const double* cv,
+                            double* result) const;
+  void DEnergyDSaturationLiquid(int n,
+                                const double* phi,
+                                const double* phi0,
+                                const double* sl,
+                                const double* nl,
+                                const double* ul,
+                                const double* rho_r,
+                                const double* ur,
+                                const double* cv,
+                                double* result) const;
+  void DEnergyDMolarDensityLiquid(int n,
+                                  const double* phi,
+                                  const double* phi0,
+                                  const double* sl,
+                                  const double* nl,
+                                  const double* ul,
+                                  const double* rho_r,
+                                  const double* ur,
+                                  const double* cv,
+                                  double* result) const;
+  void DEnergyDInternalEnergyLiquid(int n,
+                                    const double* phi,
+                                    const double* phi0,
+                                    const double* sl,
+                                    const double* nl,
+                                    const double* ul,
+                                    const double* rho_r,
+                                    const double* ur,
+                                    const double* cv,
+                                    double* result) const;
+  void DEnergyDDensityRock(int n,
+                           const double* phi,
+                           const double* phi0,
+                           const double* sl,
+                           const double* nl,
+                           const double* ul,
+                           const double* rho_r,
+                           const double* ur,
+                           const double* cv,
+                           double* result) const;
+  void DEnergyDInternalEnergyRock(int n,
+                                  const double* phi,
+                                  const double* phi0,
+                                  const double* sl,
+                                  const double* nl,
+                                  const double* ul,
+                                  const double* rho_r,
+                                  const double* ur,
+                                  const double* cv,
+                                  double* result) const;
+  void DEnergyDCellVolume(int n,
+                          const double* phi,
+                          const double* phi0,
+                          const double* sl,
+                          const double* nl,
+                          const double* ul,
+                          const double* rho_r,
+                          const double* ur,
+                          const double* cv,
+                          double* result) const;
+
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void EnergyAndDerivatives(int n,
+                            const double* phi,
+                            const double* phi0,
+                            const double* sl,
+                            const double* nl,
+                            const double* ul,
+                            const double* rho_r,
+                            const double* ur,
+                            const double* cv,
+                            double* result,
+                            double* dresult_dphi,
+                            double* dresult_dphi0,
+                            double* dresult_dsl,
+                            double* dresult_dnl,
+                            double* dresult_dul,
+                            double* dresult_drho_r,
+                            double* dresult_dur,
+                            double* dresult_dcv) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
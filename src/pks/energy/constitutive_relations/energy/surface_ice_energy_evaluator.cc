@@ -13,6 +13,8 @@ Energy evaulator for ice+liquid surface water.
   Generated via evaluator_generator.
 */
 
+#include <algorithm>
+
 #include "surface_ice_energy_evaluator.hh"
 #include "surface_ice_energy_model.hh"
 
@@ -80,6 +82,7 @@ SurfaceIceEnergyEvaluator::InitializeFromPlist_()
 void
 SurfaceIceEnergyEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  derivs_valid_ = false;
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> h = S.GetPtr<CompositeVector>(h_key_, tag);
   Teuchos::RCP<const CompositeVector> eta = S.GetPtr<CompositeVector>(eta_key_, tag);
@@ -100,10 +103,15 @@ SurfaceIceEnergyEvaluator::Evaluate_(const State& S, const std::vector<Composite
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
     int ncomp = result[0]->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->Energy(
-        h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-    }
+    model_->Energy(ncomp,
+                   h_v[0],
+                   eta_v[0],
+                   nl_v[0],
+                   ul_v[0],
+                   ni_v[0],
+                   ui_v[0],
+                   cv_v[0],
+                   result_v[0]);
   }
 }
 
@@ -123,7 +131,8 @@ SurfaceIceEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
   Teuchos::RCP<const CompositeVector> ui = S.GetPtr<CompositeVector>(ui_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
-  if (wrt_key == h_key_) {
+  // the fused kernel finds all derivatives in one pass over the dependencies
+  if (!derivs_valid_) {
     for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
          ++comp) {
       const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
@@ -133,132 +142,55 @@ SurfaceIceEnergyEvaluator::EvaluatePartialDerivative_(const State& S,
       const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
       const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
       const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPondedDepth(
-          h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
+      auto& derivs = derivs_[*comp];
+      derivs.resize(7);
+      for (auto& deriv : derivs) deriv.resize(ncomp);
+      model_->EnergyAndDerivatives(ncomp,
+                                   h_v[0],
+                                   eta_v[0],
+                                   nl_v[0],
+                                   ul_v[0],
+                                   ni_v[0],
+                                   ui_v[0],
+                                   cv_v[0],
+                                   nullptr,
+                                   derivs[0].data(),
+                                   derivs[1].data(),
+                                   derivs[2].data(),
+                                   derivs[3].data(),
+                                   derivs[4].data(),
+                                   derivs[5].data(),
+                                   derivs[6].data());
     }
+    derivs_valid_ = true;
+  }
 
+  int wrt_index = -1;
+  if (wrt_key == h_key_) {
+    wrt_index = 0;
   } else if (wrt_key == eta_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDUnfrozenFraction(
-          h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 1;
   } else if (wrt_key == nl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(
-          h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 2;
   } else if (wrt_key == ul_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(
-          h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 3;
   } else if (wrt_key == ni_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityIce(
-          h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 4;
   } else if (wrt_key == ui_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyIce(
-          h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 5;
   } else if (wrt_key == cv_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(
-          h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 6;
   } else {
     AMANZI_ASSERT(0);
   }
+
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    const std::vector<double>& deriv = derivs_.at(*comp)[wrt_index];
+    std::copy(deriv.begin(), deriv.end(), result_v[0]);
+  }
 }
 
 
@@ -34,6 +34,10 @@ Specified with evaluator type: `"surface ice energy`"
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -72,6 +76,11 @@ class SurfaceIceEnergyEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<SurfaceIceEnergyModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, SurfaceIceEnergyEvaluator> reg_;
 };
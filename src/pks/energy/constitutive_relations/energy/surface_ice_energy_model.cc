@@ -46,7 +46,7 @@ SurfaceIceEnergyModel::Energy(double h,
                               double ui,
                               double cv) const
 {
-  return cv * h * (eta * nl * ul + ni * ui * (-eta + 1));
+  return cv * h * (eta * nl * ul + ni * ui * (1 - eta));
 }
 
 double
@@ -58,7 +58,7 @@ SurfaceIceEnergyModel::DEnergyDPondedDepth(double h,
                                            double ui,
                                            double cv) const
 {
-  return cv * (eta * nl * ul + ni * ui * (-eta + 1));
+  return cv * (eta * nl * ul + ni * ui * (1 - eta));
 }
 
 double
@@ -106,7 +106,7 @@ SurfaceIceEnergyModel::DEnergyDMolarDensityIce(double h,
                                                double ui,
                                                double cv) const
 {
-  return cv * h * ui * (-eta + 1);
+  return cv * h * ui * (1 - eta);
 }
 
 double
@@ -118,7 +118,7 @@ SurfaceIceEnergyModel::DEnergyDInternalEnergyIce(double h,
                                                  double ui,
                                                  double cv) const
 {
-  return cv * h * ni * (-eta + 1);
+  return cv * h * ni * (1 - eta);
 }
 
 double
@@ -130,7 +130,165 @@ SurfaceIceEnergyModel::DEnergyDCellVolume(double h,
                                           double ui,
                                           double cv) const
 {
-  return h * (eta * nl * ul + ni * ui * (-eta + 1));
+  return h * (eta * nl * ul + ni * ui * (1 - eta));
+}
+
+
+// batched methods
+void
+SurfaceIceEnergyModel::Energy(int n,
+                              const double* h,
+                              const double* eta,
+                              const double* nl,
+                              const double* ul,
+                              const double* ni,
+                              const double* ui,
+                              const double* cv,
+                              double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = Energy(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDPondedDepth(int n,
+                                           const double* h,
+                                           const double* eta,
+                                           const double* nl,
+                                           const double* ul,
+                                           const double* ni,
+                                           const double* ui,
+                                           const double* cv,
+                                           double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDPondedDepth(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDUnfrozenFraction(int n,
+                                                const double* h,
+                                                const double* eta,
+                                                const double* nl,
+                                                const double* ul,
+                                                const double* ni,
+                                                const double* ui,
+                                                const double* cv,
+                                                double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDUnfrozenFraction(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDMolarDensityLiquid(int n,
+                                                  const double* h,
+                                                  const double* eta,
+                                                  const double* nl,
+                                                  const double* ul,
+                                                  const double* ni,
+                                                  const double* ui,
+                                                  const double* cv,
+                                                  double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDMolarDensityLiquid(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDInternalEnergyLiquid(int n,
+                                                    const double* h,
+                                                    const double* eta,
+                                                    const double* nl,
+                                                    const double* ul,
+                                                    const double* ni,
+                                                    const double* ui,
+                                                    const double* cv,
+                                                    double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyLiquid(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDMolarDensityIce(int n,
+                                               const double* h,
+                                               const double* eta,
+                                               const double* nl,
+                                               const double* ul,
+                                               const double* ni,
+                                               const double* ui,
+                                               const double* cv,
+                                               double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDMolarDensityIce(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDInternalEnergyIce(int n,
+                                                 const double* h,
+                                                 const double* eta,
+                                                 const double* nl,
+                                                 const double* ul,
+                                                 const double* ni,
+                                                 const double* ui,
+                                                 const double* cv,
+                                                 double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyIce(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+}
+
+void
+SurfaceIceEnergyModel::DEnergyDCellVolume(int n,
+                                          const double* h,
+                                          const double* eta,
+                                          const double* nl,
+                                          const double* ul,
+                                          const double* ni,
+                                          const double* ui,
+                                          const double* cv,
+                                          double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDCellVolume(h[i], eta[i], nl[i], ul[i], ni[i], ui[i], cv[i]);
+}
+
+void
+SurfaceIceEnergyModel::EnergyAndDerivatives(int n,
+                                            const double* h,
+                                            const double* eta,
+                                            const double* nl,
+                                            const double* ul,
+                                            const double* ni,
+                                            const double* ui,
+                                            const double* cv,
+                                            double* result,
+                                            double* dresult_dh,
+                                            double* dresult_deta,
+                                            double* dresult_dnl,
+                                            double* dresult_dul,
+                                            double* dresult_dni,
+                                            double* dresult_dui,
+                                            double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = 1 - eta[i];
+    const double x1 = ni[i] * ui[i];
+    const double x2 = eta[i] * nl[i] * ul[i] + x0 * x1;
+    const double x3 = cv[i] * x2;
+    const double x4 = cv[i] * h[i];
+    const double x5 = eta[i] * x4;
+    const double x6 = x0 * x4;
+    if (result) result[i] = h[i] * x3;
+    if (dresult_dh) dresult_dh[i] = x3;
+    if (dresult_deta) dresult_deta[i] = x4 * (nl[i] * ul[i] - x1);
+    if (dresult_dnl) dresult_dnl[i] = ul[i] * x5;
+    if (dresult_dul) dresult_dul[i] = nl[i] * x5;
+    if (dresult_dni) dresult_dni[i] = ui[i] * x6;
+    if (dresult_dui) dresult_dui[i] = ni[i] * x6;
+    if (dresult_dcv) dresult_dcv[i] = h[i] * x2;
+  }
 }
 
 } // namespace Relations
@@ -70,6 +70,98 @@ class SurfaceIceEnergyModel {
   DEnergyDCellVolume(double h, double eta, double nl, double ul, double ni, double ui, double cv)
     const;
 
+  void Energy(int n,
+              const double* h,
+              const double* eta,
+              const double* nl,
+              const double* ul,
+              const double* ni,
+              const double* ui,
+              const double* cv,
+              double* result) const;
+  void DEnergyDPondedDepth(int n,
+                           const double* h,
+                           const double* eta,
+                           const double* nl,
+                           const double* ul,
+                           const double* ni,
+                           const double* ui,
+                           const double* cv,
+                           double* result) const;
+  void DEnergyDUnfrozenFraction(int n,
+                                const double* h,
+                                const double* eta,
+                                const double* nl,
+                                const double* ul,
+                                const double* ni,
+                                const double* ui,
+                                const double* cv,
+                                double* result) const;
+  void DEnergyDMolarDensityLiquid(int n,
+                                  const double* h,
+                                  const double* eta,
+                                  const double* nl,
+                                  const double* ul,
+                                  const double* ni,
+                                  const double* ui,
+                                  const double* cv,
+                                  double* result) const;
+  void DEnergyDInternalEnergyLiquid(int n,
+                                    const double* h,
+                                    const double* eta,
+                                    const double* nl,
+                                    const double* ul,
+                                    const double* ni,
+                                    const double* ui,
+                                    const double* cv,
+                                    double* result) const;
+  void DEnergyDMolarDensityIce(int n,
+                               const double* h,
+                               const double* eta,
+                               const double* nl,
+                               const double* ul,
+                               const double* ni,
+                               const double* ui,
+                               const double* cv,
+                               double* result) const;
+  void DEnergyDInternalEnergyIce(int n,
+                                 const double* h,
+                                 const double* eta,
+                                 const double* nl,
+                                 const double* ul,
+                                 const double* ni,
+                                 const double* ui,
+                                 const double* cv,
+                                 double* result) const;
+  void DEnergyDCellVolume(int n,
+                          const double* h,
+                          const double* eta,
+                          const double* nl,
+                          const double* ul,
+                          const double* ni,
+                          const double* ui,
+                          const double* cv,
+                          double* result) const;
+
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void EnergyAndDerivatives(int n,
+                            const double* h,
+                            const double* eta,
+                            const double* nl,
+                            const double* ul,
+                            const double* ni,
+                            const double* ui,
+                            const double* cv,
+                            double* result,
+                            double* dresult_dh,
+                            double* dresult_deta,
+                            double* dresult_dnl,
+                            double* dresult_dul,
+                            double* dresult_dni,
+                            double* dresult_dui,
+                            double* dresult_dcv) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
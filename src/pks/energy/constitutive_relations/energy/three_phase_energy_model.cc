@@ -53,7 +53,7 @@ ThreePhaseEnergyModel::Energy(double phi,
                               double ur,
                               double cv) const
 {
-  return cv * (phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (-phi0 + 1));
+  return cv * (phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (1 - phi0));
 }
 
 double
@@ -281,7 +281,7 @@ ThreePhaseEnergyModel::DEnergyDDensityRock(double phi,
                                            double ur,
                                            double cv) const
 {
-  return cv * ur * (-phi0 + 1);
+  return cv * ur * (1 - phi0);
 }
 
 double
@@ -300,7 +300,7 @@ ThreePhaseEnergyModel::DEnergyDInternalEnergyRock(double phi,
                                                   double ur,
                                                   double cv) const
 {
-  return cv * rho_r * (-phi0 + 1);
+  return cv * rho_r * (1 - phi0);
 }
 
 double
@@ -319,7 +319,597 @@ ThreePhaseEnergyModel::DEnergyDCellVolume(double phi,
                                           double ur,
                                           double cv) const
 {
-  return phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (-phi0 + 1);
+  return phi * (ng * sg * ug + ni * si * ui + nl * sl * ul) + rho_r * ur * (1 - phi0);
+}
+
+
+// batched methods
+void
+ThreePhaseEnergyModel::Energy(int n,
+                              const double* phi,
+                              const double* phi0,
+                              const double* sl,
+                              const double* nl,
+                              const double* ul,
+                              const double* si,
+                              const double* ni,
+                              const double* ui,
+                              const double* sg,
+                              const double* ng,
+                              const double* ug,
+                              const double* rho_r,
+                              const double* ur,
+                              const double* cv,
+                              double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = Energy(phi[i],
+                       phi0[i],
+                       sl[i],
+                       nl[i],
+                       ul[i],
+                       si[i],
+                       ni[i],
+                       ui[i],
+                       sg[i],
+                       ng[i],
+                       ug[i],
+                       rho_r[i],
+                       ur[i],
+                       cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDPorosity(int n,
+                                        const double* phi,
+                                        const double* phi0,
+                                        const double* sl,
+                                        const double* nl,
+                                        const double* ul,
+                                        const double* si,
+                                        const double* ni,
+                                        const double* ui,
+                                        const double* sg,
+                                        const double* ng,
+                                        const double* ug,
+                                        const double* rho_r,
+                                        const double* ur,
+                                        const double* cv,
+                                        double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDPorosity(phi[i],
+                                 phi0[i],
+                                 sl[i],
+                                 nl[i],
+                                 ul[i],
+                                 si[i],
+                                 ni[i],
+                                 ui[i],
+                                 sg[i],
+                                 ng[i],
+                                 ug[i],
+                                 rho_r[i],
+                                 ur[i],
+                                 cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDBasePorosity(int n,
+                                            const double* phi,
+                                            const double* phi0,
+                                            const double* sl,
+                                            const double* nl,
+                                            const double* ul,
+                                            const double* si,
+                                            const double* ni,
+                                            const double* ui,
+                                            const double* sg,
+                                            const double* ng,
+                                            const double* ug,
+                                            const double* rho_r,
+                                            const double* ur,
+                                            const double* cv,
+                                            double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDBasePorosity(phi[i],
+                                     phi0[i],
+                                     sl[i],
+                                     nl[i],
+                                     ul[i],
+                                     si[i],
+                                     ni[i],
+                                     ui[i],
+                                     sg[i],
+                                     ng[i],
+                                     ug[i],
+                                     rho_r[i],
+                                     ur[i],
+                                     cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDSaturationLiquid(int n,
+                                                const double* phi,
+                                                const double* phi0,
+                                                const double* sl,
+                                                const double* nl,
+                                                const double* ul,
+                                                const double* si,
+                                                const double* ni,
+                                                const double* ui,
+                                                const double* sg,
+                                                const double* ng,
+                                                const double* ug,
+                                                const double* rho_r,
+                                                const double* ur,
+                                                const double* cv,
+                                                double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDSaturationLiquid(phi[i],
+                                         phi0[i],
+                                         sl[i],
+                                         nl[i],
+                                         ul[i],
+                                         si[i],
+                                         ni[i],
+                                         ui[i],
+                                         sg[i],
+                                         ng[i],
+                                         ug[i],
+                                         rho_r[i],
+                                         ur[i],
+                                         cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDMolarDensityLiquid(int n,
+                                                  const double* phi,
+                                                  const double* phi0,
+                                                  const double* sl,
+                                                  const double* nl,
+                                                  const double* ul,
+                                                  const double* si,
+                                                  const double* ni,
+                                                  const double* ui,
+                                                  const double* sg,
+                                                  const double* ng,
+                                                  const double* ug,
+                                                  const double* rho_r,
+                                                  const double* ur,
+                                                  const double* cv,
+                                                  double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDMolarDensityLiquid(phi[i],
+                                           phi0[i],
+                                           sl[i],
+                                           nl[i],
+                                           ul[i],
+                                           si[i],
+                                           ni[i],
+                                           ui[i],
+                                           sg[i],
+                                           ng[i],
+                                           ug[i],
+                                           rho_r[i],
+                                           ur[i],
+                                           cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDInternalEnergyLiquid(int n,
+                                                    const double* phi,
+                                                    const double* phi0,
+                                                    const double* sl,
+                                                    const double* nl,
+                                                    const double* ul,
+                                                    const double* si,
+                                                    const double* ni,
+                                                    const double* ui,
+                                                    const double* sg,
+                                                    const double* ng,
+                                                    const double* ug,
+                                                    const double* rho_r,
+                                                    const double* ur,
+                                                    const double* cv,
+                                                    double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyLiquid(phi[i],
+                                             phi0[i],
+                                             sl[i],
+                                             nl[i],
+                                             ul[i],
+                                             si[i],
+                                             ni[i],
+                                             ui[i],
+                                             sg[i],
+                                             ng[i],
+                                             ug[i],
+                                             rho_r[i],
+                                             ur[i],
+                                             cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDSaturationIce(int n,
+                                             const double* phi,
+                                             const double* phi0,
+                                             const double* sl,
+                                             const double* nl,
+                                             const double* ul,
+                                             const double* si,
+                                             const double* ni,
+                                             const double* ui,
+                                             const double* sg,
+                                             const double* ng,
+                                             const double* ug,
+                                             const double* rho_r,
+                                             const double* ur,
+                                             const double* cv,
+                                             double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDSaturationIce(phi[i],
+                                      phi0[i],
+                                      sl[i],
+                                      nl[i],
+                                      ul[i],
+                                      si[i],
+                                      ni[i],
+                                      ui[i],
+                                      sg[i],
+                                      ng[i],
+                                      ug[i],
+                                      rho_r[i],
+                                      ur[i],
+                                      cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDMolarDensityIce(int n,
+                                               const double* phi,
+                                               const double* phi0,
+                                               const double* sl,
+                                               const double* nl,
+                                               const double* ul,
+                                               const double* si,
+                                               const double* ni,
+                                               const double* ui,
+                                               const double* sg,
+                                               const double* ng,
+                                               const double* ug,
+                                               const double* rho_r,
+                                               const double* ur,
+                                               const double* cv,
+                                               double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDMolarDensityIce(phi[i],
+                                        phi0[i],
+                                        sl[i],
+                                        nl[i],
+                                        ul[i],
+                                        si[i],
+                                        ni[i],
+                                        ui[i],
+                                        sg[i],
+                                        ng[i],
+                                        ug[i],
+                                        rho_r[i],
+                                        ur[i],
+                                        cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDInternalEnergyIce(int n,
+                                                 const double* phi,
+                                                 const double* phi0,
+                                                 const double* sl,
+                                                 const double* nl,
+                                                 const double* ul,
+                                                 const double* si,
+                                                 const double* ni,
+                                                 const double* ui,
+                                                 const double* sg,
+                                                 const double* ng,
+                                                 const double* ug,
+                                                 const double* rho_r,
+                                                 const double* ur,
+                                                 const double* cv,
+                                                 double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyIce(phi[i],
+                                          phi0[i],
+                                          sl[i],
+                                          nl[i],
+                                          ul[i],
+                                          si[i],
+                                          ni[i],
+                                          ui[i],
+                                          sg[i],
+                                          ng[i],
+                                          ug[i],
+                                          rho_r[i],
+                                          ur[i],
+                                          cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDSaturationGas(int n,
+                                             const double* phi,
+                                             const double* phi0,
+                                             const double* sl,
+                                             const double* nl,
+                                             const double* ul,
+                                             const double* si,
+                                             const double* ni,
+                                             const double* ui,
+                                             const double* sg,
+                                             const double* ng,
+                                             const double* ug,
+                                             const double* rho_r,
+                                             const double* ur,
+                                             const double* cv,
+                                             double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDSaturationGas(phi[i],
+                                      phi0[i],
+                                      sl[i],
+                                      nl[i],
+                                      ul[i],
+                                      si[i],
+                                      ni[i],
+                                      ui[i],
+                                      sg[i],
+                                      ng[i],
+                                      ug[i],
+                                      rho_r[i],
+                                      ur[i],
+                                      cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDMolarDensityGas(int n,
+                                               const double* phi,
+                                               const double* phi0,
+                                               const double* sl,
+                                               const double* nl,
+                                               const double* ul,
+                                               const double* si,
+                                               const double* ni,
+                                               const double* ui,
+                                               const double* sg,
+                                               const double* ng,
+                                               const double* ug,
+                                               const double* rho_r,
+                                               const double* ur,
+                                               const double* cv,
+                                               double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDMolarDensityGas(phi[i],
+                                        phi0[i],
+                                        sl[i],
+                                        nl[i],
+                                        ul[i],
+                                        si[i],
+                                        ni[i],
+                                        ui[i],
+                                        sg[i],
+                                        ng[i],
+                                        ug[i],
+                                        rho_r[i],
+                                        ur[i],
+                                        cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDInternalEnergyGas(int n,
+                                                 const double* phi,
+                                                 const double* phi0,
+                                                 const double* sl,
+                                                 const double* nl,
+                                                 const double* ul,
+                                                 const double* si,
+                                                 const double* ni,
+                                                 const double* ui,
+                                                 const double* sg,
+                                                 const double* ng,
+                                                 const double* ug,
+                                                 const double* rho_r,
+                                                 const double* ur,
+                                                 const double* cv,
+                                                 double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyGas(phi[i],
+                                          phi0[i],
+                                          sl[i],
+                                          nl[i],
+                                          ul[i],
+                                          si[i],
+                                          ni[i],
+                                          ui[i],
+                                          sg[i],
+                                          ng[i],
+                                          ug[i],
+                                          rho_r[i],
+                                          ur[i],
+                                          cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDDensityRock(int n,
+                                           const double* phi,
+                                           const double* phi0,
+                                           const double* sl,
+                                           const double* nl,
+                                           const double* ul,
+                                           const double* si,
+                                           const double* ni,
+                                           const double* ui,
+                                           const double* sg,
+                                           const double* ng,
+                                           const double* ug,
+                                           const double* rho_r,
+                                           const double* ur,
+                                           const double* cv,
+                                           double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDDensityRock(phi[i],
+                                    phi0[i],
+                                    sl[i],
+                                    nl[i],
+                                    ul[i],
+                                    si[i],
+                                    ni[i],
+                                    ui[i],
+                                    sg[i],
+                                    ng[i],
+                                    ug[i],
+                                    rho_r[i],
+                                    ur[i],
+                                    cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDInternalEnergyRock(int n,
+                                                  const double* phi,
+                                                  const double* phi0,
+                                                  const double* sl,
+                                                  const double* nl,
+                                                  const double* ul,
+                                                  const double* si,
+                                                  const double* ni,
+                                                  const double* ui,
+                                                  const double* sg,
+                                                  const double* ng,
+                                                  const double* ug,
+                                                  const double* rho_r,
+                                                  const double* ur,
+                                                  const double* cv,
+                                                  double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDInternalEnergyRock(phi[i],
+                                           phi0[i],
+                                           sl[i],
+                                           nl[i],
+                                           ul[i],
+                                           si[i],
+                                           ni[i],
+                                           ui[i],
+                                           sg[i],
+                                           ng[i],
+                                           ug[i],
+                                           rho_r[i],
+                                           ur[i],
+                                           cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::DEnergyDCellVolume(int n,
+                                          const double* phi,
+                                          const double* phi0,
+                                          const double* sl,
+                                          const double* nl,
+                                          const double* ul,
+                                          const double* si,
+                                          const double* ni,
+                                          const double* ui,
+                                          const double* sg,
+                                          const double* ng,
+                                          const double* ug,
+                                          const double* rho_r,
+                                          const double* ur,
+                                          const double* cv,
+                                          double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDCellVolume(phi[i],
+                                   phi0[i],
+                                   sl[i],
+                                   nl[i],
+                                   ul[i],
+                                   si[i],
+                                   ni[i],
+                                   ui[i],
+                                   sg[i],
+                                   ng[i],
+                                   ug[i],
+                                   rho_r[i],
+                                   ur[i],
+                                   cv[i]);
+}
+
+void
+ThreePhaseEnergyModel::EnergyAndDerivatives(int n,
+                                            const double* phi,
+                                            const double* phi0,
+                                            const double* sl,
+                                            const double* nl,
+                                            const double* ul,
+                                            const double* si,
+                                            const double* ni,
+                                            const double* ui,
+                                            const double* sg,
+                                            const double* ng,
+                                            const double* ug,
+                                            const double* rho_r,
+                                            const double* ur,
+                                            const double* cv,
+                                            double* result,
+                                            double* dresult_dphi,
+                                            double* dresult_dphi0,
+                                            double* dresult_dsl,
+                                            double* dresult_dnl,
+                                            double* dresult_dul,
+                                            double* dresult_dsi,
+                                            double* dresult_dni,
+                                            double* dresult_dui,
+                                            double* dresult_dsg,
+                                            double* dresult_dng,
+                                            double* dresult_dug,
+                                            double* dresult_drho_r,
+                                            double* dresult_dur,
+                                            double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = 1 - phi0[i];
+    const double x1 = rho_r[i] * ur[i];
+    const double x2 = ng[i] * ug[i];
+    const double x3 = ni[i] * ui[i];
+    const double x4 = nl[i] * ul[i];
+    const double x5 = sg[i] * x2 + si[i] * x3 + sl[i] * x4;
+    const double x6 = phi[i] * x5 + x0 * x1;
+    const double x7 = cv[i] * phi[i];
+    const double x8 = sl[i] * x7;
+    const double x9 = si[i] * x7;
+    const double x10 = sg[i] * x7;
+    const double x11 = cv[i] * x0;
+    if (result) result[i] = cv[i] * x6;
+    if (dresult_dphi) dresult_dphi[i] = cv[i] * x5;
+    if (dresult_dphi0) dresult_dphi0[i] = -cv[i] * x1;
+    if (dresult_dsl) dresult_dsl[i] = x4 * x7;
+    if (dresult_dnl) dresult_dnl[i] = ul[i] * x8;
+    if (dresult_dul) dresult_dul[i] = nl[i] * x8;
+    if (dresult_dsi) dresult_dsi[i] = x3 * x7;
+    if (dresult_dni) dresult_dni[i] = ui[i] * x9;
+    if (dresult_dui) dresult_dui[i] = ni[i] * x9;
+    if (dresult_dsg) dresult_dsg[i] = x2 * x7;
+    if (dresult_dng) dresult_dng[i] = ug[i] * x10;
+    if (dresult_dug) dresult_dug[i] = ng[i] * x10;
+    if (dresult_drho_r) dresult_drho_r[i] = ur[i] * x11;
+    if (dresult_dur) dresult_dur[i] = rho_r[i] * x11;
+    if (dresult_dcv) dresult_dcv[i] = x6;
+  }
 }
 
 } // namespace Relations
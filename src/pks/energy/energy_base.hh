@@ -193,10 +193,6 @@ class EnergyBase : public PK_PhysicalBDF_Default {
   virtual void CommitStep(double t_old, double t_new, const Tag& tag) override;
   virtual void CalculateDiagnostics(const Tag& tag) override {}
 
-  // Default implementations of BDFFnBase methods.
-  // -- Compute a norm on u-du and return the result.
-  virtual double
-  ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
 
   // EnergyBase is a BDFFnBase
   // computes the non-linear functional f = f(t,u,udot)
@@ -230,6 +226,13 @@ class EnergyBase : public PK_PhysicalBDF_Default {
                    Teuchos::RCP<TreeVector> du) override;
 
  protected:
+  // -- error norm relative to mass, with an absolute floor for dry cells
+  virtual void ErrorNormComponents_(Teuchos::RCP<const TreeVector> u,
+                                    Teuchos::RCP<const TreeVector> du,
+                                    std::vector<std::string>& comps,
+                                    std::vector<ENorm_t>& enorms,
+                                    std::vector<double>& infnorms) override;
+
   // These must be provided by the deriving PK.
   // -- setup the evaluators
   virtual void SetupPhysicalEvaluators_();
@@ -34,7 +34,7 @@ EnergyBase::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
   double dt = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
   // update the energy at both the old and new times.
-  S_->GetEvaluator(conserved_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(conserved_key_, tag_next_, *S_, name_);
   // S_->GetEvaluator(conserved_key_, tag_current_).Update(*S_, name_); // for the future...
 
   // get the energy at each time
@@ -99,8 +99,7 @@ void
 EnergyBase::ApplyDiffusion_(const Tag& tag, const Teuchos::Ptr<CompositeVector>& g)
 {
   // force mass matrices to change
-  if (!deform_key_.empty() &&
-      S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " matrix"))
+  if (!deform_key_.empty() && updateEvaluator(deform_key_, tag_next_, *S_, name_ + " matrix"))
     matrix_diff_->SetTensorCoefficient(Teuchos::null);
 
   // update the thermal conductivity
@@ -135,14 +134,14 @@ EnergyBase::AddSources_(const Tag& tag, const Teuchos::Ptr<CompositeVector>& g)
 
   Epetra_MultiVector& g_c = *g->ViewComponent("cell", false);
 
-  S_->GetEvaluator(cell_vol_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(cell_vol_key_, tag_next_, *S_, name_);
   const Epetra_MultiVector& cv =
     *S_->Get<CompositeVector>(cell_vol_key_, tag_next_).ViewComponent("cell", false);
 
   // external sources of energy
   if (is_source_term_) {
     // Update the source term
-    S_->GetEvaluator(source_key_, tag).Update(*S_, name_);
+    updateEvaluator(source_key_, tag, *S_, name_);
     const Epetra_MultiVector& source1 =
       *S_->Get<CompositeVector>(source_key_, tag).ViewComponent("cell", false);
 
@@ -170,20 +169,20 @@ EnergyBase::AddSourcesToPrecon_(double h)
       double eps = 1.e-8;
       S_->GetW<CompositeVector>(key_, tag_next_, name_).Shift(eps);
       ChangedSolution();
-      S_->GetEvaluator(source_key_, tag_next_).Update(*S_, name_);
+      updateEvaluator(source_key_, tag_next_, *S_, name_);
       auto dsource_dT_nc =
         Teuchos::rcp(new CompositeVector(S_->Get<CompositeVector>(source_key_, tag_next_)));
 
       S_->GetW<CompositeVector>(key_, tag_next_, name_).Shift(-eps);
       ChangedSolution();
-      S_->GetEvaluator(source_key_, tag_next_).Update(*S_, name_);
+      updateEvaluator(source_key_, tag_next_, *S_, name_);
 
       dsource_dT_nc->Update(-1 / eps, S_->Get<CompositeVector>(source_key_, tag_next_), 1 / eps);
       dsource_dT = dsource_dT_nc;
 
     } else {
       // evaluate the derivative through the dag
-      S_->GetEvaluator(source_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+      updateEvaluatorDerivative(source_key_, tag_next_, *S_, name_, key_, tag_next_);
       dsource_dT = S_->GetDerivativePtrW<CompositeVector>(
         source_key_, tag_next_, key_, tag_next_, source_key_);
     }
@@ -222,7 +221,7 @@ EnergyBase::ApplyDirichletBCsToEnthalpy_(const Tag& tag)
   }
 
   // then put the boundary fluxes in faces for Dirichlet BCs.
-  S_->GetEvaluator(enthalpy_key_, tag).Update(*S_, name_);
+  updateEvaluator(enthalpy_key_, tag, *S_, name_);
 
   const Epetra_MultiVector& enth_bf =
     *S_->Get<CompositeVector>(enthalpy_key_, tag).ViewComponent("boundary_face", false);
@@ -473,7 +473,7 @@ bool
 EnergyBase::UpdateConductivityData_(const Tag& tag)
 {
   Teuchos::RCP<const CompositeVector> cond = S_->GetPtr<CompositeVector>(conductivity_key_, tag);
-  bool update = S_->GetEvaluator(conductivity_key_, tag).Update(*S_, name_);
+  bool update = updateEvaluator(conductivity_key_, tag, *S_, name_);
 
   if (update) {
     Teuchos::RCP<CompositeVector> uw_cond =
@@ -492,7 +492,7 @@ EnergyBase::UpdateConductivityDerivativeData_(const Tag& tag)
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "  Updating conductivity derivatives? ";
 
-  bool update = S_->GetEvaluator(conductivity_key_, tag).UpdateDerivative(*S_, name_, key_, tag);
+  bool update = updateEvaluatorDerivative(conductivity_key_, tag, *S_, name_, key_, tag);
 
   if (update) {
     Teuchos::RCP<const CompositeVector> dcond =
@@ -13,8 +13,11 @@
 #include "Debugger.hh"
 #include "BoundaryFunction.hh"
 #include "Evaluator.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "energy_base.hh"
 #include "Op.hh"
+#include "upwind_topology.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -33,6 +36,7 @@ EnergyBase::FunctionalResidual(double t_old,
                                Teuchos::RCP<TreeVector> u_new,
                                Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   Teuchos::OSTab tab = vo_->getOSTab();
 
   // increment, get timestep
@@ -119,6 +123,7 @@ EnergyBase::FunctionalResidual(double t_old,
 int
 EnergyBase::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
 #if DEBUG_FLAG
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
@@ -126,7 +131,11 @@ EnergyBase::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<T
 #endif
 
   // apply the preconditioner
-  int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  }
 
 #if DEBUG_FLAG
   db_->WriteVector("PC*T_res", Pu->Data().ptr(), true);
@@ -142,6 +151,7 @@ EnergyBase::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<T
 void
 EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -156,8 +166,7 @@ EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
 
   // div K_e grad u
   // force mass matrices to change
-  if (!deform_key_.empty() &&
-      S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " precon"))
+  if (!deform_key_.empty() && updateEvaluator(deform_key_, tag_next_, *S_, name_ + " precon"))
     preconditioner_diff_->SetTensorCoefficient(Teuchos::null);
 
   UpdateConductivityData_(tag_next_);
@@ -193,7 +202,7 @@ EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
   }
 
   // -- update the accumulation derivatives, de/dT
-  S_->GetEvaluator(conserved_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+  updateEvaluatorDerivative(conserved_key_, tag_next_, *S_, name_, key_, tag_next_);
   const auto& de_dT =
     *S_->GetDerivativePtr<CompositeVector>(conserved_key_, tag_next_, key_, tag_next_)
        ->ViewComponent("cell", false);
@@ -253,7 +262,7 @@ EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
     if (implicit_advection_ && implicit_advection_in_pc_) {
       Teuchos::RCP<const CompositeVector> water_flux =
         S_->GetPtr<CompositeVector>(flux_key_, tag_next_);
-      S_->GetEvaluator(enthalpy_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+      updateEvaluatorDerivative(enthalpy_key_, tag_next_, *S_, name_, key_, tag_next_);
       Teuchos::RCP<const CompositeVector> dhdT =
         S_->GetDerivativePtr<CompositeVector>(enthalpy_key_, tag_next_, key_, tag_next_);
       preconditioner_adv_->Setup(*water_flux);
@@ -268,10 +277,14 @@ EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
 };
 
 // -----------------------------------------------------------------------------
-// Default enorm that uses an abs and rel tolerance to monitor convergence.
+// Local error norm of each component, using an abs tolerance relative to mass.
 // -----------------------------------------------------------------------------
-double
-EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> res)
+void
+EnergyBase::ErrorNormComponents_(Teuchos::RCP<const TreeVector> u,
+                                 Teuchos::RCP<const TreeVector> res,
+                                 std::vector<std::string>& comps,
+                                 std::vector<ENorm_t>& enorms,
+                                 std::vector<double>& infnorms)
 {
   // Abs tol based on old conserved quantity -- we know these have been vetted
   // at some level whereas the new quantity is some iterate, and may be
@@ -287,35 +300,29 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
   const Epetra_MultiVector& cv =
     *S_->Get<CompositeVector>(cell_vol_key_, tag_next_).ViewComponent("cell", true);
 
-  // VerboseObject stuff.
-  Teuchos::OSTab tab = vo_->getOSTab();
-  if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-    *vo_->os() << "ENorm (Infnorm) of: " << conserved_key_ << ": " << std::endl;
-
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-
-  double enorm_val = 0.0;
+  // each component's weighted norm, its location, and the inf norm of the
+  // residual are found in a single pass
   for (CompositeVector::name_iterator comp = dvec->begin(); comp != dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
+    double infnorm = 0.0;
     const Epetra_MultiVector& dvec_v = *dvec->ViewComponent(*comp, false);
+    const double* dvec_p = dvec_v[0];
 
     if (*comp == std::string("cell")) {
       // error done in two parts, relative to mass but absolute in
       // energy since it doesn't make much sense to be relative to
       // energy
       int ncells = dvec->size(*comp, false);
-      for (unsigned int c = 0; c != ncells; ++c) {
+      for (int c = 0; c != ncells; ++c) {
         double mass = std::max(mass_atol_, wc[0][c] / cv[0][c]);
         double energy = mass * atol_ + soil_atol_;
-        double enorm_c = std::abs(h * dvec_v[0][c]) / (energy * cv[0][c]);
-
+        double res_c = std::abs(dvec_p[c]);
+        double enorm_c = h * res_c / (energy * cv[0][c]);
+        infnorm = std::max(infnorm, res_c);
         if (enorm_c > enorm_comp) {
           enorm_comp = enorm_c;
           enorm_loc = c;
@@ -325,20 +332,19 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
-
-      for (unsigned int f = 0; f != nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double mass_min = cells.size() == 1 ? wc[0][cells[0]] / cv[0][cells[0]] :
-                                              std::min(wc[0][cells[0]] / cv[0][cells[0]],
-                                                       wc[0][cells[1]] / cv[0][cells[1]]);
+      int ncells = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+      const auto& topology = Operators::getUpwindTopology(mesh_);
+      for (int f = 0; f != nfaces; ++f) {
+        int c0, c1;
+        topology.OwnedCells(f, ncells, c0, c1);
+        double cv_min = std::min(cv[0][c0], cv[0][c1]);
+        double mass_min = std::min(wc[0][c0] / cv[0][c0], wc[0][c1] / cv[0][c1]);
         mass_min = std::max(mass_min, mass_atol_);
 
         double energy = mass_min * atol_ + soil_atol_;
-        double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f]) / (energy * cv_min);
-
+        double res_f = std::abs(dvec_p[f]);
+        double enorm_f = fluxtol_ * h * res_f / (energy * cv_min);
+        infnorm = std::max(infnorm, res_f);
         if (enorm_f > enorm_comp) {
           enorm_comp = enorm_f;
           enorm_loc = f;
@@ -347,38 +353,14 @@ EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeV
 
     } else {
       // boundary face components had better be effectively identically 0
-      double norm;
-      dvec_v.Norm2(&norm);
-      AMANZI_ASSERT(norm < 1.e-15);
-    }
-
-
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr;
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] ("
-                 << infnorm << ")" << std::endl;
+      for (int i = 0; i != dvec_v.MyLength(); ++i) infnorm = std::max(infnorm, std::abs(dvec_p[i]));
+      AMANZI_ASSERT(infnorm < 1.e-15);
     }
 
-    enorm_val = std::max(enorm_val, enorm_comp);
+    comps.emplace_back(*comp);
+    enorms.emplace_back(ENorm_t{ enorm_comp, dvec_v.Map().GID(enorm_loc) });
+    infnorms.emplace_back(infnorm);
   }
-
-  double enorm_val_l = enorm_val;
-
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
 };
 
 
@@ -18,6 +18,8 @@ de/dt + q dot grad h = div Ke grad T + S?
 #include "BoundaryFunction.hh"
 #include "EvaluatorPrimary.hh"
 #include "Op.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "energy_interfrost.hh"
 
 namespace Amanzi {
@@ -48,9 +50,9 @@ InterfrostEnergy::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
   double dt = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
   // update the energy at both the old and new times.
-  S_->GetEvaluator("DEnergyDT_coef", tag_next_).Update(*S_, name_);
-  S_->GetEvaluator(key_, tag_next_).Update(*S_, name_);
-  S_->GetEvaluator(key_, tag_current_).Update(*S_, name_);
+  updateEvaluator("DEnergyDT_coef", tag_next_, *S_, name_);
+  updateEvaluator(key_, tag_next_, *S_, name_);
+  updateEvaluator(key_, tag_current_, *S_, name_);
 
   // get the energy at each time
   const auto& cv = *S_->Get<CompositeVector>(cell_vol_key_, tag_next_).ViewComponent("cell", false);
@@ -72,6 +74,7 @@ InterfrostEnergy::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
 void
 InterfrostEnergy::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -98,7 +101,7 @@ InterfrostEnergy::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector>
 
   // update with accumulation terms
   // -- update the accumulation derivatives, de/dT
-  S_->GetEvaluator("DEnergyDT_coef", tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+  updateEvaluatorDerivative("DEnergyDT_coef", tag_next_, *S_, name_, key_, tag_next_);
   const auto& dcoef_dT =
     *S_->GetDerivative<CompositeVector>("DEnergyDT_coef", tag_next_, key_, tag_next_)
        .ViewComponent("cell", false);
@@ -129,7 +132,7 @@ InterfrostEnergy::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector>
   if (implicit_advection_ && implicit_advection_in_pc_) {
     Teuchos::RCP<const CompositeVector> water_flux =
       S_->GetPtr<CompositeVector>("water_flux", tag_next_);
-    S_->GetEvaluator(enthalpy_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+    updateEvaluatorDerivative(enthalpy_key_, tag_next_, *S_, name_, key_, tag_next_);
     const auto dhdT = S_->GetDerivativePtr<CompositeVector>(
       Keys::getDerivKey(enthalpy_key_, key_), tag_next_, key_, tag_next_);
     preconditioner_adv_->Setup(*water_flux);
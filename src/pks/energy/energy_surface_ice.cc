@@ -199,8 +199,8 @@ EnergySurfaceIce::AddSources_(const Tag& tag, const Teuchos::Ptr<CompositeVector
   // -- two parts -- conduction and advection
   // -- advection source
   if (coupled_to_subsurface_via_temp_ || coupled_to_subsurface_via_flux_) {
-    S_->GetEvaluator(Keys::getKey(domain_ss_, "enthalpy"), tag).Update(*S_, name_);
-    S_->GetEvaluator(enthalpy_key_, tag).Update(*S_, name_);
+    updateEvaluator(Keys::getKey(domain_ss_, "enthalpy"), tag, *S_, name_);
+    updateEvaluator(enthalpy_key_, tag, *S_, name_);
 
     // -- advection source
     Key key_ss = Keys::getKey(domain_, "surface_subsurface_flux");
@@ -103,10 +103,15 @@ InterfrostDenergyDtemperatureEvaluator::Evaluate_(const State& S,
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
     int ncomp = result[0]->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->DEnergyDTCoef(
-        phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
-    }
+    model_->DEnergyDTCoef(ncomp,
+                          phi_v[0],
+                          sl_v[0],
+                          nl_v[0],
+                          si_v[0],
+                          ni_v[0],
+                          rhos_v[0],
+                          T_v[0],
+                          result_v[0]);
   }
 }
 
@@ -140,10 +145,15 @@ InterfrostDenergyDtemperatureEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDPorosity(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
-      }
+      model_->DDEnergyDTCoefDPorosity(ncomp,
+                                      phi_v[0],
+                                      sl_v[0],
+                                      nl_v[0],
+                                      si_v[0],
+                                      ni_v[0],
+                                      rhos_v[0],
+                                      T_v[0],
+                                      result_v[0]);
     }
 
   } else if (wrt_key == sl_key_) {
@@ -159,10 +169,15 @@ InterfrostDenergyDtemperatureEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDSaturationLiquid(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
-      }
+      model_->DDEnergyDTCoefDSaturationLiquid(ncomp,
+                                              phi_v[0],
+                                              sl_v[0],
+                                              nl_v[0],
+                                              si_v[0],
+                                              ni_v[0],
+                                              rhos_v[0],
+                                              T_v[0],
+                                              result_v[0]);
     }
 
   } else if (wrt_key == nl_key_) {
@@ -178,10 +193,15 @@ InterfrostDenergyDtemperatureEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDMolarDensityLiquid(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
-      }
+      model_->DDEnergyDTCoefDMolarDensityLiquid(ncomp,
+                                                phi_v[0],
+                                                sl_v[0],
+                                                nl_v[0],
+                                                si_v[0],
+                                                ni_v[0],
+                                                rhos_v[0],
+                                                T_v[0],
+                                                result_v[0]);
     }
 
   } else if (wrt_key == si_key_) {
@@ -197,10 +217,15 @@ InterfrostDenergyDtemperatureEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDSaturationIce(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
-      }
+      model_->DDEnergyDTCoefDSaturationIce(ncomp,
+                                           phi_v[0],
+                                           sl_v[0],
+                                           nl_v[0],
+                                           si_v[0],
+                                           ni_v[0],
+                                           rhos_v[0],
+                                           T_v[0],
+                                           result_v[0]);
     }
 
   } else if (wrt_key == ni_key_) {
@@ -216,10 +241,15 @@ InterfrostDenergyDtemperatureEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDMolarDensityIce(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
-      }
+      model_->DDEnergyDTCoefDMolarDensityIce(ncomp,
+                                             phi_v[0],
+                                             sl_v[0],
+                                             nl_v[0],
+                                             si_v[0],
+                                             ni_v[0],
+                                             rhos_v[0],
+                                             T_v[0],
+                                             result_v[0]);
     }
 
   } else if (wrt_key == rhos_key_) {
@@ -235,10 +265,15 @@ InterfrostDenergyDtemperatureEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDDensityRock(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
-      }
+      model_->DDEnergyDTCoefDDensityRock(ncomp,
+                                         phi_v[0],
+                                         sl_v[0],
+                                         nl_v[0],
+                                         si_v[0],
+                                         ni_v[0],
+                                         rhos_v[0],
+                                         T_v[0],
+                                         result_v[0]);
     }
 
   } else if (wrt_key == T_key_) {
@@ -254,10 +289,15 @@ InterfrostDenergyDtemperatureEvaluator::EvaluatePartialDerivative_(
       Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDTemperature(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
-      }
+      model_->DDEnergyDTCoefDTemperature(ncomp,
+                                         phi_v[0],
+                                         sl_v[0],
+                                         nl_v[0],
+                                         si_v[0],
+                                         ni_v[0],
+                                         rhos_v[0],
+                                         T_v[0],
+                                         result_v[0]);
     }
 
   } else {
@@ -153,6 +153,134 @@ InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDTemperature(double phi,
              0.95 * pow(2 * T - 546.3, 2) * exp(-pow(T - 273.15, 2) / pow(W_, 2)) / pow(W_, 4)));
 }
 
+
+// batched methods
+void
+InterfrostDenergyDtemperatureModel::DEnergyDTCoef(int n,
+                                                  const double* phi,
+                                                  const double* sl,
+                                                  const double* nl,
+                                                  const double* si,
+                                                  const double* ni,
+                                                  const double* rhos,
+                                                  const double* T,
+                                                  double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DEnergyDTCoef(phi[i], sl[i], nl[i], si[i], ni[i], rhos[i], T[i]);
+}
+
+void
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDPorosity(int n,
+                                                            const double* phi,
+                                                            const double* sl,
+                                                            const double* nl,
+                                                            const double* si,
+                                                            const double* ni,
+                                                            const double* rhos,
+                                                            const double* T,
+                                                            double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DDEnergyDTCoefDPorosity(phi[i], sl[i], nl[i], si[i], ni[i], rhos[i], T[i]);
+}
+
+void
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDSaturationLiquid(int n,
+                                                                    const double* phi,
+                                                                    const double* sl,
+                                                                    const double* nl,
+                                                                    const double* si,
+                                                                    const double* ni,
+                                                                    const double* rhos,
+                                                                    const double* T,
+                                                                    double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DDEnergyDTCoefDSaturationLiquid(phi[i], sl[i], nl[i], si[i], ni[i], rhos[i], T[i]);
+}
+
+void
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDMolarDensityLiquid(int n,
+                                                                      const double* phi,
+                                                                      const double* sl,
+                                                                      const double* nl,
+                                                                      const double* si,
+                                                                      const double* ni,
+                                                                      const double* rhos,
+                                                                      const double* T,
+                                                                      double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DDEnergyDTCoefDMolarDensityLiquid(phi[i],
+                                                  sl[i],
+                                                  nl[i],
+                                                  si[i],
+                                                  ni[i],
+                                                  rhos[i],
+                                                  T[i]);
+}
+
+void
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDSaturationIce(int n,
+                                                                 const double* phi,
+                                                                 const double* sl,
+                                                                 const double* nl,
+                                                                 const double* si,
+                                                                 const double* ni,
+                                                                 const double* rhos,
+                                                                 const double* T,
+                                                                 double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DDEnergyDTCoefDSaturationIce(phi[i], sl[i], nl[i], si[i], ni[i], rhos[i], T[i]);
+}
+
+void
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDMolarDensityIce(int n,
+                                                                   const double* phi,
+                                                                   const double* sl,
+                                                                   const double* nl,
+                                                                   const double* si,
+                                                                   const double* ni,
+                                                                   const double* rhos,
+                                                                   const double* T,
+                                                                   double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DDEnergyDTCoefDMolarDensityIce(phi[i], sl[i], nl[i], si[i], ni[i], rhos[i], T[i]);
+}
+
+void
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDDensityRock(int n,
+                                                               const double* phi,
+                                                               const double* sl,
+                                                               const double* nl,
+                                                               const double* si,
+                                                               const double* ni,
+                                                               const double* rhos,
+                                                               const double* T,
+                                                               double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DDEnergyDTCoefDDensityRock(phi[i], sl[i], nl[i], si[i], ni[i], rhos[i], T[i]);
+}
+
+void
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDTemperature(int n,
+                                                               const double* phi,
+                                                               const double* sl,
+                                                               const double* nl,
+                                                               const double* si,
+                                                               const double* ni,
+                                                               const double* rhos,
+                                                               const double* T,
+                                                               double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DDEnergyDTCoefDTemperature(phi[i], sl[i], nl[i], si[i], ni[i], rhos[i], T[i]);
+}
+
 } // namespace Relations
 } // namespace Flow
 } // namespace Amanzi
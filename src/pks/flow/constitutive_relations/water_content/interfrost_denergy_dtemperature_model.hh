@@ -80,6 +80,79 @@ class InterfrostDenergyDtemperatureModel {
                                     double rhos,
                                     double T) const;
 
+  void DEnergyDTCoef(int n,
+                     const double* phi,
+                     const double* sl,
+                     const double* nl,
+                     const double* si,
+                     const double* ni,
+                     const double* rhos,
+                     const double* T,
+                     double* result) const;
+  void DDEnergyDTCoefDPorosity(int n,
+                               const double* phi,
+                               const double* sl,
+                               const double* nl,
+                               const double* si,
+                               const double* ni,
+                               const double* rhos,
+                               const double* T,
+                               double* result) const;
+  void DDEnergyDTCoefDSaturationLiquid(int n,
+                                       const double* phi,
+                                       const double* sl,
+                                       const double* nl,
+                                       const double* si,
+                                       const double* ni,
+                                       const double* rhos,
+                                       const double* T,
+                                       double* result) const;
+  void DDEnergyDTCoefDMolarDensityLiquid(int n,
+                                         const double* phi,
+                                         const double* sl,
+                                         const double* nl,
+                                         const double* si,
+                                         const double* ni,
+                                         const double* rhos,
+                                         const double* T,
+                                         double* result) const;
+  void DDEnergyDTCoefDSaturationIce(int n,
+                                    const double* phi,
+                                    const double* sl,
+                                    const double* nl,
+                                    const double* si,
+                                    const double* ni,
+                                    const double* rhos,
+                                    const double* T,
+                                    double* result) const;
+  void DDEnergyDTCoefDMolarDensityIce(int n,
+                                      const double* phi,
+                                      const double* sl,
+                                      const double* nl,
+                                      const double* si,
+                                      const double* ni,
+                                      const double* rhos,
+                                      const double* T,
+                                      double* result) const;
+  void DDEnergyDTCoefDDensityRock(int n,
+                                  const double* phi,
+                                  const double* sl,
+                                  const double* nl,
+                                  const double* si,
+                                  const double* ni,
+                                  const double* rhos,
+                                  const double* T,
+                                  double* result) const;
+  void DDEnergyDTCoefDTemperature(int n,
+                                  const double* phi,
+                                  const double* sl,
+                                  const double* nl,
+                                  const double* si,
+                                  const double* ni,
+                                  const double* rhos,
+                                  const double* T,
+                                  double* result) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
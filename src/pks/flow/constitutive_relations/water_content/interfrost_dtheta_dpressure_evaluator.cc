@@ -13,6 +13,8 @@ Interfrost water content portion sl.
   Generated via evaluator_generator.
 */
 
+#include <algorithm>
+
 #include "interfrost_dtheta_dpressure_evaluator.hh"
 #include "interfrost_dtheta_dpressure_model.hh"
 
@@ -67,6 +69,7 @@ void
 InterfrostDthetaDpressureEvaluator::Evaluate_(const State& S,
                                               const std::vector<CompositeVector*>& result)
 {
+  derivs_valid_ = false;
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> nl = S.GetPtr<CompositeVector>(nl_key_, tag);
   Teuchos::RCP<const CompositeVector> sl = S.GetPtr<CompositeVector>(sl_key_, tag);
@@ -79,9 +82,7 @@ InterfrostDthetaDpressureEvaluator::Evaluate_(const State& S,
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
     int ncomp = result[0]->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->DThetaDpCoef(nl_v[0][i], sl_v[0][i], phi_v[0][i]);
-    }
+    model_->DThetaDpCoef(ncomp, nl_v[0], sl_v[0], phi_v[0], result_v[0]);
   }
 }
 
@@ -98,53 +99,46 @@ InterfrostDthetaDpressureEvaluator::EvaluatePartialDerivative_(
   Teuchos::RCP<const CompositeVector> sl = S.GetPtr<CompositeVector>(sl_key_, tag);
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
 
-  if (wrt_key == nl_key_) {
+  // the fused kernel finds all derivatives in one pass over the dependencies
+  if (!derivs_valid_) {
     for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
          ++comp) {
       const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
       const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
       const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] =
-          model_->DDThetaDpCoefDMolarDensityLiquid(nl_v[0][i], sl_v[0][i], phi_v[0][i]);
-      }
+      auto& derivs = derivs_[*comp];
+      derivs.resize(3);
+      for (auto& deriv : derivs) deriv.resize(ncomp);
+      model_->DThetaDpCoefAndDerivatives(ncomp,
+                                         nl_v[0],
+                                         sl_v[0],
+                                         phi_v[0],
+                                         nullptr,
+                                         derivs[0].data(),
+                                         derivs[1].data(),
+                                         derivs[2].data());
     }
+    derivs_valid_ = true;
+  }
 
+  int wrt_index = -1;
+  if (wrt_key == nl_key_) {
+    wrt_index = 0;
   } else if (wrt_key == sl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] =
-          model_->DDThetaDpCoefDSaturationLiquid(nl_v[0][i], sl_v[0][i], phi_v[0][i]);
-      }
-    }
-
+    wrt_index = 1;
   } else if (wrt_key == phi_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDThetaDpCoefDPorosity(nl_v[0][i], sl_v[0][i], phi_v[0][i]);
-      }
-    }
-
+    wrt_index = 2;
   } else {
     AMANZI_ASSERT(0);
   }
+
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    const std::vector<double>& deriv = derivs_.at(*comp)[wrt_index];
+    std::copy(deriv.begin(), deriv.end(), result_v[0]);
+  }
 }
 
 
@@ -18,6 +18,10 @@ Interfrost water content portion sl.
 #ifndef AMANZI_FLOW_INTERFROST_DTHETA_DPRESSURE_EVALUATOR_HH_
 #define AMANZI_FLOW_INTERFROST_DTHETA_DPRESSURE_EVALUATOR_HH_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -52,6 +56,11 @@ class InterfrostDthetaDpressureEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<InterfrostDthetaDpressureModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, InterfrostDthetaDpressureEvaluator> reg_;
 };
@@ -67,6 +67,68 @@ InterfrostDthetaDpressureModel::DDThetaDpCoefDPorosity(double nl, double sl, dou
   return beta_ * nl * sl;
 }
 
+
+// batched methods
+void
+InterfrostDthetaDpressureModel::DThetaDpCoef(int n,
+                                             const double* nl,
+                                             const double* sl,
+                                             const double* phi,
+                                             double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DThetaDpCoef(nl[i], sl[i], phi[i]);
+}
+
+void
+InterfrostDthetaDpressureModel::DDThetaDpCoefDMolarDensityLiquid(int n,
+                                                                 const double* nl,
+                                                                 const double* sl,
+                                                                 const double* phi,
+                                                                 double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DDThetaDpCoefDMolarDensityLiquid(nl[i], sl[i], phi[i]);
+}
+
+void
+InterfrostDthetaDpressureModel::DDThetaDpCoefDSaturationLiquid(int n,
+                                                               const double* nl,
+                                                               const double* sl,
+                                                               const double* phi,
+                                                               double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DDThetaDpCoefDSaturationLiquid(nl[i], sl[i], phi[i]);
+}
+
+void
+InterfrostDthetaDpressureModel::DDThetaDpCoefDPorosity(int n,
+                                                       const double* nl,
+                                                       const double* sl,
+                                                       const double* phi,
+                                                       double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DDThetaDpCoefDPorosity(nl[i], sl[i], phi[i]);
+}
+
+void
+InterfrostDthetaDpressureModel::DThetaDpCoefAndDerivatives(int n,
+                                                           const double* nl,
+                                                           const double* sl,
+                                                           const double* phi,
+                                                           double* result,
+                                                           double* dresult_dnl,
+                                                           double* dresult_dsl,
+                                                           double* dresult_dphi) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = beta_ * phi[i];
+    const double x1 = sl[i] * x0;
+    if (result) result[i] = nl[i] * x1;
+    if (dresult_dnl) dresult_dnl[i] = x1;
+    if (dresult_dsl) dresult_dsl[i] = nl[i] * x0;
+    if (dresult_dphi) dresult_dphi[i] = beta_ * nl[i] * sl[i];
+  }
+}
+
 } // namespace Relations
 } // namespace Flow
 } // namespace Amanzi
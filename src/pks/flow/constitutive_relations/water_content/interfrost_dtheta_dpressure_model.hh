@@ -32,6 +32,38 @@ class InterfrostDthetaDpressureModel {
   double DDThetaDpCoefDSaturationLiquid(double nl, double sl, double phi) const;
   double DDThetaDpCoefDPorosity(double nl, double sl, double phi) const;
 
+  void DThetaDpCoef(int n,
+                    const double* nl,
+                    const double* sl,
+                    const double* phi,
+                    double* result) const;
+  void DDThetaDpCoefDMolarDensityLiquid(int n,
+                                        const double* nl,
+                                        const double* sl,
+                                        const double* phi,
+                                        double* result) const;
+  void DDThetaDpCoefDSaturationLiquid(int n,
+                                      const double* nl,
+                                      const double* sl,
+                                      const double* phi,
+                                      double* result) const;
+  void DDThetaDpCoefDPorosity(int n,
+                              const double* nl,
+                              const double* sl,
+                              const double* phi,
+                              double* result) const;
+
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void DThetaDpCoefAndDerivatives(int n,
+                                  const double* nl,
+                                  const double* sl,
+                                  const double* phi,
+                                  double* result,
+                                  double* dresult_dnl,
+                                  double* dresult_dsl,
+                                  double* dresult_dphi) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
@@ -13,6 +13,8 @@ Interfrost water content portion sl.
   Generated via evaluator_generator.
 */
 
+#include <algorithm>
+
 #include "interfrost_sl_wc_evaluator.hh"
 #include "interfrost_sl_wc_model.hh"
 
@@ -73,6 +75,7 @@ InterfrostSlWcEvaluator::InitializeFromPlist_()
 void
 InterfrostSlWcEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
+  derivs_valid_ = false;
   Tag tag = my_keys_.front().second;
   Teuchos::RCP<const CompositeVector> phi = S.GetPtr<CompositeVector>(phi_key_, tag);
   Teuchos::RCP<const CompositeVector> sl = S.GetPtr<CompositeVector>(sl_key_, tag);
@@ -89,10 +92,7 @@ InterfrostSlWcEvaluator::Evaluate_(const State& S, const std::vector<CompositeVe
     Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
     int ncomp = result[0]->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] =
-        model_->WaterContent(phi_v[0][i], sl_v[0][i], nl_v[0][i], ni_v[0][i], cv_v[0][i]);
-    }
+    model_->WaterContent(ncomp, phi_v[0], sl_v[0], nl_v[0], ni_v[0], cv_v[0], result_v[0]);
   }
 }
 
@@ -110,7 +110,8 @@ InterfrostSlWcEvaluator::EvaluatePartialDerivative_(const State& S,
   Teuchos::RCP<const CompositeVector> ni = S.GetPtr<CompositeVector>(ni_key_, tag);
   Teuchos::RCP<const CompositeVector> cv = S.GetPtr<CompositeVector>(cv_key_, tag);
 
-  if (wrt_key == phi_key_) {
+  // the fused kernel finds all derivatives in one pass over the dependencies
+  if (!derivs_valid_) {
     for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
          ++comp) {
       const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
@@ -118,86 +119,47 @@ InterfrostSlWcEvaluator::EvaluatePartialDerivative_(const State& S,
       const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
       const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
       const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
       int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDPorosity(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], ni_v[0][i], cv_v[0][i]);
-      }
+      auto& derivs = derivs_[*comp];
+      derivs.resize(5);
+      for (auto& deriv : derivs) deriv.resize(ncomp);
+      model_->WaterContentAndDerivatives(ncomp,
+                                         phi_v[0],
+                                         sl_v[0],
+                                         nl_v[0],
+                                         ni_v[0],
+                                         cv_v[0],
+                                         nullptr,
+                                         derivs[0].data(),
+                                         derivs[1].data(),
+                                         derivs[2].data(),
+                                         derivs[3].data(),
+                                         derivs[4].data());
     }
+    derivs_valid_ = true;
+  }
 
+  int wrt_index = -1;
+  if (wrt_key == phi_key_) {
+    wrt_index = 0;
   } else if (wrt_key == sl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDSaturationLiquid(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], ni_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 1;
   } else if (wrt_key == nl_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityLiquid(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], ni_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 2;
   } else if (wrt_key == ni_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDMolarDensityIce(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], ni_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 3;
   } else if (wrt_key == cv_key_) {
-    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
-         ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
-
-      int ncomp = result[0]->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DWaterContentDCellVolume(
-          phi_v[0][i], sl_v[0][i], nl_v[0][i], ni_v[0][i], cv_v[0][i]);
-      }
-    }
-
+    wrt_index = 4;
   } else {
     AMANZI_ASSERT(0);
   }
+
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    const std::vector<double>& deriv = derivs_.at(*comp)[wrt_index];
+    std::copy(deriv.begin(), deriv.end(), result_v[0]);
+  }
 }
 
 
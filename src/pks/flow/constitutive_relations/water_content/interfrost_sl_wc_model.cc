@@ -90,6 +90,114 @@ InterfrostSlWcModel::DWaterContentDCellVolume(double phi,
   return phi * sl * (-ni + nl);
 }
 
+
+// batched methods
+void
+InterfrostSlWcModel::WaterContent(int n,
+                                  const double* phi,
+                                  const double* sl,
+                                  const double* nl,
+                                  const double* ni,
+                                  const double* cv,
+                                  double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = WaterContent(phi[i], sl[i], nl[i], ni[i], cv[i]);
+}
+
+void
+InterfrostSlWcModel::DWaterContentDPorosity(int n,
+                                            const double* phi,
+                                            const double* sl,
+                                            const double* nl,
+                                            const double* ni,
+                                            const double* cv,
+                                            double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDPorosity(phi[i], sl[i], nl[i], ni[i], cv[i]);
+}
+
+void
+InterfrostSlWcModel::DWaterContentDSaturationLiquid(int n,
+                                                    const double* phi,
+                                                    const double* sl,
+                                                    const double* nl,
+                                                    const double* ni,
+                                                    const double* cv,
+                                                    double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationLiquid(phi[i], sl[i], nl[i], ni[i], cv[i]);
+}
+
+void
+InterfrostSlWcModel::DWaterContentDMolarDensityLiquid(int n,
+                                                      const double* phi,
+                                                      const double* sl,
+                                                      const double* nl,
+                                                      const double* ni,
+                                                      const double* cv,
+                                                      double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i], sl[i], nl[i], ni[i], cv[i]);
+}
+
+void
+InterfrostSlWcModel::DWaterContentDMolarDensityIce(int n,
+                                                   const double* phi,
+                                                   const double* sl,
+                                                   const double* nl,
+                                                   const double* ni,
+                                                   const double* cv,
+                                                   double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityIce(phi[i], sl[i], nl[i], ni[i], cv[i]);
+}
+
+void
+InterfrostSlWcModel::DWaterContentDCellVolume(int n,
+                                              const double* phi,
+                                              const double* sl,
+                                              const double* nl,
+                                              const double* ni,
+                                              const double* cv,
+                                              double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDCellVolume(phi[i], sl[i], nl[i], ni[i], cv[i]);
+}
+
+void
+InterfrostSlWcModel::WaterContentAndDerivatives(int n,
+                                                const double* phi,
+                                                const double* sl,
+                                                const double* nl,
+                                                const double* ni,
+                                                const double* cv,
+                                                double* result,
+                                                double* dresult_dphi,
+                                                double* dresult_dsl,
+                                                double* dresult_dnl,
+                                                double* dresult_dni,
+                                                double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = -ni[i] + nl[i];
+    const double x1 = cv[i] * x0;
+    const double x2 = sl[i] * x1;
+    const double x3 = phi[i] * sl[i];
+    const double x4 = cv[i] * x3;
+    if (result) result[i] = phi[i] * x2;
+    if (dresult_dphi) dresult_dphi[i] = x2;
+    if (dresult_dsl) dresult_dsl[i] = phi[i] * x1;
+    if (dresult_dnl) dresult_dnl[i] = x4;
+    if (dresult_dni) dresult_dni[i] = -x4;
+    if (dresult_dcv) dresult_dcv[i] = x0 * x3;
+  }
+}
+
 } // namespace Relations
 } // namespace Flow
 } // namespace Amanzi
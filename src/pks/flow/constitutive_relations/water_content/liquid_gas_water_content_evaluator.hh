@@ -34,6 +34,10 @@ Specified with evaluator type: `"liquid+gas water content`"
 #ifndef AMANZI_FLOW_LIQUID_GAS_WATER_CONTENT_EVALUATOR_HH_
 #define AMANZI_FLOW_LIQUID_GAS_WATER_CONTENT_EVALUATOR_HH_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -73,6 +77,11 @@ class LiquidGasWaterContentEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<LiquidGasWaterContentModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, LiquidGasWaterContentEvaluator> reg_;
 };
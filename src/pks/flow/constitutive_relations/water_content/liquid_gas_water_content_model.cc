@@ -133,6 +133,169 @@ LiquidGasWaterContentModel::DWaterContentDCellVolume(double phi,
   return phi * (ng * omega * sg + nl * sl);
 }
 
+
+// batched methods
+void
+LiquidGasWaterContentModel::WaterContent(int n,
+                                         const double* phi,
+                                         const double* sl,
+                                         const double* nl,
+                                         const double* sg,
+                                         const double* ng,
+                                         const double* omega,
+                                         const double* cv,
+                                         double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = WaterContent(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDPorosity(int n,
+                                                   const double* phi,
+                                                   const double* sl,
+                                                   const double* nl,
+                                                   const double* sg,
+                                                   const double* ng,
+                                                   const double* omega,
+                                                   const double* cv,
+                                                   double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDPorosity(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDSaturationLiquid(int n,
+                                                           const double* phi,
+                                                           const double* sl,
+                                                           const double* nl,
+                                                           const double* sg,
+                                                           const double* ng,
+                                                           const double* omega,
+                                                           const double* cv,
+                                                           double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationLiquid(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDMolarDensityLiquid(int n,
+                                                             const double* phi,
+                                                             const double* sl,
+                                                             const double* nl,
+                                                             const double* sg,
+                                                             const double* ng,
+                                                             const double* omega,
+                                                             const double* cv,
+                                                             double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i],
+                                                 sl[i],
+                                                 nl[i],
+                                                 sg[i],
+                                                 ng[i],
+                                                 omega[i],
+                                                 cv[i]);
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDSaturationGas(int n,
+                                                        const double* phi,
+                                                        const double* sl,
+                                                        const double* nl,
+                                                        const double* sg,
+                                                        const double* ng,
+                                                        const double* omega,
+                                                        const double* cv,
+                                                        double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationGas(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDMolarDensityGas(int n,
+                                                          const double* phi,
+                                                          const double* sl,
+                                                          const double* nl,
+                                                          const double* sg,
+                                                          const double* ng,
+                                                          const double* omega,
+                                                          const double* cv,
+                                                          double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityGas(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDMolFracGas(int n,
+                                                     const double* phi,
+                                                     const double* sl,
+                                                     const double* nl,
+                                                     const double* sg,
+                                                     const double* ng,
+                                                     const double* omega,
+                                                     const double* cv,
+                                                     double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolFracGas(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+}
+
+void
+LiquidGasWaterContentModel::DWaterContentDCellVolume(int n,
+                                                     const double* phi,
+                                                     const double* sl,
+                                                     const double* nl,
+                                                     const double* sg,
+                                                     const double* ng,
+                                                     const double* omega,
+                                                     const double* cv,
+                                                     double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDCellVolume(phi[i], sl[i], nl[i], sg[i], ng[i], omega[i], cv[i]);
+}
+
+void
+LiquidGasWaterContentModel::WaterContentAndDerivatives(int n,
+                                                       const double* phi,
+                                                       const double* sl,
+                                                       const double* nl,
+                                                       const double* sg,
+                                                       const double* ng,
+                                                       const double* omega,
+                                                       const double* cv,
+                                                       double* result,
+                                                       double* dresult_dphi,
+                                                       double* dresult_dsl,
+                                                       double* dresult_dnl,
+                                                       double* dresult_dsg,
+                                                       double* dresult_dng,
+                                                       double* dresult_domega,
+                                                       double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = ng[i] * omega[i];
+    const double x1 = nl[i] * sl[i] + sg[i] * x0;
+    const double x2 = cv[i] * x1;
+    const double x3 = cv[i] * phi[i];
+    const double x4 = sg[i] * x3;
+    if (result) result[i] = phi[i] * x2;
+    if (dresult_dphi) dresult_dphi[i] = x2;
+    if (dresult_dsl) dresult_dsl[i] = nl[i] * x3;
+    if (dresult_dnl) dresult_dnl[i] = sl[i] * x3;
+    if (dresult_dsg) dresult_dsg[i] = x0 * x3;
+    if (dresult_dng) dresult_dng[i] = omega[i] * x4;
+    if (dresult_domega) dresult_domega[i] = ng[i] * x4;
+    if (dresult_dcv) dresult_dcv[i] = phi[i] * x1;
+  }
+}
+
 } // namespace Relations
 } // namespace Flow
 } // namespace Amanzi
@@ -80,6 +80,98 @@ class LiquidGasWaterContentModel {
                                   double omega,
                                   double cv) const;
 
+  void WaterContent(int n,
+                    const double* phi,
+                    const double* sl,
+                    const double* nl,
+                    const double* sg,
+                    const double* ng,
+                    const double* omega,
+                    const double* cv,
+                    double* result) const;
+  void DWaterContentDPorosity(int n,
+                              const double* phi,
+                              const double* sl,
+                              const double* nl,
+                              const double* sg,
+                              const double* ng,
+                              const double* omega,
+                              const double* cv,
+                              double* result) const;
+  void DWaterContentDSaturationLiquid(int n,
+                                      const double* phi,
+                                      const double* sl,
+                                      const double* nl,
+                                      const double* sg,
+                                      const double* ng,
+                                      const double* omega,
+                                      const double* cv,
+                                      double* result) const;
+  void DWaterContentDMolarDensityLiquid(int n,
+                                        const double* phi,
+                                        const double* sl,
+                                        const double* nl,
+                                        const double* sg,
+                                        const double* ng,
+                                        const double* omega,
+                                        const double* cv,
+                                        double* result) const;
+  void DWaterContentDSaturationGas(int n,
+                                   const double* phi,
+                                   const double* sl,
+                                   const double* nl,
+                                   const double* sg,
+                                   const double* ng,
+                                   const double* omega,
+                                   const double* cv,
+                                   double* result) const;
+  void DWaterContentDMolarDensityGas(int n,
+                                     const double* phi,
+                                     const double* sl,
+                                     const double* nl,
+                                     const double* sg,
+                                     const double* ng,
+                                     const double* omega,
+                                     const double* cv,
+                                     double* result) const;
+  void DWaterContentDMolFracGas(int n,
+                                const double* phi,
+                                const double* sl,
+                                const double* nl,
+                                const double* sg,
+                                const double* ng,
+                                const double* omega,
+                                const double* cv,
+                                double* result) const;
+  void DWaterContentDCellVolume(int n,
+                                const double* phi,
+                                const double* sl,
+                                const double* nl,
+                                const double* sg,
+                                const double* ng,
+                                const double* omega,
+                                const double* cv,
+                                double* result) const;
+
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void WaterContentAndDerivatives(int n,
+                                  const double* phi,
+                                  const double* sl,
+                                  const double* nl,
+                                  const double* sg,
+                                  const double* ng,
+                                  const double* omega,
+                                  const double* cv,
+                                  double* result,
+                                  double* dresult_dphi,
+                                  double* dresult_dsl,
+                                  double* dresult_dnl,
+                                  double* dresult_dsg,
+                                  double* dresult_dng,
+                                  double* dresult_domega,
+                                  double* dresult_dcv) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
@@ -33,6 +33,10 @@ Specified with evaluator type: `"liquid+ice water content`"
 #ifndef AMANZI_FLOW_LIQUID_ICE_WATER_CONTENT_EVALUATOR_HH_
 #define AMANZI_FLOW_LIQUID_ICE_WATER_CONTENT_EVALUATOR_HH_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -70,6 +74,11 @@ class LiquidIceWaterContentEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<LiquidIceWaterContentModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, LiquidIceWaterContentEvaluator> reg_;
 };
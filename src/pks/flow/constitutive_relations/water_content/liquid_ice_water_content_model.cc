@@ -114,6 +114,135 @@ LiquidIceWaterContentModel::DWaterContentDCellVolume(double phi,
   return phi * (ni * si + nl * sl);
 }
 
+
+// batched methods
+void
+LiquidIceWaterContentModel::WaterContent(int n,
+                                         const double* phi,
+                                         const double* sl,
+                                         const double* nl,
+                                         const double* si,
+                                         const double* ni,
+                                         const double* cv,
+                                         double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = WaterContent(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDPorosity(int n,
+                                                   const double* phi,
+                                                   const double* sl,
+                                                   const double* nl,
+                                                   const double* si,
+                                                   const double* ni,
+                                                   const double* cv,
+                                                   double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDPorosity(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDSaturationLiquid(int n,
+                                                           const double* phi,
+                                                           const double* sl,
+                                                           const double* nl,
+                                                           const double* si,
+                                                           const double* ni,
+                                                           const double* cv,
+                                                           double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationLiquid(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDMolarDensityLiquid(int n,
+                                                             const double* phi,
+                                                             const double* sl,
+                                                             const double* nl,
+                                                             const double* si,
+                                                             const double* ni,
+                                                             const double* cv,
+                                                             double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDSaturationIce(int n,
+                                                        const double* phi,
+                                                        const double* sl,
+                                                        const double* nl,
+                                                        const double* si,
+                                                        const double* ni,
+                                                        const double* cv,
+                                                        double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationIce(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDMolarDensityIce(int n,
+                                                          const double* phi,
+                                                          const double* sl,
+                                                          const double* nl,
+                                                          const double* si,
+                                                          const double* ni,
+                                                          const double* cv,
+                                                          double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityIce(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+}
+
+void
+LiquidIceWaterContentModel::DWaterContentDCellVolume(int n,
+                                                     const double* phi,
+                                                     const double* sl,
+                                                     const double* nl,
+                                                     const double* si,
+                                                     const double* ni,
+                                                     const double* cv,
+                                                     double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDCellVolume(phi[i], sl[i], nl[i], si[i], ni[i], cv[i]);
+}
+
+void
+LiquidIceWaterContentModel::WaterContentAndDerivatives(int n,
+                                                       const double* phi,
+                                                       const double* sl,
+                                                       const double* nl,
+                                                       const double* si,
+                                                       const double* ni,
+                                                       const double* cv,
+                                                       double* result,
+                                                       double* dresult_dphi,
+                                                       double* dresult_dsl,
+                                                       double* dresult_dnl,
+                                                       double* dresult_dsi,
+                                                       double* dresult_dni,
+                                                       double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = ni[i] * si[i] + nl[i] * sl[i];
+    const double x1 = cv[i] * x0;
+    const double x2 = cv[i] * phi[i];
+    if (result) result[i] = phi[i] * x1;
+    if (dresult_dphi) dresult_dphi[i] = x1;
+    if (dresult_dsl) dresult_dsl[i] = nl[i] * x2;
+    if (dresult_dnl) dresult_dnl[i] = sl[i] * x2;
+    if (dresult_dsi) dresult_dsi[i] = ni[i] * x2;
+    if (dresult_dni) dresult_dni[i] = si[i] * x2;
+    if (dresult_dcv) dresult_dcv[i] = phi[i] * x0;
+  }
+}
+
 } // namespace Relations
 } // namespace Flow
 } // namespace Amanzi
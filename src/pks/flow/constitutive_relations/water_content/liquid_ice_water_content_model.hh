@@ -48,6 +48,80 @@ class LiquidIceWaterContentModel {
   double
   DWaterContentDCellVolume(double phi, double sl, double nl, double si, double ni, double cv) const;
 
+  void WaterContent(int n,
+                    const double* phi,
+                    const double* sl,
+                    const double* nl,
+                    const double* si,
+                    const double* ni,
+                    const double* cv,
+                    double* result) const;
+  void DWaterContentDPorosity(int n,
+                              const double* phi,
+                              const double* sl,
+                              const double* nl,
+                              const double* si,
+                              const double* ni,
+                              const double* cv,
+                              double* result) const;
+  void DWaterContentDSaturationLiquid(int n,
+                                      const double* phi,
+                                      const double* sl,
+                                      const double* nl,
+                                      const double* si,
+                                      const double* ni,
+                                      const double* cv,
+                                      double* result) const;
+  void DWaterContentDMolarDensityLiquid(int n,
+                                        const double* phi,
+                                        const double* sl,
+                                        const double* nl,
+                                        const double* si,
+                                        const double* ni,
+                                        const double* cv,
+                                        double* result) const;
+  void DWaterContentDSaturationIce(int n,
+                                   const double* phi,
+                                   const double* sl,
+                                   const double* nl,
+                                   const double* si,
+                                   const double* ni,
+                                   const double* cv,
+                                   double* result) const;
+  void DWaterContentDMolarDensityIce(int n,
+                                     const double* phi,
+                                     const double* sl,
+                                     const double* nl,
+                                     const double* si,
+                                     const double* ni,
+                                     const double* cv,
+                                     double* result) const;
+  void DWaterContentDCellVolume(int n,
+                                const double* phi,
+                                const double* sl,
+                                const double* nl,
+                                const double* si,
+                                const double* ni,
+                                const double* cv,
+                                double* result) const;
+
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void WaterContentAndDerivatives(int n,
+                                  const double* phi,
+                                  const double* sl,
+                                  const double* nl,
+                                  const double* si,
+                                  const double* ni,
+                                  const double* cv,
+                                  double* result,
+                                  double* dresult_dphi,
+                                  double* dresult_dsl,
+                                  double* dresult_dnl,
+                                  double* dresult_dsi,
+                                  double* dresult_dni,
+                                  double* dresult_dcv) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
@@ -30,6 +30,10 @@ Specified with evaluator type: `"richards water content`"
 #ifndef AMANZI_FLOW_RICHARDS_WATER_CONTENT_EVALUATOR_HH_
 #define AMANZI_FLOW_RICHARDS_WATER_CONTENT_EVALUATOR_HH_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -66,6 +70,11 @@ class RichardsWaterContentEvaluator : public EvaluatorSecondaryMonotypeCV {
 
   Teuchos::RCP<RichardsWaterContentModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, RichardsWaterContentEvaluator> reg_;
 };
@@ -76,6 +76,89 @@ RichardsWaterContentModel::DWaterContentDCellVolume(double phi,
   return nl * phi * sl;
 }
 
+
+// batched methods
+void
+RichardsWaterContentModel::WaterContent(int n,
+                                        const double* phi,
+                                        const double* sl,
+                                        const double* nl,
+                                        const double* cv,
+                                        double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = WaterContent(phi[i], sl[i], nl[i], cv[i]);
+}
+
+void
+RichardsWaterContentModel::DWaterContentDPorosity(int n,
+                                                  const double* phi,
+                                                  const double* sl,
+                                                  const double* nl,
+                                                  const double* cv,
+                                                  double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DWaterContentDPorosity(phi[i], sl[i], nl[i], cv[i]);
+}
+
+void
+RichardsWaterContentModel::DWaterContentDSaturationLiquid(int n,
+                                                          const double* phi,
+                                                          const double* sl,
+                                                          const double* nl,
+                                                          const double* cv,
+                                                          double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationLiquid(phi[i], sl[i], nl[i], cv[i]);
+}
+
+void
+RichardsWaterContentModel::DWaterContentDMolarDensityLiquid(int n,
+                                                            const double* phi,
+                                                            const double* sl,
+                                                            const double* nl,
+                                                            const double* cv,
+                                                            double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i], sl[i], nl[i], cv[i]);
+}
+
+void
+RichardsWaterContentModel::DWaterContentDCellVolume(int n,
+                                                    const double* phi,
+                                                    const double* sl,
+                                                    const double* nl,
+                                                    const double* cv,
+                                                    double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DWaterContentDCellVolume(phi[i], sl[i], nl[i], cv[i]);
+}
+
+void
+RichardsWaterContentModel::WaterContentAndDerivatives(int n,
+                                                      const double* phi,
+                                                      const double* sl,
+                                                      const double* nl,
+                                                      const double* cv,
+                                                      double* result,
+                                                      double* dresult_dphi,
+                                                      double* dresult_dsl,
+                                                      double* dresult_dnl,
+                                                      double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = cv[i] * nl[i];
+    const double x1 = sl[i] * x0;
+    const double x2 = phi[i] * sl[i];
+    if (result) result[i] = phi[i] * x1;
+    if (dresult_dphi) dresult_dphi[i] = x1;
+    if (dresult_dsl) dresult_dsl[i] = phi[i] * x0;
+    if (dresult_dnl) dresult_dnl[i] = cv[i] * x2;
+    if (dresult_dcv) dresult_dcv[i] = nl[i] * x2;
+  }
+}
+
 } // namespace Relations
 } // namespace Flow
 } // namespace Amanzi
@@ -33,6 +33,50 @@ class RichardsWaterContentModel {
   double DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double cv) const;
   double DWaterContentDCellVolume(double phi, double sl, double nl, double cv) const;
 
+  void WaterContent(int n,
+                    const double* phi,
+                    const double* sl,
+                    const double* nl,
+                    const double* cv,
+                    double* result) const;
+  void DWaterContentDPorosity(int n,
+                              const double* phi,
+                              const double* sl,
+                              const double* nl,
+                              const double* cv,
+                              double* result) const;
+  void DWaterContentDSaturationLiquid(int n,
+                                      const double* phi,
+                                      const double* sl,
+                                      const double* nl,
+                                      const double* cv,
+                                      double* result) const;
+  void DWaterContentDMolarDensityLiquid(int n,
+                                        const double* phi,
+                                        const double* sl,
+                                        const double* nl,
+                                        const double* cv,
+                                        double* result) const;
+  void DWaterContentDCellVolume(int n,
+                                const double* phi,
+                                const double* sl,
+                                const double* nl,
+                                const double* cv,
+                                double* result) const;
+
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void WaterContentAndDerivatives(int n,
+                                  const double* phi,
+                                  const double* sl,
+                                  const double* nl,
+                                  const double* cv,
+                                  double* result,
+                                  double* dresult_dphi,
+                                  double* dresult_dsl,
+                                  double* dresult_dnl,
+                                  double* dresult_dcv) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
@@ -177,6 +177,291 @@ ThreePhaseWaterContentModel::DWaterContentDCellVolume(double phi,
   return phi * (ng * omega * sg + ni * si + nl * sl);
 }
 
+
+// batched methods
+void
+ThreePhaseWaterContentModel::WaterContent(int n,
+                                          const double* phi,
+                                          const double* sl,
+                                          const double* nl,
+                                          const double* si,
+                                          const double* ni,
+                                          const double* sg,
+                                          const double* ng,
+                                          const double* omega,
+                                          const double* cv,
+                                          double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = WaterContent(phi[i], sl[i], nl[i], si[i], ni[i], sg[i], ng[i], omega[i], cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDPorosity(int n,
+                                                    const double* phi,
+                                                    const double* sl,
+                                                    const double* nl,
+                                                    const double* si,
+                                                    const double* ni,
+                                                    const double* sg,
+                                                    const double* ng,
+                                                    const double* omega,
+                                                    const double* cv,
+                                                    double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDPorosity(phi[i],
+                                       sl[i],
+                                       nl[i],
+                                       si[i],
+                                       ni[i],
+                                       sg[i],
+                                       ng[i],
+                                       omega[i],
+                                       cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDSaturationLiquid(int n,
+                                                            const double* phi,
+                                                            const double* sl,
+                                                            const double* nl,
+                                                            const double* si,
+                                                            const double* ni,
+                                                            const double* sg,
+                                                            const double* ng,
+                                                            const double* omega,
+                                                            const double* cv,
+                                                            double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationLiquid(phi[i],
+                                               sl[i],
+                                               nl[i],
+                                               si[i],
+                                               ni[i],
+                                               sg[i],
+                                               ng[i],
+                                               omega[i],
+                                               cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityLiquid(int n,
+                                                              const double* phi,
+                                                              const double* sl,
+                                                              const double* nl,
+                                                              const double* si,
+                                                              const double* ni,
+                                                              const double* sg,
+                                                              const double* ng,
+                                                              const double* omega,
+                                                              const double* cv,
+                                                              double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityLiquid(phi[i],
+                                                 sl[i],
+                                                 nl[i],
+                                                 si[i],
+                                                 ni[i],
+                                                 sg[i],
+                                                 ng[i],
+                                                 omega[i],
+                                                 cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDSaturationIce(int n,
+                                                         const double* phi,
+                                                         const double* sl,
+                                                         const double* nl,
+                                                         const double* si,
+                                                         const double* ni,
+                                                         const double* sg,
+                                                         const double* ng,
+                                                         const double* omega,
+                                                         const double* cv,
+                                                         double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationIce(phi[i],
+                                            sl[i],
+                                            nl[i],
+                                            si[i],
+                                            ni[i],
+                                            sg[i],
+                                            ng[i],
+                                            omega[i],
+                                            cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityIce(int n,
+                                                           const double* phi,
+                                                           const double* sl,
+                                                           const double* nl,
+                                                           const double* si,
+                                                           const double* ni,
+                                                           const double* sg,
+                                                           const double* ng,
+                                                           const double* omega,
+                                                           const double* cv,
+                                                           double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityIce(phi[i],
+                                              sl[i],
+                                              nl[i],
+                                              si[i],
+                                              ni[i],
+                                              sg[i],
+                                              ng[i],
+                                              omega[i],
+                                              cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDSaturationGas(int n,
+                                                         const double* phi,
+                                                         const double* sl,
+                                                         const double* nl,
+                                                         const double* si,
+                                                         const double* ni,
+                                                         const double* sg,
+                                                         const double* ng,
+                                                         const double* omega,
+                                                         const double* cv,
+                                                         double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDSaturationGas(phi[i],
+                                            sl[i],
+                                            nl[i],
+                                            si[i],
+                                            ni[i],
+                                            sg[i],
+                                            ng[i],
+                                            omega[i],
+                                            cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityGas(int n,
+                                                           const double* phi,
+                                                           const double* sl,
+                                                           const double* nl,
+                                                           const double* si,
+                                                           const double* ni,
+                                                           const double* sg,
+                                                           const double* ng,
+                                                           const double* omega,
+                                                           const double* cv,
+                                                           double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolarDensityGas(phi[i],
+                                              sl[i],
+                                              nl[i],
+                                              si[i],
+                                              ni[i],
+                                              sg[i],
+                                              ng[i],
+                                              omega[i],
+                                              cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDMolFracGas(int n,
+                                                      const double* phi,
+                                                      const double* sl,
+                                                      const double* nl,
+                                                      const double* si,
+                                                      const double* ni,
+                                                      const double* sg,
+                                                      const double* ng,
+                                                      const double* omega,
+                                                      const double* cv,
+                                                      double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDMolFracGas(phi[i],
+                                         sl[i],
+                                         nl[i],
+                                         si[i],
+                                         ni[i],
+                                         sg[i],
+                                         ng[i],
+                                         omega[i],
+                                         cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::DWaterContentDCellVolume(int n,
+                                                      const double* phi,
+                                                      const double* sl,
+                                                      const double* nl,
+                                                      const double* si,
+                                                      const double* ni,
+                                                      const double* sg,
+                                                      const double* ng,
+                                                      const double* omega,
+                                                      const double* cv,
+                                                      double* result) const
+{
+  for (int i = 0; i != n; ++i)
+    result[i] = DWaterContentDCellVolume(phi[i],
+                                         sl[i],
+                                         nl[i],
+                                         si[i],
+                                         ni[i],
+                                         sg[i],
+                                         ng[i],
+                                         omega[i],
+                                         cv[i]);
+}
+
+void
+ThreePhaseWaterContentModel::WaterContentAndDerivatives(int n,
+                                                        const double* phi,
+                                                        const double* sl,
+                                                        const double* nl,
+                                                        const double* si,
+                                                        const double* ni,
+                                                        const double* sg,
+                                                        const double* ng,
+                                                        const double* omega,
+                                                        const double* cv,
+                                                        double* result,
+                                                        double* dresult_dphi,
+                                                        double* dresult_dsl,
+                                                        double* dresult_dnl,
+                                                        double* dresult_dsi,
+                                                        double* dresult_dni,
+                                                        double* dresult_dsg,
+                                                        double* dresult_dng,
+                                                        double* dresult_domega,
+                                                        double* dresult_dcv) const
+{
+  for (int i = 0; i != n; ++i) {
+    const double x0 = ng[i] * omega[i];
+    const double x1 = ni[i] * si[i] + nl[i] * sl[i] + sg[i] * x0;
+    const double x2 = cv[i] * x1;
+    const double x3 = cv[i] * phi[i];
+    const double x4 = sg[i] * x3;
+    if (result) result[i] = phi[i] * x2;
+    if (dresult_dphi) dresult_dphi[i] = x2;
+    if (dresult_dsl) dresult_dsl[i] = nl[i] * x3;
+    if (dresult_dnl) dresult_dnl[i] = sl[i] * x3;
+    if (dresult_dsi) dresult_dsi[i] = ni[i] * x3;
+    if (dresult_dni) dresult_dni[i] = si[i] * x3;
+    if (dresult_dsg) dresult_dsg[i] = x0 * x3;
+    if (dresult_dng) dresult_dng[i] = omega[i] * x4;
+    if (dresult_domega) dresult_domega[i] = ng[i] * x4;
+    if (dresult_dcv) dresult_dcv[i] = phi[i] * x1;
+  }
+}
+
 } // namespace Relations
 } // namespace Flow
 } // namespace Amanzi
@@ -0,0 +1,155 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "monotone_cubic_table.hh"
+
+using namespace Amanzi::Flow;
+
+namespace {
+
+// a van Genuchten-like curve, monotone decreasing in log(pc)
+double
+curve(double log_pc)
+{
+  return std::pow(1. + std::pow(2.e-4 * std::exp(log_pc), 1.6), -0.375);
+}
+
+std::vector<double>
+uniformGrid(double x0, double x1, int n)
+{
+  std::vector<double> x;
+  for (int i = 0; i != n; ++i) x.push_back(x0 + i * (x1 - x0) / (n - 1));
+  return x;
+}
+
+bool
+withinTolerance(double approx, double exact, double rtol, double atol)
+{
+  return std::abs(approx - exact) <= atol + rtol * std::abs(exact);
+}
+
+} // namespace
+
+
+// Refinement only bisects, so the initial nodes remain nodes, where the table
+// is exact, and the midpoint of each initial interval is either a node or the
+// midpoint of a final interval, where the tolerance is checked.
+TEST(MONOTONE_CUBIC_TABLE_NODES_AND_MIDPOINTS)
+{
+  double rtol = 1.e-6, atol = 1.e-10;
+  auto x = uniformGrid(std::log(1.e-2), std::log(1.e8), 11);
+
+  MonotoneCubicTable table;
+  table.Setup(curve, x, rtol, atol, 100000);
+  CHECK(table.size() > x.size());
+  CHECK_EQUAL(x.front(), table.x_min());
+  CHECK_EQUAL(x.back(), table.x_max());
+
+  for (int i = 0; i != x.size(); ++i) {
+    CHECK_EQUAL(curve(x[i]), table(x[i]));
+    if (i + 1 < x.size()) {
+      double xm = x[i] + 0.5 * (x[i + 1] - x[i]);
+      CHECK(withinTolerance(table(xm), curve(xm), rtol, atol));
+    }
+  }
+}
+
+
+// PCHIP slopes keep the interpolant of monotone data monotone, and the
+// derivative is that of the interpolant.
+TEST(MONOTONE_CUBIC_TABLE_MONOTONE_AND_DERIVATIVE)
+{
+  auto x = uniformGrid(std::log(1.e-2), std::log(1.e8), 41);
+  MonotoneCubicTable table;
+  table.Setup(curve, x, 1.e-6, 1.e-10, 100000);
+
+  int n = 20000;
+  double prev = table(table.x_min());
+  for (int i = 1; i <= n; ++i) {
+    double xi = table.x_min() + i * (table.x_max() - table.x_min()) / n;
+    double v = table(xi);
+    CHECK(v <= prev);
+    prev = v;
+  }
+
+  double h = 1.e-6;
+  for (double xi : { 0.3, 4.1, 7.7, 12.9 }) {
+    double fd = (table(xi + h) - table(xi - h)) / (2 * h);
+    CHECK_CLOSE(fd, table.Derivative(xi), 1.e-6);
+    CHECK(table.Derivative(xi) <= 0.);
+  }
+}
+
+
+TEST(MONOTONE_CUBIC_TABLE_SIZE_LIMIT)
+{
+  auto x = uniformGrid(std::log(1.e-2), std::log(1.e8), 3);
+  MonotoneCubicTable table;
+  CHECK_THROW(table.Setup(curve, x, 1.e-12, 0., 10), std::exception);
+}
+
+
+// As in 1D, initial nodes remain nodes, and the edge midpoints and centers of
+// initial cells are nodes, edge midpoints, or centers of final cells.
+TEST(MONOTONE_BICUBIC_TABLE_NODES_AND_MIDPOINTS)
+{
+  double rtol = 1.e-5, atol = 1.e-8;
+  auto func = [](double x, double y, double* vals) {
+    vals[0] = curve(x) * (1. - 0.5 * curve(y));
+    vals[1] = 0.5 * curve(y) * (1. - 0.2 * curve(x));
+  };
+  auto x = uniformGrid(0., std::log(1.e8), 9);
+  auto y = uniformGrid(0., std::log(1.e8), 7);
+
+  MonotoneBicubicTable table;
+  table.Setup(func, 2, x, y, rtol, atol, 4000000);
+  CHECK(table.size() > x.size() * y.size());
+
+  double vals[2], exact[2];
+  for (int i = 0; i != x.size(); ++i) {
+    for (int j = 0; j != y.size(); ++j) {
+      func(x[i], y[j], exact);
+      table.Evaluate(x[i], y[j], vals);
+      for (int k = 0; k != 2; ++k) CHECK_EQUAL(exact[k], vals[k]);
+    }
+  }
+
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i != x.size(); ++i) {
+    for (int j = 0; j != y.size(); ++j) {
+      double xm = i + 1 < x.size() ? (x[i] + x[i + 1]) / 2. : x[i];
+      double ym = j + 1 < y.size() ? (y[j] + y[j + 1]) / 2. : y[j];
+      points.emplace_back(xm, y[j]);
+      points.emplace_back(x[i], ym);
+      points.emplace_back(xm, ym);
+    }
+  }
+  for (const auto& p : points) {
+    func(p.first, p.second, exact);
+    table.Evaluate(p.first, p.second, vals);
+    for (int k = 0; k != 2; ++k) CHECK(withinTolerance(vals[k], exact[k], rtol, atol));
+  }
+
+  // derivatives are those of the interpolant
+  double h = 1.e-6;
+  double dx[2], dy[2], vp[2], vm[2];
+  for (const auto& p : { std::make_pair(5.3, 7.1), std::make_pair(11.2, 2.9) }) {
+    table.EvaluateDerivatives(p.first, p.second, dx, dy);
+    table.Evaluate(p.first + h, p.second, vp);
+    table.Evaluate(p.first - h, p.second, vm);
+    for (int k = 0; k != 2; ++k) CHECK_CLOSE((vp[k] - vm[k]) / (2 * h), dx[k], 1.e-6);
+    table.Evaluate(p.first, p.second + h, vp);
+    table.Evaluate(p.first, p.second - h, vm);
+    for (int k = 0; k != 2; ++k) CHECK_CLOSE((vp[k] - vm[k]) / (2 * h), dy[k], 1.e-6);
+  }
+}
@@ -0,0 +1,72 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <vector>
+#include "UnitTest++.h"
+
+#include "wrm_van_genuchten.hh"
+#include "wrm_brooks_corey.hh"
+
+namespace {
+
+// Batched methods must match the pointwise ones across the saturated,
+// smoothed, and unsaturated ranges.
+void
+checkBatch(Amanzi::Flow::WRM& wrm, double fused_tol)
+{
+  std::vector<double> pc = { -1.e5, -1., 0., 1., 10., 100., 1.e3, 1.e4, 1.e5, 1.e6 };
+  int n = pc.size();
+  std::vector<double> s(n), ds(n), s_f(n), ds_f(n);
+
+  wrm.saturation_batch(pc.data(), s.data(), n);
+  wrm.d_saturation_batch(pc.data(), ds.data(), n);
+  wrm.saturation_and_derivative_batch(pc.data(), s_f.data(), ds_f.data(), n);
+  for (int i = 0; i != n; ++i) {
+    CHECK_EQUAL(wrm.saturation(pc[i]), s[i]);
+    CHECK_EQUAL(wrm.d_saturation(pc[i]), ds[i]);
+    CHECK_CLOSE(s[i], s_f[i], fused_tol);
+    CHECK_CLOSE(ds[i], ds_f[i], fused_tol);
+  }
+
+  std::vector<double> sat = { 0.5, 0.6, 0.7, 0.8, 0.9, 0.95, 0.99, 1.0 };
+  int m = sat.size();
+  std::vector<double> kr(m), dkr(m);
+  wrm.k_relative_batch(sat.data(), kr.data(), m);
+  wrm.d_k_relative_batch(sat.data(), dkr.data(), m);
+  for (int i = 0; i != m; ++i) {
+    CHECK_EQUAL(wrm.k_relative(sat[i]), kr[i]);
+    CHECK_EQUAL(wrm.d_k_relative(sat[i]), dkr[i]);
+  }
+}
+
+} // namespace
+
+
+TEST(vanGenuchten_batch)
+{
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten m [-]", 0.5);
+  plist.set("van Genuchten alpha [Pa^-1]", 1.e-4);
+  plist.set("residual saturation [-]", 0.1);
+  plist.set("smoothing interval width [saturation]", 0.05);
+  Amanzi::Flow::WRMVanGenuchten vG(plist);
+  checkBatch(vG, 1.e-12);
+}
+
+
+TEST(BrooksCorey_batch)
+{
+  Teuchos::ParameterList plist;
+  plist.set("Brooks Corey lambda [-]", 0.3);
+  plist.set("Brooks Corey saturated matric suction [Pa]", 100.);
+  plist.set("residual saturation [-]", 0.1);
+  plist.set("smoothing interval width [saturation]", 0.05);
+  Amanzi::Flow::WRMBrooksCorey bc(plist);
+  checkBatch(bc, 1.e-12);
+}
@@ -0,0 +1,225 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "wrm_van_genuchten.hh"
+#include "wrm_van_genuchten_reg.hh"
+#include "wrm_tabulated.hh"
+#include "wrm_tabulated_permafrost_model.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::Flow;
+
+namespace {
+
+bool
+withinTolerance(double approx, double exact, double rtol, double atol)
+{
+  return std::abs(approx - exact) <= atol + rtol * std::abs(exact);
+}
+
+Teuchos::ParameterList
+vanGenuchtenList()
+{
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten alpha [Pa^-1]", 2.e-4);
+  plist.set("van Genuchten m [-]", 0.4);
+  plist.set("residual saturation [-]", 0.1);
+  plist.set("smoothing interval width [saturation]", 0.05);
+  return plist;
+}
+
+// A smooth permafrost model, in terms of the logs of the capillary pressures.
+class SmoothPermafrostModel : public WRMPermafrostModel {
+ public:
+  explicit SmoothPermafrostModel(Teuchos::ParameterList& plist) : WRMPermafrostModel(plist) {}
+
+  virtual bool freezing(double T, double pc_liq, double pc_ice) { return pc_ice > pc_liq; }
+
+  virtual void saturations(double pc_liq, double pc_ice, double (&sats)[3])
+  {
+    double u = std::log(pc_liq), v = std::log(pc_ice);
+    sats[1] = 0.5 * (1. - std::tanh((u + v - 20.) / 8.));
+    sats[2] = (1. - sats[1]) * 0.5 * (1. + std::tanh((v - u) / 8.));
+    sats[0] = 1. - sats[1] - sats[2];
+  }
+
+  virtual void dsaturations_dpc_liq(double pc_liq, double pc_ice, double (&dsats)[3])
+  {
+    double dsats_du[3], dsats_dv[3];
+    dsaturations_(pc_liq, pc_ice, dsats_du, dsats_dv);
+    for (int k = 0; k != 3; ++k) dsats[k] = dsats_du[k] / pc_liq;
+  }
+
+  virtual void dsaturations_dpc_ice(double pc_liq, double pc_ice, double (&dsats)[3])
+  {
+    double dsats_du[3], dsats_dv[3];
+    dsaturations_(pc_liq, pc_ice, dsats_du, dsats_dv);
+    for (int k = 0; k != 3; ++k) dsats[k] = dsats_dv[k] / pc_ice;
+  }
+
+ private:
+  void dsaturations_(double pc_liq, double pc_ice, double* dsats_du, double* dsats_dv)
+  {
+    double u = std::log(pc_liq), v = std::log(pc_ice);
+    double tl = std::tanh((u + v - 20.) / 8.), ti = std::tanh((v - u) / 8.);
+    double sl = 0.5 * (1. - tl);
+    double dsl = -0.5 * (1. - tl * tl) / 8.;
+    double fi = 0.5 * (1. + ti);
+    double dfi = 0.5 * (1. - ti * ti) / 8.;
+    dsats_du[1] = dsl;
+    dsats_dv[1] = dsl;
+    dsats_du[2] = -dsl * fi - (1. - sl) * dfi;
+    dsats_dv[2] = -dsl * fi + (1. - sl) * dfi;
+    dsats_du[0] = -dsats_du[1] - dsats_du[2];
+    dsats_dv[0] = -dsats_dv[1] - dsats_dv[2];
+  }
+
+  static Utils::RegisteredFactory<WRMPermafrostModel, SmoothPermafrostModel> factory_;
+};
+
+Utils::RegisteredFactory<WRMPermafrostModel, SmoothPermafrostModel>
+  SmoothPermafrostModel::factory_("test smooth permafrost model");
+
+} // namespace
+
+
+// Tables are exact at their initial nodes, and within tolerance at the
+// midpoints of the initial intervals, which are either nodes or midpoints of
+// refined intervals.  See the table's default initial grids.
+TEST(WRM_TABULATED_MATCHES_WRAPPED)
+{
+  double rtol = 1.e-6, atol = 1.e-10;
+  auto vg_plist = vanGenuchtenList();
+  WRMVanGenuchten vg(vg_plist);
+
+  auto plist = vanGenuchtenList();
+  plist.set<std::string>("WRM type", "tabulated");
+  plist.set<std::string>("tabulated WRM type", "van Genuchten");
+  plist.set("relative tolerance [-]", rtol);
+  plist.set("absolute tolerance [-]", atol);
+  WRMTabulated wrm(plist);
+
+  // saturation, in log(pc) from 1.e-2 to 1.e8 Pa, with four points per decade
+  double log_pc_min = std::log(1.e-2), log_pc_max = std::log(1.e8);
+  int n_x = 41;
+  for (int i = 0; i != n_x; ++i) {
+    double x = log_pc_min + i * (log_pc_max - log_pc_min) / (n_x - 1);
+    double pc = std::exp(x);
+    // exact up to the rounding of log(exp(x))
+    CHECK_CLOSE(vg.saturation(pc), wrm.saturation(pc), 1.e-12);
+    if (i + 1 < n_x) {
+      double pc_mid = std::exp(x + 0.5 * (log_pc_max - log_pc_min) / (n_x - 1));
+      CHECK(withinTolerance(wrm.saturation(pc_mid), vg.saturation(pc_mid), rtol, atol + 1.e-12));
+
+      // the derivative is that of the table, not held to the tolerance, and
+      // checked to within the rounding error of the difference
+      double h = 1.e-6 * pc_mid;
+      double fd = (wrm.saturation(pc_mid + h) - wrm.saturation(pc_mid - h)) / (2 * h);
+      CHECK_CLOSE(fd, wrm.d_saturation(pc_mid), 1.e-5 * std::abs(fd) + 1.e-15 / h);
+    }
+  }
+
+  // relative permeability and capillary pressure, in saturation, from 33
+  // points away from residual and full saturation
+  double sr = vg.residualSaturation();
+  double s_min = sr + 1.e-4 * (1. - sr);
+  double s_max = 1. - 1.e-4 * (1. - sr);
+  for (int i = 0; i != 33; ++i) {
+    double s = s_min + i * (s_max - s_min) / 32;
+    CHECK_EQUAL(vg.k_relative(s), wrm.k_relative(s));
+    CHECK_EQUAL(vg.capillaryPressure(s), wrm.capillaryPressure(s));
+    if (i + 1 < 33) {
+      double s_mid = s + 0.5 * ((s_min + (i + 1) * (s_max - s_min) / 32) - s);
+      CHECK(withinTolerance(wrm.k_relative(s_mid), vg.k_relative(s_mid), rtol, atol));
+      CHECK(withinTolerance(
+        wrm.capillaryPressure(s_mid), vg.capillaryPressure(s_mid), rtol, atol));
+    }
+  }
+
+  // outside of the tables, the wrapped WRM is called directly
+  for (double pc : { -1.e4, 0., 1.e-3, 1.e9 }) {
+    CHECK_EQUAL(vg.saturation(pc), wrm.saturation(pc));
+    CHECK_EQUAL(vg.d_saturation(pc), wrm.d_saturation(pc));
+  }
+  for (double s : { sr, 1. }) {
+    CHECK_EQUAL(vg.k_relative(s), wrm.k_relative(s));
+    CHECK_EQUAL(vg.capillaryPressure(s), wrm.capillaryPressure(s));
+  }
+  CHECK_EQUAL(vg.residualSaturation(), wrm.residualSaturation());
+}
+
+
+TEST(WRM_TABULATED_PERMAFROST_MATCHES_WRAPPED)
+{
+  double rtol = 1.e-5, atol = 1.e-7;
+  Teuchos::ParameterList model_plist;
+  SmoothPermafrostModel model(model_plist);
+
+  Teuchos::ParameterList plist;
+  plist.set<std::string>("permafrost WRM type", "tabulated permafrost model");
+  plist.set<std::string>("tabulated permafrost WRM type", "test smooth permafrost model");
+  plist.set("relative tolerance [-]", rtol);
+  plist.set("absolute tolerance [-]", atol);
+  WRMTabulatedPermafrostModel tabulated(plist);
+  tabulated.set_WRM(Teuchos::null);
+
+  // the initial grid, in log(pc) from 1 to 1.e8 Pa, with two points per decade
+  double log_pc_max = std::log(1.e8);
+  int n_x = 17;
+  std::vector<double> x;
+  for (int i = 0; i != n_x; ++i) x.push_back(i * log_pc_max / (n_x - 1));
+
+  double sats[3], exact[3];
+  for (int i = 0; i != n_x; ++i) {
+    for (int j = 0; j != n_x; ++j) {
+      double pc_liq = std::exp(x[i]), pc_ice = std::exp(x[j]);
+      tabulated.saturations(pc_liq, pc_ice, sats);
+      model.saturations(pc_liq, pc_ice, exact);
+      for (int k = 0; k != 3; ++k) CHECK_CLOSE(exact[k], sats[k], 1.e-12);
+
+      // edge midpoints and cell centers
+      double xm = i + 1 < n_x ? (x[i] + x[i + 1]) / 2. : x[i];
+      double ym = j + 1 < n_x ? (x[j] + x[j + 1]) / 2. : x[j];
+      for (const auto& p : { std::make_pair(xm, x[j]), std::make_pair(x[i], ym),
+                             std::make_pair(xm, ym) }) {
+        pc_liq = std::exp(p.first);
+        pc_ice = std::exp(p.second);
+        tabulated.saturations(pc_liq, pc_ice, sats);
+        model.saturations(pc_liq, pc_ice, exact);
+        for (int k = 1; k != 3; ++k) {
+          CHECK(withinTolerance(sats[k], exact[k], rtol, atol + 1.e-12));
+        }
+        CHECK_CLOSE(1., sats[0] + sats[1] + sats[2], 1.e-14);
+      }
+    }
+  }
+
+  // derivatives are those of the table, in pc rather than log(pc)
+  double dsats[3], dexact[3];
+  for (const auto& p : { std::make_pair(3.e2, 5.e5), std::make_pair(2.e6, 4.e1) }) {
+    double pc_liq = p.first, pc_ice = p.second;
+    tabulated.dsaturations_dpc_liq(pc_liq, pc_ice, dsats);
+    model.dsaturations_dpc_liq(pc_liq, pc_ice, dexact);
+    for (int k = 0; k != 3; ++k) CHECK_CLOSE(dexact[k], dsats[k], 1.e-3 * std::abs(dexact[k]) + 1.e-12);
+    tabulated.dsaturations_dpc_ice(pc_liq, pc_ice, dsats);
+    model.dsaturations_dpc_ice(pc_liq, pc_ice, dexact);
+    for (int k = 0; k != 3; ++k) CHECK_CLOSE(dexact[k], dsats[k], 1.e-3 * std::abs(dexact[k]) + 1.e-12);
+  }
+
+  // outside of the table, the wrapped model is called directly
+  for (const auto& p : { std::make_pair(0.5, 1.e3), std::make_pair(1.e3, 2.e8) }) {
+    tabulated.saturations(p.first, p.second, sats);
+    model.saturations(p.first, p.second, exact);
+    for (int k = 0; k != 3; ++k) CHECK_EQUAL(exact[k], sats[k]);
+  }
+}
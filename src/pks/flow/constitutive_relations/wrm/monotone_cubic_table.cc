@@ -0,0 +1,387 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Adaptively refined, monotone cubic interpolation tables.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "dbc.hh"
+#include "errors.hh"
+
+#include "monotone_cubic_table.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+namespace {
+
+// Fritsch-Carlson (PCHIP) slopes of the data f, sampled at x, where f and d
+// are strided arrays.  Interior slopes are the weighted harmonic mean of the
+// neighboring secants, or zero at extrema; end slopes are the secants.
+void
+pchipSlopes(const std::vector<double>& x, const double* f, double* d, int stride)
+{
+  int n = x.size();
+  double h_prev = x[1] - x[0];
+  double del_prev = (f[stride] - f[0]) / h_prev;
+  d[0] = del_prev;
+  for (int k = 1; k < n - 1; ++k) {
+    double h = x[k + 1] - x[k];
+    double del = (f[(k + 1) * stride] - f[k * stride]) / h;
+    if (del_prev * del <= 0.) {
+      d[k * stride] = 0.;
+    } else {
+      double w1 = 2 * h + h_prev;
+      double w2 = h + 2 * h_prev;
+      d[k * stride] = (w1 + w2) / (w1 / del_prev + w2 / del);
+    }
+    h_prev = h;
+    del_prev = del;
+  }
+  d[(n - 1) * stride] = del_prev;
+}
+
+
+// index of the interval of x containing v, clamped to the table
+int
+findInterval(const std::vector<double>& x, double v)
+{
+  int i = std::upper_bound(x.begin(), x.end(), v) - x.begin() - 1;
+  return std::min(std::max(i, 0), (int)x.size() - 2);
+}
+
+
+// cubic Hermite basis functions on [0,1] and their derivatives
+struct HermiteBasis {
+  HermiteBasis(double t)
+  {
+    double t2 = t * t;
+    double t3 = t2 * t;
+    h00 = 2 * t3 - 3 * t2 + 1;
+    h10 = t3 - 2 * t2 + t;
+    h01 = -2 * t3 + 3 * t2;
+    h11 = t3 - t2;
+    dh00 = 6 * t2 - 6 * t;
+    dh10 = 3 * t2 - 4 * t + 1;
+    dh01 = -6 * t2 + 6 * t;
+    dh11 = 3 * t2 - 2 * t;
+  }
+  double h00, h10, h01, h11;
+  double dh00, dh10, dh01, dh11;
+};
+
+
+bool
+withinTolerance(double approx, double exact, double rtol, double atol)
+{
+  return std::abs(approx - exact) <= atol + rtol * std::abs(exact);
+}
+
+
+// sorted, unique copy of a grid with at least two points
+std::vector<double>
+initialGrid(const std::vector<double>& x_initial)
+{
+  std::vector<double> x(x_initial);
+  std::sort(x.begin(), x.end());
+  x.erase(std::unique(x.begin(), x.end()), x.end());
+  if (x.size() < 2) {
+    Errors::Message msg("MonotoneCubicTable: initial grid must contain at least two distinct points.");
+    Exceptions::amanzi_throw(msg);
+  }
+  return x;
+}
+
+} // namespace
+
+
+// -----------------------------------------------------------------------------
+// 1D table
+// -----------------------------------------------------------------------------
+void
+MonotoneCubicTable::Setup(const std::function<double(double)>& func,
+                          const std::vector<double>& x_initial,
+                          double rtol,
+                          double atol,
+                          int max_size)
+{
+  x_ = initialGrid(x_initial);
+  f_.resize(x_.size());
+  for (int i = 0; i != x_.size(); ++i) f_[i] = func(x_[i]);
+
+  const double check_points[3] = { 0.25, 0.5, 0.75 };
+  while (true) {
+    ComputeSlopes_();
+
+    // find intervals that do not meet the tolerance
+    std::vector<bool> refine(x_.size() - 1, false);
+    int n_refine = 0;
+    for (int i = 0; i != x_.size() - 1; ++i) {
+      for (double q : check_points) {
+        double x = x_[i] + q * (x_[i + 1] - x_[i]);
+        if (!withinTolerance((*this)(x), func(x), rtol, atol)) {
+          refine[i] = true;
+          ++n_refine;
+          break;
+        }
+      }
+    }
+    if (n_refine == 0) return;
+
+    if (x_.size() + n_refine > max_size) {
+      Errors::Message msg;
+      msg << "MonotoneCubicTable: unable to meet tolerance (rtol = " << rtol << ", atol = " << atol
+          << ") within " << max_size << " points.";
+      Exceptions::amanzi_throw(msg);
+    }
+
+    // bisect them
+    std::vector<double> x_new, f_new;
+    x_new.reserve(x_.size() + n_refine);
+    f_new.reserve(x_.size() + n_refine);
+    for (int i = 0; i != x_.size(); ++i) {
+      x_new.push_back(x_[i]);
+      f_new.push_back(f_[i]);
+      if (i < refine.size() && refine[i]) {
+        double x = (x_[i] + x_[i + 1]) / 2.;
+        x_new.push_back(x);
+        f_new.push_back(func(x));
+      }
+    }
+    x_ = std::move(x_new);
+    f_ = std::move(f_new);
+  }
+}
+
+
+double
+MonotoneCubicTable::operator()(double x) const
+{
+  int i = Interval_(x);
+  double h = x_[i + 1] - x_[i];
+  HermiteBasis b((x - x_[i]) / h);
+  return b.h00 * f_[i] + b.h10 * h * d_[i] + b.h01 * f_[i + 1] + b.h11 * h * d_[i + 1];
+}
+
+
+double
+MonotoneCubicTable::Derivative(double x) const
+{
+  int i = Interval_(x);
+  double h = x_[i + 1] - x_[i];
+  HermiteBasis b((x - x_[i]) / h);
+  return (b.dh00 * f_[i] + b.dh01 * f_[i + 1]) / h + b.dh10 * d_[i] + b.dh11 * d_[i + 1];
+}
+
+
+int
+MonotoneCubicTable::Interval_(double x) const
+{
+  return findInterval(x_, x);
+}
+
+
+void
+MonotoneCubicTable::ComputeSlopes_()
+{
+  d_.resize(x_.size());
+  pchipSlopes(x_, f_.data(), d_.data(), 1);
+}
+
+
+// -----------------------------------------------------------------------------
+// 2D table
+// -----------------------------------------------------------------------------
+void
+MonotoneBicubicTable::Setup(const std::function<void(double, double, double*)>& func,
+                            int n_vals,
+                            const std::vector<double>& x_initial,
+                            const std::vector<double>& y_initial,
+                            double rtol,
+                            double atol,
+                            int max_size)
+{
+  n_vals_ = n_vals;
+  x_ = initialGrid(x_initial);
+  y_ = initialGrid(y_initial);
+
+  // Cache function evaluations: check points at cell centers and edge
+  // midpoints become grid nodes when a cell is bisected, and unrefined cells
+  // are rechecked on every pass.
+  std::map<std::pair<double, double>, std::vector<double>> cache;
+  auto eval = [&](double x, double y, double* vals) {
+    auto& cached = cache[std::make_pair(x, y)];
+    if (cached.empty()) {
+      cached.resize(n_vals_);
+      func(x, y, cached.data());
+    }
+    std::copy(cached.begin(), cached.end(), vals);
+  };
+
+  f_.resize(x_.size() * y_.size() * n_vals_);
+  for (int i = 0; i != x_.size(); ++i) {
+    for (int j = 0; j != y_.size(); ++j) eval(x_[i], y_[j], &F_(i, j, 0));
+  }
+
+  std::vector<double> exact(n_vals_), approx(n_vals_);
+  auto fails = [&](double x, double y) {
+    eval(x, y, exact.data());
+    Evaluate(x, y, approx.data());
+    for (int k = 0; k != n_vals_; ++k) {
+      if (!withinTolerance(approx[k], exact[k], rtol, atol)) return true;
+    }
+    return false;
+  };
+
+  while (true) {
+    ComputeSlopes_();
+    int nx = x_.size();
+    int ny = y_.size();
+
+    // find intervals in each direction that do not meet the tolerance
+    std::vector<bool> refine_x(nx - 1, false), refine_y(ny - 1, false);
+    for (int i = 0; i != nx - 1; ++i) {
+      double xm = (x_[i] + x_[i + 1]) / 2.;
+      for (int j = 0; j != ny && !refine_x[i]; ++j) {
+        if (fails(xm, y_[j])) refine_x[i] = true;
+      }
+    }
+    for (int j = 0; j != ny - 1; ++j) {
+      double ym = (y_[j] + y_[j + 1]) / 2.;
+      for (int i = 0; i != nx && !refine_y[j]; ++i) {
+        if (fails(x_[i], ym)) refine_y[j] = true;
+      }
+    }
+    for (int i = 0; i != nx - 1; ++i) {
+      for (int j = 0; j != ny - 1; ++j) {
+        if (refine_x[i] && refine_y[j]) continue;
+        if (fails((x_[i] + x_[i + 1]) / 2., (y_[j] + y_[j + 1]) / 2.)) {
+          refine_x[i] = true;
+          refine_y[j] = true;
+        }
+      }
+    }
+
+    int n_refine_x = std::count(refine_x.begin(), refine_x.end(), true);
+    int n_refine_y = std::count(refine_y.begin(), refine_y.end(), true);
+    if (n_refine_x == 0 && n_refine_y == 0) return;
+
+    if ((nx + n_refine_x) * (ny + n_refine_y) > max_size) {
+      Errors::Message msg;
+      msg << "MonotoneBicubicTable: unable to meet tolerance (rtol = " << rtol
+          << ", atol = " << atol << ") within " << max_size << " points.";
+      Exceptions::amanzi_throw(msg);
+    }
+
+    // bisect them, then fill the new grid from the cache
+    auto bisect = [](const std::vector<double>& x, const std::vector<bool>& refine) {
+      std::vector<double> x_new;
+      for (int i = 0; i != x.size(); ++i) {
+        x_new.push_back(x[i]);
+        if (i < refine.size() && refine[i]) x_new.push_back((x[i] + x[i + 1]) / 2.);
+      }
+      return x_new;
+    };
+    x_ = bisect(x_, refine_x);
+    y_ = bisect(y_, refine_y);
+
+    f_.resize(x_.size() * y_.size() * n_vals_);
+    for (int i = 0; i != x_.size(); ++i) {
+      for (int j = 0; j != y_.size(); ++j) eval(x_[i], y_[j], &F_(i, j, 0));
+    }
+  }
+}
+
+
+void
+MonotoneBicubicTable::Evaluate(double x, double y, double* vals) const
+{
+  Evaluate_(x, y, vals, nullptr, nullptr);
+}
+
+
+void
+MonotoneBicubicTable::EvaluateDerivatives(double x,
+                                          double y,
+                                          double* dvals_dx,
+                                          double* dvals_dy) const
+{
+  Evaluate_(x, y, nullptr, dvals_dx, dvals_dy);
+}
+
+
+void
+MonotoneBicubicTable::Evaluate_(double x,
+                                double y,
+                                double* vals,
+                                double* dvals_dx,
+                                double* dvals_dy) const
+{
+  int i = findInterval(x_, x);
+  int j = findInterval(y_, y);
+  double hx = x_[i + 1] - x_[i];
+  double hy = y_[j + 1] - y_[j];
+  HermiteBasis bx((x - x_[i]) / hx);
+  HermiteBasis by((y - y_[j]) / hy);
+
+  // value, slope-in-x, and slope-in-y weights of each of the four corners
+  const double Hx[2] = { bx.h00, bx.h01 }, Gx[2] = { bx.h10 * hx, bx.h11 * hx };
+  const double Hy[2] = { by.h00, by.h01 }, Gy[2] = { by.h10 * hy, by.h11 * hy };
+  const double dHx[2] = { bx.dh00 / hx, bx.dh01 / hx }, dGx[2] = { bx.dh10, bx.dh11 };
+  const double dHy[2] = { by.dh00 / hy, by.dh01 / hy }, dGy[2] = { by.dh10, by.dh11 };
+
+  for (int k = 0; k != n_vals_; ++k) {
+    double v = 0., dvdx = 0., dvdy = 0.;
+    for (int a = 0; a != 2; ++a) {
+      for (int b = 0; b != 2; ++b) {
+        double f = F_(i + a, j + b, k);
+        double fx = Fx_(i + a, j + b, k);
+        double fy = Fy_(i + a, j + b, k);
+        double fxy = Fxy_(i + a, j + b, k);
+        v += Hx[a] * Hy[b] * f + Gx[a] * Hy[b] * fx + Hx[a] * Gy[b] * fy + Gx[a] * Gy[b] * fxy;
+        dvdx += dHx[a] * Hy[b] * f + dGx[a] * Hy[b] * fx + dHx[a] * Gy[b] * fy + dGx[a] * Gy[b] * fxy;
+        dvdy += Hx[a] * dHy[b] * f + Gx[a] * dHy[b] * fx + Hx[a] * dGy[b] * fy + Gx[a] * dGy[b] * fxy;
+      }
+    }
+    if (vals) vals[k] = v;
+    if (dvals_dx) dvals_dx[k] = dvdx;
+    if (dvals_dy) dvals_dy[k] = dvdy;
+  }
+}
+
+
+void
+MonotoneBicubicTable::ComputeSlopes_()
+{
+  int nx = x_.size();
+  int ny = y_.size();
+  fx_.resize(f_.size());
+  fy_.resize(f_.size());
+  fxy_.resize(f_.size());
+  for (int k = 0; k != n_vals_; ++k) {
+    // along x, for each y node
+    for (int j = 0; j != ny; ++j) {
+      int start = j * n_vals_ + k;
+      pchipSlopes(x_, &f_[start], &fx_[start], ny * n_vals_);
+    }
+    // along y, for each x node, and the cross derivative as the slope of fx
+    for (int i = 0; i != nx; ++i) {
+      int start = i * ny * n_vals_ + k;
+      pchipSlopes(y_, &f_[start], &fy_[start], n_vals_);
+      pchipSlopes(y_, &fx_[start], &fxy_[start], n_vals_);
+    }
+  }
+}
+
+} // namespace Flow
+} // namespace Amanzi
@@ -0,0 +1,112 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Adaptively refined, monotone cubic interpolation tables.
+/*!
+
+Tables of expensive functions, used to replace repeated evaluation of WRMs and
+permafrost models by lookup.
+
+MonotoneCubicTable is a piecewise cubic Hermite interpolant of a function of
+one variable, with slopes chosen by the Fritsch-Carlson (PCHIP) method so that
+the interpolant is monotone wherever the data is.  MonotoneBicubicTable is the
+tensor-product analogue in two variables, using PCHIP slopes along each grid
+line (the cross derivative is the PCHIP slope in y of the slopes in x), and
+interpolating several values at once.
+
+Both are built from an initial grid, which is refined by bisecting every
+interval in which the interpolant differs from the function by more than
+atol + rtol * abs(f) at any check point (the quarter points of each interval,
+or the centers and edge midpoints of each cell in 2D).  Refinement repeats
+until all check points pass, so the error bound is verified on the final
+table.  If that requires more than the allowed number of grid points, Setup()
+throws.
+
+*/
+
+#ifndef AMANZI_FLOW_RELATIONS_MONOTONE_CUBIC_TABLE_HH_
+#define AMANZI_FLOW_RELATIONS_MONOTONE_CUBIC_TABLE_HH_
+
+#include <functional>
+#include <vector>
+
+namespace Amanzi {
+namespace Flow {
+
+class MonotoneCubicTable {
+ public:
+  MonotoneCubicTable() {}
+
+  void Setup(const std::function<double(double)>& func,
+             const std::vector<double>& x_initial,
+             double rtol,
+             double atol,
+             int max_size);
+
+  // evaluation, valid for x in [x_min(), x_max()]
+  double operator()(double x) const;
+  double Derivative(double x) const;
+
+  double x_min() const { return x_.front(); }
+  double x_max() const { return x_.back(); }
+  bool InRange(double x) const { return !x_.empty() && x >= x_.front() && x <= x_.back(); }
+  int size() const { return x_.size(); }
+
+ private:
+  int Interval_(double x) const;
+  void ComputeSlopes_();
+
+  std::vector<double> x_, f_, d_;
+};
+
+
+class MonotoneBicubicTable {
+ public:
+  MonotoneBicubicTable() : n_vals_(0) {}
+
+  // func(x, y, vals) fills n_vals values at (x, y)
+  void Setup(const std::function<void(double, double, double*)>& func,
+             int n_vals,
+             const std::vector<double>& x_initial,
+             const std::vector<double>& y_initial,
+             double rtol,
+             double atol,
+             int max_size);
+
+  // Evaluation, valid for (x, y) in the table's range.  vals, dvals_dx, and
+  // dvals_dy are each of length n_vals.
+  void Evaluate(double x, double y, double* vals) const;
+  void EvaluateDerivatives(double x, double y, double* dvals_dx, double* dvals_dy) const;
+
+  bool InRange(double x, double y) const
+  {
+    return !x_.empty() && x >= x_.front() && x <= x_.back() && y >= y_.front() && y <= y_.back();
+  }
+  int size() const { return x_.size() * y_.size(); }
+
+ private:
+  // value k at grid node (i,j), and its slopes
+  double& F_(int i, int j, int k) { return f_[(i * y_.size() + j) * n_vals_ + k]; }
+  double F_(int i, int j, int k) const { return f_[(i * y_.size() + j) * n_vals_ + k]; }
+  double Fx_(int i, int j, int k) const { return fx_[(i * y_.size() + j) * n_vals_ + k]; }
+  double Fy_(int i, int j, int k) const { return fy_[(i * y_.size() + j) * n_vals_ + k]; }
+  double Fxy_(int i, int j, int k) const { return fxy_[(i * y_.size() + j) * n_vals_ + k]; }
+
+  void ComputeSlopes_();
+  void Evaluate_(double x, double y, double* vals, double* dvals_dx, double* dvals_dy) const;
+
+  int n_vals_;
+  std::vector<double> x_, y_;
+  std::vector<double> f_, fx_, fy_, fxy_;
+};
+
+} // namespace Flow
+} // namespace Amanzi
+
+#endif
@@ -56,6 +56,31 @@ class WRM {
   virtual double residualSaturation() = 0;
   virtual double suction_head(double saturation) { return 0.; };
   virtual double d_suction_head(double saturation) { return 0.; };
+
+  // Batched versions, evaluating n entries at once.  The defaults loop over
+  // the pointwise methods; models override these with loops that the
+  // compiler can vectorize.
+  virtual void saturation_batch(const double* pc, double* s, int n)
+  {
+    for (int i = 0; i != n; ++i) s[i] = saturation(pc[i]);
+  }
+  virtual void d_saturation_batch(const double* pc, double* dsdpc, int n)
+  {
+    for (int i = 0; i != n; ++i) dsdpc[i] = d_saturation(pc[i]);
+  }
+  virtual void saturation_and_derivative_batch(const double* pc, double* s, double* dsdpc, int n)
+  {
+    saturation_batch(pc, s, n);
+    d_saturation_batch(pc, dsdpc, n);
+  }
+  virtual void k_relative_batch(const double* s, double* kr, int n)
+  {
+    for (int i = 0; i != n; ++i) kr[i] = k_relative(s[i]);
+  }
+  virtual void d_k_relative_batch(const double* s, double* dkrds, int n)
+  {
+    for (int i = 0; i != n; ++i) dkrds[i] = d_k_relative(s[i]);
+  }
 };
 
 typedef double (WRM::*KRelFn)(double pc);
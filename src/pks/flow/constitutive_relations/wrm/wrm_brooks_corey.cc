@@ -8,6 +8,7 @@
            Bo Gao (gaob@ornl.gov)
 */
 
+#include <algorithm>
 #include <cmath>
 #include "dbc.hh"
 #include "errors.hh"
@@ -130,5 +131,91 @@ WRMBrooksCorey::d_capillaryPressure(double s)
   return -b_ * p_sat_ / (1. - sr_) * pow(se, -b_ - 1.);
 }
 
+
+/* ******************************************************************
+ * Batched saturation.  Written as selects rather than branches so that
+ * the loop vectorizes; results are identical to the pointwise method.
+ ****************************************************************** */
+void
+WRMBrooksCorey::saturation_batch(const double* pc, double* s, int n)
+{
+  // local copies, as members could otherwise alias the output
+  const double p_sat = p_sat_, lambda = lambda_, sr = sr_;
+  for (int i = 0; i != n; ++i) {
+    double se = pow(p_sat / std::max(pc[i], p_sat), lambda);
+    s[i] = pc[i] <= p_sat ? 1. : se * (1. - sr) + sr;
+  }
+}
+
+
+/* ******************************************************************
+ * Batched derivative of saturation w.r.t. capillary pressure.
+ ****************************************************************** */
+void
+WRMBrooksCorey::d_saturation_batch(const double* pc, double* dsdpc, int n)
+{
+  const double p_sat = p_sat_, lambda = lambda_, sr = sr_;
+  for (int i = 0; i != n; ++i) {
+    double pc_l = std::max(pc[i], p_sat);
+    double ds = -(1. - sr) * lambda * pow(p_sat / pc_l, lambda) / pc_l;
+    dsdpc[i] = pc[i] <= p_sat ? 0. : ds;
+  }
+}
+
+
+/* ******************************************************************
+ * Fused saturation and derivative, sharing the pow() call.
+ ****************************************************************** */
+void
+WRMBrooksCorey::saturation_and_derivative_batch(const double* pc,
+                                                double* s,
+                                                double* dsdpc,
+                                                int n)
+{
+  const double p_sat = p_sat_, lambda = lambda_, sr = sr_;
+  for (int i = 0; i != n; ++i) {
+    double pc_l = std::max(pc[i], p_sat);
+    double se = pow(p_sat / pc_l, lambda);
+    bool saturated = pc[i] <= p_sat;
+    s[i] = saturated ? 1. : se * (1. - sr) + sr;
+    dsdpc[i] = saturated ? 0. : -(1. - sr) * lambda * se / pc_l;
+  }
+}
+
+
+/* ******************************************************************
+ * Batched relative permeability, identical to the pointwise method.
+ ****************************************************************** */
+void
+WRMBrooksCorey::k_relative_batch(const double* s, double* kr, int n)
+{
+  const double b = b_, sr = sr_, s0 = s0_;
+  for (int i = 0; i != n; ++i) {
+    double se = (s[i] - sr) / (1 - sr);
+    kr[i] = pow(se, 2 * b + 3);
+  }
+  for (int i = 0; i != n; ++i) {
+    if (!(s[i] <= s0)) kr[i] = s[i] == 1. ? 1. : fit_kr_(s[i]);
+  }
+}
+
+
+/* ******************************************************************
+ * Batched derivative of relative permeability w.r.t. saturation.
+ ****************************************************************** */
+void
+WRMBrooksCorey::d_k_relative_batch(const double* s, double* dkrds, int n)
+{
+  const double b = b_, sr = sr_, s0 = s0_;
+  for (int i = 0; i != n; ++i) {
+    double se = (s[i] - sr) / (1 - sr);
+    double dkdse = (2 * b + 3) * pow(se, 2 * b + 2);
+    dkrds[i] = dkdse / (1. - sr);
+  }
+  for (int i = 0; i != n; ++i) {
+    if (!(s[i] <= s0)) dkrds[i] = s[i] == 1. ? 0.0 : fit_kr_.Derivative(s[i]);
+  }
+}
+
 } // namespace Flow
 } // namespace Amanzi
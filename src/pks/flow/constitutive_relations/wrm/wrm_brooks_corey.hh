@@ -68,6 +68,13 @@ class WRMBrooksCorey : public WRM {
   double d_capillaryPressure(double saturation);
   double residualSaturation() { return sr_; }
 
+  // batched methods
+  void saturation_batch(const double* pc, double* s, int n);
+  void d_saturation_batch(const double* pc, double* dsdpc, int n);
+  void saturation_and_derivative_batch(const double* pc, double* s, double* dsdpc, int n);
+  void k_relative_batch(const double* s, double* kr, int n);
+  void d_k_relative_batch(const double* s, double* dkrds, int n);
+
  private:
   void InitializeFromPlist_();
 
@@ -13,14 +13,37 @@
 */
 
 
+#include <algorithm>
+
 #include "wrm_evaluator.hh"
 #include "wrm_factory.hh"
 
 namespace Amanzi {
 namespace Flow {
 
+namespace {
+
+// Evaluate whichever of saturation and its derivative are requested, with a
+// single fused pass when both are.
+void
+evaluateBatch(WRM& wrm, const double* pc, double* s, double* dsdpc, int n)
+{
+  if (s && dsdpc) {
+    wrm.saturation_and_derivative_batch(pc, s, dsdpc, n);
+  } else if (s) {
+    wrm.saturation_batch(pc, s, n);
+  } else {
+    wrm.d_saturation_batch(pc, dsdpc, n);
+  }
+}
+
+} // namespace
+
 WRMEvaluator::WRMEvaluator(Teuchos::ParameterList& plist)
-  : EvaluatorSecondaryMonotypeCV(plist), calc_other_sat_(true)
+  : EvaluatorSecondaryMonotypeCV(plist),
+    calc_other_sat_(true),
+    need_dsat_(false),
+    dsat_valid_(false)
 {
   AMANZI_ASSERT(plist_.isSublist("WRM parameters"));
   Teuchos::ParameterList wrm_plist = plist_.sublist("WRM parameters");
@@ -30,7 +53,7 @@ WRMEvaluator::WRMEvaluator(Teuchos::ParameterList& plist)
 }
 
 WRMEvaluator::WRMEvaluator(Teuchos::ParameterList& plist, const Teuchos::RCP<WRMPartition>& wrms)
-  : EvaluatorSecondaryMonotypeCV(plist), wrms_(wrms)
+  : EvaluatorSecondaryMonotypeCV(plist), wrms_(wrms), need_dsat_(false), dsat_valid_(false)
 {
   InitializeFromPlist_();
 }
@@ -90,40 +113,28 @@ WRMEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& res
   }
 
   Tag tag = my_keys_.front().second;
+  const CompositeVector& pres = *S.GetPtr<CompositeVector>(cap_pres_key_, tag);
   Epetra_MultiVector& sat_c = *results[0]->ViewComponent("cell", false);
-  const Epetra_MultiVector& pres_c =
-    *S.GetPtr<CompositeVector>(cap_pres_key_, tag)->ViewComponent("cell", false);
+  const Epetra_MultiVector& pres_c = *pres.ViewComponent("cell", false);
+  bool has_bfaces = results[0]->HasComponent("boundary_face");
+  int ncells = sat_c.MyLength();
+  int nbfaces = has_bfaces ? results[0]->ViewComponent("boundary_face", false)->MyLength() : 0;
+  if (region_cells_.empty()) InitializeRegions_(*results[0]->Mesh(), ncells, nbfaces);
 
-  // calculate cell values
-  AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c = 0; c != ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->saturation(pres_c[0][c]);
-  }
+  // calculate cell values, and their derivatives if they will be needed
+  if (need_dsat_) dsat_c_.resize(ncells);
+  EvaluateRegions_(
+    region_cells_, pres_c[0], sat_c[0], need_dsat_ ? dsat_c_.data() : nullptr, ncells);
 
   // Potentially do face values as well.
-  if (results[0]->HasComponent("boundary_face")) {
+  if (has_bfaces) {
     Epetra_MultiVector& sat_bf = *results[0]->ViewComponent("boundary_face", false);
-    const Epetra_MultiVector& pres_bf =
-      *S.GetPtr<CompositeVector>(cap_pres_key_, tag)->ViewComponent("boundary_face", false);
-
-    // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    const Epetra_Map& face_map = mesh->face_map(false);
-    AmanziMesh::Entity_ID_List cells;
-
-    // calculate boundary face values
-    int nbfaces = sat_bf.MyLength();
-    for (int bf = 0; bf != nbfaces; ++bf) {
-      // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      int index = (*wrms_->first)[cells[0]];
-      sat_bf[0][bf] = wrms_->second[index]->saturation(pres_bf[0][bf]);
-    }
+    const Epetra_MultiVector& pres_bf = *pres.ViewComponent("boundary_face", false);
+    if (need_dsat_) dsat_bf_.resize(nbfaces);
+    EvaluateRegions_(
+      region_bfaces_, pres_bf[0], sat_bf[0], need_dsat_ ? dsat_bf_.data() : nullptr, nbfaces);
   }
+  dsat_valid_ = need_dsat_;
 
   // If needed, also do gas saturation
   if (calc_other_sat_) {
@@ -160,40 +171,33 @@ WRMEvaluator::EvaluatePartialDerivative_(const State& S,
   }
 
   Tag tag = my_keys_.front().second;
+  const CompositeVector& pres = *S.GetPtr<CompositeVector>(cap_pres_key_, tag);
   Epetra_MultiVector& sat_c = *results[0]->ViewComponent("cell", false);
-  const Epetra_MultiVector& pres_c =
-    *S.GetPtr<CompositeVector>(cap_pres_key_, tag)->ViewComponent("cell", false);
-
-  // calculate cell values
-  AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c = 0; c != ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->d_saturation(pres_c[0][c]);
+  const Epetra_MultiVector& pres_c = *pres.ViewComponent("cell", false);
+  bool has_bfaces = results[0]->HasComponent("boundary_face");
+  int ncells = sat_c.MyLength();
+  int nbfaces = has_bfaces ? results[0]->ViewComponent("boundary_face", false)->MyLength() : 0;
+  if (region_cells_.empty()) InitializeRegions_(*results[0]->Mesh(), ncells, nbfaces);
+
+  // use the derivatives computed with saturation if available, else compute
+  // them now, and from here on compute them with saturation
+  if (dsat_valid_) {
+    std::copy(dsat_c_.begin(), dsat_c_.end(), sat_c[0]);
+  } else {
+    EvaluateRegions_(region_cells_, pres_c[0], nullptr, sat_c[0], ncells);
   }
 
   // Potentially do face values as well.
-  if (results[0]->HasComponent("boundary_face")) {
+  if (has_bfaces) {
     Epetra_MultiVector& sat_bf = *results[0]->ViewComponent("boundary_face", false);
-    const Epetra_MultiVector& pres_bf =
-      *S.GetPtr<CompositeVector>(cap_pres_key_, tag)->ViewComponent("boundary_face", false);
-
-    // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    const Epetra_Map& face_map = mesh->face_map(false);
-    AmanziMesh::Entity_ID_List cells;
-
-    // calculate boundary face values
-    int nbfaces = sat_bf.MyLength();
-    for (int bf = 0; bf != nbfaces; ++bf) {
-      // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      int index = (*wrms_->first)[cells[0]];
-      sat_bf[0][bf] = wrms_->second[index]->d_saturation(pres_bf[0][bf]);
+    if (dsat_valid_) {
+      std::copy(dsat_bf_.begin(), dsat_bf_.end(), sat_bf[0]);
+    } else {
+      const Epetra_MultiVector& pres_bf = *pres.ViewComponent("boundary_face", false);
+      EvaluateRegions_(region_bfaces_, pres_bf[0], nullptr, sat_bf[0], nbfaces);
     }
   }
+  need_dsat_ = true;
 
   // If needed, also do gas saturation
   if (calc_other_sat_) {
@@ -216,5 +220,67 @@ WRMEvaluator::EvaluatePartialDerivative_(const State& S,
 }
 
 
+void
+WRMEvaluator::InitializeRegions_(const AmanziMesh::Mesh& mesh, int ncells, int nbfaces)
+{
+  int nregions = wrms_->second.size();
+  region_cells_.resize(nregions);
+  for (AmanziMesh::Entity_ID c = 0; c != ncells; ++c) {
+    region_cells_[(*wrms_->first)[c]].push_back(c);
+  }
+
+  // Need to get boundary face's inner cell to specify the WRM.
+  region_bfaces_.resize(nregions);
+  const Epetra_Map& vandelay_map = mesh.exterior_face_map(false);
+  const Epetra_Map& face_map = mesh.face_map(false);
+  AmanziMesh::Entity_ID_List cells;
+  for (AmanziMesh::Entity_ID bf = 0; bf != nbfaces; ++bf) {
+    AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
+    mesh.face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    AMANZI_ASSERT(cells.size() == 1);
+    region_bfaces_[(*wrms_->first)[cells[0]]].push_back(bf);
+  }
+}
+
+
+void
+WRMEvaluator::EvaluateRegions_(const std::vector<std::vector<AmanziMesh::Entity_ID>>& region_ents,
+                               const double* pc,
+                               double* s,
+                               double* dsdpc,
+                               int n)
+{
+  int nregions = wrms_->second.size();
+  for (int r = 0; r != nregions; ++r) {
+    const auto& ents = region_ents[r];
+    int n_r = ents.size();
+    if (n_r == 0) continue;
+    auto& wrm = *wrms_->second[r];
+
+    if (n_r == n) {
+      // a single region covers all entities, no need to gather
+      evaluateBatch(wrm, pc, s, dsdpc, n);
+
+    } else {
+      pc_region_.resize(n_r);
+      s_region_.resize(n_r);
+      ds_region_.resize(n_r);
+      for (int i = 0; i != n_r; ++i) pc_region_[i] = pc[ents[i]];
+      evaluateBatch(wrm,
+                    pc_region_.data(),
+                    s ? s_region_.data() : nullptr,
+                    dsdpc ? ds_region_.data() : nullptr,
+                    n_r);
+      if (s) {
+        for (int i = 0; i != n_r; ++i) s[ents[i]] = s_region_[i];
+      }
+      if (dsdpc) {
+        for (int i = 0; i != n_r; ++i) dsdpc[ents[i]] = ds_region_[i];
+      }
+    }
+  }
+}
+
+
 } // namespace Flow
 } // namespace Amanzi
@@ -70,11 +70,35 @@ class WRMEvaluator : public EvaluatorSecondaryMonotypeCV {
     EnsureCompatibility_StructureSame_(S);
   }
 
+  // Build the cells and boundary faces of each region of the partition.
+  void InitializeRegions_(const AmanziMesh::Mesh& mesh, int n_cells, int n_bfaces);
+
+  // Evaluate saturation, its derivative, or both (whichever of s and dsdpc
+  // is non-null) on n entities, region by region of the partition, using the
+  // WRMs' batched methods.
+  void EvaluateRegions_(const std::vector<std::vector<AmanziMesh::Entity_ID>>& region_ents,
+                        const double* pc,
+                        double* s,
+                        double* dsdpc,
+                        int n);
+
  protected:
   Teuchos::RCP<WRMPartition> wrms_;
   bool calc_other_sat_;
   Key cap_pres_key_;
 
+  // cells and boundary faces of each region of the partition, built on first
+  // use, and scratch space for gathering a region's values contiguously
+  std::vector<std::vector<AmanziMesh::Entity_ID>> region_cells_, region_bfaces_;
+  std::vector<double> pc_region_, s_region_, ds_region_;
+
+  // Once a derivative has been requested, Evaluate_ computes it alongside
+  // saturation with the fused batched call, and keeps it until the next
+  // Evaluate_ for EvaluatePartialDerivative_.
+  bool need_dsat_;
+  bool dsat_valid_;
+  std::vector<double> dsat_c_, dsat_bf_;
+
  private:
   static Utils::RegisteredFactory<Evaluator, WRMEvaluator> factory_;
   static Utils::RegisteredFactory<Evaluator, WRMEvaluator> factory2_;
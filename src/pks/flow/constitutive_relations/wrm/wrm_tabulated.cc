@@ -0,0 +1,124 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include "errors.hh"
+
+#include "wrm_factory.hh"
+#include "wrm_tabulated.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+WRMTabulated::WRMTabulated(Teuchos::ParameterList& plist)
+{
+  InitializeFromPlist_(plist);
+};
+
+
+void
+WRMTabulated::InitializeFromPlist_(Teuchos::ParameterList& plist)
+{
+  // create the wrapped WRM from a copy of this list with the type replaced
+  wrm_plist_ = plist;
+  for (const auto& type_name : { "wrm type", "WRM Type", "WRM type" }) {
+    if (wrm_plist_.isParameter(type_name)) wrm_plist_.remove(type_name);
+  }
+  wrm_plist_.set("WRM type", plist.get<std::string>("tabulated WRM type"));
+  if (wrm_plist_.get<std::string>("WRM type") == "tabulated") {
+    Errors::Message msg("WRM: \"tabulated WRM type\" cannot itself be \"tabulated\"");
+    Exceptions::amanzi_throw(msg);
+  }
+  WRMFactory fac;
+  wrm_ = fac.createWRM(wrm_plist_);
+
+  double rtol = plist.get<double>("relative tolerance [-]", 1.e-6);
+  double atol = plist.get<double>("absolute tolerance [-]", 1.e-10);
+  int max_size = plist.get<int>("maximum table size", 100000);
+  double pc_min = plist.get<double>("table minimum capillary pressure [Pa]", 1.e-2);
+  double pc_max = plist.get<double>("table maximum capillary pressure [Pa]", 1.e8);
+  double se_min = plist.get<double>("table minimum effective saturation [-]", 1.e-4);
+  if (pc_min <= 0. || pc_max <= pc_min) {
+    Errors::Message msg("WRM: tabulated capillary pressure range must satisfy 0 < min < max");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // saturation, against log(pc), starting from four points per decade
+  std::vector<double> x;
+  double log_pc_min = std::log(pc_min);
+  double log_pc_max = std::log(pc_max);
+  int n_x = std::max(2, (int)std::ceil(4 * std::log10(pc_max / pc_min)) + 1);
+  for (int i = 0; i != n_x; ++i) x.push_back(log_pc_min + i * (log_pc_max - log_pc_min) / (n_x - 1));
+  sat_.Setup([this](double log_pc) { return wrm_->saturation(std::exp(log_pc)); },
+             x, rtol, atol, max_size);
+
+  // Relative permeability and capillary pressure, against saturation.  Both
+  // may have unbounded slopes at full saturation, and capillary pressure is
+  // singular at residual saturation, so neither end is tabulated.
+  double sr = wrm_->residualSaturation();
+  double s_min = sr + se_min * (1. - sr);
+  double s_max = 1. - se_min * (1. - sr);
+  x.clear();
+  for (int i = 0; i != 33; ++i) x.push_back(s_min + i * (s_max - s_min) / 32);
+  krel_.Setup([this](double s) { return wrm_->k_relative(s); }, x, rtol, atol, max_size);
+  pc_.Setup([this](double s) { return wrm_->capillaryPressure(s); }, x, rtol, atol, max_size);
+}
+
+
+double
+WRMTabulated::k_relative(double s)
+{
+  return krel_.InRange(s) ? krel_(s) : wrm_->k_relative(s);
+}
+
+
+double
+WRMTabulated::d_k_relative(double s)
+{
+  return krel_.InRange(s) ? krel_.Derivative(s) : wrm_->d_k_relative(s);
+}
+
+
+double
+WRMTabulated::saturation(double pc)
+{
+  if (pc > 0.) {
+    double log_pc = std::log(pc);
+    if (sat_.InRange(log_pc)) return sat_(log_pc);
+  }
+  return wrm_->saturation(pc);
+}
+
+
+double
+WRMTabulated::d_saturation(double pc)
+{
+  if (pc > 0.) {
+    double log_pc = std::log(pc);
+    if (sat_.InRange(log_pc)) return sat_.Derivative(log_pc) / pc;
+  }
+  return wrm_->d_saturation(pc);
+}
+
+
+double
+WRMTabulated::capillaryPressure(double s)
+{
+  return pc_.InRange(s) ? pc_(s) : wrm_->capillaryPressure(s);
+}
+
+
+double
+WRMTabulated::d_capillaryPressure(double s)
+{
+  return pc_.InRange(s) ? pc_.Derivative(s) : wrm_->d_capillaryPressure(s);
+}
+
+} // namespace Flow
+} // namespace Amanzi
@@ -0,0 +1,110 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! WRMTabulated : a WRM evaluated by lookup in tables of another WRM.
+/*!
+
+Wraps any other WRM, replacing evaluation of its saturation, relative
+permeability, and capillary pressure curves by lookup in monotone cubic tables
+built at setup.  This is useful for models whose curves are expensive to
+evaluate, e.g. those requiring many calls to pow().
+
+Tables are adaptively refined until the interpolant matches the wrapped WRM to
+within `"absolute tolerance`" + `"relative tolerance`" times the value at check
+points in every interval.  Derivatives are those of the interpolant, so they
+are consistent with the tabulated values but are not themselves held to the
+tolerance.  Outside of the tabulated range, the wrapped WRM is called
+directly.
+
+Saturation is tabulated against the log of capillary pressure, and relative
+permeability and capillary pressure against saturation, for effective
+saturations from the minimum effective saturation to one minus it.  Capillary
+pressure is singular at residual saturation, and both curves may have
+unbounded slopes at full saturation, so these ends are left to the wrapped
+WRM.
+
+.. _WRM-tabulated-spec
+.. admonition:: WRM-tabulated-spec
+
+    * `"region`" ``[string]`` Region to which this applies
+    * `"tabulated WRM type`" ``[string]`` Type of the wrapped WRM, whose
+      parameters are read from this same list.
+    * `"relative tolerance [-]`" ``[double]`` **1.e-6**
+    * `"absolute tolerance [-]`" ``[double]`` **1.e-10**
+    * `"maximum table size`" ``[int]`` **100000** Maximum number of points in
+      each table.  Setup fails if the tolerance cannot be met.
+    * `"table minimum capillary pressure [Pa]`" ``[double]`` **1.e-2**
+    * `"table maximum capillary pressure [Pa]`" ``[double]`` **1.e8**
+    * `"table minimum effective saturation [-]`" ``[double]`` **1.e-4**
+      Distance, in effective saturation, of the ends of the relative
+      permeability and capillary pressure tables from residual and full
+      saturation.
+
+Example:
+
+.. code-block:: xml
+
+    <ParameterList name="moss" type="ParameterList">
+      <Parameter name="region" type="string" value="moss" />
+      <Parameter name="WRM type" type="string" value="tabulated" />
+      <Parameter name="tabulated WRM type" type="string" value="van Genuchten" />
+      <Parameter name="van Genuchten alpha [Pa^-1]" type="double" value="0.002" />
+      <Parameter name="van Genuchten m [-]" type="double" value="0.2" />
+      <Parameter name="residual saturation [-]" type="double" value="0.0" />
+      <Parameter name="smoothing interval width [saturation]" type="double" value=".05" />
+    </ParameterList>
+
+*/
+
+#ifndef ATS_FLOWRELATIONS_WRM_TABULATED_
+#define ATS_FLOWRELATIONS_WRM_TABULATED_
+
+#include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+#include "wrm.hh"
+#include "monotone_cubic_table.hh"
+#include "Factory.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+class WRMTabulated : public WRM {
+ public:
+  explicit WRMTabulated(Teuchos::ParameterList& plist);
+
+  // required methods from the base class
+  double k_relative(double saturation);
+  double d_k_relative(double saturation);
+  double saturation(double pc);
+  double d_saturation(double pc);
+  double capillaryPressure(double saturation);
+  double d_capillaryPressure(double saturation);
+  double residualSaturation() { return wrm_->residualSaturation(); }
+  double suction_head(double saturation) { return wrm_->suction_head(saturation); }
+  double d_suction_head(double saturation) { return wrm_->d_suction_head(saturation); }
+
+ private:
+  void InitializeFromPlist_(Teuchos::ParameterList& plist);
+
+  // WRMs may keep a reference to their list, so it must outlive wrm_
+  Teuchos::ParameterList wrm_plist_;
+  Teuchos::RCP<WRM> wrm_;
+
+  MonotoneCubicTable sat_;  // saturation of log(pc)
+  MonotoneCubicTable krel_; // relative permeability of saturation
+  MonotoneCubicTable pc_;   // capillary pressure of saturation
+
+  static Utils::RegisteredFactory<WRM, WRMTabulated> factory_;
+};
+
+} // namespace Flow
+} // namespace Amanzi
+
+#endif
@@ -0,0 +1,145 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! A permafrost model evaluated by lookup in tables of another permafrost model.
+#include <cmath>
+
+#include "errors.hh"
+
+#include "wrm.hh"
+#include "wrm_tabulated_permafrost_model.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+// Constructor
+WRMTabulatedPermafrostModel::WRMTabulatedPermafrostModel(Teuchos::ParameterList& plist)
+  : WRMPermafrostModel(plist), table_built_(false)
+{
+  // create the wrapped model from a copy of this list with the type replaced
+  Teuchos::ParameterList model_plist(plist);
+  model_plist.set("permafrost WRM type",
+                  plist_.get<std::string>("tabulated permafrost WRM type"));
+  if (model_plist.get<std::string>("permafrost WRM type") == "tabulated permafrost model") {
+    Errors::Message msg(
+      "WRM: \"tabulated permafrost WRM type\" cannot itself be \"tabulated permafrost model\"");
+    Exceptions::amanzi_throw(msg);
+  }
+  // the WRM is not yet known, it is passed on in BuildTable_()
+  WRMPermafrostFactory fac;
+  model_ = fac.createWRMPermafrostModel(model_plist, Teuchos::null);
+}
+
+
+bool
+WRMTabulatedPermafrostModel::freezing(double T, double pc_liq, double pc_ice)
+{
+  if (!table_built_) BuildTable_();
+  return model_->freezing(T, pc_liq, pc_ice);
+}
+
+
+void
+WRMTabulatedPermafrostModel::saturations(double pc_liq, double pc_ice, double (&sats)[3])
+{
+  double x, y;
+  if (InTable_(pc_liq, pc_ice, x, y)) {
+    double vals[2];
+    table_.Evaluate(x, y, vals);
+    sats[1] = vals[0];
+    sats[2] = vals[1];
+    sats[0] = 1. - sats[1] - sats[2];
+  } else {
+    model_->saturations(pc_liq, pc_ice, sats);
+  }
+}
+
+
+void
+WRMTabulatedPermafrostModel::dsaturations_dpc_liq(double pc_liq,
+                                                   double pc_ice,
+                                                   double (&dsats)[3])
+{
+  double x, y;
+  if (InTable_(pc_liq, pc_ice, x, y)) {
+    double dvals_dx[2], dvals_dy[2];
+    table_.EvaluateDerivatives(x, y, dvals_dx, dvals_dy);
+    dsats[1] = dvals_dx[0] / pc_liq;
+    dsats[2] = dvals_dx[1] / pc_liq;
+    dsats[0] = -dsats[1] - dsats[2];
+  } else {
+    model_->dsaturations_dpc_liq(pc_liq, pc_ice, dsats);
+  }
+}
+
+
+void
+WRMTabulatedPermafrostModel::dsaturations_dpc_ice(double pc_liq,
+                                                   double pc_ice,
+                                                   double (&dsats)[3])
+{
+  double x, y;
+  if (InTable_(pc_liq, pc_ice, x, y)) {
+    double dvals_dx[2], dvals_dy[2];
+    table_.EvaluateDerivatives(x, y, dvals_dx, dvals_dy);
+    dsats[1] = dvals_dy[0] / pc_ice;
+    dsats[2] = dvals_dy[1] / pc_ice;
+    dsats[0] = -dsats[1] - dsats[2];
+  } else {
+    model_->dsaturations_dpc_ice(pc_liq, pc_ice, dsats);
+  }
+}
+
+
+bool
+WRMTabulatedPermafrostModel::InTable_(double pc_liq, double pc_ice, double& x, double& y)
+{
+  if (!table_built_) BuildTable_();
+  if (pc_liq <= 0. || pc_ice <= 0.) return false;
+  x = std::log(pc_liq);
+  y = std::log(pc_ice);
+  return table_.InRange(x, y);
+}
+
+
+// The WRM is set after construction, so the table is built on first use.
+void
+WRMTabulatedPermafrostModel::BuildTable_()
+{
+  model_->set_WRM(wrm_);
+
+  double rtol = plist_.get<double>("relative tolerance [-]", 1.e-5);
+  double atol = plist_.get<double>("absolute tolerance [-]", 1.e-7);
+  int max_size = plist_.get<int>("maximum table size", 4000000);
+  double pc_min = plist_.get<double>("table minimum capillary pressure [Pa]", 1.);
+  double pc_max = plist_.get<double>("table maximum capillary pressure [Pa]", 1.e8);
+  if (pc_min <= 0. || pc_max <= pc_min) {
+    Errors::Message msg("WRM: tabulated capillary pressure range must satisfy 0 < min < max");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // two points per decade in each direction to start
+  std::vector<double> x;
+  double log_pc_min = std::log(pc_min);
+  double log_pc_max = std::log(pc_max);
+  int n_x = std::max(2, (int)std::ceil(2 * std::log10(pc_max / pc_min)) + 1);
+  for (int i = 0; i != n_x; ++i) x.push_back(log_pc_min + i * (log_pc_max - log_pc_min) / (n_x - 1));
+
+  auto func = [this](double log_pc_liq, double log_pc_ice, double* vals) {
+    double sats[3];
+    model_->saturations(std::exp(log_pc_liq), std::exp(log_pc_ice), sats);
+    vals[0] = sats[1];
+    vals[1] = sats[2];
+  };
+  table_.Setup(func, 2, x, x, rtol, atol, max_size);
+  table_built_ = true;
+}
+
+} // namespace Flow
+} // namespace Amanzi
@@ -0,0 +1,80 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! A permafrost model evaluated by lookup in tables of another permafrost model.
+/*!
+
+Wraps any other permafrost model, replacing evaluation of the liquid and ice
+saturations in the frozen, unsaturated regime (both capillary pressures
+positive) by lookup in a bicubic table against the logs of the two capillary
+pressures.  This is most useful for the implicit `"permafrost model`", which
+otherwise does an iterative solve for every evaluation.  Gas saturation is one
+minus the other two.
+
+The table is built on first use, and adaptively refined until liquid and ice
+saturations match the wrapped model to within `"absolute tolerance`" +
+`"relative tolerance`" times the value at the center and edge midpoints of
+every table cell.  Derivatives are those of the interpolant.  Outside of the
+tabulated range, the wrapped model is called directly.
+
+.. _wrm-tabulated-permafrost-spec
+.. admonition:: wrm-tabulated-permafrost-spec
+
+    * `"tabulated permafrost WRM type`" ``[string]`` Type of the wrapped
+      permafrost model, whose parameters are read from this same list.
+    * `"relative tolerance [-]`" ``[double]`` **1.e-5**
+    * `"absolute tolerance [-]`" ``[double]`` **1.e-7**
+    * `"maximum table size`" ``[int]`` **4000000** Maximum number of table
+      points.  Setup fails if the tolerance cannot be met.
+    * `"table minimum capillary pressure [Pa]`" ``[double]`` **1.**
+    * `"table maximum capillary pressure [Pa]`" ``[double]`` **1.e8**
+
+*/
+
+#ifndef AMANZI_FLOWRELATIONS_WRM_TABULATED_PERMAFROST_MODEL_
+#define AMANZI_FLOWRELATIONS_WRM_TABULATED_PERMAFROST_MODEL_
+
+#include "wrm_permafrost_model.hh"
+#include "wrm_permafrost_factory.hh"
+#include "monotone_cubic_table.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+class WRMTabulatedPermafrostModel : public WRMPermafrostModel {
+ public:
+  explicit WRMTabulatedPermafrostModel(Teuchos::ParameterList& plist);
+
+  // required methods from the base class
+  // sats[0] = sg, sats[1] = sl, sats[2] = si
+  virtual bool freezing(double T, double pc_liq, double pc_ice);
+  virtual void saturations(double pc_liq, double pc_ice, double (&sats)[3]);
+  virtual void dsaturations_dpc_liq(double pc_liq, double pc_ice, double (&dsats)[3]);
+  virtual void dsaturations_dpc_ice(double pc_liq, double pc_ice, double (&dsats)[3]);
+
+ protected:
+  // Sets log(pc_liq), log(pc_ice) and returns true if in the table, building
+  // the table first if needed.
+  bool InTable_(double pc_liq, double pc_ice, double& x, double& y);
+  void BuildTable_();
+
+ protected:
+  Teuchos::RCP<WRMPermafrostModel> model_;
+  MonotoneBicubicTable table_; // (sl, si) of (log(pc_liq), log(pc_ice))
+  bool table_built_;
+
+ private:
+  // factory registration
+  static Utils::RegisteredFactory<WRMPermafrostModel, WRMTabulatedPermafrostModel> factory_;
+};
+
+} // namespace Flow
+} // namespace Amanzi
+
+#endif
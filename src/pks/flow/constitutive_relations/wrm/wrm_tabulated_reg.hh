@@ -0,0 +1,18 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include "wrm_tabulated.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+Utils::RegisteredFactory<WRM, WRMTabulated> WRMTabulated::factory_("tabulated");
+
+} // namespace Flow
+} // namespace Amanzi
@@ -8,6 +8,7 @@
            Konstantin Lipnikov (lipnikov@lanl.gov)
 */
 
+#include <algorithm>
 #include <cmath>
 #include "dbc.hh"
 #include "errors.hh"
@@ -149,6 +150,126 @@ WRMVanGenuchten::d_capillaryPressure(double s)
 }
 
 
+/* ******************************************************************
+ * Batched saturation.  The van Genuchten curve is evaluated for all
+ * entries without branching so that the loop vectorizes, then the
+ * (typically few) entries in the saturated or smoothed range are patched.
+ * Results are identical to the pointwise method.
+ ****************************************************************** */
+void
+WRMVanGenuchten::saturation_batch(const double* pc, double* s, int n)
+{
+  // local copies, as members could otherwise alias the output
+  const double alpha = alpha_, n_vg = n_, m = m_, sr = sr_, pc0 = pc0_;
+  for (int i = 0; i != n; ++i) {
+    double apc = alpha * std::max(pc[i], 0.);
+    s[i] = std::pow(1.0 + std::pow(apc, n_vg), -m) * (1.0 - sr) + sr;
+  }
+  for (int i = 0; i != n; ++i) {
+    if (!(pc[i] > pc0)) s[i] = pc[i] <= 0. ? 1.0 : fit_s_(pc[i]);
+  }
+}
+
+
+/* ******************************************************************
+ * Batched derivative of saturation w.r.t. capillary pressure.
+ ****************************************************************** */
+void
+WRMVanGenuchten::d_saturation_batch(const double* pc, double* dsdpc, int n)
+{
+  const double alpha = alpha_, n_vg = n_, m = m_, sr = sr_, pc0 = pc0_;
+  for (int i = 0; i != n; ++i) {
+    double apc = alpha * std::max(pc[i], 0.);
+    dsdpc[i] = -m * n_vg * std::pow(1.0 + std::pow(apc, n_vg), -m - 1.0) *
+               std::pow(apc, n_vg - 1) * alpha * (1.0 - sr);
+  }
+  for (int i = 0; i != n; ++i) {
+    if (!(pc[i] > pc0)) dsdpc[i] = pc[i] <= 0. ? 0.0 : fit_s_.Derivative(pc[i]);
+  }
+}
+
+
+/* ******************************************************************
+ * Fused saturation and derivative, sharing (alpha pc)^n and
+ * (1 + (alpha pc)^n)^-m.  Two pow() calls per entry instead of five, at
+ * the cost of round-off level differences from the pointwise methods.
+ ****************************************************************** */
+void
+WRMVanGenuchten::saturation_and_derivative_batch(const double* pc,
+                                                 double* s,
+                                                 double* dsdpc,
+                                                 int n)
+{
+  const double alpha = alpha_, n_vg = n_, m = m_, sr = sr_, pc0 = pc0_;
+  for (int i = 0; i != n; ++i) {
+    double apc = alpha * std::max(pc[i], 0.);
+    double x = std::pow(apc, n_vg);
+    double y = std::pow(1.0 + x, -m);
+    s[i] = y * (1.0 - sr) + sr;
+    // d/dpc of y = -m n y / (1 + x) * x / pc
+    dsdpc[i] = apc > 0. ? -m * n_vg * y / (1.0 + x) * x / apc * alpha * (1.0 - sr) : 0.;
+  }
+  for (int i = 0; i != n; ++i) {
+    if (!(pc[i] > pc0)) {
+      if (pc[i] <= 0.) {
+        s[i] = 1.0;
+        dsdpc[i] = 0.0;
+      } else {
+        s[i] = fit_s_(pc[i]);
+        dsdpc[i] = fit_s_.Derivative(pc[i]);
+      }
+    }
+  }
+}
+
+
+/* ******************************************************************
+ * Batched relative permeability, identical to the pointwise method.
+ ****************************************************************** */
+void
+WRMVanGenuchten::k_relative_batch(const double* s, double* kr, int n)
+{
+  const double m = m_, l = l_, sr = sr_, s0 = s0_;
+  if (function_ == FLOW_WRM_MUALEM) {
+    for (int i = 0; i != n; ++i) {
+      double se = (s[i] - sr) / (1 - sr);
+      kr[i] = pow(se, l) * pow(1.0 - pow(1.0 - pow(se, 1.0 / m), m), 2.0);
+    }
+  } else {
+    for (int i = 0; i != n; ++i) {
+      double se = (s[i] - sr) / (1 - sr);
+      kr[i] = se * se * (1.0 - pow(1.0 - pow(se, 1.0 / m), m));
+    }
+  }
+  for (int i = 0; i != n; ++i) {
+    if (!(s[i] <= s0)) kr[i] = s[i] == 1.0 ? 1.0 : fit_kr_(s[i]);
+  }
+}
+
+
+/* ******************************************************************
+ * Batched derivative of relative permeability w.r.t. saturation.
+ ****************************************************************** */
+void
+WRMVanGenuchten::d_k_relative_batch(const double* s, double* dkrds, int n)
+{
+  const double m = m_, l = l_, sr = sr_, s0 = s0_;
+  const bool mualem = function_ == FLOW_WRM_MUALEM;
+  for (int i = 0; i != n; ++i) {
+    double se = (s[i] - sr) / (1 - sr);
+    double x = pow(se, 1.0 / m);
+    double y = pow(1.0 - x, m);
+    double dkdse = mualem ? (1.0 - y) * (l * (1.0 - y) + 2 * x * y / (1.0 - x)) * pow(se, l - 1.0) :
+                            (2 * (1.0 - y) + x / (1.0 - x)) * se;
+    bool degenerate = fabs(1.0 - x) < FLOW_WRM_TOLERANCE || fabs(x) < FLOW_WRM_TOLERANCE;
+    dkrds[i] = degenerate ? 0.0 : dkdse / (1 - sr);
+  }
+  for (int i = 0; i != n; ++i) {
+    if (!(s[i] <= s0)) dkrds[i] = s[i] == 1.0 ? 0.0 : fit_kr_.Derivative(s[i]);
+  }
+}
+
+
 void
 WRMVanGenuchten::InitializeFromPlist_()
 {
@@ -75,6 +75,13 @@ class WRMVanGenuchten : public WRM {
   double suction_head(double saturation);
   double d_suction_head(double saturation);
 
+  // batched methods
+  void saturation_batch(const double* pc, double* s, int n);
+  void d_saturation_batch(const double* pc, double* dsdpc, int n);
+  void saturation_and_derivative_batch(const double* pc, double* s, double* dsdpc, int n);
+  void k_relative_batch(const double* s, double* kr, int n);
+  void d_k_relative_batch(const double* s, double* dkrds, int n);
+
  private:
   void InitializeFromPlist_();
 
@@ -8,6 +8,8 @@
 */
 
 #include "Op.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "interfrost.hh"
 
 namespace Amanzi {
@@ -21,9 +23,9 @@ Interfrost::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
   double dt = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
   // addition dp/dt part
-  S_->GetEvaluator("DThetaDp_coef", tag_next_).Update(*S_, name_);
-  S_->GetEvaluator(key_, tag_next_).Update(*S_, name_);
-  S_->GetEvaluator(key_, tag_current_).Update(*S_, name_);
+  updateEvaluator("DThetaDp_coef", tag_next_, *S_, name_);
+  updateEvaluator(key_, tag_next_, *S_, name_);
+  updateEvaluator(key_, tag_current_, *S_, name_);
 
   const Epetra_MultiVector& pres1 =
     *S_->Get<CompositeVector>(key_, tag_next_).ViewComponent("cell", false);
@@ -43,13 +45,13 @@ Interfrost::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
 void
 Interfrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
 
   // Recreate mass matrices
-  if (!deform_key_.empty() &&
-      S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " precon"))
+  if (!deform_key_.empty() && updateEvaluator(deform_key_, tag_next_, *S_, name_ + " precon"))
     preconditioner_diff_->SetTensorCoefficient(K_);
 
   // update state with the solution up.
@@ -82,7 +84,7 @@ Interfrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
 
   // fill local matrices
   // -- gravity fluxes
-  S_->GetEvaluator(mass_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mass_dens_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const CompositeVector> rho = S_->GetPtr<CompositeVector>(mass_dens_key_, tag_next_);
   preconditioner_diff_->SetDensity(rho);
 
@@ -110,7 +112,7 @@ Interfrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
 
   // Update the preconditioner with accumulation terms.
   // -- update the accumulation derivatives
-  S_->GetEvaluator(conserved_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+  updateEvaluatorDerivative(conserved_key_, tag_next_, *S_, name_, key_, tag_next_);
 
   // -- get the accumulation deriv
   Teuchos::RCP<const CompositeVector> dwc_dp =
@@ -118,7 +120,7 @@ Interfrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
   db_->WriteVector("    dwc_dp", dwc_dp.ptr());
 
   // -- and the extra interfrost deriv
-  S_->GetEvaluator("DThetaDp_coef", tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+  updateEvaluatorDerivative("DThetaDp_coef", tag_next_, *S_, name_, key_, tag_next_);
   const Epetra_MultiVector& dwc_dp_vec = *dwc_dp->ViewComponent("cell", false);
   const Epetra_MultiVector& dThdp_coef =
     *S_->Get<CompositeVector>("DThetaDp_coef", tag_next_).ViewComponent("cell", false);
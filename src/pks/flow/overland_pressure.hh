@@ -73,6 +73,14 @@ Solves the diffusion wave equation for overland flow with pressure as a primary
     * `"min ponded depth for velocity calculation`" ``[double]`` **1.e-2** For
       ponded depth below this height, declare the velocity 0.
 
+    * `"velocity reconstruction threads`" ``[int]`` **1** Number of threads
+      used, within each rank, to reconstruct the velocity from the flux.  The
+      least-squares operator is computed once and recomputed only when the
+      mesh deforms.
+
+    * `"deformation indicator`" ``[string]`` **elevation** On a deformable
+      mesh, the field whose change signals that the geometry has changed.
+
     * `"min ponded depth for tidal bc`" ``[double]`` **0.02** Control on the
       tidal boundary condition.  TODO: This should live in the BC spec?
 
@@ -127,6 +135,7 @@ Solves the diffusion wave equation for overland flow with pressure as a primary
 #include "BoundaryFunction.hh"
 #include "DynamicBoundaryFunction.hh"
 #include "upwinding.hh"
+#include "velocity_reconstruction.hh"
 
 #include "Operator.hh"
 #include "PDE_Diffusion.hh"
@@ -258,6 +267,7 @@ class OverlandPressureFlow : public PK_PhysicalBDF_Default {
   Key source_key_;
   Key source_molar_dens_key_;
   Key ss_flux_key_;
+  Key deform_key_;
 
   // control switches
   bool standalone_mode_; // domain mesh == surface mesh
@@ -277,6 +287,10 @@ class OverlandPressureFlow : public PK_PhysicalBDF_Default {
   bool patm_hard_limit_;
   double min_vel_ponded_depth_, min_tidal_bc_ponded_depth_;
 
+  // cell velocity from face flux, built on first use
+  Teuchos::RCP<Operators::VelocityReconstruction> velocity_reconstruction_;
+  int velocity_threads_;
+
   // coupling term
   bool coupled_to_subsurface_via_head_;
   bool coupled_to_subsurface_via_flux_;
@@ -36,7 +36,7 @@ OverlandPressureFlow::ApplyDiffusion_(const Tag& tag, const Teuchos::Ptr<Composi
 
   // derive fluxes -- this gets done independently fo update as precon does
   // not calculate fluxes.
-  S_->GetEvaluator(potential_key_, tag).Update(*S_, name_);
+  updateEvaluator(potential_key_, tag, *S_, name_);
   auto pres_elev = S_->GetPtr<CompositeVector>(potential_key_, tag);
   auto flux = S_->GetPtrW<CompositeVector>(flux_key_, tag, name_);
   matrix_diff_->UpdateFlux(pres_elev.ptr(), flux.ptr());
@@ -56,7 +56,7 @@ OverlandPressureFlow::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
   double dt = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
   // get these fields
-  S_->GetEvaluator(conserved_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(conserved_key_, tag_next_, *S_, name_);
   //  S_->GetEvaluator(conserved_key_, tag_current_).Update(*S_, name_); // for the future...
   Teuchos::RCP<const CompositeVector> wc1 = S_->GetPtr<CompositeVector>(conserved_key_, tag_next_);
   Teuchos::RCP<const CompositeVector> wc0 =
@@ -90,13 +90,13 @@ OverlandPressureFlow::AddSourceTerms_(const Teuchos::Ptr<CompositeVector>& g)
 {
   Epetra_MultiVector& g_c = *g->ViewComponent("cell", false);
 
-  S_->GetEvaluator(cv_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(cv_key_, tag_next_, *S_, name_);
   const Epetra_MultiVector& cv1 =
     *S_->Get<CompositeVector>(cv_key_, tag_next_).ViewComponent("cell", false);
 
   if (is_source_term_) {
     // Add in external source term.
-    S_->GetEvaluator(source_key_, tag_next_).Update(*S_, name_);
+    updateEvaluator(source_key_, tag_next_, *S_, name_);
     const Epetra_MultiVector& source1 =
       *S_->Get<CompositeVector>(source_key_, tag_next_).ViewComponent("cell", false);
     db_->WriteVector("  source", S_->GetPtr<CompositeVector>(source_key_, tag_next_).ptr(), false);
@@ -106,7 +106,7 @@ OverlandPressureFlow::AddSourceTerms_(const Teuchos::Ptr<CompositeVector>& g)
 
   if (coupled_to_subsurface_via_head_) {
     // Add in source term from coupling.
-    S_->GetEvaluator(ss_flux_key_, tag_next_).Update(*S_, name_);
+    updateEvaluator(ss_flux_key_, tag_next_, *S_, name_);
     Teuchos::RCP<const CompositeVector> source1 =
       S_->GetPtr<CompositeVector>(ss_flux_key_, tag_next_);
 
@@ -125,7 +125,7 @@ OverlandPressureFlow::AddSourcesToPrecon_(double h)
   // -- update the source term derivatives
   if (is_source_term_ && source_term_is_differentiable_ &&
       S_->GetEvaluator(source_key_, tag_next_).IsDifferentiableWRT(*S_, key_, tag_next_)) {
-    S_->GetEvaluator(source_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+    updateEvaluatorDerivative(source_key_, tag_next_, *S_, name_, key_, tag_next_);
     preconditioner_acc_->AddAccumulationTerm(
       S_->GetDerivative<CompositeVector>(source_key_, tag_next_, key_, tag_next_),
       -1.0,
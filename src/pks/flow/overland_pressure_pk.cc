@@ -7,7 +7,6 @@
   Authors: Ethan Coon (coonet@ornl.gov)
 */
 
-#include "Teuchos_LAPACK.hpp"
 #include "Teuchos_SerialDenseMatrix.hpp"
 #include "Epetra_MultiVector.h"
 
@@ -51,7 +50,8 @@ OverlandPressureFlow::OverlandPressureFlow(Teuchos::ParameterList& pk_tree,
     jacobian_(false),
     jacobian_lag_(0),
     iter_(0),
-    iter_counter_time_(0.)
+    iter_counter_time_(0.),
+    velocity_threads_(1)
 {
   // set a default absolute tolerance
   if (!plist_->isParameter("absolute error tolerance"))
@@ -106,6 +106,10 @@ OverlandPressureFlow::OverlandPressureFlow(Teuchos::ParameterList& pk_tree,
   patm_hard_limit_ = plist_->get<bool>("allow no negative ponded depths", false);
   min_vel_ponded_depth_ = plist_->get<double>("min ponded depth for velocity calculation", 1e-2);
   min_tidal_bc_ponded_depth_ = plist_->get<double>("min ponded depth for tidal bc", 0.02);
+  velocity_threads_ = plist_->get<int>("velocity reconstruction threads", 1);
+
+  if (S_->IsDeformableMesh(domain_))
+    deform_key_ = Keys::readKey(*plist_, domain_, "deformation indicator", "elevation");
 }
 
 
@@ -155,6 +159,9 @@ OverlandPressureFlow::SetupOverlandFlow_()
     ->AddComponent("face", AmanziMesh::Entity_kind::FACE, 1);
   S_->RequireEvaluator(elev_key_, tag_next_);
 
+  // is dynamic mesh?  If so, get a key for indicating when the mesh has changed.
+  if (!deform_key_.empty()) S_->RequireEvaluator(deform_key_, tag_next_);
+
   // Set up Operators
   // -- boundary conditions
   Teuchos::ParameterList bc_plist = plist_->sublist("boundary conditions", true);
@@ -577,42 +584,23 @@ OverlandPressureFlow::CalculateDiagnostics(const Tag& tag)
   const Epetra_MultiVector& pd_c =
     *S_->GetPtr<CompositeVector>(pd_key_, tag_next_)->ViewComponent("cell");
 
-  int d(mesh_->space_dimension());
-  AmanziGeometry::Point local_velocity(d);
-
-  Teuchos::LAPACK<int, double> lapack;
-  Teuchos::SerialDenseMatrix<int, double> matrix(d, d);
-  double rhs[d];
+  // the reconstruction depends only on geometry
+  bool deformed = !deform_key_.empty() &&
+                  updateEvaluator(deform_key_, tag_next_, *S_, name_ + " velocity");
+  if (velocity_reconstruction_ == Teuchos::null) {
+    velocity_reconstruction_ = Teuchos::rcp(new Operators::VelocityReconstruction(mesh_));
+  } else if (deformed) {
+    velocity_reconstruction_->Init();
+  }
+  velocity_reconstruction_->Apply(flux_f, velocity, velocity_threads_);
 
+  // NOTE this is probably wrong in the frozen case?  pd --> uf*pd?
+  int d(mesh_->space_dimension());
   int ncells_owned = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  AmanziMesh::Entity_ID_List faces;
-  for (int c = 0; c != ncells_owned; ++c) {
-    mesh_->cell_get_faces(c, &faces);
-    int nfaces = faces.size();
-
-    for (int i = 0; i != d; ++i) rhs[i] = 0.0;
-    matrix.putScalar(0.0);
-
-    for (int n = 0; n != nfaces; ++n) { // populate least-square matrix
-      int f = faces[n];
-      const AmanziGeometry::Point& normal = mesh_->face_normal(f);
-      double area = mesh_->face_area(f);
-
-      for (int i = 0; i != d; ++i) {
-        rhs[i] += normal[i] * flux_f[0][f];
-        matrix(i, i) += normal[i] * normal[i];
-        for (int j = i + 1; j < d; ++j) { matrix(j, i) = matrix(i, j) += normal[i] * normal[j]; }
-      }
-    }
-
-    int info;
-    lapack.POSV('U', d, 1, matrix.values(), d, rhs, d, &info);
-
-    // NOTE this is probably wrong in the frozen case?  pd --> uf*pd?
-    for (int i = 0; i != d; ++i)
+  for (int i = 0; i != d; ++i)
+    for (int c = 0; c != ncells_owned; ++c)
       velocity[i][c] =
-        pd_c[0][c] > min_vel_ponded_depth_ ? rhs[i] / (nliq_c[0][c] * pd_c[0][c]) : 0.;
-  }
+        pd_c[0][c] > min_vel_ponded_depth_ ? velocity[i][c] / (nliq_c[0][c] * pd_c[0][c]) : 0.;
 };
 
 
@@ -627,15 +615,15 @@ OverlandPressureFlow::UpdatePermeabilityData_(const Tag& tag)
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "  Updating permeability?";
 
-  bool update_perm = S_->GetEvaluator(pd_key_, tag).Update(*S_, name_);
+  bool update_perm = updateEvaluator(pd_key_, tag, *S_, name_);
 
   // this is an ugly hack to get boundary conditions into conductivities
   Teuchos::RCP<CompositeVector> pd = S_->GetPtrW<CompositeVector>(pd_key_, tag, pd_key_);
   Teuchos::RCP<const CompositeVector> elev = S_->GetPtr<CompositeVector>(elev_key_, tag);
   ApplyBoundaryConditions_(pd.ptr(), elev.ptr());
 
-  update_perm |= S_->GetEvaluator(potential_key_, tag).Update(*S_, name_);
-  update_perm |= S_->GetEvaluator(cond_key_, tag).Update(*S_, name_);
+  update_perm |= updateEvaluator(potential_key_, tag, *S_, name_);
+  update_perm |= updateEvaluator(cond_key_, tag, *S_, name_);
   update_perm |= perm_update_required_;
 
   if (update_perm) {
@@ -693,7 +681,7 @@ OverlandPressureFlow::UpdatePermeabilityDerivativeData_(const Tag& tag)
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "  Updating permeability derivatives?";
 
-  bool update_perm = S_->GetEvaluator(cond_key_, tag).UpdateDerivative(*S_, name_, pd_key_, tag);
+  bool update_perm = updateEvaluatorDerivative(cond_key_, tag, *S_, name_, pd_key_, tag);
   Teuchos::RCP<const CompositeVector> dcond =
     S_->GetDerivativePtr<CompositeVector>(cond_key_, tag, pd_key_, tag);
 
@@ -747,7 +735,7 @@ OverlandPressureFlow::UpdateBoundaryConditions_(const Tag& tag)
   auto& markers = bc_markers();
   auto& values = bc_values();
 
-  S_->GetEvaluator(elev_key_, tag).Update(*S_, name_);
+  updateEvaluator(elev_key_, tag, *S_, name_);
   const Epetra_MultiVector& elevation =
     *S_->Get<CompositeVector>(elev_key_, tag).ViewComponent("face", false);
 
@@ -768,7 +756,7 @@ OverlandPressureFlow::UpdateBoundaryConditions_(const Tag& tag)
 
   // Pressure BCs require a change in coordinates from pressure to head
   if (bc_pressure_->size() > 0) {
-    S_->GetEvaluator(pd_key_, tag).Update(*S_, name_);
+    updateEvaluator(pd_key_, tag, *S_, name_);
 
     const Epetra_MultiVector& h_cells =
       *S_->Get<CompositeVector>(pd_key_, tag).ViewComponent("cell");
@@ -880,7 +868,7 @@ OverlandPressureFlow::UpdateBoundaryConditions_(const Tag& tag)
 
   // Critical depth boundary condition -- v = sqrt(gzh), so q = n_liq * h * sqrt(gzh)
   if (bc_critical_depth_->size() > 0) {
-    S_->GetEvaluator(pd_key_, tag).Update(*S_, name_);
+    updateEvaluator(pd_key_, tag, *S_, name_);
 
     const Epetra_MultiVector& h_c =
       *S_->GetPtr<CompositeVector>(pd_key_, tag)->ViewComponent("cell");
@@ -906,7 +894,7 @@ OverlandPressureFlow::UpdateBoundaryConditions_(const Tag& tag)
   // ------------------------------------------------
   // Seepage face head boundary condition
   if (bc_seepage_head_->size() > 0) {
-    S_->GetEvaluator(pd_key_, tag).Update(*S_, name_);
+    updateEvaluator(pd_key_, tag, *S_, name_);
     const Epetra_MultiVector& h_c = *S_->Get<CompositeVector>(pd_key_, tag).ViewComponent("cell");
     const Epetra_MultiVector& elevation_c =
       *S_->Get<CompositeVector>(elev_key_, tag).ViewComponent("cell");
@@ -932,7 +920,7 @@ OverlandPressureFlow::UpdateBoundaryConditions_(const Tag& tag)
 
   // Seepage face pressure boundary condition
   if (bc_seepage_pressure_->size() > 0) {
-    S_->GetEvaluator(pd_key_, tag).Update(*S_, name_);
+    updateEvaluator(pd_key_, tag, *S_, name_);
 
     const Epetra_MultiVector& h_cells =
       *S_->Get<CompositeVector>(pd_key_, tag).ViewComponent("cell");
@@ -9,6 +9,8 @@
 
 #include "overland_pressure.hh"
 #include "Op.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -26,6 +28,7 @@ OverlandPressureFlow::FunctionalResidual(double t_old,
                                          Teuchos::RCP<TreeVector> u_new,
                                          Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -48,7 +51,7 @@ OverlandPressureFlow::FunctionalResidual(double t_old,
                << std::endl;
 
   // unnecessary here if not debeugging, but doesn't hurt either
-  S_->GetEvaluator(potential_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(potential_key_, tag_next_, *S_, name_);
 
   // debugging -- write primary variables to screen
   db_->WriteCellInfo(true);
@@ -120,13 +123,18 @@ int
 OverlandPressureFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                           Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
   AMANZI_ASSERT(!precon_scaled_); // otherwise this factor was built into the matrix
 
   // apply the preconditioner
   db_->WriteVector("h_res", u->Data().ptr(), true);
-  int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  }
   db_->WriteVector("PC*h_res (h-coords)", Pu->Data().ptr(), true);
 
   // tack on the variable change
@@ -149,6 +157,7 @@ OverlandPressureFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
 void
 OverlandPressureFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -195,7 +204,7 @@ OverlandPressureFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVect
 
   // -- local matrices, Jacobian term
   if (jacobian_ && iter_ >= jacobian_lag_) {
-    S_->GetEvaluator(potential_key_, tag_next_).Update(*S_, name_);
+    updateEvaluator(potential_key_, tag_next_, *S_, name_);
     Teuchos::RCP<const CompositeVector> pres_elev =
       S_->GetPtr<CompositeVector>(potential_key_, tag_next_);
     Teuchos::RCP<CompositeVector> flux = Teuchos::null;
@@ -215,11 +224,11 @@ OverlandPressureFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVect
   //    to h.
   //
   // -- update dh_bar / dp
-  S_->GetEvaluator(pd_bar_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+  updateEvaluatorDerivative(pd_bar_key_, tag_next_, *S_, name_, key_, tag_next_);
   auto dh_dp = S_->GetDerivativePtr<CompositeVector>(pd_bar_key_, tag_next_, key_, tag_next_);
 
   // -- update the accumulation derivatives
-  S_->GetEvaluator(wc_bar_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+  updateEvaluatorDerivative(wc_bar_key_, tag_next_, *S_, name_, key_, tag_next_);
   auto dwc_dp = S_->GetDerivativePtr<CompositeVector>(wc_bar_key_, tag_next_, key_, tag_next_);
   db_->WriteVector("    dwc_dp", dwc_dp.ptr());
   db_->WriteVector("    dh_dp", dh_dp.ptr());
@@ -240,7 +249,7 @@ OverlandPressureFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVect
   //  if (coupled_to_subsurface_via_head_ || coupled_to_subsurface_via_flux_) {
   if (precon_scaled_) {
     // Scale Spp by dh/dp (h, NOT h_bar), clobbering rows with p < p_atm
-    S_->GetEvaluator(pd_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+    updateEvaluatorDerivative(pd_key_, tag_next_, *S_, name_, key_, tag_next_);
     Teuchos::RCP<const CompositeVector> dh0_dp =
       S_->GetDerivativePtr<CompositeVector>(pd_key_, tag_next_, key_, tag_next_);
     preconditioner_->Rescale(*dh0_dp);
@@ -13,6 +13,7 @@
 
 #include "overland.hh"
 #include "Op.hh"
+#include "pk_profiler.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -33,6 +34,7 @@ OverlandFlow::FunctionalResidual(double t_old,
                                  Teuchos::RCP<TreeVector> u_new,
                                  Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   niter_++;
@@ -120,6 +122,7 @@ OverlandFlow::FunctionalResidual(double t_old,
 int
 OverlandFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -128,7 +131,11 @@ OverlandFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP
 #endif
 
   // apply the preconditioner
-  int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  }
 
 #if DEBUG_FLAG
   db_->WriteVector("PC*h_res (h-coords)", Pu->Data().ptr(), true);
@@ -144,6 +151,7 @@ OverlandFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP
 void
 OverlandFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -224,6 +232,7 @@ OverlandFlow::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
 double
 OverlandFlow::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> res)
 {
+  PKProfiler::Scope profile(name(), "ErrorNorm");
   const Epetra_MultiVector& pd =
     *S_next_->GetPtr<CompositeVector>(key_)->ViewComponent("cell", true);
   const Epetra_MultiVector& cv =
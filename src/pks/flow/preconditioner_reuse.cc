@@ -0,0 +1,86 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Reuse of the lagged part of a preconditioner across nonlinear iterations.
+*/
+
+#include "errors.hh"
+#include "preconditioner_reuse.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+PreconditionerReuse::PreconditionerReuse(Teuchos::ParameterList& plist)
+  : freq_(plist.get<int>("preconditioner rebuild frequency", 1)),
+    stall_factor_(plist.get<double>("preconditioner rebuild stall factor", 0.5)),
+    enorm_prev_(0.)
+{}
+
+
+bool
+PreconditionerReuse::IsRebuildNeeded(int iter,
+                                     bool forced,
+                                     const std::vector<int>& bc_model,
+                                     double enorm) const
+{
+  if (!enabled() || forced || matrices_.empty()) return true;
+  if (iter == 0 || iter % freq_ == 0) return true;
+
+  // BC types change the structure of the local matrices
+  if (bc_model != bc_model_) return true;
+
+  // the lagged preconditioner is not converging fast enough
+  return enorm > stall_factor_ * enorm_prev_;
+}
+
+
+void
+PreconditionerReuse::Save(Operators::Operator& op,
+                          const Teuchos::RCP<Operators::Op>& skip,
+                          const std::vector<int>& bc_model)
+{
+  matrices_.clear();
+  diags_.clear();
+  for (auto it = op.begin(); it != op.end(); ++it) {
+    if (*it == skip) continue;
+    matrices_.emplace_back((*it)->matrices);
+    diags_.emplace_back((*it)->diag == Teuchos::null ?
+                          Teuchos::null :
+                          Teuchos::rcp(new Epetra_MultiVector(*(*it)->diag)));
+  }
+  bc_model_ = bc_model;
+}
+
+
+void
+PreconditionerReuse::Restore(Operators::Operator& op, const Teuchos::RCP<Operators::Op>& skip) const
+{
+  int i = 0;
+  for (auto it = op.begin(); it != op.end(); ++it) {
+    if (*it == skip) continue;
+    AMANZI_ASSERT(i < matrices_.size());
+    (*it)->matrices = matrices_[i];
+    if (diags_[i] != Teuchos::null) *(*it)->diag = *diags_[i];
+    ++i;
+  }
+  AMANZI_ASSERT(i == matrices_.size());
+}
+
+
+void
+PreconditionerReuse::Reset()
+{
+  matrices_.clear();
+  diags_.clear();
+  bc_model_.clear();
+}
+
+} // namespace Flow
+} // namespace Amanzi
@@ -0,0 +1,71 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+/*
+  Reuse of the lagged part of a preconditioner across nonlinear iterations.
+
+  Stores the local matrices of every op of an operator except one (the
+  accumulation op, which is always recomputed), and decides when they must
+  be rebuilt instead of restored.  See the "preconditioner rebuild frequency"
+  and "preconditioner rebuild stall factor" options of Richards.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Epetra_MultiVector.h"
+
+#include "DenseMatrix.hh"
+#include "Op.hh"
+#include "Operator.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+class PreconditionerReuse {
+ public:
+  explicit PreconditionerReuse(Teuchos::ParameterList& plist);
+
+  bool enabled() const { return freq_ > 1; }
+
+  // Must the stored matrices be rebuilt at nonlinear iteration iter?  They
+  // always are on the first iteration, every frequency iterations, when
+  // forced, when the BC types differ from those they were built with, and
+  // when the error norm has not dropped by the stall factor since the last
+  // preconditioner update.
+  bool IsRebuildNeeded(int iter, bool forced, const std::vector<int>& bc_model, double enorm) const;
+
+  // Records the error norm at a preconditioner update, rebuilt or not.
+  void set_error_norm(double enorm) { enorm_prev_ = enorm; }
+
+  // Stores the local matrices of all ops but skip.
+  void Save(Operators::Operator& op,
+            const Teuchos::RCP<Operators::Op>& skip,
+            const std::vector<int>& bc_model);
+
+  // Copies the stored local matrices back into the (just initialized) ops.
+  void Restore(Operators::Operator& op, const Teuchos::RCP<Operators::Op>& skip) const;
+
+  // Forgets the stored matrices.
+  void Reset();
+
+ private:
+  int freq_;
+  double stall_factor_;
+  double enorm_prev_;
+  std::vector<std::vector<WhetStone::DenseMatrix>> matrices_;
+  std::vector<Teuchos::RCP<Epetra_MultiVector>> diags_;
+  std::vector<int> bc_model_;
+};
+
+} // namespace Flow
+} // namespace Amanzi
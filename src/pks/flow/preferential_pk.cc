@@ -129,13 +129,13 @@ Preferential::UpdatePermeabilityData_(const Tag& tag)
   Teuchos::RCP<const CompositeVector> rel_perm = S_->GetPtr<CompositeVector>(coef_key_, tag);
   Teuchos::RCP<const CompositeVector> rel_perm_grav =
     S_->GetPtr<CompositeVector>(coef_grav_key_, tag);
-  bool update_perm = S_->GetEvaluator(coef_key_, tag).Update(*S_, name_);
-  update_perm |= S_->GetEvaluator(coef_grav_key_, tag).Update(*S_, name_);
+  bool update_perm = updateEvaluator(coef_key_, tag, *S_, name_);
+  update_perm |= updateEvaluator(coef_grav_key_, tag, *S_, name_);
 
   // requirements due to the upwinding method
   if (Krel_method_ == Operators::UPWIND_METHOD_TOTAL_FLUX) {
-    bool update_dir = S_->GetEvaluator(mass_dens_key_, tag).Update(*S_, name_);
-    update_dir |= S_->GetEvaluator(key_, tag).Update(*S_, name_);
+    bool update_dir = updateEvaluator(mass_dens_key_, tag, *S_, name_);
+    update_dir |= updateEvaluator(key_, tag, *S_, name_);
 
     if (update_dir) {
       // update the direction of the flux -- note this is NOT the flux
@@ -144,8 +144,7 @@ Preferential::UpdatePermeabilityData_(const Tag& tag)
         S_->GetPtrW<CompositeVector>(flux_dir_key_, tag, name_);
       Teuchos::RCP<const CompositeVector> pres = S_->GetPtr<CompositeVector>(key_, tag);
 
-      if (!deform_key_.empty() &&
-          S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " flux dir"))
+      if (!deform_key_.empty() && updateEvaluator(deform_key_, tag_next_, *S_, name_ + " flux dir"))
         face_matrix_diff_->SetTensorCoefficient(K_);
 
       face_matrix_diff_->SetDensity(rho);
@@ -248,8 +247,8 @@ Preferential::UpdatePermeabilityDerivativeData_(const Tag& tag)
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "  Updating permeability derivatives?";
 
-  bool update_perm = S_->GetEvaluator(coef_key_, tag).UpdateDerivative(*S_, name_, key_, tag);
-  update_perm |= S_->GetEvaluator(coef_grav_key_, tag).UpdateDerivative(*S_, name_, key_, tag);
+  bool update_perm = updateEvaluatorDerivative(coef_key_, tag, *S_, name_, key_, tag);
+  update_perm |= updateEvaluatorDerivative(coef_grav_key_, tag, *S_, name_, key_, tag);
   ;
 
   if (update_perm) {
@@ -141,6 +141,26 @@ Solves Richards equation:
      The inverse of the accumulation operator.  See PDE_Accumulation_.
      Typically not provided by users, as defaults are correct.
 
+   * `"preconditioner rebuild frequency`" ``[int]`` **1** Rebuild the
+     diffusion block of the preconditioner every this many nonlinear
+     iterations.  In between, the local matrices from the last rebuild are
+     reused, lagging relative permeability, density, and the Newton
+     correction, and only the accumulation and source terms are updated.
+     The diffusion block is always rebuilt on the first iteration of a step,
+     when the Newton correction lag ends, when boundary condition types
+     change, and when the mesh deforms.  The default rebuilds every
+     iteration.
+
+   * `"preconditioner rebuild stall factor`" ``[double]`` **0.5** When
+     reusing the diffusion block, rebuild it anyway if the error norm has not
+     dropped by at least this factor since the previous preconditioner
+     update.
+
+   * `"velocity reconstruction threads`" ``[int]`` **1** Number of threads
+     used, within each rank, to reconstruct the Darcy velocity from the
+     flux.  The least-squares operator is computed once and recomputed only
+     when the mesh deforms.
+
    * `"absolute error tolerance`" ``[double]`` **2750.0** in units of [mol].
 
    * `"compute boundary values`" ``[bool]`` **false** Used to include boundary
@@ -227,6 +247,8 @@ Solves Richards equation:
 #include "wrm_partition.hh"
 #include "BoundaryFunction.hh"
 #include "upwinding.hh"
+#include "velocity_reconstruction.hh"
+#include "preconditioner_reuse.hh"
 
 #include "EvaluatorPrimary.hh"
 #include "PDE_DiffusionFactory.hh"
@@ -287,6 +309,13 @@ class Richards : public PK_PhysicalBDF_Default {
   virtual bool
   ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0, Teuchos::RCP<TreeVector> u) override;
 
+  // error norm, also used to detect stalls when reusing the preconditioner
+  virtual double
+  ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
+  virtual int ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                               Teuchos::RCP<const TreeVector> du,
+                               ReductionBatch& batch) override;
+
   // problems with pressures -- setting a range of admissible pressures
   virtual bool IsAdmissible(Teuchos::RCP<const TreeVector> up) override;
 
@@ -333,6 +362,9 @@ class Richards : public PK_PhysicalBDF_Default {
   virtual void AddSources_(const Tag& tag, const Teuchos::Ptr<CompositeVector>& f);
   virtual void AddSourcesToPrecon_(double h);
 
+  // -- reuse of the diffusion block of the preconditioner
+  void UpdatePreconditionerDiffusion_(Teuchos::RCP<const TreeVector> up);
+
   // Nonlinear version of CalculateConsistentFaces()
   // virtual void CalculateConsistentFacesForInfiltration_(
   //     const Teuchos::Ptr<CompositeVector>& u);
@@ -394,6 +426,15 @@ class Richards : public PK_PhysicalBDF_Default {
   double iter_counter_time_;
   int jacobian_lag_;
 
+  // preconditioner reuse: the diffusion block from the last rebuild, and the
+  // last error norm
+  PreconditionerReuse precon_reuse_;
+  double enorm_;
+
+  // cell velocity from face flux, built on first use
+  Teuchos::RCP<Operators::VelocityReconstruction> velocity_reconstruction_;
+  int velocity_threads_;
+
   // residual vector for vapor diffusion
   Teuchos::RCP<CompositeVector> res_vapor;
   // note PC is in PKPhysicalBDFBase
@@ -7,7 +7,6 @@
   Authors: Ethan Coon (coonet@ornl.gov)
 */
 
-#include "Teuchos_LAPACK.hpp"
 #include "Teuchos_SerialDenseMatrix.hpp"
 
 #include "Evaluator.hh"
@@ -26,8 +25,7 @@ void
 Richards::ApplyDiffusion_(const Tag& tag, const Teuchos::Ptr<CompositeVector>& g)
 {
   // force mass matrices to change
-  if (!deform_key_.empty() &&
-      S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " matrix"))
+  if (!deform_key_.empty() && updateEvaluator(deform_key_, tag_next_, *S_, name_ + " matrix"))
     matrix_diff_->SetTensorCoefficient(K_);
 
   // update the rel perm according to the scheme of choice
@@ -36,7 +34,7 @@ Richards::ApplyDiffusion_(const Tag& tag, const Teuchos::Ptr<CompositeVector>& g
   // update the matrix
   matrix_->Init();
 
-  S_->GetEvaluator(mass_dens_key_, tag).Update(*S_, name_);
+  updateEvaluator(mass_dens_key_, tag, *S_, name_);
   matrix_diff_->SetDensity(S_->GetPtr<CompositeVector>(mass_dens_key_, tag));
   matrix_diff_->SetScalarCoefficient(S_->GetPtr<CompositeVector>(uw_coef_key_, tag), Teuchos::null);
 
@@ -63,7 +61,7 @@ Richards::AddAccumulation_(const Teuchos::Ptr<CompositeVector>& g)
   double dt = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
   // update the water content at both the old and new times.
-  S_->GetEvaluator(conserved_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(conserved_key_, tag_next_, *S_, name_);
   // S_->GetEvaluator(conserved_key_, tag_current_).Update(*S_, name_); // for the future...
 
   // get these fields
@@ -94,7 +92,7 @@ Richards::AddSources_(const Tag& tag, const Teuchos::Ptr<CompositeVector>& g)
     Epetra_MultiVector& g_c = *g->ViewComponent("cell", false);
 
     // Update the source term
-    S_->GetEvaluator(source_key_, tag).Update(*S_, name_);
+    updateEvaluator(source_key_, tag, *S_, name_);
     const Epetra_MultiVector& source1 =
       *S_->Get<CompositeVector>(source_key_, tag).ViewComponent("cell", false);
 
@@ -118,7 +116,7 @@ Richards::AddSourcesToPrecon_(double h)
   // nonlinear water sources include a dQ/dp term into PC
   if (is_source_term_ && !explicit_source_ && source_term_is_differentiable_ &&
       S_->GetEvaluator(source_key_, tag_next_).IsDifferentiableWRT(*S_, key_, tag_next_)) {
-    S_->GetEvaluator(source_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+    updateEvaluatorDerivative(source_key_, tag_next_, *S_, name_, key_, tag_next_);
     preconditioner_acc_->AddAccumulationTerm(
       S_->GetDerivative<CompositeVector>(source_key_, tag_next_, key_, tag_next_),
       -1.0,
@@ -135,7 +133,7 @@ void
 Richards::SetAbsolutePermeabilityTensor_(const Tag& tag)
 {
   // currently assumes isotropic perm, should be updated
-  S_->GetEvaluator(perm_key_, tag).Update(*S_, name_);
+  updateEvaluator(perm_key_, tag, *S_, name_);
   const Epetra_MultiVector& perm =
     *S_->Get<CompositeVector>(perm_key_, tag).ViewComponent("cell", false);
   unsigned int ncells = perm.MyLength();
@@ -186,45 +184,26 @@ Richards::UpdateVelocity_(const Tag& tag)
   const Epetra_MultiVector& flux =
     *S_->Get<CompositeVector>(flux_key_, tag_next_).ViewComponent("face", true);
 
-  S_->GetEvaluator(molar_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(molar_dens_key_, tag_next_, *S_, name_);
   const Epetra_MultiVector& nliq_c =
     *S_->Get<CompositeVector>(molar_dens_key_, tag_next_).ViewComponent("cell", false);
   Epetra_MultiVector& velocity =
     *S_->GetW<CompositeVector>(velocity_key_, tag, name_).ViewComponent("cell", true);
 
-  int d(mesh_->space_dimension());
-  AmanziGeometry::Point local_velocity(d);
-
-  Teuchos::LAPACK<int, double> lapack;
-  Teuchos::SerialDenseMatrix<int, double> matrix(d, d);
-  double rhs[d];
+  // the reconstruction depends only on geometry
+  bool deformed = !deform_key_.empty() &&
+                  updateEvaluator(deform_key_, tag_next_, *S_, name_ + " velocity");
+  if (velocity_reconstruction_ == Teuchos::null) {
+    velocity_reconstruction_ = Teuchos::rcp(new Operators::VelocityReconstruction(mesh_));
+  } else if (deformed) {
+    velocity_reconstruction_->Init();
+  }
+  velocity_reconstruction_->Apply(flux, velocity, velocity_threads_);
 
+  int d(mesh_->space_dimension());
   int ncells_owned = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  AmanziMesh::Entity_ID_List faces;
-  for (int c = 0; c != ncells_owned; ++c) {
-    mesh_->cell_get_faces(c, &faces);
-    int nfaces = faces.size();
-
-    for (int i = 0; i != d; ++i) rhs[i] = 0.0;
-    matrix.putScalar(0.0);
-
-    for (int n = 0; n != nfaces; ++n) { // populate least-square matrix
-      int f = faces[n];
-      const AmanziGeometry::Point& normal = mesh_->face_normal(f);
-      double area = mesh_->face_area(f);
-
-      for (int i = 0; i != d; ++i) {
-        rhs[i] += normal[i] * flux[0][f];
-        matrix(i, i) += normal[i] * normal[i];
-        for (int j = i + 1; j < d; ++j) { matrix(j, i) = matrix(i, j) += normal[i] * normal[j]; }
-      }
-    }
-
-    int info;
-    lapack.POSV('U', d, 1, matrix.values(), d, rhs, d, &info);
-
-    for (int i = 0; i != d; ++i) velocity[i][c] = rhs[i] / nliq_c[0][c];
-  }
+  for (int i = 0; i != d; ++i)
+    for (int c = 0; c != ncells_owned; ++c) velocity[i][c] /= nliq_c[0][c];
 }
 
 
@@ -59,6 +59,9 @@ Richards::Richards(Teuchos::ParameterList& pk_tree,
     jacobian_lag_(0),
     iter_(0),
     iter_counter_time_(0.),
+    precon_reuse_(*plist_),
+    enorm_(0.),
+    velocity_threads_(1),
     fixed_kr_(false)
 {
   // set a default absolute tolerance
@@ -103,6 +106,8 @@ Richards::Richards(Teuchos::ParameterList& pk_tree,
   // scaling for permeability for better "nondimensionalization"
   perm_scale_ = plist_->get<double>("permeability rescaling", 1.e7);
   S_->GetEvaluatorList(coef_key_).set<double>("permeability rescaling", perm_scale_);
+
+  velocity_threads_ = plist_->get<int>("velocity reconstruction threads", 1);
 }
 
 // -------------------------------------------------------------
@@ -791,12 +796,12 @@ Richards::UpdatePermeabilityData_(const Tag& tag)
   if (fixed_kr_) return false;
 
   Teuchos::RCP<const CompositeVector> rel_perm = S_->GetPtr<CompositeVector>(coef_key_, tag);
-  bool update_perm = S_->GetEvaluator(coef_key_, tag).Update(*S_, name_);
+  bool update_perm = updateEvaluator(coef_key_, tag, *S_, name_);
 
   // requirements due to the upwinding method
   if (Krel_method_ == Operators::UPWIND_METHOD_TOTAL_FLUX) {
-    bool update_dir = S_->GetEvaluator(mass_dens_key_, tag).Update(*S_, name_);
-    update_dir |= S_->GetEvaluator(key_, tag).Update(*S_, name_);
+    bool update_dir = updateEvaluator(mass_dens_key_, tag, *S_, name_);
+    update_dir |= updateEvaluator(key_, tag, *S_, name_);
 
     if (update_dir) {
       // update the direction of the flux -- note this is NOT the flux
@@ -805,8 +810,7 @@ Richards::UpdatePermeabilityData_(const Tag& tag)
         S_->GetPtrW<CompositeVector>(flux_dir_key_, tag, name_);
       Teuchos::RCP<const CompositeVector> pres = S_->GetPtr<CompositeVector>(key_, tag);
 
-      if (!deform_key_.empty() &&
-          S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " flux dir"))
+      if (!deform_key_.empty() && updateEvaluator(deform_key_, tag_next_, *S_, name_ + " flux dir"))
         face_matrix_diff_->SetTensorCoefficient(K_);
       face_matrix_diff_->SetDensity(rho);
       face_matrix_diff_->UpdateMatrices(Teuchos::null, pres.ptr());
@@ -900,7 +904,7 @@ Richards::UpdatePermeabilityDerivativeData_(const Tag& tag)
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "  Updating permeability derivatives?";
   if (fixed_kr_) return false;
 
-  bool update_perm = S_->GetEvaluator(coef_key_, tag).UpdateDerivative(*S_, name_, key_, tag);
+  bool update_perm = updateEvaluatorDerivative(coef_key_, tag, *S_, name_, key_, tag);
   if (update_perm) {
     const CompositeVector& drel_perm =
       S_->GetDerivative<CompositeVector>(coef_key_, tag, key_, tag);
@@ -1417,7 +1421,7 @@ Richards::CalculateConsistentFaces(const Teuchos::Ptr<CompositeVector>& u)
   Teuchos::RCP<const CompositeVector> rel_perm =
     S_->GetPtr<CompositeVector>(uw_coef_key_, tag_next_);
 
-  S_->GetEvaluator(mass_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mass_dens_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const CompositeVector> rho = S_->GetPtr<CompositeVector>(mass_dens_key_, tag_next_);
 
   // Update the preconditioner with darcy and gravity fluxes
@@ -12,6 +12,8 @@ Steady state solution of Richards equation
 
 */
 
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "richards_steadystate.hh"
 
 namespace Amanzi {
@@ -36,6 +38,7 @@ RichardsSteadyState::FunctionalResidual(double t_old,
                                         Teuchos::RCP<TreeVector> u_new,
                                         Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -75,7 +78,7 @@ RichardsSteadyState::FunctionalResidual(double t_old,
   ApplyDiffusion_(tag_next_, res.ptr());
 
   // evaulate water content, because otherwise it is never done.
-  S_->GetEvaluator(conserved_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(conserved_key_, tag_next_, *S_, name_);
 
   // dump s_old, s_new
   vnames[0] = "sl_old";
@@ -126,13 +129,13 @@ RichardsSteadyState::FunctionalResidual(double t_old,
 void
 RichardsSteadyState::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) { *vo_->os() << "Precon update at t = " << t << std::endl; }
 
   // Recreate mass matrices
-  if (!deform_key_.empty() &&
-      S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " precon"))
+  if (!deform_key_.empty() && updateEvaluator(deform_key_, tag_next_, *S_, name_ + " precon"))
     preconditioner_diff_->SetTensorCoefficient(K_);
 
   AMANZI_ASSERT(std::abs(S_->get_time(tag_next_) - t) <= 1.e-4 * t);
@@ -151,7 +154,7 @@ RichardsSteadyState::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVecto
 
   // fill local matrices
   // -- gravity fluxes
-  S_->GetEvaluator(mass_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mass_dens_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const CompositeVector> rho = S_->GetPtr<CompositeVector>(mass_dens_key_, tag_next_);
   preconditioner_diff_->SetDensity(rho);
 
@@ -8,6 +8,8 @@
 */
 
 #include "Op.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "richards.hh"
 
 namespace Amanzi {
@@ -24,6 +26,7 @@ Richards::FunctionalResidual(double t_old,
                              Teuchos::RCP<TreeVector> u_new,
                              Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -112,12 +115,17 @@ Richards::FunctionalResidual(double t_old,
 int
 Richards::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
 
   // Apply the preconditioner
   db_->WriteVector("p_res", u->Data().ptr(), true);
-  int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  }
   db_->WriteVector("PC*p_res", Pu->Data().ptr(), true);
 
   return (ierr > 0) ? 0 : 1;
@@ -130,14 +138,17 @@ Richards::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<Tre
 void
 Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
 
   // Recreate mass matrices
-  if (!deform_key_.empty() &&
-      S_->GetEvaluator(deform_key_, tag_next_).Update(*S_, name_ + " precon"))
+  bool deformed = false;
+  if (!deform_key_.empty() && updateEvaluator(deform_key_, tag_next_, *S_, name_ + " precon")) {
     preconditioner_diff_->SetTensorCoefficient(K_);
+    deformed = true;
+  }
 
   // update state with the solution up.
   if (std::abs(t - iter_counter_time_) / t > 1.e-4) {
@@ -147,6 +158,46 @@ Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, doub
   AMANZI_ASSERT(std::abs(S_->get_time(tag_next_) - t) <= 1.e-4 * t);
   PK_PhysicalBDF_Default::Solution_to_State(*up, tag_next_);
 
+  // rebuild the diffusion block, or reuse it from the last rebuild
+  bool forced = deformed || (jacobian_ && iter_ == jacobian_lag_);
+  if (precon_reuse_.IsRebuildNeeded(iter_, forced, bc_markers(), enorm_)) {
+    UpdatePreconditionerDiffusion_(up);
+    if (precon_reuse_.enabled())
+      precon_reuse_.Save(*preconditioner_, preconditioner_acc_->local_op(), bc_markers());
+  } else {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "  reusing diffusion preconditioner" << std::endl;
+    preconditioner_->Init();
+    precon_reuse_.Restore(*preconditioner_, preconditioner_acc_->local_op());
+  }
+  precon_reuse_.set_error_norm(enorm_);
+
+  // Update the preconditioner with accumulation terms.
+  // -- update the accumulation derivatives
+  updateEvaluatorDerivative(conserved_key_, tag_next_, *S_, name_, key_, tag_next_);
+
+  // -- get the accumulation deriv
+  Teuchos::RCP<const CompositeVector> dwc_dp =
+    S_->GetDerivativePtr<CompositeVector>(conserved_key_, tag_next_, key_, tag_next_);
+  db_->WriteVector("    dwc_dp", dwc_dp.ptr());
+
+  // -- update the cell-cell block
+  preconditioner_acc_->AddAccumulationTerm(*dwc_dp, h, "cell", false);
+
+  // -- update preconditioner with source term derivatives if needed
+  AddSourcesToPrecon_(h);
+
+  // increment the iterator count
+  iter_++;
+};
+
+
+// -----------------------------------------------------------------------------
+// Rebuild the diffusion block of the preconditioner at up.
+// -----------------------------------------------------------------------------
+void
+Richards::UpdatePreconditionerDiffusion_(Teuchos::RCP<const TreeVector> up)
+{
   // update the rel perm according to the scheme of choice, also upwind derivatives of rel perm
   UpdatePermeabilityData_(tag_next_);
   if (jacobian_ && iter_ >= jacobian_lag_) UpdatePermeabilityDerivativeData_(tag_next_);
@@ -157,7 +208,7 @@ Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, doub
 
   // fill local matrices
   // -- gravity fluxes
-  S_->GetEvaluator(mass_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mass_dens_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const CompositeVector> rho = S_->GetPtr<CompositeVector>(mass_dens_key_, tag_next_);
   preconditioner_diff_->SetDensity(rho);
 
@@ -187,25 +238,30 @@ Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, doub
     preconditioner_diff_->UpdateFlux(up->Data().ptr(), flux.ptr());
     preconditioner_diff_->UpdateMatricesNewtonCorrection(flux.ptr(), up->Data().ptr());
   }
+}
 
-  // Update the preconditioner with accumulation terms.
-  // -- update the accumulation derivatives
-  S_->GetEvaluator(conserved_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
-
-  // -- get the accumulation deriv
-  Teuchos::RCP<const CompositeVector> dwc_dp =
-    S_->GetDerivativePtr<CompositeVector>(conserved_key_, tag_next_, key_, tag_next_);
-  db_->WriteVector("    dwc_dp", dwc_dp.ptr());
 
-  // -- update the cell-cell block
-  preconditioner_acc_->AddAccumulationTerm(*dwc_dp, h, "cell", false);
+// -----------------------------------------------------------------------------
+// Error norm, stored to detect stalls when reusing the preconditioner.
+// -----------------------------------------------------------------------------
+double
+Richards::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du)
+{
+  PKProfiler::Scope profile(name(), "ErrorNorm");
+  enorm_ = PK_PhysicalBDF_Default::ErrorNorm(u, du);
+  return enorm_;
+}
 
-  // -- update preconditioner with source term derivatives if needed
-  AddSourcesToPrecon_(h);
 
-  // increment the iterator count
-  iter_++;
-};
+int
+Richards::ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                           Teuchos::RCP<const TreeVector> du,
+                           ReductionBatch& batch)
+{
+  int handle = PK_PhysicalBDF_Default::ErrorNormBatched(u, du, batch);
+  batch.OnFlush([this, handle](const ReductionBatch& b) { enorm_ = b.get(handle); });
+  return handle;
+}
 
 
 } // namespace Flow
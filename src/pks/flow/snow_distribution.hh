@@ -97,6 +97,13 @@ class SnowDistribution : public PK_PhysicalBDF_Default {
 
   // error monitor
   double ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
+  int ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                       Teuchos::RCP<const TreeVector> du,
+                       ReductionBatch& batch) override
+  {
+    // the norm above does its own reduction
+    return PK_BDF_Default::ErrorNormBatched(u, du, batch);
+  }
 
   bool
   ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0, Teuchos::RCP<TreeVector> u) override;
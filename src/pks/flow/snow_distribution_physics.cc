@@ -7,6 +7,7 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include "pk_helpers.hh"
 #include "snow_distribution.hh"
 
 namespace Amanzi {
@@ -29,7 +30,7 @@ SnowDistribution::ApplyDiffusion_(const Tag& tag, const Teuchos::Ptr<CompositeVe
   matrix_diff_->ApplyBCs(true, true, true);
 
   // update the potential
-  S_->GetEvaluator(potential_key_, tag).Update(*S_, name_);
+  updateEvaluator(potential_key_, tag, *S_, name_);
   auto potential = S_->GetPtr<CompositeVector>(potential_key_, tag);
 
   // calculate the residual
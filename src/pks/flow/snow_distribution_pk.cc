@@ -227,9 +227,9 @@ SnowDistribution::Initialize()
 bool
 SnowDistribution::UpdatePermeabilityData_(const Tag& tag)
 {
-  bool update_perm = S_->GetEvaluator(cond_key_, tag).Update(*S_, name_);
-  update_perm |= S_->GetEvaluator(precip_key_, tag).Update(*S_, name_);
-  update_perm |= S_->GetEvaluator(potential_key_, tag).Update(*S_, name_);
+  bool update_perm = updateEvaluator(cond_key_, tag, *S_, name_);
+  update_perm |= updateEvaluator(precip_key_, tag, *S_, name_);
+  update_perm |= updateEvaluator(potential_key_, tag, *S_, name_);
 
   if (update_perm) {
     if (upwind_method_ == Operators::UPWIND_METHOD_TOTAL_FLUX) {
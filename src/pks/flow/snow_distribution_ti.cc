@@ -9,6 +9,8 @@
 
 #include "boost/math/special_functions/fpclassify.hpp"
 #include "Op.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "snow_distribution.hh"
 
 #define DEBUG_FLAG 1
@@ -27,6 +29,7 @@ SnowDistribution::FunctionalResidual(double t_old,
                                      Teuchos::RCP<TreeVector> u_new,
                                      Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
 
@@ -69,7 +72,7 @@ SnowDistribution::FunctionalResidual(double t_old,
 #endif
 
   // unnecessary here if not debeugging, but doesn't hurt either
-  S_->GetEvaluator(potential_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(potential_key_, tag_next_, *S_, name_);
 
 #if DEBUG_FLAG
   // dump u_old, u_new
@@ -112,6 +115,7 @@ SnowDistribution::FunctionalResidual(double t_old,
 int
 SnowDistribution::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -120,7 +124,11 @@ SnowDistribution::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos:
 #endif
 
   // apply the preconditioner
-  int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+  }
   Pu->Data()->Scale(1. / (10 * dt_factor_));
 
 
@@ -138,6 +146,7 @@ SnowDistribution::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos:
 void
 SnowDistribution::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // VerboseObject stuff.
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon update at t = " << t << std::endl;
@@ -155,7 +164,7 @@ SnowDistribution::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector>
 
   // Jacobian
   // playing it fast and loose.... --etc
-  S_->GetEvaluator(cond_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+  updateEvaluatorDerivative(cond_key_, tag_next_, *S_, name_, key_, tag_next_);
   Teuchos::RCP<CompositeVector> dcond =
     S_->GetDerivativePtrW<CompositeVector>(cond_key_, tag_next_, key_, tag_next_, cond_key_);
   // NOTE: this scaling of dt is wrong, but keeps consistent with the diffusion derivatives
@@ -168,7 +177,7 @@ SnowDistribution::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector>
   preconditioner_diff_->SetScalarCoefficient(cond, dcond);
   preconditioner_diff_->UpdateMatrices(Teuchos::null, Teuchos::null);
 
-  S_->GetEvaluator(potential_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(potential_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const CompositeVector> potential =
     S_->GetPtr<CompositeVector>(potential_key_, tag_next_);
   preconditioner_diff_->UpdateMatricesNewtonCorrection(Teuchos::null, potential.ptr());
@@ -187,6 +196,7 @@ SnowDistribution::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector>
 double
 SnowDistribution::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du)
 {
+  PKProfiler::Scope profile(name(), "ErrorNorm");
   Teuchos::OSTab tab = vo_->getOSTab();
 
   Teuchos::RCP<const CompositeVector> res = du->Data();
@@ -0,0 +1,195 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Epetra_MultiVector.h"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "BCs.hh"
+#include "CompositeVector.hh"
+#include "Mesh.hh"
+#include "MeshFactory.hh"
+#include "OperatorDefs.hh"
+#include "PDE_Accumulation.hh"
+#include "PDE_DiffusionFactory.hh"
+#include "Tensor.hh"
+
+#include "preconditioner_reuse.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// A finite volume diffusion operator plus an accumulation term on a box, with
+// Dirichlet conditions on the x = 0 side, as in a Richards preconditioner.
+struct Problem {
+  Problem()
+  {
+    AmanziMesh::MeshFactory factory(getDefaultComm());
+    mesh = factory.create(0.0, 0.0, 0.0, 3.0, 2.0, 1.0, 6, 5, 4);
+
+    bc = Teuchos::rcp(new Operators::BCs(mesh, AmanziMesh::FACE, WhetStone::DOF_Type::SCALAR));
+    int nfaces = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+    for (int f = 0; f != nfaces; ++f) {
+      if (std::abs(mesh->face_centroid(f)[0]) < 1.e-12) {
+        bc->bc_model()[f] = Operators::OPERATOR_BC_DIRICHLET;
+        bc->bc_value()[f] = 1.;
+      }
+    }
+
+    Teuchos::ParameterList olist;
+    olist.set<std::string>("discretization primary", "fv: default");
+    Operators::PDE_DiffusionFactory opfactory;
+    diff = opfactory.Create(olist, mesh, bc);
+    op = diff->global_operator();
+    acc = Teuchos::rcp(new Operators::PDE_Accumulation(AmanziMesh::CELL, op));
+
+    K = Teuchos::rcp(new std::vector<WhetStone::Tensor>(
+      mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED)));
+    SetPermeability(1.);
+    diff->SetScalarCoefficient(Teuchos::null, Teuchos::null);
+  }
+
+  void SetPermeability(double scale)
+  {
+    for (int c = 0; c != K->size(); ++c) {
+      (*K)[c].Init(3, 1);
+      (*K)[c](0, 0) = scale * (1. + 0.5 * std::sin(c));
+    }
+    diff->SetTensorCoefficient(K);
+  }
+
+  void Accumulate(double scale)
+  {
+    CompositeVector dwc(op->DomainMap());
+    Epetra_MultiVector& dwc_c = *dwc.ViewComponent("cell", false);
+    for (int c = 0; c != dwc_c.MyLength(); ++c) dwc_c[0][c] = scale * (2. + std::cos(c));
+    acc->AddAccumulationTerm(dwc, 0.1, "cell", false);
+  }
+
+  // the full update of Richards::UpdatePreconditioner()
+  void Rebuild(double scale)
+  {
+    op->Init();
+    diff->UpdateMatrices(Teuchos::null, Teuchos::null);
+    diff->ApplyBCs(true, true, true);
+    Accumulate(scale);
+  }
+
+  std::vector<double> Apply()
+  {
+    CompositeVector x(op->DomainMap()), y(op->RangeMap());
+    Epetra_MultiVector& x_c = *x.ViewComponent("cell", false);
+    for (int c = 0; c != x_c.MyLength(); ++c) x_c[0][c] = std::sin(0.3 * c) + 2.;
+    op->Apply(x, y);
+    const Epetra_MultiVector& y_c = *y.ViewComponent("cell", false);
+    return std::vector<double>(y_c[0], y_c[0] + y_c.MyLength());
+  }
+
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh;
+  Teuchos::RCP<Operators::BCs> bc;
+  Teuchos::RCP<Operators::PDE_Diffusion> diff;
+  Teuchos::RCP<Operators::Operator> op;
+  Teuchos::RCP<Operators::PDE_Accumulation> acc;
+  Teuchos::RCP<std::vector<WhetStone::Tensor>> K;
+};
+
+Teuchos::ParameterList
+reuseList(int freq)
+{
+  Teuchos::ParameterList plist;
+  plist.set("preconditioner rebuild frequency", freq);
+  plist.set("preconditioner rebuild stall factor", 0.5);
+  return plist;
+}
+
+} // namespace
+
+
+// the diffusion block is rebuilt on the first iteration, every frequency
+// iterations, when forced, when BC types change, and on a stall
+TEST(PRECONDITIONER_REUSE_REBUILD_POLICY)
+{
+  Problem p;
+  std::vector<int> bc_model = p.bc->bc_model();
+
+  auto plist = reuseList(3);
+  Flow::PreconditionerReuse reuse(plist);
+  CHECK(reuse.enabled());
+
+  // nothing stored yet
+  CHECK(reuse.IsRebuildNeeded(1, false, bc_model, 0.1));
+
+  p.Rebuild(1.);
+  reuse.Save(*p.op, p.acc->local_op(), bc_model);
+  reuse.set_error_norm(1.);
+  CHECK(reuse.IsRebuildNeeded(0, false, bc_model, 0.1));
+  CHECK(!reuse.IsRebuildNeeded(1, false, bc_model, 0.1));
+  reuse.set_error_norm(0.1);
+  CHECK(!reuse.IsRebuildNeeded(2, false, bc_model, 0.01));
+  CHECK(reuse.IsRebuildNeeded(3, false, bc_model, 0.01));
+  CHECK(reuse.IsRebuildNeeded(4, true, bc_model, 0.01));
+
+  // a stall: the norm dropped, but not by half
+  CHECK(reuse.IsRebuildNeeded(4, false, bc_model, 0.08));
+
+  // a BC type change
+  std::vector<int> bc_model_changed(bc_model);
+  for (auto& m : bc_model_changed) {
+    if (m == Operators::OPERATOR_BC_DIRICHLET) m = Operators::OPERATOR_BC_NEUMANN;
+  }
+  CHECK(reuse.IsRebuildNeeded(4, false, bc_model_changed, 0.01));
+  CHECK(!reuse.IsRebuildNeeded(4, false, bc_model, 0.01));
+
+  reuse.Reset();
+  CHECK(reuse.IsRebuildNeeded(4, false, bc_model, 0.01));
+
+  // the default rebuilds every iteration
+  Teuchos::ParameterList default_plist;
+  Flow::PreconditionerReuse always(default_plist);
+  CHECK(!always.enabled());
+  CHECK(always.IsRebuildNeeded(1, false, bc_model, 0.));
+}
+
+
+// Restoring the saved diffusion block and adding a new accumulation term
+// gives exactly the operator a full rebuild gives at the saved coefficients.
+TEST(PRECONDITIONER_REUSE_SAVE_RESTORE)
+{
+  Problem p;
+  auto plist = reuseList(3);
+  Flow::PreconditionerReuse reuse(plist);
+
+  p.Rebuild(1.);
+  reuse.Save(*p.op, p.acc->local_op(), p.bc->bc_model());
+
+  p.Rebuild(3.);
+  std::vector<double> expected = p.Apply();
+
+  // the coefficients change, but the restored block lags them
+  p.SetPermeability(2.);
+  p.op->Init();
+  reuse.Restore(*p.op, p.acc->local_op());
+  p.Accumulate(3.);
+  std::vector<double> restored = p.Apply();
+  CHECK_EQUAL(expected.size(), restored.size());
+  for (int c = 0; c != expected.size(); ++c) CHECK_EQUAL(expected[c], restored[c]);
+
+  // which a rebuild does not
+  p.Rebuild(3.);
+  std::vector<double> rebuilt = p.Apply();
+  double diff = 0.;
+  for (int c = 0; c != expected.size(); ++c) diff += std::abs(rebuilt[c] - expected[c]);
+  CHECK(diff > 1.e-6);
+}
@@ -0,0 +1,75 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Detects the cells whose chemistry inputs have changed.
+#include <algorithm>
+#include <cmath>
+
+#include "errors.hh"
+#include "pk_helpers.hh"
+#include "chemistry_activity_filter.hh"
+
+namespace Amanzi {
+
+ChemistryActivityFilter::ChemistryActivityFilter(Teuchos::ParameterList& plist)
+  : tol_(plist.get<double>("chemistry activity tolerance", -1.)), has_kinetics_(false)
+{}
+
+
+int
+ChemistryActivityFilter::FindActive(const Inputs& inputs, std::vector<bool>& active) const
+{
+  AMANZI_ASSERT(inputs.size() > 0);
+  int ncells = inputs[0]->MyLength();
+  if (!enabled() || recorded_.size() != inputs.size()) {
+    active.assign(ncells, true);
+    return ncells;
+  }
+
+  active.assign(ncells, false);
+  for (int i = 0; i != inputs.size(); ++i) {
+    const Epetra_MultiVector& x = *inputs[i];
+    const Epetra_MultiVector& x0 = *recorded_[i];
+    AMANZI_ASSERT(x.NumVectors() == x0.NumVectors() && x.MyLength() == ncells);
+    for (int k = 0; k != x.NumVectors(); ++k) {
+      for (int c = 0; c != ncells; ++c) {
+        if (std::abs(x[k][c] - x0[k][c]) > tol_ * std::abs(x0[k][c])) active[c] = true;
+      }
+    }
+  }
+  return std::count(active.begin(), active.end(), true);
+}
+
+
+void
+ChemistryActivityFilter::Record(const Inputs& inputs)
+{
+  if (recorded_.size() != inputs.size()) {
+    recorded_.clear();
+    for (const auto& x : inputs) recorded_.emplace_back(Teuchos::rcp(new Epetra_MultiVector(*x)));
+  } else {
+    for (int i = 0; i != inputs.size(); ++i) *recorded_[i] = *inputs[i];
+  }
+}
+
+
+ChemistryActivityFilter::Inputs
+getChemistryInputs(State& S, const std::vector<Key>& keys, const Tag& tag, const Key& requestor)
+{
+  ChemistryActivityFilter::Inputs inputs;
+  for (const auto& key : keys) {
+    if (S.HasRecord(key, tag)) {
+      if (S.HasEvaluator(key, tag)) updateEvaluator(key, tag, S, requestor);
+      inputs.emplace_back(S.Get<CompositeVector>(key, tag).ViewComponent("cell", false));
+    }
+  }
+  return inputs;
+}
+
+} // namespace Amanzi
@@ -0,0 +1,90 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Detects the cells whose chemistry inputs have changed.
+/*!
+
+Geochemistry is often near equilibrium in most of the domain, where transport
+changes the concentrations very little from one step to the next.  This filter
+records the concentrations and water state of each cell when chemistry is
+solved, and before the next solve counts the cells whose inputs have changed
+by more than a relative tolerance since then.  A cell is active if any of its
+values x differs from the recorded value x0 by more than `tol * |x0|`.
+
+The chemistry PK advances all of its cells together, so the engine is skipped
+only when no cell on any rank is active; otherwise every cell is solved and
+recorded.  Skipped steps keep their recorded inputs, so that slow changes
+accumulate until some cell becomes active.  Solving only the active cells, and
+balancing them across ranks, would need a per-cell entry point in the
+chemistry PK, and is not done.
+
+Skipping a step is only correct for equilibrium reactions.  If the chemistry
+engine has any kinetic reactions (aqueous kinetics or minerals), or cannot be
+asked, every cell is active and the filter has no effect.
+
+.. _chemistry-activity-filter-spec:
+.. admonition:: chemistry-activity-filter-spec
+
+   * `"chemistry activity tolerance`" ``[double]`` **-1** Relative change in
+     concentrations or water state below which a cell is considered inactive.
+     A negative value disables the filter, and chemistry is solved every step.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Epetra_MultiVector.h"
+
+#include "Key.hh"
+#include "Tag.hh"
+#include "State.hh"
+
+namespace Amanzi {
+
+class ChemistryActivityFilter {
+ public:
+  using Inputs = std::vector<Teuchos::RCP<const Epetra_MultiVector>>;
+
+  explicit ChemistryActivityFilter(Teuchos::ParameterList& plist);
+
+  bool enabled() const { return tol_ >= 0. && !has_kinetics_; }
+
+  // Cells with kinetic reactions are never skipped.
+  void set_has_kinetics(bool has_kinetics) { has_kinetics_ = has_kinetics; }
+
+  // Marks the cells whose inputs changed since they were last recorded, and
+  // returns the number of them on this rank.  All cells are active if nothing
+  // has been recorded.  Vectors are owned cell views: the concentrations,
+  // then any water state.
+  int FindActive(const Inputs& inputs, std::vector<bool>& active) const;
+
+  // Stores the inputs of every cell as they are after a successful solve.
+  void Record(const Inputs& inputs);
+
+  // Forgets the recorded inputs, so that every cell is active in the next
+  // solve.
+  void Reset() { recorded_.clear(); }
+
+ private:
+  double tol_;
+  bool has_kinetics_;
+  std::vector<Teuchos::RCP<Epetra_MultiVector>> recorded_;
+};
+
+
+// Updates the evaluators of the given keys, skipping any not in State, and
+// returns owned cell views of them.
+ChemistryActivityFilter::Inputs
+getChemistryInputs(State& S, const std::vector<Key>& keys, const Tag& tag, const Key& requestor);
+
+} // namespace Amanzi
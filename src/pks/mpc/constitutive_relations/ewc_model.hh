@@ -41,6 +41,42 @@ class EWCModel {
   InverseEvaluate(double energy, double wc, double& T, double& p, bool verbose = false) = 0;
   virtual int InverseEvaluateEnergy(double energy, double p, double& T) = 0;
 
+  // Batched inverse evaluation for cells[0], ..., cells[n-1].  On return
+  // ierr[k] holds the error code InverseEvaluate() would have returned for
+  // cells[k], and T[k], p[k] are overwritten only where ierr[k] == 0.  If
+  // given, steps[k] is the number of Newton steps taken, or -1 if unknown.
+  // The default simply loops over the cells.
+  virtual void InverseEvaluateBatch(const Teuchos::Ptr<State>& S,
+                                    int n,
+                                    const int* cells,
+                                    const double* energy,
+                                    const double* wc,
+                                    double* T,
+                                    double* p,
+                                    int* ierr,
+                                    int* steps = nullptr)
+  {
+    for (int k = 0; k != n; ++k) {
+      UpdateModel(S, cells[k]);
+      ierr[k] = InverseEvaluate(energy[k], wc[k], T[k], p[k]);
+      if (steps) steps[k] = -1;
+    }
+  }
+
+  virtual void InverseEvaluateEnergyBatch(const Teuchos::Ptr<State>& S,
+                                          int n,
+                                          const int* cells,
+                                          const double* energy,
+                                          const double* p,
+                                          double* T,
+                                          int* ierr)
+  {
+    for (int k = 0; k != n; ++k) {
+      UpdateModel(S, cells[k]);
+      ierr[k] = InverseEvaluateEnergy(energy[k], p[k], T[k]);
+    }
+  }
+
   virtual int
   EvaluateSaturations(double T, double p, double& s_gas, double& s_liq, double& s_ice) = 0;
 };
@@ -15,6 +15,9 @@ evaluating.
 
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <cmath>
+
 #include "ewc_model_base.hh"
 
 #define DEBUG_FLAG 0
@@ -346,6 +349,296 @@ EWCModelBase::InverseEvaluateEnergy(double energy, double p, double& T)
 }
 
 
+/* ----------------------------------------------------------------------
+Batched version of InverseEvaluate().  All cells take Newton steps in
+lockstep; error codes per cell are as for InverseEvaluate().
+---------------------------------------------------------------------- */
+void
+EWCModelBase::InverseEvaluateBatch(const Teuchos::Ptr<State>& S,
+                                   int n,
+                                   const int* cells,
+                                   const double* energy,
+                                   const double* wc,
+                                   double* T,
+                                   double* p,
+                                   int* ierr,
+                                   int* steps)
+{
+  const double T_corr_cap = 2.;
+  const double p_corr_cap = 200000.;
+  const double tol = 1.e-6;
+  const int max_steps = 100;
+
+  BatchWorkspace& w = ws_;
+  w.resize(n);
+  BeginBatch_(S);
+
+  // evaluate residual and, optionally, Jacobian at the trial iterate of
+  // cell k, deactivating it on failure
+  auto evaluate = [&](int k, bool jacobian) {
+    SetBatchCell_(S, cells[k]);
+    double res[2], jac[4];
+    int ierr_k;
+    if (jacobian) {
+      ierr_k = EvaluateEnergyAndWaterContentAndJacobian_(w.T_tmp[k], w.p_tmp[k], res, jac);
+    } else {
+      AmanziGeometry::Point res_pt(2);
+      ierr_k = EvaluateEnergyAndWaterContent_(w.T_tmp[k], w.p_tmp[k], res_pt);
+      res[0] = res_pt[0];
+      res[1] = res_pt[1];
+    }
+    if (ierr_k) {
+      ierr[k] = ierr_k + 10;
+      w.active[k] = 0;
+      return;
+    }
+    w.res_e[k] = res[0] - energy[k];
+    w.res_wc[k] = res[1] - wc[k];
+    w.norm_new[k] = std::sqrt(w.res_e[k] * w.res_e[k] + w.res_wc[k] * w.res_wc[k]);
+    if (jacobian) {
+      w.j00[k] = jac[0];
+      w.j01[k] = jac[1];
+      w.j10[k] = jac[2];
+      w.j11[k] = jac[3];
+    }
+  };
+
+  // initial residual
+  for (int k = 0; k != n; ++k) {
+    ierr[k] = 0;
+    if (steps) steps[k] = 0;
+    w.active[k] = 1;
+    w.T[k] = w.T_tmp[k] = T[k];
+    w.p[k] = w.p_tmp[k] = p[k];
+    evaluate(k, true);
+    if (w.active[k]) {
+      w.norm[k] = w.norm_new[k];
+      if (w.norm[k] < tol) w.active[k] = 0;
+    }
+  }
+
+  int n_active = std::count(w.active.begin(), w.active.begin() + n, 1);
+  int stepnum = 0;
+  while (n_active > 0) {
+    // capped Newton correction
+    for (int k = 0; k != n; ++k) {
+      if (!w.active[k]) continue;
+      double detJ = w.j00[k] * w.j11[k] - w.j01[k] * w.j10[k];
+      if (std::abs(detJ) < 1.e-20) {
+        ierr[k] = 1;
+        w.active[k] = 0;
+        continue;
+      }
+      double dT = (w.j11[k] * w.res_e[k] - w.j01[k] * w.res_wc[k]) / detJ;
+      double dp = (w.j00[k] * w.res_wc[k] - w.j10[k] * w.res_e[k]) / detJ;
+
+      double scale = 1.;
+      if (std::abs(dT) > T_corr_cap) scale = T_corr_cap / std::abs(dT);
+      if (std::abs(dp) > p_corr_cap) scale = std::min(scale, p_corr_cap / std::abs(dp));
+      w.dT[k] = scale * dT;
+      w.dp[k] = scale * dp;
+
+      w.T_tmp[k] = w.T[k] - w.dT[k];
+      w.p_tmp[k] = w.p[k] - w.dp[k];
+      w.damp[k] = 1.;
+      w.need_jac[k] = 0;
+    }
+
+    // perform the update
+    for (int k = 0; k != n; ++k) {
+      if (w.active[k]) evaluate(k, true);
+    }
+
+    // backtrack cells whose residual grew
+    bool backtracking = true;
+    while (backtracking) {
+      backtracking = false;
+      for (int k = 0; k != n; ++k) {
+        w.backtrack[k] = w.active[k] && w.norm_new[k] > w.norm[k];
+        if (w.backtrack[k]) {
+          w.damp[k] *= 0.5;
+          w.T_tmp[k] = w.T[k] - w.damp[k] * w.dT[k];
+          w.p_tmp[k] = w.p[k] - w.damp[k] * w.dp[k];
+          w.need_jac[k] = 1;
+          backtracking = true;
+        }
+      }
+      for (int k = 0; k != n; ++k) {
+        if (w.backtrack[k]) evaluate(k, false);
+      }
+    }
+
+    // must recalculate the Jacobian at backtracked values
+    for (int k = 0; k != n; ++k) {
+      if (w.active[k] && w.need_jac[k]) evaluate(k, true);
+    }
+
+    // iterate and check convergence
+    ++stepnum;
+    n_active = 0;
+    for (int k = 0; k != n; ++k) {
+      if (!w.active[k]) continue;
+      w.T[k] = w.T_tmp[k];
+      w.p[k] = w.p_tmp[k];
+      w.norm[k] = w.norm_new[k];
+
+      double corr_T = w.damp[k] * w.dT[k];
+      double corr_p = w.damp[k] * w.dp[k] / 100000.;
+      bool converged =
+        w.norm[k] < tol || std::sqrt(corr_T * corr_T + corr_p * corr_p) < 1.e-10;
+      if (converged) {
+        w.active[k] = 0;
+        if (steps) steps[k] = stepnum;
+      } else if (stepnum > max_steps) {
+        ierr[k] = 2;
+        w.active[k] = 0;
+      } else {
+        ++n_active;
+      }
+    }
+  }
+
+  for (int k = 0; k != n; ++k) {
+    if (ierr[k] == 0) {
+      T[k] = w.T[k];
+      p[k] = w.p[k];
+    }
+  }
+}
+
+
+/* ----------------------------------------------------------------------
+Batched version of InverseEvaluateEnergy().
+---------------------------------------------------------------------- */
+void
+EWCModelBase::InverseEvaluateEnergyBatch(const Teuchos::Ptr<State>& S,
+                                         int n,
+                                         const int* cells,
+                                         const double* energy,
+                                         const double* p,
+                                         double* T,
+                                         int* ierr)
+{
+  const double T_corr_cap = 2.;
+  const double tol = 1.e-6;
+  const int max_steps = 100;
+
+  BatchWorkspace& w = ws_;
+  w.resize(n);
+  BeginBatch_(S);
+
+  auto evaluate = [&](int k, bool jacobian) {
+    SetBatchCell_(S, cells[k]);
+    double res[2], jac[4];
+    int ierr_k;
+    if (jacobian) {
+      ierr_k = EvaluateEnergyAndWaterContentAndJacobian_(w.T_tmp[k], p[k], res, jac);
+    } else {
+      AmanziGeometry::Point res_pt(2);
+      ierr_k = EvaluateEnergyAndWaterContent_(w.T_tmp[k], p[k], res_pt);
+      res[0] = res_pt[0];
+    }
+    if (ierr_k) {
+      ierr[k] = ierr_k + 10;
+      w.active[k] = 0;
+      return;
+    }
+    w.res_e[k] = res[0] - energy[k];
+    w.norm_new[k] = std::abs(w.res_e[k]);
+    if (jacobian) w.j00[k] = jac[0];
+  };
+
+  for (int k = 0; k != n; ++k) {
+    ierr[k] = 0;
+    w.active[k] = 1;
+    w.T[k] = w.T_tmp[k] = T[k];
+    evaluate(k, true);
+    if (w.active[k]) {
+      w.norm[k] = w.norm_new[k];
+      if (w.norm[k] < tol) w.active[k] = 0;
+    }
+  }
+
+  int n_active = std::count(w.active.begin(), w.active.begin() + n, 1);
+  int stepnum = 0;
+  while (n_active > 0) {
+    for (int k = 0; k != n; ++k) {
+      if (!w.active[k]) continue;
+      if (std::abs(w.j00[k]) < 1.e-20) {
+        ierr[k] = 1;
+        w.active[k] = 0;
+        continue;
+      }
+      double dT = w.res_e[k] / w.j00[k];
+      if (std::abs(dT) > T_corr_cap) dT = dT / std::abs(dT) * T_corr_cap;
+      w.dT[k] = dT;
+      w.T_tmp[k] = w.T[k] - dT;
+      w.damp[k] = 1.;
+      w.need_jac[k] = 0;
+    }
+
+    for (int k = 0; k != n; ++k) {
+      if (w.active[k]) evaluate(k, true);
+    }
+
+    bool backtracking = true;
+    while (backtracking) {
+      backtracking = false;
+      for (int k = 0; k != n; ++k) {
+        w.backtrack[k] = w.active[k] && w.norm_new[k] > w.norm[k];
+        if (w.backtrack[k]) {
+          w.damp[k] *= 0.5;
+          w.T_tmp[k] = w.T[k] - w.damp[k] * w.dT[k];
+          w.need_jac[k] = 1;
+          backtracking = true;
+        }
+      }
+      for (int k = 0; k != n; ++k) {
+        if (w.backtrack[k]) evaluate(k, false);
+      }
+    }
+
+    for (int k = 0; k != n; ++k) {
+      if (w.active[k] && w.need_jac[k]) evaluate(k, true);
+    }
+
+    ++stepnum;
+    n_active = 0;
+    for (int k = 0; k != n; ++k) {
+      if (!w.active[k]) continue;
+      w.T[k] = w.T_tmp[k];
+      w.norm[k] = w.norm_new[k];
+
+      bool converged = w.norm[k] < tol || std::abs(w.dT[k]) < 1.e-3;
+      if (converged) {
+        w.active[k] = 0;
+      } else if (stepnum > max_steps) {
+        ierr[k] = 2;
+        w.active[k] = 0;
+      } else {
+        ++n_active;
+      }
+    }
+  }
+
+  for (int k = 0; k != n; ++k) {
+    if (ierr[k] == 0) T[k] = w.T[k];
+  }
+}
+
+
+void
+EWCModelBase::BatchWorkspace::resize(int n)
+{
+  if (T.size() >= n) return;
+  for (auto* v : { &T, &p, &T_tmp, &p_tmp, &res_e, &res_wc, &j00, &j01, &j10, &j11, &dT, &dp,
+                   &norm, &norm_new, &damp }) {
+    v->resize(n);
+  }
+  for (auto* v : { &active, &backtrack, &need_jac }) v->resize(n);
+}
+
+
 int
 EWCModelBase::EvaluateEnergyAndWaterContentAndJacobian_(double T,
                                                         double p,
@@ -415,4 +708,57 @@ EWCModelBase::EvaluateEnergyAndWaterContentAndJacobian_FD_(double T,
 }
 
 
+int
+EWCModelBase::EvaluateEnergyAndWaterContentAndJacobian_(double T,
+                                                        double p,
+                                                        double* result,
+                                                        double* jac)
+{
+  double eps_T = 1.e-7;
+  double eps_p = 1.e-3;
+
+  AmanziGeometry::Point res(2), test(2), test2(2);
+  int ierr = EvaluateEnergyAndWaterContent_(T, p, res);
+  if (ierr) return ierr;
+  result[0] = res[0];
+  result[1] = res[1];
+
+  // d / dT
+  bool done = false;
+  int its = 0;
+  while (!done) {
+    ierr = EvaluateEnergyAndWaterContent_(T + eps_T, p, test);
+    if (ierr) return ierr;
+
+    jac[0] = (test[0] - res[0]) / (eps_T);
+    jac[2] = (test[1] - res[1]) / (eps_T);
+
+    its++;
+    done = (std::abs(jac[0]) > 1.e-12) || (std::abs(jac[2]) > 1.e-12);
+    done |= (its > 30);
+    eps_T *= 2;
+  }
+
+  // d / dp, centered
+  done = false;
+  its = 0;
+  while (!done) {
+    ierr = EvaluateEnergyAndWaterContent_(T, p + eps_p, test);
+    if (ierr) return ierr;
+    ierr = EvaluateEnergyAndWaterContent_(T, p - eps_p, test2);
+    if (ierr) return ierr;
+
+    jac[1] = (test[0] - test2[0]) / (2 * eps_p);
+    jac[3] = (test[1] - test2[1]) / (2 * eps_p);
+
+    its++;
+    done = (std::abs(jac[1]) > 1.e-12) || (std::abs(jac[3]) > 1.e-12);
+    done |= (its > 30);
+    eps_p *= 2;
+  }
+
+  return 0;
+}
+
+
 } // namespace Amanzi
@@ -13,11 +13,20 @@ ATS
 EWCModelBase provides some of the functionality of EWCModel for inverse
 evaluating.
 
+The batched inverse evaluations iterate all cells of the batch in lockstep,
+using the same damped, backtracking Newton method as the scalar versions.  The
+Newton updates, caps, and convergence checks are done on structure-of-arrays
+workspaces with converged or failed cells masked off; only model evaluations
+are done cell by cell.  Workspaces are kept between calls, so repeated calls
+with batches of similar size do not allocate.
+
 ------------------------------------------------------------------------- */
 
 #ifndef AMANZI_EWC_MODEL_BASE_HH_
 #define AMANZI_EWC_MODEL_BASE_HH_
 
+#include <vector>
+
 #include "Tensor.hh"
 #include "Point.hh"
 
@@ -35,7 +44,30 @@ class EWCModelBase : public EWCModel {
   InverseEvaluate(double energy, double wc, double& T, double& p, bool verbose = false) override;
   virtual int InverseEvaluateEnergy(double energy, double p, double& T) override;
 
+  virtual void InverseEvaluateBatch(const Teuchos::Ptr<State>& S,
+                                    int n,
+                                    const int* cells,
+                                    const double* energy,
+                                    const double* wc,
+                                    double* T,
+                                    double* p,
+                                    int* ierr,
+                                    int* steps = nullptr) override;
+  virtual void InverseEvaluateEnergyBatch(const Teuchos::Ptr<State>& S,
+                                          int n,
+                                          const int* cells,
+                                          const double* energy,
+                                          const double* p,
+                                          double* T,
+                                          int* ierr) override;
+
  protected:
+  // Called once per batch, then before each evaluation for cell c.  The
+  // default calls UpdateModel(); models may override to cache what
+  // UpdateModel() looks up in State.
+  virtual void BeginBatch_(const Teuchos::Ptr<State>& S) {}
+  virtual void SetBatchCell_(const Teuchos::Ptr<State>& S, int c) { UpdateModel(S, c); }
+
   virtual int EvaluateEnergyAndWaterContent_(double T, double p, AmanziGeometry::Point& result) = 0;
 
   int EvaluateEnergyAndWaterContentAndJacobian_(double T,
@@ -47,6 +79,23 @@ class EWCModelBase : public EWCModel {
                                                    double p,
                                                    AmanziGeometry::Point& result,
                                                    WhetStone::Tensor& jac);
+
+  // allocation-free version: result = (energy, wc), jac is row-major 2x2
+  int EvaluateEnergyAndWaterContentAndJacobian_(double T, double p, double* result, double* jac);
+
+ private:
+  // structure-of-arrays workspace for the batched inverse evaluations
+  struct BatchWorkspace {
+    void resize(int n);
+
+    std::vector<double> T, p, T_tmp, p_tmp;  // iterate and trial iterate
+    std::vector<double> res_e, res_wc;       // residual at the trial iterate
+    std::vector<double> j00, j01, j10, j11;  // Jacobian at the trial iterate
+    std::vector<double> dT, dp;              // capped Newton correction
+    std::vector<double> norm, norm_new, damp;
+    std::vector<char> active, backtrack, need_jac;
+  };
+  BatchWorkspace ws_;
 };
 
 } // namespace Amanzi
@@ -175,6 +175,29 @@ PermafrostModel::UpdateModel(const Teuchos::Ptr<State>& S, int c)
   AMANZI_ASSERT(IsSetUp_());
 }
 
+// Look up State data once per batch, rather than once per cell evaluation.
+void
+PermafrostModel::BeginBatch_(const Teuchos::Ptr<State>& S)
+{
+  p_atm_ = S->Get<double>("atmospheric_pressure", Tags::DEFAULT);
+  rho_rock_batch_ =
+    S->Get<CompositeVector>(Keys::getKey(domain, "density_rock"), tag_).ViewComponent("cell").get();
+  poro_batch_ =
+    S->Get<CompositeVector>(Keys::getKey(domain, "base_porosity"), tag_).ViewComponent("cell").get();
+}
+
+void
+PermafrostModel::SetBatchCell_(const Teuchos::Ptr<State>& S, int c)
+{
+  rho_rock_ = (*rho_rock_batch_)[0][c];
+  poro_ = (*poro_batch_)[0][c];
+  wrm_ = wrms_->second[(*wrms_->first)[c]];
+  if (!poro_leij_)
+    poro_model_ = poro_models_->second[(*poro_models_->first)[c]];
+  else
+    poro_leij_model_ = poro_leij_models_->second[(*poro_leij_models_->first)[c]];
+}
+
 bool
 PermafrostModel::IsSetUp_()
 {
@@ -60,6 +60,9 @@ class PermafrostModel : public EWCModelBase {
  protected:
   bool IsSetUp_();
 
+  virtual void BeginBatch_(const Teuchos::Ptr<State>& S) override;
+  virtual void SetBatchCell_(const Teuchos::Ptr<State>& S, int c) override;
+
   int EvaluateEnergyAndWaterContent_(double T, double p, AmanziGeometry::Point& result) override;
 
  protected:
@@ -85,6 +88,10 @@ class PermafrostModel : public EWCModelBase {
   double p_atm_;
   double poro_;
   double rho_rock_;
+
+  // cell data cached for batched evaluation
+  const Epetra_MultiVector* rho_rock_batch_;
+  const Epetra_MultiVector* poro_batch_;
   bool poro_leij_;
   Key domain;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
@@ -47,6 +47,7 @@ respective methods.
 
 #include "PK.hh"
 #include "PK_Factory.hh"
+#include "pk_profiler.hh"
 
 namespace Amanzi {
 
@@ -194,7 +195,11 @@ MPC<PK_t>::CommitStep(double t_old, double t_new, const Tag& tag)
 {
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "commiting step @ " << tag << std::endl;
-  for (auto& pk : sub_pks_) { pk->CommitStep(t_old, t_new, tag); }
+  PKProfiler::Scope profile(name(), "CommitStep");
+  for (auto& pk : sub_pks_) {
+    PKProfiler::Scope profile_sub(pk->name(), "CommitStep");
+    pk->CommitStep(t_old, t_new, tag);
+  }
 };
 
 
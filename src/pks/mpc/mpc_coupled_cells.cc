@@ -43,6 +43,8 @@
 #include "Operator.hh"
 #include "TreeOperator.hh"
 #include "PDE_Accumulation.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 
 #include "mpc_coupled_cells.hh"
 
@@ -129,12 +131,13 @@ MPCCoupledCells::Setup()
 void
 MPCCoupledCells::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   StrongMPC<PK_PhysicalBDF_Default>::UpdatePreconditioner(t, up, h);
 
   if (dA_dy2_ != Teuchos::null &&
       S_->GetEvaluator(A_key_, tag_next_).IsDifferentiableWRT(*S_, y2_key_, tag_next_)) {
     dA_dy2_->global_operator()->Init();
-    S_->GetEvaluator(A_key_, tag_next_).UpdateDerivative(*S_, name_, y2_key_, tag_next_);
+    updateEvaluatorDerivative(A_key_, tag_next_, *S_, name_, y2_key_, tag_next_);
     Teuchos::RCP<const CompositeVector> dA_dy2_v =
       S_->GetDerivativePtr<CompositeVector>(A_key_, tag_next_, y2_key_, tag_next_);
     db_->WriteVector("  dwc_dT", dA_dy2_v.ptr());
@@ -146,7 +149,7 @@ MPCCoupledCells::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> u
   if (dB_dy1_ != Teuchos::null &&
       S_->GetEvaluator(B_key_, tag_next_).IsDifferentiableWRT(*S_, y1_key_, tag_next_)) {
     dB_dy1_->global_operator()->Init();
-    S_->GetEvaluator(B_key_, tag_next_).UpdateDerivative(*S_, name_, y1_key_, tag_next_);
+    updateEvaluatorDerivative(B_key_, tag_next_, *S_, name_, y1_key_, tag_next_);
     Teuchos::RCP<const CompositeVector> dB_dy1_v =
       S_->GetDerivativePtr<CompositeVector>(B_key_, tag_next_, y1_key_, tag_next_);
     db_->WriteVector("  dE_dp", dB_dy1_v.ptr());
@@ -161,6 +164,7 @@ MPCCoupledCells::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> u
 int
 MPCCoupledCells::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   // write residuals
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
     *vo_->os() << "Residuals:" << std::endl;
@@ -173,7 +177,11 @@ MPCCoupledCells::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::
     db_->WriteVectors(vnames, vecs, true);
   }
 
-  int ierr = preconditioner_->ApplyInverse(*u, *Pu);
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = preconditioner_->ApplyInverse(*u, *Pu);
+  }
 
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
     *vo_->os() << "PC * residuals:" << std::endl;
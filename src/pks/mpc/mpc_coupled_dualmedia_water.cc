@@ -10,6 +10,7 @@
 #include "Teuchos_XMLParameterListHelpers.hpp"
 #include "EpetraExt_RowMatrixOut.h"
 
+#include "pk_profiler.hh"
 #include "mpc_coupled_dualmedia_water.hh"
 
 namespace Amanzi {
@@ -132,6 +133,7 @@ MPCCoupledDualMediaWater::FunctionalResidual(double t_old,
                                              Teuchos::RCP<TreeVector> u_new,
                                              Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // propagate updated info into state
   Solution_to_State(*u_new, S_next_);
 
@@ -155,6 +157,7 @@ int
 MPCCoupledDualMediaWater::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                               Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   int ierr;
 
   return (ierr > 0) ? 0 : 1;
@@ -166,6 +169,7 @@ MPCCoupledDualMediaWater::UpdatePreconditioner(double t,
                                                Teuchos::RCP<const TreeVector> up,
                                                double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
 }
@@ -26,7 +26,10 @@ MPCCoupledReactiveTransport::MPCCoupledReactiveTransport(
   const Teuchos::RCP<Teuchos::ParameterList>& global_list,
   const Teuchos::RCP<State>& S,
   const Teuchos::RCP<TreeVector>& soln)
-  : PK(pk_tree, global_list, S, soln), WeakMPC(pk_tree, global_list, S, soln)
+  : PK(pk_tree, global_list, S, soln),
+    WeakMPC(pk_tree, global_list, S, soln),
+    chem_filter_(*plist_),
+    chem_filter_surf_(*plist_)
 {
   chem_step_succeeded_ = true;
 
@@ -45,6 +48,8 @@ MPCCoupledReactiveTransport::MPCCoupledReactiveTransport(
   mol_dens_key_ = Keys::readKey(*plist_, domain_, "molar density liquid", "molar_density_liquid");
   mol_dens_surf_key_ =
     Keys::readKey(*plist_, domain_surf_, "surface molar density liquid", "molar_density_liquid");
+  sat_key_ = Keys::readKey(*plist_, domain_, "saturation liquid", "saturation_liquid");
+  pd_surf_key_ = Keys::readKey(*plist_, domain_surf_, "surface ponded depth", "ponded_depth");
 }
 
 
@@ -133,13 +138,13 @@ MPCCoupledReactiveTransport::Initialize()
   // of concentration itself, but should work for all other problems?
   Teuchos::RCP<Epetra_MultiVector> tcc_surf =
     S_->GetW<CompositeVector>(tcc_surf_key_, tag_next_, "state").ViewComponent("cell", true);
-  S_->GetEvaluator(mol_dens_surf_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mol_dens_surf_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens_surf =
     S_->Get<CompositeVector>(mol_dens_surf_key_, tag_next_).ViewComponent("cell", true);
 
   Teuchos::RCP<Epetra_MultiVector> tcc =
     S_->GetW<CompositeVector>(tcc_key_, tag_next_, "state").ViewComponent("cell", true);
-  S_->GetEvaluator(mol_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mol_dens_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens =
     S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
 
@@ -158,11 +163,37 @@ MPCCoupledReactiveTransport::Initialize()
   convertConcentrationToATS(*mol_dens_surf, num_aqueous, *tcc_surf, *tcc_surf);
   convertConcentrationToATS(*mol_dens, num_aqueous, *tcc, *tcc);
 
+  // skipped cells would drop kinetic reactions
+  if (chem_filter_surf_.enabled() && hasKineticReactions(*chemistry_pk_surf_)) {
+    chem_filter_surf_.set_has_kinetics(true);
+    if (vo_->os_OK(Teuchos::VERB_LOW))
+      *vo_->os() << "Chemistry on \"" << domain_surf_
+                 << "\" has kinetic reactions: no cells will be skipped." << std::endl;
+  }
+  if (chem_filter_.enabled() && hasKineticReactions(*chemistry_pk_)) {
+    chem_filter_.set_has_kinetics(true);
+    if (vo_->os_OK(Teuchos::VERB_LOW))
+      *vo_->os() << "Chemistry on \"" << domain_
+                 << "\" has kinetic reactions: no cells will be skipped." << std::endl;
+  }
+
   transport_pk_surf_->Initialize();
   transport_pk_->Initialize();
 }
 
 
+// -----------------------------------------------------------------------------
+// The recorded chemistry inputs belong to the failed step.
+// -----------------------------------------------------------------------------
+void
+MPCCoupledReactiveTransport::FailStep(double t_old, double t_new, const Tag& tag)
+{
+  WeakMPC::FailStep(t_old, t_new, tag);
+  chem_filter_.Reset();
+  chem_filter_surf_.Reset();
+}
+
+
 // -----------------------------------------------------------------------------
 // Calculate the min of sub PKs timestep sizes.
 // -----------------------------------------------------------------------------
@@ -200,40 +231,59 @@ MPCCoupledReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit
   // Chemistry on the surface
   Teuchos::RCP<Epetra_MultiVector> tcc_surf =
     S_->GetW<CompositeVector>(tcc_surf_key_, tag_next_, "state").ViewComponent("cell", true);
-  S_->GetEvaluator(mol_dens_surf_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mol_dens_surf_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens_surf =
     S_->Get<CompositeVector>(mol_dens_surf_key_, tag_next_).ViewComponent("cell", true);
-  fail = advanceChemistry(
-    chemistry_pk_surf_, t_old, t_new, reinit, *mol_dens_surf, tcc_surf, *alquimia_surf_timer_);
-  changedEvaluatorPrimary(tcc_surf_key_, tag_next_, *S_);
-  if (fail) {
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-      *vo_->os() << chemistry_pk_surf_->name() << " failed." << std::endl;
-    return fail;
-  } else {
-    transport_pk_surf_->debugger()->WriteCellVector("tcc (chem)", *tcc_surf);
-    transport_pk_surf_->VV_PrintSoluteExtrema(*tcc_surf, t_new - t_old);
+  ChemistryActivityFilter::Inputs chem_inputs_surf;
+  std::vector<bool> active_surf;
+  if (chem_filter_surf_.enabled()) {
+    chem_inputs_surf = getChemistryInputs(
+      *S_, { tcc_surf_key_, mol_dens_surf_key_, pd_surf_key_ }, tag_next_, name_);
+  }
+  if (isChemistryActive_(chem_filter_surf_, chem_inputs_surf, domain_surf_, active_surf)) {
+    fail = advanceChemistry(
+      chemistry_pk_surf_, t_old, t_new, reinit, *mol_dens_surf, tcc_surf, *alquimia_surf_timer_);
+    changedEvaluatorPrimary(tcc_surf_key_, tag_next_, *S_);
+    if (fail) {
+      if (vo_->os_OK(Teuchos::VERB_MEDIUM))
+        *vo_->os() << chemistry_pk_surf_->name() << " failed." << std::endl;
+      return fail;
+    } else {
+      if (chem_filter_surf_.enabled()) chem_filter_surf_.Record(chem_inputs_surf);
+      transport_pk_surf_->debugger()->WriteCellVector("tcc (chem)", *tcc_surf);
+      transport_pk_surf_->VV_PrintSoluteExtrema(*tcc_surf, t_new - t_old);
+    }
   }
 
   // Chemistry in the subsurface
   Teuchos::RCP<Epetra_MultiVector> tcc =
     S_->GetW<CompositeVector>(tcc_key_, tag_next_, "state").ViewComponent("cell", true);
-  S_->GetEvaluator(mol_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mol_dens_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens =
     S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
-  try {
-    fail = advanceChemistry(chemistry_pk_, t_old, t_new, reinit, *mol_dens, tcc, *alquimia_timer_);
-    changedEvaluatorPrimary(tcc_key_, tag_next_, *S_);
-  } catch (const Errors::Message& chem_error) {
-    fail = true;
+  ChemistryActivityFilter::Inputs chem_inputs;
+  std::vector<bool> active;
+  if (chem_filter_.enabled()) {
+    chem_inputs =
+      getChemistryInputs(*S_, { tcc_key_, mol_dens_key_, sat_key_ }, tag_next_, name_);
   }
-  if (fail) {
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-      *vo_->os() << chemistry_pk_->name() << " failed." << std::endl;
-    return fail;
-  } else {
-    transport_pk_->debugger()->WriteCellVector("tcc (chem)", *tcc);
-    transport_pk_->VV_PrintSoluteExtrema(*tcc, t_new - t_old);
+  if (isChemistryActive_(chem_filter_, chem_inputs, domain_, active)) {
+    try {
+      fail =
+        advanceChemistry(chemistry_pk_, t_old, t_new, reinit, *mol_dens, tcc, *alquimia_timer_);
+      changedEvaluatorPrimary(tcc_key_, tag_next_, *S_);
+    } catch (const Errors::Message& chem_error) {
+      fail = true;
+    }
+    if (fail) {
+      if (vo_->os_OK(Teuchos::VERB_MEDIUM))
+        *vo_->os() << chemistry_pk_->name() << " failed." << std::endl;
+      return fail;
+    } else {
+      if (chem_filter_.enabled()) chem_filter_.Record(chem_inputs);
+      transport_pk_->debugger()->WriteCellVector("tcc (chem)", *tcc);
+      transport_pk_->VV_PrintSoluteExtrema(*tcc, t_new - t_old);
+    }
   }
 
   chem_step_succeeded_ = true;
@@ -241,4 +291,24 @@ MPCCoupledReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit
 };
 
 
+// -----------------------------------------------------------------------------
+// Does chemistry on this domain need to be solved this step?
+// -----------------------------------------------------------------------------
+bool
+MPCCoupledReactiveTransport::isChemistryActive_(const ChemistryActivityFilter& filter,
+                                                const ChemistryActivityFilter::Inputs& inputs,
+                                                const Key& domain,
+                                                std::vector<bool>& active)
+{
+  if (!filter.enabled()) return true;
+  int n_active_l = filter.FindActive(inputs, active);
+  int n_active = 0;
+  inputs[0]->Comm().SumAll(&n_active_l, &n_active, 1);
+  if (vo_->os_OK(Teuchos::VERB_HIGH))
+    *vo_->os() << "Chemistry on \"" << domain << "\": " << n_active << " active cells."
+               << std::endl;
+  return n_active > 0;
+}
+
+
 } // namespace Amanzi
@@ -23,6 +23,7 @@
 #include "mpc_coupled_transport.hh"
 #include "transport_ats.hh"
 #include "Chemistry_PK.hh"
+#include "chemistry_activity_filter.hh"
 #include "weak_mpc.hh"
 
 namespace Amanzi {
@@ -39,9 +40,14 @@ class MPCCoupledReactiveTransport : public WeakMPC {
   virtual void Setup() override;
   virtual void Initialize() override;
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit = false) override;
+  virtual void FailStep(double t_old, double t_new, const Tag& tag) override;
 
  protected:
   virtual void cast_sub_pks_();
+  bool isChemistryActive_(const ChemistryActivityFilter& filter,
+                          const ChemistryActivityFilter::Inputs& inputs,
+                          const Key& domain,
+                          std::vector<bool>& active);
 
  protected:
   bool chem_step_succeeded_;
@@ -49,9 +55,13 @@ class MPCCoupledReactiveTransport : public WeakMPC {
   Key domain_, domain_surf_;
   Key tcc_key_, tcc_surf_key_;
   Key mol_dens_key_, mol_dens_surf_key_;
+  Key sat_key_, pd_surf_key_;
 
   Teuchos::RCP<Teuchos::Time> alquimia_timer_, alquimia_surf_timer_;
 
+  // skip the cells whose chemistry inputs have not changed
+  ChemistryActivityFilter chem_filter_, chem_filter_surf_;
+
   // storage for the component concentration intermediate values
   Teuchos::RCP<MPCCoupledTransport> coupled_transport_pk_;
   Teuchos::RCP<WeakMPC> coupled_chemistry_pk_;
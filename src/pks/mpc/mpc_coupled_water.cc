@@ -12,6 +12,7 @@
 #include "EpetraExt_RowMatrixOut.h"
 
 #include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "mpc_surface_subsurface_helpers.hh"
 #include "mpc_coupled_water.hh"
 
@@ -46,6 +47,7 @@ MPCCoupledWater::Setup()
   // grab the meshes
   surf_mesh_ = S_->GetMesh(domain_surf_);
   domain_mesh_ = S_->GetMesh(domain_ss_);
+  surf_sub_map_ = Teuchos::rcp(new SurfaceSubsurfaceMap(surf_mesh_, domain_mesh_));
 
   // cast the PKs
   domain_flow_pk_ = sub_pks_[0];
@@ -129,10 +131,10 @@ MPCCoupledWater::Initialize()
   MPC<PK_PhysicalBDF_Default>::Initialize();
 
   // ensure continuity of ICs... subsurface takes precedence.
-  CopySubsurfaceToSurface(S_->Get<CompositeVector>(Keys::getKey(domain_ss_, "pressure"), tag_next_),
-                          S_->GetW<CompositeVector>(Keys::getKey(domain_surf_, "pressure"),
-                                                    tag_next_,
-                                                    sub_pks_[1]->name()));
+  surf_sub_map_->CopySubsurfaceToSurface(
+    S_->Get<CompositeVector>(Keys::getKey(domain_ss_, "pressure"), tag_next_),
+    S_->GetW<CompositeVector>(
+      Keys::getKey(domain_surf_, "pressure"), tag_next_, sub_pks_[1]->name()));
 
   // Initialize my timestepper.
   PK_BDF_Default::Initialize();
@@ -148,6 +150,7 @@ MPCCoupledWater::FunctionalResidual(double t_old,
                                     Teuchos::RCP<TreeVector> u_new,
                                     Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // propagate updated info into state
   Solution_to_State(*u_new, tag_next_);
 
@@ -175,18 +178,23 @@ MPCCoupledWater::FunctionalResidual(double t_old,
 int
 MPCCoupledWater::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon application:" << std::endl;
 
   // call the precon's inverse
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
     *vo_->os() << "Precon applying subsurface operator." << std::endl;
-  int ierr = precon_->ApplyInverse(*u->SubVector(0)->Data(), *Pu->SubVector(0)->Data());
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = precon_->ApplyInverse(*u->SubVector(0)->Data(), *Pu->SubVector(0)->Data());
+  }
 
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
     *vo_->os() << "Precon applying  CopySubsurfaceToSurface." << std::endl;
   // Copy subsurface face corrections to surface cell corrections
-  CopySubsurfaceToSurface(*Pu->SubVector(0)->Data(), *Pu->SubVector(1)->Data());
+  surf_sub_map_->CopySubsurfaceToSurface(*Pu->SubVector(0)->Data(), *Pu->SubVector(1)->Data());
 
   // // Derive surface face corrections.
   // UpdateConsistentFaceCorrectionWater_(u, Pu);
@@ -229,7 +237,8 @@ MPCCoupledWater::ModifyPredictor(double h,
   if (modified) {
     Teuchos::RCP<const CompositeVector> h_prev =
       S_->GetPtr<CompositeVector>(Keys::getKey(domain_surf_, "ponded_depth"), tag_next_);
-    MergeSubsurfaceAndSurfacePressure(*h_prev, *u->SubVector(0)->Data(), *u->SubVector(1)->Data());
+    surf_sub_map_->MergeSubsurfaceAndSurfacePressure(
+      *h_prev, *u->SubVector(0)->Data(), *u->SubVector(1)->Data());
   }
 
   // Hack surface faces
@@ -246,7 +255,7 @@ MPCCoupledWater::ModifyPredictor(double h,
 
   // -- copy surf --> sub
   if (newly_modified) {
-    CopySurfaceToSubsurface(*u->SubVector(1)->Data(), *u->SubVector(0)->Data());
+    surf_sub_map_->CopySurfaceToSubsurface(*u->SubVector(1)->Data(), *u->SubVector(0)->Data());
   }
 
   // Calculate consistent surface faces
@@ -331,7 +340,7 @@ MPCCoupledWater::ModifyCorrection(double h,
     // }
 
     // Copy subsurface face corrections to surface cell corrections
-    CopySubsurfaceToSurface(*du->SubVector(0)->Data(), *du->SubVector(1)->Data());
+    surf_sub_map_->CopySubsurfaceToSurface(*du->SubVector(0)->Data(), *du->SubVector(1)->Data());
   }
 
   // if (modified) {
@@ -367,8 +376,10 @@ MPCCoupledWater::ModifyCorrection(double h,
 }
 
 
-double
-MPCCoupledWater::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> res)
+int
+MPCCoupledWater::ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                                  Teuchos::RCP<const TreeVector> res,
+                                  ReductionBatch& batch)
 {
   // move the surface face residual onto the surface cell.
   auto res2 = Teuchos::rcp(new TreeVector(*res, INIT_MODE_COPY));
@@ -383,7 +394,7 @@ MPCCoupledWater::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const
       res_face[0][f] = 0.;
     }
   }
-  return StrongMPC<PK_PhysicalBDF_Default>::ErrorNorm(u, res2);
+  return StrongMPC<PK_PhysicalBDF_Default>::ErrorNormBatched(u, res2, batch);
 }
 
 
@@ -42,6 +42,7 @@ surface equations are directly assembled into the subsurface discrete operator.
 
 #include "Operator.hh"
 #include "mpc_delegate_water.hh"
+#include "mpc_surface_subsurface_helpers.hh"
 #include "pk_physical_bdf_default.hh"
 
 #include "strong_mpc.hh"
@@ -81,8 +82,10 @@ class MPCCoupledWater : public StrongMPC<PK_PhysicalBDF_Default> {
                    Teuchos::RCP<const TreeVector> u,
                    Teuchos::RCP<TreeVector> du) override;
 
-  virtual double
-  ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> res) override;
+  // -- Error norm, with the surface face residual moved onto surface cells.
+  virtual int ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                               Teuchos::RCP<const TreeVector> res,
+                               ReductionBatch& batch) override;
 
   Teuchos::RCP<Operators::Operator> preconditioner() { return precon_; }
 
@@ -102,6 +105,7 @@ class MPCCoupledWater : public StrongMPC<PK_PhysicalBDF_Default> {
   // sub meshes
   Teuchos::RCP<const AmanziMesh::Mesh> domain_mesh_;
   Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh_;
+  Teuchos::RCP<SurfaceSubsurfaceMap> surf_sub_map_;
 
   // coupled preconditioner
   Teuchos::RCP<Operators::Operator> precon_;
@@ -14,6 +14,8 @@ Interface for EWC, a helper class that does projections and preconditioners in
 energy/water-content space instead of temperature/pressure space.
 ------------------------------------------------------------------------- */
 #include "Evaluator.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "ewc_model.hh"
 #include "mpc_delegate_ewc.hh"
 
@@ -193,6 +195,7 @@ MPCDelegateEWC::ModifyPredictor(double h, Teuchos::RCP<TreeVector> up)
 void
 MPCDelegateEWC::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   if (precon_type_ == PRECON_EWC || precon_type_ == PRECON_SMART_EWC) {
     update_precon_ewc_(t, up, h);
   }
@@ -205,6 +208,7 @@ MPCDelegateEWC::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up
 int
 MPCDelegateEWC::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   int ierr = 0;
   if ((precon_type_ == PRECON_EWC) || (precon_type_ == PRECON_SMART_EWC)) {
     precon_ewc_(u, Pu);
@@ -218,22 +222,22 @@ MPCDelegateEWC::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::R
 void
 MPCDelegateEWC::update_precon_ewc_(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
-  S_->GetEvaluator(e_key_, tag_next_).UpdateDerivative(*S_, "ewc", temp_key_, tag_next_);
+  updateEvaluatorDerivative(e_key_, tag_next_, *S_, "ewc", temp_key_, tag_next_);
   const Epetra_MultiVector& dedT =
     *S_->GetDerivativePtr<CompositeVector>(e_key_, tag_next_, temp_key_, tag_next_)
        ->ViewComponent("cell", false);
 
-  S_->GetEvaluator(e_key_, tag_next_).UpdateDerivative(*S_, "ewc", pres_key_, tag_next_);
+  updateEvaluatorDerivative(e_key_, tag_next_, *S_, "ewc", pres_key_, tag_next_);
   const Epetra_MultiVector& dedp =
     *S_->GetDerivativePtr<CompositeVector>(e_key_, tag_next_, pres_key_, tag_next_)
        ->ViewComponent("cell", false);
 
-  S_->GetEvaluator(wc_key_, tag_next_).UpdateDerivative(*S_, "ewc", temp_key_, tag_next_);
+  updateEvaluatorDerivative(wc_key_, tag_next_, *S_, "ewc", temp_key_, tag_next_);
   const Epetra_MultiVector& dwcdT =
     *S_->GetDerivativePtr<CompositeVector>(wc_key_, tag_next_, temp_key_, tag_next_)
        ->ViewComponent("cell", false);
 
-  S_->GetEvaluator(wc_key_, tag_next_).UpdateDerivative(*S_, "ewc", pres_key_, tag_next_);
+  updateEvaluatorDerivative(wc_key_, tag_next_, *S_, "ewc", pres_key_, tag_next_);
   const Epetra_MultiVector& dwcdp =
     *S_->GetDerivativePtr<CompositeVector>(wc_key_, tag_next_, pres_key_, tag_next_)
        ->ViewComponent("cell", false);
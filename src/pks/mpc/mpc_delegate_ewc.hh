@@ -67,6 +67,14 @@ provides the initial guess to the nonlinear solve.
       over which to assume we are close to the latent heat cliff as we get
       warmer, and begins applying the EWC algorithm in `"ewc smarter`".
 
+    * `"predictor reuse tolerance`" ``[double]`` **0** The subsurface
+      predictor caches each cell's last converged inversion and uses it as the
+      initial guess when its energy and water content are closer to the new
+      target than the previous step's.  If the relative change from the cached
+      target is below this tolerance, the cached inverse is reused without a
+      solve.  The default never reuses.  Keep this at zero on deforming
+      meshes, where the inverse also depends on porosity.
+
     * `"pressure key`" ``[string]`` **DOMAIN-pressure**
     * `"temperature key`" ``[string]`` **DOMAIN-temperature**
     * `"water content key`" ``[string]`` **DOMAIN-water_content**
@@ -23,6 +23,9 @@ energy/water-content space instead of temperature/pressure space.
 #define EWC_PC_SATURATION 0
 #define EWC_PC_INCREASING_PRESSURE 0
 
+#include <algorithm>
+#include <cmath>
+
 #include "ewc_model.hh"
 #include "Evaluator.hh"
 #include "mpc_delegate_ewc_subsurface.hh"
@@ -33,7 +36,9 @@ namespace Amanzi {
 MPCDelegateEWCSubsurface::MPCDelegateEWCSubsurface(Teuchos::ParameterList& plist,
                                                    const Teuchos::RCP<State>& S)
   : MPCDelegateEWC(plist, S)
-{}
+{
+  ewc_reuse_tol_ = plist_->get<double>("predictor reuse tolerance", 0.);
+}
 
 
 bool
@@ -93,6 +98,12 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
   const Epetra_MultiVector& cv =
     *S_->GetPtr<CompositeVector>(cv_key_, tag_next_)->ViewComponent("cell", false);
 
+  // Cells needing an inversion, and which transition they are in, are
+  // collected first, then inverted together.
+  enum { FREEZING, THAWING, DRYING, WETTING };
+  ewc_cells_.clear();
+  ewc_case_.clear();
+
   int rank = mesh_->get_comm()->MyPID();
   int ncells = wc0.MyLength();
   for (int c = 0; c != ncells; ++c) {
@@ -157,27 +168,10 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
         // pass, guesses are good
 
       } else {
-        // -- invert for T,p at the projected ewc
-        ierr = model_->InverseEvaluate(e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
+        // -- invert for T,p at the projected ewc, batched below
+        ewc_cells_.push_back(c);
+        ewc_case_.push_back(FREEZING);
         ewc_completed = true;
-        if (ierr) {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-          // pass, keep the T,p projections
-        } else {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "     kept within the transition zone." << std::endl
-                        << "   p,T = " << p << ", " << T << std::endl;
-
-          // in the transition zone of latent heat exchange
-          if (T > 200.) {
-            temp_guess_c[0][c] = T;
-            pres_guess_c[0][c] = p;
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "       not admissible!" << std::endl;
-          }
-        }
       }
 #if EWC_THAWING
     } else { // increasing, thawing
@@ -194,32 +188,10 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
         // pass, guesses are good
 
       } else {
-        // in the transition zone of latent heat exchange
-        ierr = model_->InverseEvaluate(e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
+        // -- invert for T,p at the projected ewc, batched below
+        ewc_cells_.push_back(c);
+        ewc_case_.push_back(THAWING);
         ewc_completed = true;
-        if (ierr) {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-          // pass, keep the T,p projections
-        } else {
-          if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-            *dcvo->os() << "     kept within the transition zone." << std::endl
-                        << "   p,T = " << p << ", " << T << std::endl;
-
-          // two ways to get a projected T past freezing point:
-          //  -- be on the lower branch and overshoot (ewc results in smaller dT)
-          //  -- be on the middle branch and get over the hump (ewc results in much larger dT)
-          if (T - T_prev < temp_guess_c[0][c] - T_prev) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     dT_ewc < dT_std, on the lower branch, using EWC" << std::endl;
-            temp_guess_c[0][c] = T;
-            pres_guess_c[0][c] = p;
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     dT_ewc > dT_std, on the middle branch, use std prediction"
-                          << std::endl;
-          }
-        }
       }
 #endif
     }
@@ -243,26 +215,9 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
           // pass, guesses are good
 
         } else {
-          // -- invert for T,p at the projected ewc
-          ierr = model_->InverseEvaluate(e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-            // pass, keep the T,p projections
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     kept within the transition zone." << std::endl
-                          << "   p,T = " << p << ", " << T << std::endl;
-
-            // in the transition zone of latent heat exchange
-            if (T > 200.) {
-              temp_guess_c[0][c] = T;
-              pres_guess_c[0][c] = p;
-            } else {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "       not admissible!" << std::endl;
-            }
-          }
+          // -- invert for T,p at the projected ewc, batched below
+          ewc_cells_.push_back(c);
+          ewc_case_.push_back(DRYING);
         }
 
 #  if EWC_INCREASING_PRESSURE
@@ -280,37 +235,176 @@ MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<Tre
           // pass, guesses are good
 
         } else {
-          // in the transition zone of latent heat exchange
-          ierr = model_->InverseEvaluate(e2[0][c] / cv[0][c], wc2[0][c] / cv[0][c], T, p);
-          if (ierr) {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
-            // pass, keep the T,p projections
-          } else {
-            if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-              *dcvo->os() << "     kept within the transition zone." << std::endl
-                          << "   p,T = " << p << ", " << T << std::endl;
-
-            // two ways to get a projected p to saturated:
-            //  -- be on the lower branch and overshoot (ewc results in smaller dp)
-            //  -- be on the middle branch and get over the hump (ewc results in much larger dp)
-            if (p - p_prev < pres_guess_c[0][c] - p_prev) {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "     dp_ewc < dp_std, on the lower branch, using EWC" << std::endl;
-              temp_guess_c[0][c] = T;
-              pres_guess_c[0][c] = p;
-            } else {
-              if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
-                *dcvo->os() << "     dp_ewc > dp_std, on the middle branch, use std prediction"
-                            << std::endl;
-            }
-          }
+          // -- invert for T,p at the projected ewc, batched below
+          ewc_cells_.push_back(c);
+          ewc_case_.push_back(WETTING);
         }
 #  endif
       }
     }
 #endif
   }
+
+  // invert for T,p at the projected ewc
+  InverseCache& cache = ewc_cache_;
+  if (cache.valid.size() != ncells) {
+    cache.valid.assign(ncells, 0);
+    cache.e.resize(ncells);
+    cache.wc.resize(ncells);
+    cache.T.resize(ncells);
+    cache.p.resize(ncells);
+    cache.steps.resize(ncells);
+  }
+
+  // relative distance between two (e,wc) targets
+  auto distance = [](double e_a, double wc_a, double e_b, double wc_b) {
+    return std::abs(e_a - e_b) / std::max(std::abs(e_b), 1.e-10) +
+           std::abs(wc_a - wc_b) / std::max(std::abs(wc_b), 1.e-10);
+  };
+
+  // Start from whichever of the previous T,p and the cached inverse has the
+  // nearer target.  Cells whose cached target is within tolerance reuse the
+  // cached inverse; the others are moved to the front to be solved.
+  int n_ewc = ewc_cells_.size();
+  ewc_e_.resize(n_ewc);
+  ewc_wc_.resize(n_ewc);
+  ewc_T_.resize(n_ewc);
+  ewc_p_.resize(n_ewc);
+  ewc_ierr_.resize(n_ewc);
+  ewc_steps_.resize(n_ewc);
+  int n_solve = 0;
+  for (int k = 0; k != n_ewc; ++k) {
+    int c = ewc_cells_[k];
+    double e = e2[0][c] / cv[0][c];
+    double wc = wc2[0][c] / cv[0][c];
+    double T = T1[0][c];
+    double p = p1[0][c];
+    bool reuse = false;
+
+    if (cache.valid[c]) {
+      double dist_cache = distance(e, wc, cache.e[c], cache.wc[c]);
+      if (dist_cache < ewc_reuse_tol_) {
+        reuse = true;
+      } else if (dist_cache < distance(e, wc, e1[0][c] / cv[0][c], wc1[0][c] / cv[0][c])) {
+        T = cache.T[c];
+        p = cache.p[c];
+      }
+    }
+
+    if (reuse) {
+      ewc_e_[k] = e;
+      ewc_wc_[k] = wc;
+      ewc_T_[k] = cache.T[c];
+      ewc_p_[k] = cache.p[c];
+      ewc_ierr_[k] = 0;
+    } else {
+      std::swap(ewc_cells_[k], ewc_cells_[n_solve]);
+      std::swap(ewc_case_[k], ewc_case_[n_solve]);
+      ewc_e_[k] = ewc_e_[n_solve];
+      ewc_wc_[k] = ewc_wc_[n_solve];
+      ewc_T_[k] = ewc_T_[n_solve];
+      ewc_p_[k] = ewc_p_[n_solve];
+      ewc_ierr_[k] = ewc_ierr_[n_solve];
+      ewc_e_[n_solve] = e;
+      ewc_wc_[n_solve] = wc;
+      ewc_T_[n_solve] = T;
+      ewc_p_[n_solve] = p;
+      ++n_solve;
+    }
+  }
+
+  model_->InverseEvaluateBatch(S_.ptr(),
+                               n_solve,
+                               ewc_cells_.data(),
+                               ewc_e_.data(),
+                               ewc_wc_.data(),
+                               ewc_T_.data(),
+                               ewc_p_.data(),
+                               ewc_ierr_.data(),
+                               ewc_steps_.data());
+
+  int n_steps = 0;
+  for (int k = 0; k != n_solve; ++k) {
+    if (ewc_ierr_[k]) continue;
+    int c = ewc_cells_[k];
+    cache.valid[c] = 1;
+    cache.e[c] = ewc_e_[k];
+    cache.wc[c] = ewc_wc_[k];
+    cache.T[c] = ewc_T_[k];
+    cache.p[c] = ewc_p_[k];
+    cache.steps[c] = ewc_steps_[k];
+    n_steps += std::max(ewc_steps_[k], 0);
+  }
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH))
+    *vo_->os() << "  EWC predictor: inverted " << n_solve << " cells in " << n_steps
+               << " Newton steps, reused " << n_ewc - n_solve << " cached inverses" << std::endl;
+
+  for (int k = 0; k != n_ewc; ++k) {
+    int c = ewc_cells_[k];
+    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
+    if (vo_->os_OK(Teuchos::VERB_EXTREME)) dcvo = db_->GetVerboseObject(c, rank);
+    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
+
+    double T = ewc_T_[k];
+    double p = ewc_p_[k];
+    double T_prev = T1[0][c];
+    double p_prev = p1[0][c];
+
+    if (ewc_ierr_[k]) {
+      if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+        *dcvo->os() << "FAILED EWC PREDICTOR (c = " << c << ", ierr = " << ewc_ierr_[k] << ")"
+                    << std::endl;
+      // pass, keep the T,p projections
+      continue;
+    }
+
+    if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+      *dcvo->os() << "EWC predictor: c = " << c << std::endl
+                  << "     kept within the transition zone." << std::endl
+                  << "   p,T = " << p << ", " << T << std::endl;
+
+    if (ewc_case_[k] == FREEZING || ewc_case_[k] == DRYING) {
+      // in the transition zone of latent heat exchange
+      if (T > 200.) {
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "       not admissible!" << std::endl;
+      }
+
+    } else if (ewc_case_[k] == THAWING) {
+      // two ways to get a projected T past freezing point:
+      //  -- be on the lower branch and overshoot (ewc results in smaller dT)
+      //  -- be on the middle branch and get over the hump (ewc results in much larger dT)
+      if (T - T_prev < temp_guess_c[0][c] - T_prev) {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "     dT_ewc < dT_std, on the lower branch, using EWC" << std::endl;
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "     dT_ewc > dT_std, on the middle branch, use std prediction"
+                      << std::endl;
+      }
+
+    } else { // WETTING
+      // two ways to get a projected p to saturated:
+      //  -- be on the lower branch and overshoot (ewc results in smaller dp)
+      //  -- be on the middle branch and get over the hump (ewc results in much larger dp)
+      if (p - p_prev < pres_guess_c[0][c] - p_prev) {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "     dp_ewc < dp_std, on the lower branch, using EWC" << std::endl;
+        temp_guess_c[0][c] = T;
+        pres_guess_c[0][c] = p;
+      } else {
+        if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
+          *dcvo->os() << "     dp_ewc > dp_std, on the middle branch, use std prediction"
+                      << std::endl;
+      }
+    }
+  }
   return true;
 }
 
@@ -19,6 +19,8 @@ energy/water-content space instead of temperature/pressure space.
 #ifndef MPC_DELEGATE_EWC_SUBSURFACE_HH_
 #define MPC_DELEGATE_EWC_SUBSURFACE_HH_
 
+#include <vector>
+
 #include "mpc_delegate_ewc.hh"
 
 namespace Amanzi {
@@ -30,6 +32,22 @@ class MPCDelegateEWCSubsurface : public MPCDelegateEWC {
  protected:
   virtual bool modify_predictor_smart_ewc_(double h, Teuchos::RCP<TreeVector> up);
   virtual void precon_ewc_(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu);
+
+  // workspace for the batched inversions in the predictor
+  std::vector<int> ewc_cells_, ewc_case_, ewc_ierr_, ewc_steps_;
+  std::vector<double> ewc_e_, ewc_wc_, ewc_T_, ewc_p_;
+
+  // Per-cell cache of the last converged inversion: its target energy and
+  // water content (per unit volume), the resulting T,p, and the number of
+  // Newton steps it took.  Kept across steps and failed-step retries, as
+  // each entry is a valid inverse independent of the step that made it.
+  struct InverseCache {
+    std::vector<char> valid;
+    std::vector<double> e, wc, T, p;
+    std::vector<int> steps;
+  };
+  InverseCache ewc_cache_;
+  double ewc_reuse_tol_;
 };
 
 } // namespace Amanzi
@@ -21,6 +21,7 @@
 #include "energy_base.hh"
 #include "advection.hh"
 #include "pk_helpers.hh"
+#include "pk_profiler.hh"
 
 #include "mpc_permafrost.hh"
 
@@ -89,6 +90,7 @@ MPCPermafrost::Setup()
   // grab the meshes
   surf_mesh_ = S_->GetMesh(domain_surf_);
   domain_mesh_ = S_->GetMesh(domain_subsurf_);
+  surf_sub_map_ = Teuchos::rcp(new SurfaceSubsurfaceMap(surf_mesh_, domain_mesh_));
 
   // alias the PKs for easier reference
   domain_flow_pk_ = sub_pks_[0];
@@ -346,21 +348,21 @@ MPCPermafrost::Initialize()
 
   // ensure continuity of ICs... surface takes precedence if it was initialized
   if (S_->GetRecord(surf_pres_key_, tag_next_).initialized()) {
-    CopySurfaceToSubsurface(
+    surf_sub_map_->CopySurfaceToSubsurface(
       S_->Get<CompositeVector>(surf_pres_key_, tag_next_),
       S_->GetW<CompositeVector>(pres_key_, tag_next_, domain_flow_pk_->name()));
   } else {
-    CopySubsurfaceToSurface(
+    surf_sub_map_->CopySubsurfaceToSurface(
       S_->Get<CompositeVector>(pres_key_, tag_next_),
       S_->GetW<CompositeVector>(surf_pres_key_, tag_next_, surf_flow_pk_->name()));
     S_->GetRecordW(surf_pres_key_, tag_next_, surf_flow_pk_->name()).set_initialized();
   }
   if (S_->GetRecord(surf_temp_key_, tag_next_).initialized()) {
-    CopySurfaceToSubsurface(
+    surf_sub_map_->CopySurfaceToSubsurface(
       S_->Get<CompositeVector>(surf_temp_key_, tag_next_),
       S_->GetW<CompositeVector>(temp_key_, tag_next_, domain_energy_pk_->name()));
   } else {
-    CopySubsurfaceToSurface(
+    surf_sub_map_->CopySubsurfaceToSurface(
       S_->Get<CompositeVector>(temp_key_, tag_next_),
       S_->GetW<CompositeVector>(surf_temp_key_, tag_next_, surf_energy_pk_->name()));
     S_->GetRecordW(surf_temp_key_, tag_next_, surf_energy_pk_->name()).set_initialized();
@@ -404,6 +406,7 @@ MPCPermafrost::FunctionalResidual(double t_old,
                                   Teuchos::RCP<TreeVector> u_new,
                                   Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   // propagate updated info into state
   Solution_to_State(*u_new, tag_next_);
 
@@ -451,6 +454,7 @@ MPCPermafrost::FunctionalResidual(double t_old,
 int
 MPCPermafrost::ApplyPreconditioner(Teuchos::RCP<const TreeVector> r, Teuchos::RCP<TreeVector> Pr)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -490,14 +494,18 @@ MPCPermafrost::ApplyPreconditioner(Teuchos::RCP<const TreeVector> r, Teuchos::RC
   // call the operator's inverse
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
     *vo_->os() << "Precon applying coupled subsurface operator." << std::endl;
-  int ierr = preconditioner_->ApplyInverse(*domain_u_tv, *domain_Pu_tv);
+  int ierr = 0;
+  {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
+    ierr = preconditioner_->ApplyInverse(*domain_u_tv, *domain_Pu_tv);
+  }
 
   // rescale to Pa from MPa
   Pr->SubVector(0)->Data()->Scale(1.e6);
 
   // Copy subsurface face corrections to surface cell corrections
-  CopySubsurfaceToSurface(*Pr->SubVector(0)->Data(), *Pr->SubVector(2)->Data());
-  CopySubsurfaceToSurface(*Pr->SubVector(1)->Data(), *Pr->SubVector(3)->Data());
+  surf_sub_map_->CopySubsurfaceToSurface(*Pr->SubVector(0)->Data(), *Pr->SubVector(2)->Data());
+  surf_sub_map_->CopySubsurfaceToSurface(*Pr->SubVector(1)->Data(), *Pr->SubVector(3)->Data());
 
   // dump to screen
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
@@ -517,6 +525,7 @@ MPCPermafrost::ApplyPreconditioner(Teuchos::RCP<const TreeVector> r, Teuchos::RC
 void
 MPCPermafrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon update at t = " << t << std::endl;
 
@@ -529,8 +538,7 @@ MPCPermafrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
   // -- dkr/dT
   if (ddivq_dT_ != Teuchos::null) {
     // -- update and upwind d kr / dT
-    S_->GetEvaluator(surf_kr_key_, tag_next_)
-      .UpdateDerivative(*S_, name_, surf_temp_key_, tag_next_);
+    updateEvaluatorDerivative(surf_kr_key_, tag_next_, *S_, name_, surf_temp_key_, tag_next_);
     Teuchos::RCP<const CompositeVector> dkrdT =
       S_->GetDerivativePtr<CompositeVector>(surf_kr_key_, tag_next_, surf_temp_key_, tag_next_);
     Teuchos::RCP<const CompositeVector> kr_uw =
@@ -538,7 +546,7 @@ MPCPermafrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     Teuchos::RCP<const CompositeVector> flux =
       S_->GetPtr<CompositeVector>(surf_water_flux_key_, tag_next_);
 
-    S_->GetEvaluator(surf_potential_key_, tag_next_).Update(*S_, name_);
+    updateEvaluator(surf_potential_key_, tag_next_, *S_, name_);
     Teuchos::RCP<const CompositeVector> pres_elev =
       S_->GetPtr<CompositeVector>(surf_potential_key_, tag_next_);
 
@@ -551,8 +559,7 @@ MPCPermafrost::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
 
   if (precon_type_ != PRECON_NO_FLOW_COUPLING) {
     // -- surface dE_dp
-    S_->GetEvaluator(surf_e_key_, tag_next_)
-      .UpdateDerivative(*S_, name_, surf_pres_key_, tag_next_);
+    updateEvaluatorDerivative(surf_e_key_, tag_next_, *S_, name_, surf_pres_key_, tag_next_);
     Teuchos::RCP<const CompositeVector> dEdp =
       S_->GetDerivativePtr<CompositeVector>(surf_e_key_, tag_next_, surf_pres_key_, tag_next_);
     dE_dp_surf_->AddAccumulationTerm(*dEdp, h, "cell", false);
@@ -672,8 +679,9 @@ MPCPermafrost::ModifyPredictor(double h,
     Teuchos::RCP<const CompositeVector> h_prev =
       S_->GetPtr<CompositeVector>(surf_pd_key_, tag_current_);
 
-    MergeSubsurfaceAndSurfacePressure(*h_prev, *u->SubVector(0)->Data(), *u->SubVector(2)->Data());
-    CopySubsurfaceToSurface(*u->SubVector(1)->Data(), *u->SubVector(3)->Data());
+    surf_sub_map_->MergeSubsurfaceAndSurfacePressure(
+      *h_prev, *u->SubVector(0)->Data(), *u->SubVector(2)->Data());
+    surf_sub_map_->CopySubsurfaceToSurface(*u->SubVector(1)->Data(), *u->SubVector(3)->Data());
   }
 
   // Hack surface faces
@@ -717,8 +725,8 @@ MPCPermafrost::ModifyPredictor(double h,
 
   // -- copy surf --> sub
   //  if (newly_modified) {
-  CopySurfaceToSubsurface(*u->SubVector(2)->Data(), *u->SubVector(0)->Data());
-  CopySurfaceToSubsurface(*u->SubVector(3)->Data(), *u->SubVector(1)->Data());
+  surf_sub_map_->CopySurfaceToSubsurface(*u->SubVector(2)->Data(), *u->SubVector(0)->Data());
+  surf_sub_map_->CopySurfaceToSubsurface(*u->SubVector(3)->Data(), *u->SubVector(1)->Data());
   //  }
 
   // Calculate consistent surface faces
@@ -762,8 +770,8 @@ MPCPermafrost::ModifyCorrection(double h,
   AmanziSolvers::FnBaseDefs::ModifyCorrectionResult pk_modified =
     StrongMPC<PK_PhysicalBDF_Default>::ModifyCorrection(h, r, u, du);
   if (pk_modified) {
-    CopySurfaceToSubsurface(*du->SubVector(2)->Data(), *du->SubVector(0)->Data());
-    CopySurfaceToSubsurface(*du->SubVector(3)->Data(), *du->SubVector(1)->Data());
+    surf_sub_map_->CopySurfaceToSubsurface(*du->SubVector(2)->Data(), *du->SubVector(0)->Data());
+    surf_sub_map_->CopySurfaceToSubsurface(*du->SubVector(3)->Data(), *du->SubVector(1)->Data());
   }
 
   // modify correction using water approaches
@@ -802,7 +810,7 @@ MPCPermafrost::ModifyCorrection(double h,
 
   if (modified) {
     // Copy subsurface face corrections to surface cell corrections
-    CopySubsurfaceToSurface(*du->SubVector(0)->Data(), *du->SubVector(2)->Data());
+    surf_sub_map_->CopySubsurfaceToSurface(*du->SubVector(0)->Data(), *du->SubVector(2)->Data());
   }
 
   // dump modified correction to screen
@@ -42,6 +42,7 @@ and flow for integrated hydrology with freeze/thaw processes.
 
 #include "mpc_delegate_ewc.hh"
 #include "mpc_delegate_water.hh"
+#include "mpc_surface_subsurface_helpers.hh"
 #include "mpc_subsurface.hh"
 
 namespace Amanzi {
@@ -100,6 +101,7 @@ class MPCPermafrost : public MPCSubsurface {
   Key domain_subsurf_;
   Teuchos::RCP<const AmanziMesh::Mesh> domain_mesh_;
   Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh_;
+  Teuchos::RCP<SurfaceSubsurfaceMap> surf_sub_map_;
 
   // Primary variable evaluators for exchange fluxes
   Key mass_exchange_key_;
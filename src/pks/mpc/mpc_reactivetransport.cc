@@ -25,7 +25,9 @@ MPCReactiveTransport::MPCReactiveTransport(Teuchos::ParameterList& pk_tree,
                                            const Teuchos::RCP<Teuchos::ParameterList>& global_list,
                                            const Teuchos::RCP<State>& S,
                                            const Teuchos::RCP<TreeVector>& soln)
-  : PK(pk_tree, global_list, S, soln), WeakMPC(pk_tree, global_list, S, soln)
+  : PK(pk_tree, global_list, S, soln),
+    WeakMPC(pk_tree, global_list, S, soln),
+    chem_filter_(*plist_)
 {
   chem_step_succeeded_ = true;
 
@@ -35,6 +37,7 @@ MPCReactiveTransport::MPCReactiveTransport(Teuchos::ParameterList& pk_tree,
   tcc_key_ = Keys::readKey(
     *plist_, domain_, "total component concentration", "total_component_concentration");
   mol_dens_key_ = Keys::readKey(*plist_, domain_, "molar density liquid", "molar_density_liquid");
+  sat_key_ = Keys::readKey(*plist_, domain_, "saturation liquid", "saturation_liquid");
 }
 
 
@@ -90,7 +93,7 @@ MPCReactiveTransport::Initialize()
   // of concentration itself, but should work for all other problems?
   Teuchos::RCP<Epetra_MultiVector> tcc =
     S_->GetW<CompositeVector>(tcc_key_, tag_next_, "state").ViewComponent("cell", true);
-  S_->GetEvaluator(mol_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mol_dens_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens =
     S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
 
@@ -101,10 +104,28 @@ MPCReactiveTransport::Initialize()
   //*tcc = *chemistry_pk_->aqueous_components();
   convertConcentrationToATS(*mol_dens, num_aqueous, *tcc, *tcc);
 
+  // skipped cells would drop kinetic reactions
+  if (chem_filter_.enabled() && hasKineticReactions(*chemistry_pk_)) {
+    chem_filter_.set_has_kinetics(true);
+    if (vo_->os_OK(Teuchos::VERB_LOW))
+      *vo_->os() << "Chemistry has kinetic reactions: no cells will be skipped." << std::endl;
+  }
+
   transport_pk_->Initialize();
 }
 
 
+// -----------------------------------------------------------------------------
+// The recorded chemistry inputs belong to the failed step.
+// -----------------------------------------------------------------------------
+void
+MPCReactiveTransport::FailStep(double t_old, double t_new, const Tag& tag)
+{
+  WeakMPC::FailStep(t_old, t_new, tag);
+  chem_filter_.Reset();
+}
+
+
 // -----------------------------------------------------------------------------
 // Calculate the min of sub PKs timestep sizes.
 // -----------------------------------------------------------------------------
@@ -137,12 +158,30 @@ MPCReactiveTransport::AdvanceStep(double t_old, double t_new, bool reinit)
   Teuchos::RCP<Epetra_MultiVector> tcc_copy =
     S_->GetW<CompositeVector>(tcc_key_, tag_next_, "state").ViewComponent("cell", true);
 
-  S_->GetEvaluator(mol_dens_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(mol_dens_key_, tag_next_, *S_, name_);
   Teuchos::RCP<const Epetra_MultiVector> mol_dens =
     S_->Get<CompositeVector>(mol_dens_key_, tag_next_).ViewComponent("cell", true);
 
+  // skip the step if no cell's inputs have changed since they were last solved
+  ChemistryActivityFilter::Inputs chem_inputs;
+  std::vector<bool> active;
+  if (chem_filter_.enabled()) {
+    chem_inputs =
+      getChemistryInputs(*S_, { tcc_key_, mol_dens_key_, sat_key_ }, tag_next_, name_);
+    int n_active_l = chem_filter_.FindActive(chem_inputs, active);
+    int n_active = 0;
+    tcc_copy->Comm().SumAll(&n_active_l, &n_active, 1);
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "Chemistry: " << n_active << " active cells." << std::endl;
+    if (n_active == 0) {
+      chem_step_succeeded_ = true;
+      return fail;
+    }
+  }
+
   fail |=
     advanceChemistry(chemistry_pk_, t_old, t_new, reinit, *mol_dens, tcc_copy, *alquimia_timer_);
+  if (!fail && chem_filter_.enabled()) chem_filter_.Record(chem_inputs);
   changedEvaluatorPrimary(tcc_key_, tag_next_, *S_);
   if (!fail) chem_step_succeeded_ = true;
   return fail;
@@ -22,6 +22,7 @@
 #include "PK.hh"
 #include "transport_ats.hh"
 #include "Chemistry_PK.hh"
+#include "chemistry_activity_filter.hh"
 #include "weak_mpc.hh"
 
 namespace Amanzi {
@@ -38,6 +39,7 @@ class MPCReactiveTransport : public WeakMPC {
   virtual void Setup() override;
   virtual void Initialize() override;
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit = false) override;
+  virtual void FailStep(double t_old, double t_new, const Tag& tag) override;
 
  protected:
   virtual void cast_sub_pks_();
@@ -48,9 +50,13 @@ class MPCReactiveTransport : public WeakMPC {
   Key domain_;
   Key tcc_key_;
   Key mol_dens_key_;
+  Key sat_key_;
 
   Teuchos::RCP<Teuchos::Time> alquimia_timer_;
 
+  // skips the cells whose chemistry inputs have not changed
+  ChemistryActivityFilter chem_filter_;
+
   // storage for the component concentration intermediate values
   Teuchos::RCP<Transport::Transport_ATS> transport_pk_;
   Teuchos::RCP<AmanziChemistry::Chemistry_PK> chemistry_pk_;
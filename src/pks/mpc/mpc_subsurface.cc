@@ -22,6 +22,8 @@ with freezing.
 #include "PDE_Advection.hh"
 #include "PDE_Accumulation.hh"
 #include "Operator.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "upwind_total_flux.hh"
 #include "upwind_arithmetic_mean.hh"
 
@@ -358,10 +360,8 @@ MPCSubsurface::Setup()
         S_->GetRecordW(Keys::getDerivKey(uw_hkr_key_, temp_key_), tag_next_, name_)
           .set_io_vis(false);
 
-        // -- and the upwinding
-        upwinding_dhkr_dp_ = Teuchos::rcp(
-          new Operators::UpwindTotalFlux(name_, tag_next_, water_flux_dir_key_, 1.e-8));
-        upwinding_dhkr_dT_ = Teuchos::rcp(
+        // -- and the upwinding, one batched pass for both derivatives
+        upwinding_dhkr_ = Teuchos::rcp(
           new Operators::UpwindTotalFlux(name_, tag_next_, water_flux_dir_key_, 1.e-8));
       }
     }
@@ -520,6 +520,7 @@ MPCSubsurface::ModifyPredictor(double h,
 void
 MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
 
   if (precon_type_ == PRECON_NONE) {
@@ -534,7 +535,7 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     // -- dkr/dT
     // -- update and upwind d kr / dT
     if (ddivq_dT_ != Teuchos::null) {
-      S_->GetEvaluator(kr_key_, tag_next_).UpdateDerivative(*S_, name_, temp_key_, tag_next_);
+      updateEvaluatorDerivative(kr_key_, tag_next_, *S_, name_, temp_key_, tag_next_);
       Teuchos::RCP<const CompositeVector> dkrdT =
         S_->GetDerivativePtr<CompositeVector>(kr_key_, tag_next_, temp_key_, tag_next_);
       if (!is_fv_) {
@@ -563,7 +564,7 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     // -- dWC/dT diagonal term
     Teuchos::RCP<const CompositeVector> dWC_dT = Teuchos::null;
     if (S_->GetEvaluator(wc_key_, tag_next_).IsDifferentiableWRT(*S_, temp_key_, tag_next_)) {
-      S_->GetEvaluator(wc_key_, tag_next_).UpdateDerivative(*S_, name_, temp_key_, tag_next_);
+      updateEvaluatorDerivative(wc_key_, tag_next_, *S_, name_, temp_key_, tag_next_);
       dWC_dT = S_->GetDerivativePtr<CompositeVector>(wc_key_, tag_next_, temp_key_, tag_next_);
       dWC_dT_->AddAccumulationTerm(*dWC_dT, h, "cell", false);
     }
@@ -572,7 +573,7 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     // -- d Kappa / dp
     // Update and upwind thermal conductivity
     if (ddivKgT_dp_ != Teuchos::null) {
-      S_->GetEvaluator(tc_key_, tag_next_).UpdateDerivative(*S_, name_, pres_key_, tag_next_);
+      updateEvaluatorDerivative(tc_key_, tag_next_, *S_, name_, pres_key_, tag_next_);
       Teuchos::RCP<const CompositeVector> dkappa_dp =
         S_->GetDerivativePtr<CompositeVector>(tc_key_, tag_next_, pres_key_, tag_next_);
       if (!is_fv_) {
@@ -599,9 +600,9 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     // Update and upwind enthalpy * kr * rho/mu
     if (ddivhq_dp_ != Teuchos::null) {
       // -- update values
-      S_->GetEvaluator(hkr_key_, tag_next_).Update(*S_, name_);
-      S_->GetEvaluator(hkr_key_, tag_next_).UpdateDerivative(*S_, name_, pres_key_, tag_next_);
-      S_->GetEvaluator(hkr_key_, tag_next_).UpdateDerivative(*S_, name_, temp_key_, tag_next_);
+      updateEvaluator(hkr_key_, tag_next_, *S_, name_);
+      updateEvaluatorDerivative(hkr_key_, tag_next_, *S_, name_, pres_key_, tag_next_);
+      updateEvaluatorDerivative(hkr_key_, tag_next_, *S_, name_, temp_key_, tag_next_);
 
       Teuchos::RCP<const CompositeVector> denth_kr_dp_uw;
       Teuchos::RCP<const CompositeVector> denth_kr_dT_uw;
@@ -652,9 +653,10 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
                    mesh_->exterior_face_importer(),
                    Insert);
 
-        // -- upwind
-        upwinding_dhkr_dp_->Update(*denth_kr_dp, *denth_kr_dp_uw_nc, *S_);
-        upwinding_dhkr_dT_->Update(*denth_kr_dT, *denth_kr_dT_uw_nc, *S_);
+        // -- upwind, both derivatives in one pass as they share the flux
+        upwinding_dhkr_->UpdateBatched({ denth_kr_dp.get(), denth_kr_dT.get() },
+                                       { denth_kr_dp_uw_nc.get(), denth_kr_dT_uw_nc.get() },
+                                       *S_);
 
         // -- stick zeros in the boundary faces
         Epetra_MultiVector enth_kr_bf(*enth_kr->ViewComponent("boundary_face", false));
@@ -699,7 +701,7 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     // -- dE/dp diagonal term
     Teuchos::RCP<const CompositeVector> dE_dp = Teuchos::null;
     if (S_->GetEvaluator(e_key_, tag_next_).IsDifferentiableWRT(*S_, pres_key_, tag_next_)) {
-      S_->GetEvaluator(e_key_, tag_next_).UpdateDerivative(*S_, name_, pres_key_, tag_next_);
+      updateEvaluatorDerivative(e_key_, tag_next_, *S_, name_, pres_key_, tag_next_);
       dE_dp = S_->GetDerivativePtr<CompositeVector>(e_key_, tag_next_, pres_key_, tag_next_);
       dE_dp_->AddAccumulationTerm(*dE_dp, h, "cell", false);
     }
@@ -729,6 +731,7 @@ MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
 int
 MPCSubsurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -751,8 +754,10 @@ MPCSubsurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RC
   } else if (precon_type_ == PRECON_BLOCK_DIAGONAL) {
     ierr = StrongMPC::ApplyPreconditioner(u, Pu);
   } else if (precon_type_ == PRECON_PICARD) {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
     ierr = preconditioner_->ApplyInverse(*u, *Pu);
   } else if (precon_type_ == PRECON_EWC) {
+    PKProfiler::Scope profile_ls(name(), "LinearSolve");
     ierr = preconditioner_->ApplyInverse(*u, *Pu);
   }
 
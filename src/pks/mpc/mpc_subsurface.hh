@@ -222,14 +222,13 @@ class MPCSubsurface : public StrongMPC<PK_PhysicalBDF_Default> {
   // -- d ( div hq ) / dp terms
   Teuchos::RCP<Operators::PDE_DiffusionWithGravity> ddivhq_dp_;
   Teuchos::RCP<Operators::UpwindTotalFlux> upwinding_hkr_;
-  Teuchos::RCP<Operators::UpwindTotalFlux> upwinding_dhkr_dp_;
+  Teuchos::RCP<Operators::UpwindTotalFlux> upwinding_dhkr_;
   // -- d ( dE/dt ) / dp terms
   Teuchos::RCP<Operators::PDE_Accumulation> dE_dp_;
 
   // dE / dT on-diagonal block additional terms that use q info
   // -- d ( div hq ) / dT terms
   Teuchos::RCP<Operators::PDE_DiffusionWithGravity> ddivhq_dT_;
-  Teuchos::RCP<Operators::UpwindTotalFlux> upwinding_dhkr_dT_;
 
   // friend sub-pk Richards (need K_, some flags from private data)
   //Teuchos::RCP<Flow::Richards> richards_pk_;
@@ -22,6 +22,8 @@ with freezing.
 #include "PDE_Advection.hh"
 #include "PDE_Accumulation.hh"
 #include "Operator.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "upwind_total_flux.hh"
 #include "upwind_arithmetic_mean.hh"
 
@@ -224,6 +226,7 @@ MPCSurface::ModifyPredictor(double h,
 void
 MPCSurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
 
   if (precon_type_ == PRECON_NONE) {
@@ -238,7 +241,7 @@ MPCSurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
     // -- dkr/dT
     if (ddivq_dT_ != Teuchos::null) {
       // -- update and upwind d kr / dT
-      S_->GetEvaluator(kr_key_, tag_next_).UpdateDerivative(*S_, name_, temp_key_, tag_next_);
+      updateEvaluatorDerivative(kr_key_, tag_next_, *S_, name_, temp_key_, tag_next_);
       Teuchos::RCP<const CompositeVector> dkrdT =
         S_->GetDerivativePtr<CompositeVector>(kr_key_, tag_next_, temp_key_, tag_next_);
       Teuchos::RCP<const CompositeVector> kr_uw =
@@ -246,7 +249,7 @@ MPCSurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
       Teuchos::RCP<const CompositeVector> flux =
         S_->GetPtr<CompositeVector>(water_flux_key_, tag_next_);
 
-      S_->GetEvaluator(potential_key_, tag_next_).Update(*S_, name_);
+      updateEvaluator(potential_key_, tag_next_, *S_, name_);
       Teuchos::RCP<const CompositeVector> pres_elev =
         S_->GetPtr<CompositeVector>(potential_key_, tag_next_);
 
@@ -258,12 +261,12 @@ MPCSurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
     }
 
     // -- dE/dp diagonal term
-    S_->GetEvaluator(e_key_, tag_next_).UpdateDerivative(*S_, name_, pres_key_, tag_next_);
+    updateEvaluatorDerivative(e_key_, tag_next_, *S_, name_, pres_key_, tag_next_);
     Teuchos::RCP<const CompositeVector> dE_dp =
       S_->GetDerivativePtr<CompositeVector>(e_key_, tag_next_, pres_key_, tag_next_);
 
     // -- scale to dE/dh
-    S_->GetEvaluator(pd_bar_key_, tag_next_).UpdateDerivative(*S_, name_, pres_key_, tag_next_);
+    updateEvaluatorDerivative(pd_bar_key_, tag_next_, *S_, name_, pres_key_, tag_next_);
     auto dh_dp =
       S_->GetDerivativePtr<CompositeVector>(pd_bar_key_, tag_next_, pres_key_, tag_next_);
 
@@ -286,6 +289,7 @@ MPCSurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, do
 int
 MPCSurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_EXTREME)) *vo_->os() << "Precon application:" << std::endl;
 
@@ -308,7 +312,10 @@ MPCSurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<T
   } else if (precon_type_ == PRECON_BLOCK_DIAGONAL) {
     ierr = StrongMPC::ApplyPreconditioner(u, Pu);
   } else if (precon_type_ == PRECON_PICARD || (precon_type_ == PRECON_EWC)) {
-    ierr = preconditioner_->ApplyInverse(*u, *Pu);
+    {
+      PKProfiler::Scope profile_ls(name(), "LinearSolve");
+      ierr = preconditioner_->ApplyInverse(*u, *Pu);
+    }
 
     if (vo_->os_OK(Teuchos::VERB_HIGH)) {
       *vo_->os() << "PC * residuals:" << std::endl;
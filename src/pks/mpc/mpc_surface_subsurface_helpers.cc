@@ -95,4 +95,116 @@ MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
 }
 
 
+SurfaceSubsurfaceMap::SurfaceSubsurfaceMap(const Teuchos::RCP<const AmanziMesh::Mesh>& surf_mesh,
+                                           const Teuchos::RCP<const AmanziMesh::Mesh>& sub_mesh)
+  : surf_mesh_(surf_mesh), sub_mesh_(sub_mesh)
+{
+  int ncells_surf =
+    surf_mesh_->num_entities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED);
+  faces_.resize(ncells_surf);
+  boundary_faces_.resize(ncells_surf);
+  for (int sc = 0; sc != ncells_surf; ++sc) {
+    AmanziMesh::Entity_ID f = surf_mesh_->entity_get_parent(AmanziMesh::CELL, sc);
+    faces_[sc] = f;
+    boundary_faces_[sc] = AmanziMesh::getFaceOnBoundaryBoundaryFace(*sub_mesh_, f);
+  }
+}
+
+
+const std::vector<AmanziMesh::Entity_ID>*
+SurfaceSubsurfaceMap::Indices_(const CompositeVector& sub, std::string& component) const
+{
+  if (sub.HasComponent("face")) {
+    component = "face";
+    return &faces_;
+  } else if (sub.HasComponent("boundary_face")) {
+    component = "boundary_face";
+    return &boundary_faces_;
+  }
+  return nullptr;
+}
+
+
+void
+SurfaceSubsurfaceMap::CheckMeshes_(const CompositeVector& surf, const CompositeVector& sub) const
+{
+  if (surf.Mesh().get() != surf_mesh_.get() || sub.Mesh().get() != sub_mesh_.get()) {
+    Errors::Message msg("SurfaceSubsurfaceMap: vectors are not defined on the mesh pair this map "
+                        "was built for.");
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+void
+SurfaceSubsurfaceMap::CopySurfaceToSubsurface(const CompositeVector& surf,
+                                              CompositeVector& sub) const
+{
+  CheckMeshes_(surf, sub);
+  std::string comp;
+  const auto* index = Indices_(sub, comp);
+  if (!index) return;
+
+  const Epetra_MultiVector& surf_c = *surf.ViewComponent("cell", false);
+  AMANZI_ASSERT(surf_c.MyLength() == (int)index->size());
+  const double* surf_v = surf_c[0];
+  double* sub_v = (*sub.ViewComponent(comp, false))[0];
+  const AmanziMesh::Entity_ID* idx = index->data();
+
+  int ncells_surf = index->size();
+  for (int sc = 0; sc != ncells_surf; ++sc) sub_v[idx[sc]] = surf_v[sc];
+}
+
+
+void
+SurfaceSubsurfaceMap::CopySubsurfaceToSurface(const CompositeVector& sub,
+                                              CompositeVector& surf) const
+{
+  CheckMeshes_(surf, sub);
+  std::string comp;
+  const auto* index = Indices_(sub, comp);
+  if (!index) return;
+
+  Epetra_MultiVector& surf_c = *surf.ViewComponent("cell", false);
+  AMANZI_ASSERT(surf_c.MyLength() == (int)index->size());
+  double* surf_v = surf_c[0];
+  const double* sub_v = (*sub.ViewComponent(comp, false))[0];
+  const AmanziMesh::Entity_ID* idx = index->data();
+
+  // a gather with contiguous writes, which the compiler may vectorize
+  int ncells_surf = index->size();
+  for (int sc = 0; sc != ncells_surf; ++sc) surf_v[sc] = sub_v[idx[sc]];
+}
+
+
+void
+SurfaceSubsurfaceMap::MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
+                                                        CompositeVector& sub_p,
+                                                        CompositeVector& surf_p) const
+{
+  CheckMeshes_(surf_p, sub_p);
+  std::string comp;
+  const auto* index = Indices_(sub_p, comp);
+  if (!index) return;
+
+  Epetra_MultiVector& surf_p_c = *surf_p.ViewComponent("cell", false);
+  AMANZI_ASSERT(surf_p_c.MyLength() == (int)index->size());
+  double* surf_v = surf_p_c[0];
+  const double* h_v = (*h_prev.ViewComponent("cell", false))[0];
+  double* sub_v = (*sub_p.ViewComponent(comp, false))[0];
+  const AmanziMesh::Entity_ID* idx = index->data();
+  double p_atm = 101325.;
+
+  int ncells_surf = index->size();
+  for (int sc = 0; sc != ncells_surf; ++sc) {
+    double p_surf = surf_v[sc];
+    if (h_v[sc] > 0. && p_surf > p_atm) {
+      sub_v[idx[sc]] = p_surf;
+    } else {
+      surf_v[sc] = sub_v[idx[sc]];
+    }
+  }
+}
+
+
 } // namespace Amanzi
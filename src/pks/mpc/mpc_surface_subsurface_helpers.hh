@@ -10,6 +10,8 @@
 #ifndef PKS_MPC_SURFACE_SUBSURFACE_HELPERS_HH_
 #define PKS_MPC_SURFACE_SUBSURFACE_HELPERS_HH_
 
+#include <vector>
+
 #include "Mesh_Algorithms.hh"
 #include "CompositeVector.hh"
 
@@ -26,6 +28,46 @@ MergeSubsurfaceAndSurfacePressure(const CompositeVector& kr_surf,
                                   CompositeVector& sub_p,
                                   CompositeVector& surf_p);
 
+//
+// A cached map from surface cells to the subsurface faces (and boundary
+// faces) they are extruded from.  The helpers above look up the parent face
+// of every surface cell on every call; this map does so once, and the copy
+// and merge then run as a single pass over flat index arrays.  The map
+// depends only on mesh topology, which mesh deformation does not change, so
+// it is built once per (surface, subsurface) mesh pair and stays valid for
+// the life of the meshes.
+//
+class SurfaceSubsurfaceMap {
+ public:
+  SurfaceSubsurfaceMap(const Teuchos::RCP<const AmanziMesh::Mesh>& surf_mesh,
+                       const Teuchos::RCP<const AmanziMesh::Mesh>& sub_mesh);
+
+  // Subsurface face (or boundary face) index of each owned surface cell.
+  const std::vector<AmanziMesh::Entity_ID>& faces() const { return faces_; }
+  const std::vector<AmanziMesh::Entity_ID>& boundary_faces() const { return boundary_faces_; }
+
+  // Same semantics as the free functions of the same name.
+  void CopySurfaceToSubsurface(const CompositeVector& surf, CompositeVector& sub) const;
+  void CopySubsurfaceToSurface(const CompositeVector& sub, CompositeVector& surf) const;
+  void MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
+                                         CompositeVector& sub_p,
+                                         CompositeVector& surf_p) const;
+
+ private:
+  // Index array and component name matching the face-like component of sub,
+  // or nullptr if sub has neither a face nor a boundary_face component.
+  const std::vector<AmanziMesh::Entity_ID>*
+  Indices_(const CompositeVector& sub, std::string& component) const;
+
+  void CheckMeshes_(const CompositeVector& surf, const CompositeVector& sub) const;
+
+ private:
+  Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh_;
+  Teuchos::RCP<const AmanziMesh::Mesh> sub_mesh_;
+  std::vector<AmanziMesh::Entity_ID> faces_;
+  std::vector<AmanziMesh::Entity_ID> boundary_faces_;
+};
+
 //
 // The next two helpers are getters and setters that can be used to get/set a
 // component vector that is either FACE or BOUNDARY_FACE, selected at COMPILE
@@ -20,10 +20,76 @@ subcycled.  That seems appropriate as this means to couple PKs of the same type
 but not all?  That could be generalized, but it would be tricky to define on an
 input spec.
 
+The sub-PKs on a given rank are independent of each other, so they may
+optionally be advanced concurrently on the shared pool of threads.  Each thread
+takes the next not-yet-advanced sub-PK, so that expensive columns do not hold
+up a fixed block of cheap ones.  Results are identical to the serial path.
+This is only safe if no two sub-PKs touch the same State data: at
+initialization, every evaluator of a subdomain (its domain's keys, and any key
+at its subcycling tags) is checked not to depend on an evaluator shared across
+subdomains, and threaded mode is refused otherwise.  The time, cycle, and "dt"
+writes this MPC makes for each subdomain are serialized.  Threading also
+requires a thread-safe Trilinos build (Teuchos_ENABLE_THREAD_SAFE, for atomic
+Teuchos::RCP reference counts) and an MPI providing MPI_THREAD_MULTIPLE, as
+each sub-PK still does its own (MPI_COMM_SELF) reductions.  Both are checked
+at setup; if either is missing, a warning is written and the sub-PKs are
+advanced serially.  Output from sub-PKs may be interleaved.
+
+* `"subcycle`" ``[bool]`` **false** If true, each sub-PK is subcycled
+  independently to reach the coupler's time step.
+
+* `"subcycling target time step [s]`" ``[double]`` Time step of the coupler,
+  required if `"subcycle`" is true.
+
+* `"subdomain threads`" ``[int]`` **1** Number of threads used to advance the
+  sub-PKs on this rank.  1 advances them serially.  Reduced to 1 if MPI or
+  Trilinos is not thread safe, see above.
+
+* `"record subdomain cost`" ``[bool]`` **false** If true, the wallclock time
+  of each sub-PK's most recent advance is stored as the scalar
+  `"SUBDOMAIN-advance_cost`", which is checkpointed, so it survives restart.
+  These costs order the threaded schedule most expensive first, and at high
+  verbosity the resulting imbalance across ranks is reported.
+
+* `"subdomain cost input file`" ``[string]`` **optional** If provided, the
+  recorded costs are seeded at startup from this file, so that the first
+  threaded schedule is already ordered.  Each line is `"SUBDOMAIN COST`";
+  lines starting with `"#`" and subdomains not in the file are ignored, the
+  latter keeping a cost of 0.  Costs read from a restart checkpoint take
+  precedence.  Implies `"record subdomain cost`".
+
+* `"subdomain cost output file`" ``[string]`` **optional** If provided, the
+  recorded costs of all subdomains are gathered to rank 0 and written to this
+  file, in the same format, whenever visualization is written and at the end
+  of the run.  Implies `"record subdomain cost`".
+
+.. note::
+
+   This MPC never moves subdomains between ranks: each is advanced on the
+   rank that owns it, and these costs only reorder work within a rank.  To
+   balance ranks, pass the cost output file of one run as the `"subdomain
+   cost input file`" of the indexed domain set in the next, which then
+   assigns subdomains to ranks by cost, see the mesh factory.
+
 */
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+
+#include "Teuchos_ConfigDefs.hpp"
 
+#include "AmanziComm.hh"
 #include "mpc_weak_subdomain.hh"
+#include "pk_profiler.hh"
+#include "reduction_batch.hh"
+#include "subdomain_costs.hh"
+#include "thread_pool.hh"
 
 
 namespace Amanzi {
@@ -33,7 +99,10 @@ MPCWeakSubdomain::MPCWeakSubdomain(Teuchos::ParameterList& FElist,
                                    const Teuchos::RCP<Teuchos::ParameterList>& plist,
                                    const Teuchos::RCP<State>& S,
                                    const Teuchos::RCP<TreeVector>& solution)
-  : PK(FElist, plist, S, solution), MPC<PK>(FElist, plist, S, solution)
+  : PK(FElist, plist, S, solution),
+    MPC<PK>(FElist, plist, S, solution),
+    dt_next_(-1.),
+    t_advanced_(-1.)
 {
   init_();
 
@@ -42,6 +111,21 @@ MPCWeakSubdomain::MPCWeakSubdomain(Teuchos::ParameterList& FElist,
   if (subcycled_) {
     subcycled_target_dt_ = plist_->template get<double>("subcycling target time step [s]");
   }
+
+  n_threads_ = plist_->template get<int>("subdomain threads", 1);
+  if (n_threads_ < 1) {
+    Errors::Message msg;
+    msg << "MPCWeakSubdomain: \"subdomain threads\" must be a positive integer.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  record_cost_ = plist_->template get<bool>("record subdomain cost", false);
+  cost_input_file_ = plist_->template get<std::string>("subdomain cost input file", "");
+  cost_output_file_ = plist_->template get<std::string>("subdomain cost output file", "");
+  if (!cost_input_file_.empty() || !cost_output_file_.empty()) record_cost_ = true;
+  costs_.resize(sub_pks_.size(), 0.);
+  schedule_.resize(sub_pks_.size());
+  std::iota(schedule_.begin(), schedule_.end(), 0);
 };
 
 
@@ -51,15 +135,30 @@ MPCWeakSubdomain::MPCWeakSubdomain(Teuchos::ParameterList& FElist,
 double
 MPCWeakSubdomain::get_dt()
 {
-  double dt = std::numeric_limits<double>::max();
+  if (subcycled_) return subcycled_target_dt_;
 
-  if (subcycled_) {
-    dt = subcycled_target_dt_;
-  } else {
-    for (auto& pk : sub_pks_) dt = std::min(dt, pk->get_dt());
-    double dt_local = dt;
-    solution_->Comm()->MinAll(&dt_local, &dt, 1);
+  // reduced with the fail count at the end of the last advance
+  if (dt_next_ > 0.) {
+    double dt = dt_next_;
+    dt_next_ = -1.;
+    return dt;
   }
+
+  ReductionBatch batch(*comm_);
+  int h_dt = batch.Min(getLocalDt_());
+  batch.Flush();
+  return batch.get(h_dt);
+}
+
+
+// -----------------------------------------------------------------------------
+// The min of this rank's sub PKs timestep sizes.
+// -----------------------------------------------------------------------------
+double
+MPCWeakSubdomain::getLocalDt_()
+{
+  double dt = std::numeric_limits<double>::max();
+  for (auto& pk : sub_pks_) dt = std::min(dt, pk->get_dt());
   return dt;
 }
 
@@ -73,6 +172,7 @@ MPCWeakSubdomain::set_dt(double dt)
     cycle_dt_ = dt;
   } else {
     for (auto& pk : sub_pks_) pk->set_dt(dt);
+    dt_next_ = -1.;
   }
 };
 
@@ -104,6 +204,12 @@ MPCWeakSubdomain::set_tags(const Tag& current, const Tag& next)
 void
 MPCWeakSubdomain::Setup()
 {
+  if (n_threads_ > 1) CheckThreadSupport_();
+
+  if (record_cost_) {
+    for (const auto& cost_key : cost_keys_) S_->Require<double>(cost_key, Tags::NEXT, name());
+  }
+
   if (subcycled_) {
     const auto& ds = S_->GetDomainSet(ds_name_);
     for (const auto& subdomain : *ds) {
@@ -123,6 +229,14 @@ MPCWeakSubdomain::Setup()
 void
 MPCWeakSubdomain::Initialize()
 {
+  if (record_cost_) {
+    for (const auto& cost_key : cost_keys_) {
+      S_->Assign(cost_key, Tags::NEXT, name(), 0.);
+      S_->GetRecordW(cost_key, Tags::NEXT, name()).set_initialized();
+    }
+    if (!cost_input_file_.empty()) ReadCosts_(cost_input_file_);
+  }
+
   if (subcycled_) {
     const auto& ds = S_->GetDomainSet(ds_name_);
     for (const auto& subdomain : *ds) {
@@ -131,6 +245,106 @@ MPCWeakSubdomain::Initialize()
     }
   }
   MPC<PK>::Initialize();
+
+  if (n_threads_ > 1) CheckSubdomainsIndependent_();
+}
+
+
+// -----------------------------------------------------------------------------
+// Threaded advance requires that MPI may be called from any thread and that
+// Teuchos::RCP reference counts are atomic.  If not, fall back to advancing
+// the sub-PKs serially, with a warning.
+// -----------------------------------------------------------------------------
+void
+MPCWeakSubdomain::CheckThreadSupport_()
+{
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  bool mpi_thread_safe = provided >= MPI_THREAD_MULTIPLE;
+#ifdef HAVE_TEUCHOS_THREAD_SAFE
+  bool rcp_thread_safe = true;
+#else
+  bool rcp_thread_safe = false;
+#endif
+  if (mpi_thread_safe && rcp_thread_safe) return;
+
+  if (vo_->os_OK(Teuchos::VERB_LOW)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << vo_->color("yellow") << "WARNING: \"subdomain threads\" = " << n_threads_
+               << " requires";
+    if (!mpi_thread_safe) *vo_->os() << " MPI initialized with MPI_THREAD_MULTIPLE";
+    if (!mpi_thread_safe && !rcp_thread_safe) *vo_->os() << " and";
+    if (!rcp_thread_safe) *vo_->os() << " Trilinos built with Teuchos_ENABLE_THREAD_SAFE";
+    *vo_->os() << "; advancing sub-PKs serially." << vo_->reset() << std::endl;
+  }
+  n_threads_ = 1;
+}
+
+
+// -----------------------------------------------------------------------------
+// Threaded advance requires that each sub-PK only touches its own State data.
+// Throw if an evaluator of a subdomain depends on an evaluator that is shared,
+// i.e. neither on one of the domain set's subdomains nor at a subdomain's own
+// subcycling tags.
+// -----------------------------------------------------------------------------
+void
+MPCWeakSubdomain::CheckSubdomainsIndependent_()
+{
+  const auto& ds = *S_->GetDomainSet(ds_name_);
+  std::vector<std::string> subdomains(ds.begin(), ds.end());
+  std::map<std::string, int> subdomain_index;
+  for (int i = 0; i != subdomains.size(); ++i) subdomain_index[subdomains[i]] = i;
+
+  // tags private to each subdomain, and those shared by all
+  std::vector<std::vector<Tag>> own_tags(subdomains.size());
+  if (subcycled_) {
+    for (int i = 0; i != subdomains.size(); ++i) {
+      own_tags[i] = { get_ds_tag_current_(subdomains[i]), get_ds_tag_next_(subdomains[i]) };
+    }
+  }
+  std::vector<Tag> shared_tags = { tag_current_, tag_next_ };
+
+  // evaluators owned by each subdomain, and those owned by none
+  std::vector<std::vector<std::pair<Key, Tag>>> owned(subdomains.size());
+  std::vector<std::pair<Key, Tag>> shared;
+  for (auto it = S_->data_begin(); it != S_->data_end(); ++it) {
+    const Key& key = it->first;
+    auto domain_it = subdomain_index.find(Keys::getDomain(key));
+
+    if (domain_it != subdomain_index.end()) {
+      int i = domain_it->second;
+      for (const auto* tags : { &shared_tags, &own_tags[i] }) {
+        for (const Tag& tag : *tags) {
+          if (S_->HasEvaluator(key, tag)) owned[i].emplace_back(key, tag);
+        }
+      }
+    } else {
+      for (const Tag& tag : shared_tags) {
+        if (S_->HasEvaluator(key, tag)) shared.emplace_back(key, tag);
+      }
+      for (int i = 0; i != subdomains.size(); ++i) {
+        for (const Tag& tag : own_tags[i]) {
+          if (S_->HasEvaluator(key, tag)) owned[i].emplace_back(key, tag);
+        }
+      }
+    }
+  }
+
+  for (int i = 0; i != subdomains.size(); ++i) {
+    for (const auto& kt : owned[i]) {
+      const auto& eval = S_->GetEvaluator(kt.first, kt.second);
+      for (const auto& skt : shared) {
+        if (eval.IsDependency(*S_, skt.first, skt.second)) {
+          Errors::Message msg;
+          msg << "MPCWeakSubdomain \"" << name() << "\": \"subdomain threads\" > 1 requires "
+              << "independent subdomains, but \"" << kt.first << "@" << kt.second.get()
+              << "\" depends on \"" << skt.first << "@" << skt.second.get()
+              << "\", which is shared across subdomains.  Use a single thread.";
+          Exceptions::amanzi_throw(msg);
+        }
+      }
+    }
+  }
 }
 
 
@@ -140,6 +354,7 @@ MPCWeakSubdomain::Initialize()
 bool
 MPCWeakSubdomain::AdvanceStep(double t_old, double t_new, bool reinit)
 {
+  PKProfiler::Scope profile(name(), "AdvanceStep");
   if (subcycled_)
     return AdvanceStep_Subcycled_(t_old, t_new, reinit);
   else
@@ -147,21 +362,23 @@ MPCWeakSubdomain::AdvanceStep(double t_old, double t_new, bool reinit)
 }
 
 // -----------------------------------------------------------------------------
-// Advance each sub-PK individually.
+// Advance each sub-PK individually.  The sub-PKs choose their next timestep
+// size as they advance, so its global min is reduced with the fail count and
+// kept for the next get_dt().
 // -----------------------------------------------------------------------------
 bool
 MPCWeakSubdomain::AdvanceStep_Standard_(double t_old, double t_new, bool reinit)
 {
-  bool fail = false;
-  for (auto& pk : sub_pks_) {
-    fail = pk->AdvanceStep(t_old, t_new, reinit);
-    if (fail) break;
-  }
-
-  int sub_fail_i = fail ? 1 : 0;
-  int fail_i;
-  comm_->SumAll(&sub_fail_i, &fail_i, 1);
-  return (bool)fail_i;
+  int n_fail = ForEachSubdomain_(
+    [&](int i) { return sub_pks_[i]->AdvanceStep(t_old, t_new, reinit); });
+
+  ReductionBatch batch(*comm_);
+  int h_fail = batch.Sum(n_fail > 0 ? 1. : 0.);
+  int h_dt = batch.Min(getLocalDt_());
+  batch.Flush();
+  dt_next_ = batch.get(h_dt);
+  t_advanced_ = t_new;
+  return batch.get(h_fail) > 0.;
 };
 
 
@@ -172,73 +389,41 @@ bool
 MPCWeakSubdomain::AdvanceStep_Subcycled_(double t_old, double t_new, bool reinit)
 {
   Teuchos::OSTab tab = vo_->getOSTab();
-  bool fail = false;
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
     *vo_->os() << "Beginning subcycled timestepping." << std::endl;
 
   const auto& ds = *S_->GetDomainSet(ds_name_);
-  int my_pid = solution_->Comm()->MyPID();
-
-  int i = 0;
-  int n_throw = 0;
-  std::string throw_msg;
-  for (const auto& subdomain : ds) {
-    double dt_inner = -1;
-    double t_inner = t_old;
-    try { // must catch non-collective throws for TimeStepCrash
-      if (vo_->os_OK(Teuchos::VERB_EXTREME))
-        *vo_->os() << "Beginning subcyling on pk \"" << sub_pks_[i]->name() << "\"" << std::endl;
-
-      bool done = false;
-      Tag tag_subcycle_current = get_ds_tag_current_(subdomain);
-      Tag tag_subcycle_next = get_ds_tag_next_(subdomain);
-
-      S_->set_time(tag_subcycle_current, t_old);
-      while (!done) {
-        dt_inner = std::min(sub_pks_[i]->get_dt(), t_new - t_inner);
-        S_->Assign("dt", tag_subcycle_next, name(), dt_inner);
-        S_->set_time(tag_subcycle_next, t_inner + dt_inner);
-        bool fail_inner = sub_pks_[i]->AdvanceStep(t_inner, t_inner + dt_inner, false);
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          *vo_->os() << "  step failed? " << fail_inner << std::endl;
-        bool valid_inner = sub_pks_[i]->ValidStep();
-        if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
-          *vo_->os() << "  step valid? " << valid_inner << std::endl;
-        }
-
-        if (fail_inner || !valid_inner) {
-          sub_pks_[i]->FailStep(t_old, t_new, tag_subcycle_next);
-
-          dt_inner = sub_pks_[i]->get_dt();
-          S_->set_time(tag_subcycle_next, S_->get_time(tag_subcycle_current));
-
-          if (vo_->os_OK(Teuchos::VERB_EXTREME))
-            *vo_->os() << "  failed, new timestep is " << dt_inner << std::endl;
+  std::vector<std::string> subdomains(ds.begin(), ds.end());
 
-        } else {
-          sub_pks_[i]->CommitStep(t_inner, t_inner + dt_inner, tag_subcycle_next);
-          t_inner += dt_inner;
-          if (std::abs(t_new - t_inner) < 1.e-10) done = true;
-
-          S_->set_time(tag_subcycle_current, S_->get_time(tag_subcycle_next));
-          S_->advance_cycle(tag_subcycle_next);
+  // must catch non-collective throws for TimeStepCrash
+  std::vector<std::string> throw_msgs(sub_pks_.size());
+  int n_fail = ForEachSubdomain_([&](int i) {
+    try {
+      AdvanceSubdomain_Subcycled_(i, subdomains[i], t_old, t_new);
+    } catch (Errors::TimeStepCrash& e) {
+      throw_msgs[i] = e.what();
+      return true;
+    }
+    return false;
+  });
 
-          dt_inner = sub_pks_[i]->get_dt();
-          if (vo_->os_OK(Teuchos::VERB_EXTREME))
-            *vo_->os() << "  success, new timestep is " << dt_inner << std::endl;
-        }
+  // report the lowest-indexed crash, which is the one the serial loop stops on
+  int n_throw = n_fail > 0 ? 1 : 0;
+  std::string throw_msg;
+  if (n_throw > 0) {
+    for (const auto& m : throw_msgs) {
+      if (!m.empty()) {
+        throw_msg = m;
+        break;
       }
-      i++;
-    } catch (Errors::TimeStepCrash& e) {
-      n_throw++;
-      throw_msg = e.what();
-      break;
     }
   }
 
   // check for any other ranks throwing and, if so, throw ourselves so that all procs throw
-  int n_throw_g = 0;
-  comm_->SumAll(&n_throw, &n_throw_g, 1);
+  ReductionBatch batch(*comm_);
+  int h_throw = batch.Sum(n_throw);
+  batch.Flush();
+  int n_throw_g = (int)batch.get(h_throw);
   if (n_throw > 0) {
     // inject more information into the crash message
     Errors::TimeStepCrash msg;
@@ -253,6 +438,121 @@ MPCWeakSubdomain::AdvanceStep_Subcycled_(double t_old, double t_new, bool reinit
 }
 
 
+//-------------------------------------------------------------------------------------
+// Subcycle the ith sub-PK from t_old to t_new.  Only touches data owned by
+// that sub-PK and its subdomain tags, so may be called concurrently for
+// different i once CheckSubdomainsIndependent_() has passed.
+//-------------------------------------------------------------------------------------
+void
+MPCWeakSubdomain::AdvanceSubdomain_Subcycled_(int i,
+                                              const std::string& subdomain,
+                                              double t_old,
+                                              double t_new)
+{
+  double dt_inner = -1;
+  double t_inner = t_old;
+  if (vo_->os_OK(Teuchos::VERB_EXTREME))
+    *vo_->os() << "Beginning subcyling on pk \"" << sub_pks_[i]->name() << "\"" << std::endl;
+
+  bool done = false;
+  Tag tag_subcycle_current = get_ds_tag_current_(subdomain);
+  Tag tag_subcycle_next = get_ds_tag_next_(subdomain);
+
+  // State's time, cycle, and "dt" writes are serialized, as sub-PKs may be
+  // advanced concurrently
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    S_->set_time(tag_subcycle_current, t_old);
+  }
+  while (!done) {
+    dt_inner = std::min(sub_pks_[i]->get_dt(), t_new - t_inner);
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      S_->Assign("dt", tag_subcycle_next, name(), dt_inner);
+      S_->set_time(tag_subcycle_next, t_inner + dt_inner);
+    }
+    bool fail_inner = sub_pks_[i]->AdvanceStep(t_inner, t_inner + dt_inner, false);
+    if (vo_->os_OK(Teuchos::VERB_EXTREME))
+      *vo_->os() << "  step failed? " << fail_inner << std::endl;
+    bool valid_inner = sub_pks_[i]->ValidStep();
+    if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
+      *vo_->os() << "  step valid? " << valid_inner << std::endl;
+    }
+
+    if (fail_inner || !valid_inner) {
+      sub_pks_[i]->FailStep(t_old, t_new, tag_subcycle_next);
+
+      dt_inner = sub_pks_[i]->get_dt();
+      {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        S_->set_time(tag_subcycle_next, S_->get_time(tag_subcycle_current));
+      }
+
+      if (vo_->os_OK(Teuchos::VERB_EXTREME))
+        *vo_->os() << "  failed, new timestep is " << dt_inner << std::endl;
+
+    } else {
+      sub_pks_[i]->CommitStep(t_inner, t_inner + dt_inner, tag_subcycle_next);
+      t_inner += dt_inner;
+      if (std::abs(t_new - t_inner) < 1.e-10) done = true;
+
+      {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        S_->set_time(tag_subcycle_current, S_->get_time(tag_subcycle_next));
+        S_->advance_cycle(tag_subcycle_next);
+      }
+
+      dt_inner = sub_pks_[i]->get_dt();
+      if (vo_->os_OK(Teuchos::VERB_EXTREME))
+        *vo_->os() << "  success, new timestep is " << dt_inner << std::endl;
+    }
+  }
+}
+
+
+//-------------------------------------------------------------------------------------
+// Loop over sub-PKs, serially or threaded.
+//-------------------------------------------------------------------------------------
+int
+MPCWeakSubdomain::ForEachSubdomain_(const std::function<bool(int)>& func)
+{
+  int n_pks = sub_pks_.size();
+  std::function<bool(int)> timed_func = func;
+  if (record_cost_) {
+    timed_func = [&](int i) {
+      auto start = std::chrono::steady_clock::now();
+      bool fail = func(i);
+      costs_[i] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      return fail;
+    };
+  }
+
+  int n_fail = 0;
+  if (n_threads_ <= 1 || n_pks <= 1) {
+    for (int i = 0; i != n_pks; ++i) {
+      if (timed_func(i)) {
+        n_fail = 1;
+        break;
+      }
+    }
+  } else {
+    // Each thread claims the next sub-PK in the schedule.  Columns vary
+    // widely in cost, so this balances far better than a static split, and
+    // taking the most expensive first keeps the tail short.
+    int profile_parent = PKProfiler::current();
+    n_fail = Utils::forEachDynamic(n_threads_, n_pks, [&](int k) {
+      PKProfiler::Attach profile_attach(profile_parent);
+      return timed_func(schedule_[k]);
+    });
+  }
+
+  if (record_cost_) {
+    for (int i = 0; i != n_pks; ++i) S_->Assign(cost_keys_[i], Tags::NEXT, name(), costs_[i]);
+  }
+  return n_fail;
+}
+
+
 void
 MPCWeakSubdomain::CommitStep(double t_old, double t_new, const Tag& tag_next)
 {
@@ -272,10 +572,143 @@ MPCWeakSubdomain::CommitStep(double t_old, double t_new, const Tag& tag_next)
   if (tag_next == tag_next_ && tag_next != Tags::NEXT) {
     // do not commit step in this case -- this is nested subcycling, which we
     // do not have a formal way of dealing with correctly.
+    dt_next_ = -1.;
     return;
   } else {
     for (const auto& pk : sub_pks_) { pk->CommitStep(t_old, t_new, tag_next); }
   }
+
+  // the dt reduced at the end of the advance is only valid for the step that
+  // was advanced, and only if it is the one committed
+  if (tag_next != tag_next_ || t_new != t_advanced_) dt_next_ = -1.;
+
+  if (record_cost_ && tag_next == Tags::NEXT) UpdateSchedule_();
+}
+
+
+// -----------------------------------------------------------------------------
+// Sub PKs may cut their timestep size on failure, so the dt reduced at the
+// end of the advance is stale.
+// -----------------------------------------------------------------------------
+void
+MPCWeakSubdomain::FailStep(double t_old, double t_new, const Tag& tag)
+{
+  dt_next_ = -1.;
+  MPC<PK>::FailStep(t_old, t_new, tag);
+}
+
+
+void
+MPCWeakSubdomain::UpdateSchedule_()
+{
+  // State is the source of truth, as costs may have been read from a checkpoint
+  double cost_local = 0.;
+  int n_pks = cost_keys_.size();
+  for (int i = 0; i != n_pks; ++i) {
+    costs_[i] = S_->Get<double>(cost_keys_[i], Tags::NEXT);
+    cost_local += costs_[i];
+  }
+
+  std::iota(schedule_.begin(), schedule_.end(), 0);
+  std::stable_sort(schedule_.begin(), schedule_.end(), [this](int a, int b) {
+    return costs_[a] > costs_[b];
+  });
+
+  // collective, so guarded by the verbosity level rather than os_OK()
+  if (vo_->getVerbLevel() >= Teuchos::VERB_HIGH) {
+    ReductionBatch batch(*comm_);
+    int h_max = batch.Max(cost_local);
+    int h_total = batch.Sum(cost_local);
+    batch.Flush();
+    double cost_max = batch.get(h_max);
+    double cost_mean = batch.get(h_total) / comm_->NumProc();
+    Teuchos::OSTab tab = vo_->getOSTab();
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+      *vo_->os() << "Subdomain advance cost: max rank = " << cost_max
+                 << " [s], mean rank = " << cost_mean << " [s], imbalance = "
+                 << (cost_mean > 0. ? cost_max / cost_mean : 1.) << std::endl;
+    }
+  }
+}
+
+
+void
+MPCWeakSubdomain::ReadCosts_(const std::string& filename)
+{
+  auto file_costs = Utils::readSubdomainCosts(filename);
+
+  const auto& ds = *S_->GetDomainSet(ds_name_);
+  int i = 0;
+  for (const auto& subdomain : ds) {
+    auto cost = file_costs.find(subdomain);
+    if (cost != file_costs.end()) S_->Assign(cost_keys_[i], Tags::NEXT, name(), cost->second);
+    ++i;
+  }
+}
+
+
+void
+MPCWeakSubdomain::WriteCosts_(const std::string& filename)
+{
+  std::ostringstream local;
+  local << std::setprecision(8);
+  const auto& ds = *S_->GetDomainSet(ds_name_);
+  int i = 0;
+  for (const auto& subdomain : ds) {
+    local << subdomain << " " << S_->Get<double>(cost_keys_[i], Tags::NEXT) << "\n";
+    ++i;
+  }
+  std::string local_str = local.str();
+
+  // gather each rank's lines to rank 0, or write them directly on a serial comm
+  int rank = comm_->MyPID();
+  std::vector<char> global_str(local_str.begin(), local_str.end());
+  auto mpi_comm = dynamic_cast<const MpiComm_type*>(comm_.get());
+  if (mpi_comm != nullptr) {
+    const MPI_Comm& comm = mpi_comm->Comm();
+    int nprocs = comm_->NumProc();
+
+    int local_size = local_str.size();
+    std::vector<int> sizes(nprocs, 0), offsets(nprocs + 1, 0);
+    MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, comm);
+    for (int p = 0; p != nprocs; ++p) offsets[p + 1] = offsets[p] + sizes[p];
+
+    global_str.assign(rank == 0 ? offsets[nprocs] : 0, '\0');
+    MPI_Gatherv(local_str.data(),
+                local_size,
+                MPI_CHAR,
+                global_str.data(),
+                sizes.data(),
+                offsets.data(),
+                MPI_CHAR,
+                0,
+                comm);
+  } else if (comm_->NumProc() > 1) {
+    Errors::Message msg;
+    msg << "MPCWeakSubdomain \"" << name()
+        << "\": \"subdomain cost output file\" requires an MPI communicator.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  if (rank == 0) {
+    std::ofstream file(filename);
+    if (!file.good()) {
+      Errors::Message msg;
+      msg << "MPCWeakSubdomain \"" << name() << "\": cannot open \"subdomain cost output file\" \""
+          << filename << "\".";
+      Exceptions::amanzi_throw(msg);
+    }
+    file << "# subdomain advance cost [s]\n";
+    file.write(global_str.data(), global_str.size());
+  }
+}
+
+
+void
+MPCWeakSubdomain::CalculateDiagnostics(const Tag& tag)
+{
+  MPC<PK>::CalculateDiagnostics(tag);
+  if (!cost_output_file_.empty() && tag == Tags::NEXT) WriteCosts_(cost_output_file_);
 }
 
 
@@ -317,6 +750,7 @@ MPCWeakSubdomain::init_()
     solution_->PushBack(pk_soln);
 
     // create the PK
+    cost_keys_.emplace_back(Keys::getKey(subdomain, "advance_cost"));
     auto subpk = Keys::getKey(subdomain, std::get<2>(subdomain_triple));
     sub_pks_.emplace_back(pk_factory.CreatePK(subpk, pk_tree_, global_list_, S_, pk_soln));
   }
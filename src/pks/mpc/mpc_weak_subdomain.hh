@@ -17,6 +17,9 @@
  */
 
 #pragma once
+#include <functional>
+#include <mutex>
+
 #include "mpc.hh"
 
 namespace Amanzi {
@@ -40,6 +43,10 @@ class MPCWeakSubdomain : public MPC<PK> {
   // -- advance each sub pk dt.
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit) override;
   virtual void CommitStep(double t_old, double t_new, const Tag& tag_next) override;
+  virtual void FailStep(double t_old, double t_new, const Tag& tag) override;
+
+  // -- writes the subdomain cost output file, if requested
+  virtual void CalculateDiagnostics(const Tag& tag) override;
 
  protected:
   void init_();
@@ -47,6 +54,34 @@ class MPCWeakSubdomain : public MPC<PK> {
   bool AdvanceStep_Standard_(double t_old, double t_new, bool reinit);
   bool AdvanceStep_Subcycled_(double t_old, double t_new, bool reinit);
 
+  // advance the ith sub-PK through its full subcycling loop, from t_old to t_new
+  void AdvanceSubdomain_Subcycled_(int i, const std::string& subdomain, double t_old, double t_new);
+
+  // Apply func(i) to each sub-PK index, either serially or on the shared
+  // thread pool.  func returns true on failure; once any index has failed, no
+  // new indices are started.  Returns the number of failed indices.
+  int ForEachSubdomain_(const std::function<bool(int)>& func);
+
+  // Reduce n_threads_ to 1, with a warning, unless MPI provides
+  // MPI_THREAD_MULTIPLE and Teuchos::RCP is thread safe.
+  void CheckThreadSupport_();
+
+  // Throw unless no subdomain's evaluators depend on shared evaluators, as
+  // required to advance sub-PKs concurrently.
+  void CheckSubdomainsIndependent_();
+
+  // Pull the recorded per-subdomain costs from State, order the threaded
+  // schedule most expensive first, and report the imbalance across ranks.
+  void UpdateSchedule_();
+
+  // Seed the recorded costs of this rank's subdomains from a file of
+  // "SUBDOMAIN COST" lines.
+  void ReadCosts_(const std::string& filename);
+
+  // Gather the recorded costs of all subdomains to rank 0 and write them, in
+  // the same format, ordered by rank.  Collective on comm_.
+  void WriteCosts_(const std::string& filename);
+
   Tag get_ds_tag_next_(const std::string& subdomain)
   {
     if (subcycled_)
@@ -62,11 +97,26 @@ class MPCWeakSubdomain : public MPC<PK> {
       return tag_current_;
   }
 
+  // the min of this rank's sub PKs timestep sizes
+  double getLocalDt_();
+
   Comm_ptr_type comm_;
   bool subcycled_;
   double subcycled_target_dt_;
   double cycle_dt_;
+  double dt_next_; // global min of sub PK dts after the last advance, or < 0
+  double t_advanced_; // t_new of the advance that reduced dt_next_
   Key ds_name_;
+  int n_threads_;
+  std::mutex state_mutex_; // serializes this MPC's State writes from threads
+
+  // per-subdomain wallclock cost of the most recent advance
+  bool record_cost_;
+  std::vector<Key> cost_keys_;
+  std::vector<double> costs_;
+  std::vector<int> schedule_;
+  std::string cost_input_file_;
+  std::string cost_output_file_;
 
  private:
   // factory registration
@@ -28,6 +28,8 @@ Globally implicit coupling solves all sub-PKs as a single system of equations.
 
 #include "mpc.hh"
 #include "pk_bdf_default.hh"
+#include "pk_profiler.hh"
+#include "reduction_batch.hh"
 
 namespace Amanzi {
 
@@ -68,6 +70,11 @@ class StrongMPC : public MPC<PK_t>, public PK_BDF_Default {
   virtual double
   ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
 
+  // -- enorm for the coupled system, reduced with those of any parent MPC
+  virtual int ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                               Teuchos::RCP<const TreeVector> du,
+                               ReductionBatch& batch) override;
+
   // StrongMPC's preconditioner is, by default, just the block-diagonal
   // operator formed by placing the sub PK's preconditioners on the diagonal.
   // -- Apply preconditioner to u and returns the result in Pu.
@@ -200,6 +207,7 @@ StrongMPC<PK_t>::FunctionalResidual(double t_old,
                                     Teuchos::RCP<TreeVector> u_new,
                                     Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   Solution_to_State(*u_new, tag_next_);
 
   // loop over sub-PKs
@@ -229,6 +237,7 @@ StrongMPC<PK_t>::FunctionalResidual(double t_old,
     }
 
     // fill the nonlinear function with each sub-PKs contribution
+    PKProfiler::Scope profile_sub(sub_pks_[i]->name(), "FunctionalResidual");
     sub_pks_[i]->FunctionalResidual(t_old, t_new, pk_u_old, pk_u_new, pk_g);
   }
 };
@@ -241,6 +250,7 @@ template <class PK_t>
 int
 StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   // loop over sub-PKs
   int ierr = 0;
   for (std::size_t i = 0; i != sub_pks_.size(); ++i) {
@@ -259,6 +269,7 @@ StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::
     }
 
     // Fill the preconditioned u as the block-diagonal product using each sub-PK.
+    PKProfiler::Scope profile_sub(sub_pks_[i]->name(), "ApplyPreconditioner");
     int icur_err = sub_pks_[i]->ApplyPreconditioner(pk_u, pk_Pu);
     ierr += icur_err;
   }
@@ -268,13 +279,33 @@ StrongMPC<PK_t>::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::
 
 // -----------------------------------------------------------------------------
 // Compute a norm on u-du and returns the result.
-// For a Strong MPC, the enorm is just the max of the sub PKs enorms.
+// For a Strong MPC, the enorm is just the max of the sub PKs enorms.  The
+// sub-PKs' global reductions are batched into one collective.
 // -----------------------------------------------------------------------------
 template <class PK_t>
 double
 StrongMPC<PK_t>::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du)
 {
-  double norm = 0.0;
+  PKProfiler::Scope profile(name(), "ErrorNorm");
+  ReductionBatch batch(*solution_->Comm());
+  int handle = ErrorNormBatched(u, du, batch);
+  batch.Flush();
+  return batch.get(handle);
+};
+
+
+// -----------------------------------------------------------------------------
+// Register the sub-PKs' norms in batch, returning the handle of their max.
+// Each sub-PK norm is a max, so the max of their local values reduces to the
+// max of their global values.
+// -----------------------------------------------------------------------------
+template <class PK_t>
+int
+StrongMPC<PK_t>::ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                                  Teuchos::RCP<const TreeVector> du,
+                                  ReductionBatch& batch)
+{
+  double norm_local = 0.0;
 
   // loop over sub-PKs
   for (std::size_t i = 0; i != sub_pks_.size(); ++i) {
@@ -293,10 +324,11 @@ StrongMPC<PK_t>::ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const
     }
 
     // norm is the max of the sub-PK norms
-    double tmp_norm = sub_pks_[i]->ErrorNorm(pk_u, pk_du);
-    norm = std::max(norm, tmp_norm);
+    PKProfiler::Scope profile_sub(sub_pks_[i]->name(), "ErrorNorm");
+    int handle = sub_pks_[i]->ErrorNormBatched(pk_u, pk_du, batch);
+    norm_local = std::max(norm_local, batch.getLocal(handle));
   }
-  return norm;
+  return batch.Max(norm_local);
 };
 
 
@@ -307,6 +339,7 @@ template <class PK_t>
 void
 StrongMPC<PK_t>::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   Solution_to_State(*up, tag_next_);
 
   // loop over sub-PKs
@@ -319,6 +352,7 @@ StrongMPC<PK_t>::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> u
     }
 
     // update precons of each of the sub-PKs
+    PKProfiler::Scope profile_sub(sub_pks_[i]->name(), "UpdatePreconditioner");
     sub_pks_[i]->UpdatePreconditioner(t, pk_up, h);
   };
 };
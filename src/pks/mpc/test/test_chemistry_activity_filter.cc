@@ -0,0 +1,179 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Epetra_Map.h"
+#include "Epetra_MultiVector.h"
+
+#include "AmanziComm.hh"
+
+#include "chemistry_activity_filter.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// Concentrations of two components and a saturation on ncells cells.
+struct Cells {
+  Cells(const Epetra_Map& map) : tcc(map, 2), sat(map, 1)
+  {
+    for (int c = 0; c != tcc.MyLength(); ++c) {
+      for (int k = 0; k != 2; ++k) tcc[k][c] = 1.3 + 0.4 * std::sin(1.1 * c + k);
+      sat[0][c] = 0.5 + 0.3 * std::cos(0.7 * c);
+    }
+  }
+
+  ChemistryActivityFilter::Inputs inputs() const
+  {
+    return { Teuchos::rcp(&tcc, false), Teuchos::rcp(&sat, false) };
+  }
+
+  // Equilibrium chemistry: each component precipitates down to a solubility
+  // that depends on the saturation.
+  void solve()
+  {
+    for (int c = 0; c != tcc.MyLength(); ++c) {
+      for (int k = 0; k != 2; ++k) tcc[k][c] = std::min(tcc[k][c], 1. + sat[0][c] + 0.1 * k);
+    }
+  }
+
+  // Solves every cell unless no cell is active, as the reactive transport
+  // MPCs do.
+  int solve(ChemistryActivityFilter& filter)
+  {
+    std::vector<bool> active;
+    int n_active = filter.FindActive(inputs(), active);
+    if (n_active > 0) {
+      solve();
+      filter.Record(inputs());
+    }
+    return n_active;
+  }
+
+  Epetra_MultiVector tcc, sat;
+};
+
+Teuchos::ParameterList
+filterList(double tol)
+{
+  Teuchos::ParameterList plist;
+  plist.set("chemistry activity tolerance", tol);
+  return plist;
+}
+
+} // namespace
+
+
+// Transport alternately changes every cell a little, when the solve is
+// skipped and the result stays within the tolerance of a full solve, and some
+// cells a lot, when every cell is solved.
+TEST(CHEMISTRY_ACTIVITY_FILTER_MATCHES_FULL_SOLVE)
+{
+  double tol = 1.e-3;
+  auto comm = getDefaultComm();
+  Epetra_Map map(-1, 40, 0, *comm);
+  auto plist = filterList(tol);
+  ChemistryActivityFilter filter(plist);
+  CHECK(filter.enabled());
+
+  Cells full(map), filtered(map);
+  full.solve();
+  CHECK_EQUAL(40, filtered.solve(filter));
+
+  int n_changed = 0;
+  for (int c = 0; c != 40; ++c) {
+    if (c % 4 == 0 || c % 5 == 0) n_changed++;
+  }
+
+  for (int step = 0; step != 10; ++step) {
+    bool quiet = step % 2 == 0;
+    double sign = step % 4 < 2 ? 1. : -1.;
+    for (Cells* cells : { &full, &filtered }) {
+      for (int c = 0; c != 40; ++c) {
+        for (int k = 0; k != 2; ++k) {
+          cells->tcc[k][c] *= 1. + 1.e-5 * std::sin(c + k + step);
+          if (!quiet && c % 4 == 0) cells->tcc[k][c] += sign * 0.05 * (1.5 + std::cos(c + step));
+        }
+        if (!quiet && c % 5 == 0)
+          cells->sat[0][c] += sign * 0.01 * (1.5 + std::sin(0.3 * c + step));
+      }
+    }
+
+    Cells expected(filtered);
+    expected.solve();
+    full.solve();
+    CHECK_EQUAL(quiet ? 0 : n_changed, filtered.solve(filter));
+
+    for (int c = 0; c != 40; ++c) {
+      for (int k = 0; k != 2; ++k) {
+        CHECK_CLOSE(full.tcc[k][c], filtered.tcc[k][c], 2 * tol * std::abs(full.tcc[k][c]));
+        // when solved, every cell is solved, and none keeps its transported value
+        if (!quiet) CHECK_EQUAL(expected.tcc[k][c], filtered.tcc[k][c]);
+      }
+    }
+  }
+}
+
+
+// Small changes accumulate against the recorded inputs until the cell is
+// active.
+TEST(CHEMISTRY_ACTIVITY_FILTER_ACCUMULATES)
+{
+  auto comm = getDefaultComm();
+  Epetra_Map map(-1, 1, 0, *comm);
+  auto plist = filterList(1.e-3);
+  ChemistryActivityFilter filter(plist);
+
+  Cells cells(map);
+  std::vector<bool> active;
+  CHECK_EQUAL(1, cells.solve(filter));
+
+  double x0 = cells.tcc[0][0];
+  for (int step = 1; step != 4; ++step) {
+    cells.tcc[0][0] = x0 * (1. + 4.e-4 * step);
+    CHECK_EQUAL(step < 3 ? 0 : 1, filter.FindActive(cells.inputs(), active));
+    CHECK_EQUAL(step == 3, static_cast<bool>(active[0]));
+  }
+}
+
+
+// Reset and kinetic reactions make every cell active; a negative tolerance
+// disables the filter.
+TEST(CHEMISTRY_ACTIVITY_FILTER_RESET_AND_KINETICS)
+{
+  auto comm = getDefaultComm();
+  Epetra_Map map(-1, 7, 0, *comm);
+  auto plist = filterList(1.e-3);
+  ChemistryActivityFilter filter(plist);
+
+  Cells cells(map);
+  std::vector<bool> active;
+  cells.solve(filter);
+  CHECK_EQUAL(0, filter.FindActive(cells.inputs(), active));
+
+  filter.Reset();
+  CHECK_EQUAL(7, filter.FindActive(cells.inputs(), active));
+  cells.solve(filter);
+  CHECK_EQUAL(0, filter.FindActive(cells.inputs(), active));
+
+  filter.set_has_kinetics(true);
+  CHECK(!filter.enabled());
+  CHECK_EQUAL(7, filter.FindActive(cells.inputs(), active));
+  CHECK(std::all_of(active.begin(), active.end(), [](bool a) { return a; }));
+
+  Teuchos::ParameterList disabled_plist;
+  ChemistryActivityFilter disabled(disabled_plist);
+  CHECK(!disabled.enabled());
+}
@@ -0,0 +1,169 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "CompositeVector.hh"
+#include "CompositeVectorSpace.hh"
+#include "errors.hh"
+#include "GeometricModel.hh"
+#include "Mesh.hh"
+#include "MeshFactory.hh"
+
+#include "mpc_surface_subsurface_helpers.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// A box and the surface mesh extracted from its top faces.
+struct Meshes {
+  Meshes()
+  {
+    auto comm = getDefaultComm();
+    Teuchos::ParameterList regions;
+    auto& plane = regions.sublist("surface").sublist("region: plane");
+    plane.set("point", Teuchos::Array<double>({ 0., 0., 1. }));
+    plane.set("normal", Teuchos::Array<double>({ 0., 0., 1. }));
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, regions, *comm));
+
+    AmanziMesh::MeshFactory factory(comm, gm);
+    sub = factory.create(0.0, 0.0, 0.0, 3.0, 2.0, 1.0, 6, 5, 4);
+    surf = factory.create(sub, { "surface" }, AmanziMesh::FACE, true, true, false);
+  }
+
+  Teuchos::RCP<const AmanziMesh::Mesh> sub, surf;
+};
+
+Teuchos::RCP<CompositeVector>
+createVector(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh, const std::string& face_comp)
+{
+  CompositeVectorSpace space;
+  space.SetMesh(mesh)->SetGhosted()->AddComponent("cell", AmanziMesh::CELL, 1);
+  if (face_comp == "face") {
+    space.AddComponent("face", AmanziMesh::FACE, 1);
+  } else if (face_comp == "boundary_face") {
+    space.AddComponent("boundary_face", AmanziMesh::BOUNDARY_FACE, 1);
+  }
+  return Teuchos::rcp(new CompositeVector(space));
+}
+
+// distinct values in every entry of every component
+void
+fill(CompositeVector& vec, double offset)
+{
+  for (const auto& comp : vec) {
+    Epetra_MultiVector& v = *vec.ViewComponent(comp, false);
+    for (int i = 0; i != v.MyLength(); ++i) v[0][i] = offset + 101325. + std::sin(1.3 * i) * 10.;
+  }
+}
+
+void
+checkEqual(const CompositeVector& a, const CompositeVector& b)
+{
+  for (const auto& comp : a) {
+    const Epetra_MultiVector& va = *a.ViewComponent(comp, false);
+    const Epetra_MultiVector& vb = *b.ViewComponent(comp, false);
+    CHECK_EQUAL(va.MyLength(), vb.MyLength());
+    for (int i = 0; i != va.MyLength(); ++i) CHECK_EQUAL(va[0][i], vb[0][i]);
+  }
+}
+
+} // namespace
+
+
+// each surface cell maps to the top face of the column below it
+TEST(SURFACE_SUBSURFACE_MAP_FACES)
+{
+  Meshes meshes;
+  SurfaceSubsurfaceMap map(meshes.surf, meshes.sub);
+
+  int ncells_surf =
+    meshes.surf->num_entities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED);
+  CHECK(ncells_surf > 0);
+  CHECK_EQUAL(ncells_surf, map.faces().size());
+  CHECK_EQUAL(ncells_surf, map.boundary_faces().size());
+
+  for (int sc = 0; sc != ncells_surf; ++sc) {
+    AmanziMesh::Entity_ID f = map.faces()[sc];
+    CHECK_EQUAL(meshes.surf->entity_get_parent(AmanziMesh::CELL, sc), f);
+    CHECK_EQUAL(AmanziMesh::getFaceOnBoundaryBoundaryFace(*meshes.sub, f),
+                map.boundary_faces()[sc]);
+
+    const auto& xf = meshes.sub->face_centroid(f);
+    const auto& xc = meshes.surf->cell_centroid(sc);
+    CHECK_CLOSE(1.0, xf[2], 1.e-12);
+    CHECK_CLOSE(xc[0], xf[0], 1.e-12);
+    CHECK_CLOSE(xc[1], xf[1], 1.e-12);
+  }
+}
+
+
+// the cached copies and merge give exactly what the free functions give, for
+// both face and boundary face subsurface vectors
+TEST(SURFACE_SUBSURFACE_MAP_MATCHES_HELPERS)
+{
+  Meshes meshes;
+  SurfaceSubsurfaceMap map(meshes.surf, meshes.sub);
+
+  for (const std::string face_comp : { "face", "boundary_face" }) {
+    auto surf = createVector(meshes.surf, "");
+    auto sub = createVector(meshes.sub, face_comp);
+
+    // surface to subsurface
+    fill(*surf, 1.);
+    fill(*sub, 2.);
+    auto sub_expected = Teuchos::rcp(new CompositeVector(*sub));
+    CopySurfaceToSubsurface(*surf, *sub_expected);
+    map.CopySurfaceToSubsurface(*surf, *sub);
+    checkEqual(*sub_expected, *sub);
+
+    // subsurface to surface
+    fill(*surf, 3.);
+    fill(*sub, 4.);
+    auto surf_expected = Teuchos::rcp(new CompositeVector(*surf));
+    CopySubsurfaceToSurface(*sub, *surf_expected);
+    map.CopySubsurfaceToSurface(*sub, *surf);
+    checkEqual(*surf_expected, *surf);
+
+    // merge, with ponded depth and surface pressure above atmospheric in
+    // some cells but not others
+    auto h_prev = createVector(meshes.surf, "");
+    Epetra_MultiVector& h_c = *h_prev->ViewComponent("cell", false);
+    for (int sc = 0; sc != h_c.MyLength(); ++sc) h_c[0][sc] = sc % 3 == 0 ? 0. : 0.01 * sc;
+    fill(*surf, 0.);
+    fill(*sub, 5.);
+    surf_expected = Teuchos::rcp(new CompositeVector(*surf));
+    sub_expected = Teuchos::rcp(new CompositeVector(*sub));
+    MergeSubsurfaceAndSurfacePressure(*h_prev, *sub_expected, *surf_expected);
+    map.MergeSubsurfaceAndSurfacePressure(*h_prev, *sub, *surf);
+    checkEqual(*surf_expected, *surf);
+    checkEqual(*sub_expected, *sub);
+  }
+}
+
+
+// vectors on other meshes are refused
+TEST(SURFACE_SUBSURFACE_MAP_WRONG_MESH)
+{
+  Meshes meshes;
+  Meshes other;
+  SurfaceSubsurfaceMap map(meshes.surf, meshes.sub);
+
+  auto surf = createVector(other.surf, "");
+  auto sub = createVector(meshes.sub, "face");
+  CHECK_THROW(map.CopySurfaceToSubsurface(*surf, *sub), Errors::Message);
+  CHECK_THROW(map.CopySubsurfaceToSurface(*sub, *surf), Errors::Message);
+}
@@ -19,6 +19,7 @@ See additional documentation in the base class src/pks/mpc/MPC.hh
 
 #include <limits>
 #include "weak_mpc.hh"
+#include "pk_profiler.hh"
 
 namespace Amanzi {
 
@@ -59,8 +60,10 @@ WeakMPC::set_dt(double dt)
 bool
 WeakMPC::AdvanceStep(double t_old, double t_new, bool reinit)
 {
+  PKProfiler::Scope profile(name(), "AdvanceStep");
   bool fail = false;
   for (auto& pk : sub_pks_) {
+    PKProfiler::Scope profile_sub(pk->name(), "AdvanceStep");
     fail = pk->AdvanceStep(t_old, t_new, reinit);
     if (fail) return fail;
   }
@@ -17,6 +17,7 @@ BDF.
 #include "Teuchos_TimeMonitor.hpp"
 #include "BDF1_TI.hh"
 #include "pk_bdf_default.hh"
+#include "pk_profiler.hh"
 #include "State.hh"
 
 namespace Amanzi {
@@ -108,6 +109,7 @@ PK_BDF_Default::set_dt(double dt)
 void
 PK_BDF_Default::CommitStep(double t_old, double t_new, const Tag& tag)
 {
+  PKProfiler::Scope profile(name(), "CommitStep");
   if (tag == tag_next_) {
     double dt = t_new - t_old;
     if (time_stepper_ != Teuchos::null && dt > 0) {
@@ -123,6 +125,7 @@ PK_BDF_Default::CommitStep(double t_old, double t_new, const Tag& tag)
 bool
 PK_BDF_Default::AdvanceStep(double t_old, double t_new, bool reinit)
 {
+  PKProfiler::Scope profile(name(), "AdvanceStep");
   double dt = t_new - t_old;
   Teuchos::OSTab out = vo_->getOSTab();
 
@@ -147,7 +150,10 @@ PK_BDF_Default::AdvanceStep(double t_old, double t_new, bool reinit)
   double dt_solver = -1;
   bool fail = false;
   try {
-    fail = time_stepper_->TimeStep(dt, dt_solver, solution_);
+    {
+      PKProfiler::Scope profile_ti(name(), "TimeStep");
+      fail = time_stepper_->TimeStep(dt, dt_solver, solution_);
+    }
 
     if (!fail) {
       // check step validity
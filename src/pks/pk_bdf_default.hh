@@ -47,6 +47,8 @@ PKs.
 #include "BDF1_TI.hh"
 #include "PK_BDF.hh"
 
+#include "reduction_batch.hh"
+
 
 namespace Amanzi {
 
@@ -86,6 +88,15 @@ class PK_BDF_Default : public PK_BDF {
   // -- Check the admissibility of a solution.
   virtual bool IsAdmissible(Teuchos::RCP<const TreeVector> up) override { return true; }
 
+  // -- Error norm with its global reduction deferred to batch, returning the
+  //    handle of the norm.  The default computes ErrorNorm() immediately.
+  virtual int ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                               Teuchos::RCP<const TreeVector> du,
+                               ReductionBatch& batch)
+  {
+    return batch.Max(ErrorNorm(u, du));
+  }
+
   // -- Possibly modify the predictor that is going to be used as a
   //    starting value for the nonlinear solve in the time integrator.
   virtual bool
@@ -18,6 +18,7 @@ Explicit.
 #include "PK.hh"
 #include "State.hh"
 #include "pk_explicit_default.hh"
+#include "pk_profiler.hh"
 
 namespace Amanzi {
 
@@ -56,6 +57,7 @@ PK_Explicit_Default::Initialize()
 bool
 PK_Explicit_Default::AdvanceStep(double t_old, double t_new, bool reinit)
 {
+  PKProfiler::Scope profile(name(), "AdvanceStep");
   double dt = t_new - t_old;
 
   Teuchos::OSTab out = vo_->getOSTab();
@@ -10,7 +10,11 @@
 //! A set of helper functions for doing common things in PKs.
 #include "Mesh_Algorithms.hh"
 #include "Chemistry_PK.hh"
+#ifdef ALQUIMIA_ENABLED
+#  include "ChemistryEngine.hh"
+#endif
 #include "pk_helpers.hh"
+#include "pk_profiler.hh"
 
 namespace Amanzi {
 
@@ -154,6 +158,30 @@ changedEvaluatorPrimary(const Key& key, const Tag& tag, State& S, bool or_die)
 }
 
 
+// -----------------------------------------------------------------------------
+// Updates an evaluator, or its derivative, within a profiler scope.
+// -----------------------------------------------------------------------------
+bool
+updateEvaluator(const Key& key, const Tag& tag, State& S, const Key& request)
+{
+  PKProfiler::Scope profile(key, "Update");
+  return S.GetEvaluator(key, tag).Update(S, request);
+}
+
+
+bool
+updateEvaluatorDerivative(const Key& key,
+                          const Tag& tag,
+                          State& S,
+                          const Key& request,
+                          const Key& wrt_key,
+                          const Tag& wrt_tag)
+{
+  PKProfiler::Scope profile(key, "UpdateDerivative");
+  return S.GetEvaluator(key, tag).UpdateDerivative(S, request, wrt_key, wrt_tag);
+}
+
+
 // -----------------------------------------------------------------------------
 // Require a vector and a primary variable evaluator at current tag(s).
 // -----------------------------------------------------------------------------
@@ -219,7 +247,7 @@ requireEvaluatorAssign(const Key& key, const Tag& tag, State& S)
 void
 assign(const Key& key, const Tag& tag_dest, const Tag& tag_source, State& S)
 {
-  S.GetEvaluator(key, tag_source).Update(S, Keys::getKey(key, tag_dest));
+  updateEvaluator(key, tag_source, S, Keys::getKey(key, tag_dest));
   bool changed = changedEvaluatorPrimary(key, tag_dest, S, false);
   if (changed) S.Assign(key, tag_dest, tag_source);
 }
@@ -285,6 +313,17 @@ advanceChemistry(Teuchos::RCP<AmanziChemistry::Chemistry_PK> chem_pk,
 }
 
 
+bool
+hasKineticReactions(AmanziChemistry::Chemistry_PK& chem_pk)
+{
+#ifdef ALQUIMIA_ENABLED
+  auto engine = chem_pk.chem_engine();
+  if (engine != Teuchos::null) return engine->NumAqueousKinetics() > 0 || engine->NumMinerals() > 0;
+#endif
+  return true;
+}
+
+
 void
 copyMeshCoordinatesToVector(const AmanziMesh::Mesh& mesh, CompositeVector& vec)
 {
@@ -317,6 +356,33 @@ copyVectorToMeshCoordinates(const CompositeVector& vec, AmanziMesh::Mesh& mesh)
   mesh.deform(node_ids, new_positions);
 }
 
+int
+copyChangedVectorToMeshCoordinates(const CompositeVector& vec, AmanziMesh::Mesh& mesh)
+{
+  const Epetra_MultiVector& nodes = *vec.ViewComponent("node", true);
+  int ndim = mesh.space_dimension();
+
+  std::vector<int> node_ids;
+  Amanzi::AmanziGeometry::Point_List new_positions;
+  AmanziGeometry::Point nc;
+  for (int n = 0; n != nodes.MyLength(); ++n) {
+    mesh.node_get_coordinates(n, &nc);
+    bool changed = false;
+    for (int j = 0; j != ndim; ++j) changed |= (nc[j] != nodes[j][n]);
+    if (!changed) continue;
+
+    node_ids.push_back(n);
+    if (ndim == 2) {
+      new_positions.emplace_back(Amanzi::AmanziGeometry::Point{ nodes[0][n], nodes[1][n] });
+    } else {
+      new_positions.emplace_back(
+        Amanzi::AmanziGeometry::Point{ nodes[0][n], nodes[1][n], nodes[2][n] });
+    }
+  }
+  if (node_ids.size() > 0) mesh.deform(node_ids, new_positions);
+  return node_ids.size();
+}
+
 int
 commMaxValLoc(const Comm_type& comm, const ValLoc& local, ValLoc& global)
 {
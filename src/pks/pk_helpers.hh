@@ -69,6 +69,22 @@ bool
 changedEvaluatorPrimary(const Key& key, const Tag& tag, State& S, bool or_die = true);
 
 
+// -----------------------------------------------------------------------------
+// Update an evaluator, or its derivative, timed by the PK profiler under the
+// evaluator's key.  Returns true if it changed.
+// -----------------------------------------------------------------------------
+bool
+updateEvaluator(const Key& key, const Tag& tag, State& S, const Key& request);
+
+bool
+updateEvaluatorDerivative(const Key& key,
+                          const Tag& tag,
+                          State& S,
+                          const Key& request,
+                          const Key& wrt_key,
+                          const Tag& wrt_tag);
+
+
 // -----------------------------------------------------------------------------
 // Require a vector and a primary variable evaluator at current tag(s).
 // -----------------------------------------------------------------------------
@@ -123,12 +139,23 @@ advanceChemistry(Teuchos::RCP<AmanziChemistry::Chemistry_PK> chem_pk,
                  Teuchos::RCP<Epetra_MultiVector> tcc,
                  Teuchos::Time& timer);
 
+// Does the chemistry have any kinetic reactions?  True if this cannot be
+// determined.
+bool
+hasKineticReactions(AmanziChemistry::Chemistry_PK& chem_pk);
+
 
 void
 copyMeshCoordinatesToVector(const AmanziMesh::Mesh& mesh, CompositeVector& vec);
 void
 copyVectorToMeshCoordinates(const CompositeVector& vec, AmanziMesh::Mesh& mesh);
 
+// Like copyVectorToMeshCoordinates, but moves only the nodes whose
+// coordinates differ from those in vec, and does not touch the mesh (or
+// recompute its geometry) if none do.  Returns the number of nodes moved.
+int
+copyChangedVectorToMeshCoordinates(const CompositeVector& vec, AmanziMesh::Mesh& mesh);
+
 
 // Compute pairs of value + location
 typedef struct ValLoc {
@@ -16,7 +16,9 @@ PKPhysicalBase and BDF methods of PK_BDF_Default.
 
 #include "boost/math/special_functions/fpclassify.hpp"
 #include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "pk_physical_bdf_default.hh"
+#include "upwind_topology.hh"
 
 namespace Amanzi {
 
@@ -76,6 +78,7 @@ int
 PK_PhysicalBDF_Default::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                             Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   *Pu = *u;
   return 0;
 }
@@ -87,6 +90,63 @@ PK_PhysicalBDF_Default::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
 double
 PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
                                   Teuchos::RCP<const TreeVector> res)
+{
+  PKProfiler::Scope profile(name(), "ErrorNorm");
+  ReductionBatch batch(*mesh_->get_comm());
+  int handle = PK_PhysicalBDF_Default::ErrorNormBatched(u, res, batch);
+  batch.Flush();
+  return batch.get(handle);
+};
+
+
+// -----------------------------------------------------------------------------
+// Error norm with the global reduction deferred to a batch.
+// -----------------------------------------------------------------------------
+int
+PK_PhysicalBDF_Default::ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                                         Teuchos::RCP<const TreeVector> res,
+                                         ReductionBatch& batch)
+{
+  // a PK on a different communicator must reduce on its own
+  if (!batch.isCompatible(*mesh_->get_comm())) return batch.Max(ErrorNorm(u, res));
+
+  std::vector<std::string> comps;
+  std::vector<ENorm_t> enorms;
+  std::vector<double> infnorms;
+  ErrorNormComponents_(u, res, comps, enorms, infnorms);
+
+  double enorm_val = 0.0;
+  std::vector<int> enorm_handles, infnorm_handles;
+  for (int i = 0; i != comps.size(); ++i) {
+    enorm_handles.emplace_back(batch.MaxLoc(enorms[i].value, enorms[i].gid));
+    infnorm_handles.emplace_back(batch.Max(infnorms[i]));
+    enorm_val = std::max(enorm_val, enorms[i].value);
+  }
+
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+    batch.OnFlush([this, comps, enorm_handles, infnorm_handles](const ReductionBatch& b) {
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "ENorm (Infnorm) of: " << conserved_key_ << ": " << std::endl;
+      for (int i = 0; i != comps.size(); ++i) {
+        *vo_->os() << "  ENorm (" << comps[i] << ") = " << b.get(enorm_handles[i]) << "["
+                   << b.getLoc(enorm_handles[i]) << "] (" << b.get(infnorm_handles[i]) << ")"
+                   << std::endl;
+      }
+    });
+  }
+  return batch.Max(enorm_val);
+}
+
+
+// -----------------------------------------------------------------------------
+// Local error norm of each component.
+// -----------------------------------------------------------------------------
+void
+PK_PhysicalBDF_Default::ErrorNormComponents_(Teuchos::RCP<const TreeVector> u,
+                                             Teuchos::RCP<const TreeVector> res,
+                                             std::vector<std::string>& comps,
+                                             std::vector<ENorm_t>& enorms,
+                                             std::vector<double>& infnorms)
 {
   // Abs tol based on old conserved quantity -- we know these have been vetted
   // at some level whereas the new quantity is some iterate, and may be
@@ -97,33 +157,27 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
   const Epetra_MultiVector& cv =
     *S_->Get<CompositeVector>(cell_vol_key_, tag_next_).ViewComponent("cell", true);
 
-  // VerboseObject stuff.
-  Teuchos::OSTab tab = vo_->getOSTab();
-  if (vo_->os_OK(Teuchos::VERB_MEDIUM))
-    *vo_->os() << "ENorm (Infnorm) of: " << conserved_key_ << ": " << std::endl;
-
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_->get_time(tag_next_) - S_->get_time(tag_current_);
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
-
-  double enorm_val = 0.0;
+  // each component's weighted norm, its location, and the inf norm of the
+  // residual are found in a single pass
   for (CompositeVector::name_iterator comp = dvec->begin(); comp != dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
+    double infnorm = 0.0;
     const Epetra_MultiVector& dvec_v = *dvec->ViewComponent(*comp, false);
+    const double* dvec_p = dvec_v[0];
 
     if (*comp == "cell") {
       // error done relative to extensive, conserved quantity
       int ncells = dvec->size(*comp, false);
-      for (unsigned int c = 0; c != ncells; ++c) {
-        double enorm_c =
-          std::abs(h * dvec_v[0][c]) / (atol_ * cv[0][c] + rtol_ * std::abs(conserved[0][c]));
-        AMANZI_ASSERT((atol_ * cv[0][c] + rtol_ * std::abs(conserved[0][c])) > 0.);
-
+      for (int c = 0; c != ncells; ++c) {
+        double denom = atol_ * cv[0][c] + rtol_ * std::abs(conserved[0][c]);
+        AMANZI_ASSERT(denom > 0.);
+        double res_c = std::abs(dvec_p[c]);
+        double enorm_c = h * res_c / denom;
+        infnorm = std::max(infnorm, res_c);
         if (enorm_c > enorm_comp) {
           enorm_comp = enorm_c;
           enorm_loc = c;
@@ -133,19 +187,19 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
-
-      for (unsigned int f = 0; f != nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min =
-          cells.size() == 1 ? cv[0][cells[0]] : std::min(cv[0][cells[0]], cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ?
-                                 conserved[0][cells[0]] :
-                                 std::min(conserved[0][cells[0]], conserved[0][cells[1]]);
-
-        double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f]) /
-                         (atol_ * cv_min + rtol_ * std::abs(conserved_min));
-        AMANZI_ASSERT((atol_ * cv_min + rtol_ * std::abs(conserved_min)) > 0.);
+      int ncells = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+      const auto& topology = Operators::getUpwindTopology(mesh_);
+      for (int f = 0; f != nfaces; ++f) {
+        int c0, c1;
+        topology.OwnedCells(f, ncells, c0, c1);
+        double cv_min = std::min(cv[0][c0], cv[0][c1]);
+        double conserved_min = std::min(conserved[0][c0], conserved[0][c1]);
+
+        double denom = atol_ * cv_min + rtol_ * std::abs(conserved_min);
+        AMANZI_ASSERT(denom > 0.);
+        double res_f = std::abs(dvec_p[f]);
+        double enorm_f = fluxtol_ * h * res_f / denom;
+        infnorm = std::max(infnorm, res_f);
         if (enorm_f > enorm_comp) {
           enorm_comp = enorm_f;
           enorm_loc = f;
@@ -156,36 +210,14 @@ PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       // double norm;
       // dvec_v.Norm2(&norm);
       //      AMANZI_ASSERT(norm < 1.e-15);
+      for (int i = 0; i != dvec_v.MyLength(); ++i) infnorm = std::max(infnorm, std::abs(dvec_p[i]));
     }
 
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr;
-
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] ("
-                 << infnorm << ")" << std::endl;
-    }
-
-    enorm_val = std::max(enorm_val, enorm_comp);
+    comps.emplace_back(*comp);
+    enorms.emplace_back(ENorm_t{ enorm_comp, dvec_v.Map().GID(enorm_loc) });
+    infnorms.emplace_back(infnorm);
   }
-
-  double enorm_val_l = enorm_val;
-
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
-};
+}
 
 
 void
@@ -94,6 +94,12 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default, public PK_Physical_Default
   virtual double
   ErrorNorm(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<const TreeVector> du) override;
 
+  // -- Registers the per-component norms in batch, and writes them once it is
+  //    flushed.  Subclasses customize the norm through ErrorNormComponents_().
+  virtual int ErrorNormBatched(Teuchos::RCP<const TreeVector> u,
+                               Teuchos::RCP<const TreeVector> du,
+                               ReductionBatch& batch) override;
+
   virtual bool ValidStep() override
   {
     return PK_Physical_Default::ValidStep() && PK_BDF_Default::ValidStep();
@@ -117,6 +123,15 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default, public PK_Physical_Default
   std::vector<double>& bc_values() { return bc_->bc_value(); }
   Teuchos::RCP<Operators::BCs> BCs() { return bc_; }
 
+ protected:
+  // Local weighted norm (value and local index) and residual inf norm of
+  // each component of du.
+  virtual void ErrorNormComponents_(Teuchos::RCP<const TreeVector> u,
+                                    Teuchos::RCP<const TreeVector> du,
+                                    std::vector<std::string>& comps,
+                                    std::vector<ENorm_t>& enorms,
+                                    std::vector<double>& infnorms);
+
  protected:
   // PC
   Teuchos::RCP<Operators::Operator> preconditioner_;
@@ -0,0 +1,311 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "errors.hh"
+#include "pk_profiler.hh"
+
+namespace Amanzi {
+
+namespace {
+
+struct ProfileNode {
+  std::string label;
+  int parent;
+  std::map<std::string, int> children;
+  double time;
+  double calls;
+};
+
+// The tree of scopes, shared by all threads.  Node 0 is the root.
+struct ProfileTree {
+  ProfileTree() { nodes.push_back(ProfileNode{ "", -1, {}, 0., 0. }); }
+
+  std::mutex mutex;
+  std::vector<ProfileNode> nodes;
+};
+
+ProfileTree&
+profileTree()
+{
+  static ProfileTree tree;
+  return tree;
+}
+
+thread_local int current_node = 0;
+
+
+// Labels along the path from the root, separated by tabs.
+std::string
+nodePath(const std::vector<ProfileNode>& nodes, int node)
+{
+  std::string path = nodes[node].label;
+  for (int p = nodes[node].parent; p > 0; p = nodes[p].parent) {
+    path = nodes[p].label + '\t' + path;
+  }
+  return path;
+}
+
+
+std::string
+jsonEscape(const std::string& str)
+{
+  std::string escaped;
+  for (char c : str) {
+    if (c == '"' || c == '\\') escaped.push_back('\\');
+    escaped.push_back(c);
+  }
+  return escaped;
+}
+
+
+struct ReportEntry {
+  std::vector<std::string> labels;
+  double calls;
+  double time_min, time_mean, time_max;
+  std::vector<int> children;
+};
+
+
+void
+writeJSON(std::ostream& os, const std::vector<ReportEntry>& entries, int entry, int depth)
+{
+  std::string indent(2 * depth, ' ');
+  const auto& e = entries[entry];
+  os << indent << "{" << std::endl
+     << indent << "  \"name\": \"" << jsonEscape(e.labels.back()) << "\"," << std::endl
+     << indent << "  \"calls\": " << e.calls << "," << std::endl
+     << indent << "  \"time [s]\": { \"min\": " << e.time_min << ", \"mean\": " << e.time_mean
+     << ", \"max\": " << e.time_max << " }," << std::endl
+     << indent << "  \"children\": [";
+  if (e.children.empty()) {
+    os << "]" << std::endl;
+  } else {
+    os << std::endl;
+    for (int i = 0; i != e.children.size(); ++i) {
+      writeJSON(os, entries, e.children[i], depth + 2);
+      if (i + 1 != e.children.size()) os << indent << "    ," << std::endl;
+    }
+    os << indent << "  ]" << std::endl;
+  }
+  os << indent << "}" << std::endl;
+}
+
+} // namespace
+
+
+bool PKProfiler::enabled_ = false;
+
+
+PKProfiler::Scope::Scope(const std::string& name, const char* method) : node_(-1), parent_(-1)
+{
+  if (!enabled_) return;
+
+  std::string label = name + "::" + method;
+  auto& tree = profileTree();
+  {
+    std::lock_guard<std::mutex> lock(tree.mutex);
+    parent_ = current_node;
+    if (tree.nodes[parent_].label == label) return;
+
+    auto child = tree.nodes[parent_].children.find(label);
+    if (child == tree.nodes[parent_].children.end()) {
+      node_ = tree.nodes.size();
+      tree.nodes[parent_].children[label] = node_;
+      tree.nodes.push_back(ProfileNode{ label, parent_, {}, 0., 0. });
+    } else {
+      node_ = child->second;
+    }
+  }
+  current_node = node_;
+  start_ = std::chrono::steady_clock::now();
+}
+
+
+PKProfiler::Scope::~Scope()
+{
+  if (node_ < 0) return;
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_;
+  auto& tree = profileTree();
+  {
+    std::lock_guard<std::mutex> lock(tree.mutex);
+    tree.nodes[node_].time += elapsed.count();
+    tree.nodes[node_].calls += 1;
+  }
+  current_node = parent_;
+}
+
+
+PKProfiler::Attach::Attach(int node) : parent_(current_node)
+{
+  current_node = node;
+}
+
+
+PKProfiler::Attach::~Attach()
+{
+  current_node = parent_;
+}
+
+
+int
+PKProfiler::current()
+{
+  return current_node;
+}
+
+
+void
+PKProfiler::Write(const Comm_type& comm, const std::string& filename)
+{
+  // collect the local timers, by path
+  std::map<std::string, std::pair<double, double>> local;
+  std::string local_paths;
+  {
+    auto& tree = profileTree();
+    std::lock_guard<std::mutex> lock(tree.mutex);
+    for (int n = 1; n != tree.nodes.size(); ++n) {
+      std::string path = nodePath(tree.nodes, n);
+      local[path] = std::make_pair(tree.nodes[n].time, tree.nodes[n].calls);
+      local_paths += path + '\n';
+    }
+  }
+
+  // Form the union of paths over all ranks, in order of first appearance.
+  // Parents are always created before their children, so this order lists a
+  // parent before its children.
+  auto mpi_comm = dynamic_cast<const MpiComm_type*>(&comm);
+  std::string all_paths = local_paths;
+  int n_ranks = 1;
+  int rank = 0;
+  if (mpi_comm != nullptr) {
+    const MPI_Comm& mpi_comm_raw = mpi_comm->Comm();
+    MPI_Comm_size(mpi_comm_raw, &n_ranks);
+    MPI_Comm_rank(mpi_comm_raw, &rank);
+
+    int my_size = local_paths.size();
+    std::vector<int> sizes(n_ranks), offsets(n_ranks + 1, 0);
+    MPI_Allgather(&my_size, 1, MPI_INT, &sizes[0], 1, MPI_INT, mpi_comm_raw);
+    for (int r = 0; r != n_ranks; ++r) offsets[r + 1] = offsets[r] + sizes[r];
+
+    std::vector<char> buffer(offsets[n_ranks] + 1);
+    MPI_Allgatherv(local_paths.data(),
+                   my_size,
+                   MPI_CHAR,
+                   &buffer[0],
+                   &sizes[0],
+                   &offsets[0],
+                   MPI_CHAR,
+                   mpi_comm_raw);
+    all_paths.assign(buffer.begin(), buffer.begin() + offsets[n_ranks]);
+  }
+
+  std::vector<std::string> paths;
+  std::map<std::string, int> path_index;
+  {
+    std::istringstream is(all_paths);
+    std::string path;
+    while (std::getline(is, path)) {
+      if (!path.empty() && !path_index.count(path)) {
+        path_index[path] = paths.size();
+        paths.push_back(path);
+      }
+    }
+  }
+
+  // reduce
+  int n_paths = paths.size();
+  std::vector<double> times(n_paths, 0.), calls(n_paths, 0.);
+  for (int i = 0; i != n_paths; ++i) {
+    auto entry = local.find(paths[i]);
+    if (entry != local.end()) {
+      times[i] = entry->second.first;
+      calls[i] = entry->second.second;
+    }
+  }
+
+  std::vector<double> times_min(times), times_max(times), times_sum(times), calls_sum(calls);
+  if (mpi_comm != nullptr && n_paths > 0) {
+    const MPI_Comm& mpi_comm_raw = mpi_comm->Comm();
+    MPI_Allreduce(&times[0], &times_min[0], n_paths, MPI_DOUBLE, MPI_MIN, mpi_comm_raw);
+    MPI_Allreduce(&times[0], &times_max[0], n_paths, MPI_DOUBLE, MPI_MAX, mpi_comm_raw);
+    MPI_Allreduce(&times[0], &times_sum[0], n_paths, MPI_DOUBLE, MPI_SUM, mpi_comm_raw);
+    MPI_Allreduce(&calls[0], &calls_sum[0], n_paths, MPI_DOUBLE, MPI_SUM, mpi_comm_raw);
+  }
+  if (rank != 0) return;
+
+  // form the tree of entries; entry n_paths is the root
+  std::vector<ReportEntry> entries(n_paths + 1);
+  for (int i = 0; i != n_paths; ++i) {
+    auto& e = entries[i];
+    std::istringstream is(paths[i]);
+    std::string label;
+    while (std::getline(is, label, '\t')) e.labels.push_back(label);
+    e.calls = calls_sum[i] / n_ranks;
+    e.time_min = times_min[i];
+    e.time_mean = times_sum[i] / n_ranks;
+    e.time_max = times_max[i];
+
+    auto parent = paths[i].rfind('\t');
+    int p = parent == std::string::npos ? n_paths : path_index.at(paths[i].substr(0, parent));
+    entries[p].children.push_back(i);
+  }
+
+  std::ofstream os(filename);
+  if (!os.good()) {
+    Errors::Message msg;
+    msg << "PKProfiler: cannot open profile file \"" << filename << "\" for writing.";
+    Exceptions::amanzi_throw(msg);
+  }
+  os << std::setprecision(6);
+
+  bool csv = filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".csv") == 0;
+  if (csv) {
+    os << "path,depth,calls,min time [s],mean time [s],max time [s]" << std::endl;
+
+    // depth-first, so that children follow their parent
+    std::vector<int> stack(entries[n_paths].children.rbegin(), entries[n_paths].children.rend());
+    while (!stack.empty()) {
+      int i = stack.back();
+      stack.pop_back();
+      const auto& e = entries[i];
+
+      std::string path;
+      for (const auto& label : e.labels) {
+        if (!path.empty()) path += " / ";
+        for (char c : label) {
+          if (c == '"') path.push_back('"');
+          path.push_back(c);
+        }
+      }
+      os << "\"" << path << "\"," << e.labels.size() << "," << e.calls << "," << e.time_min << ","
+         << e.time_mean << "," << e.time_max << std::endl;
+      stack.insert(stack.end(), e.children.rbegin(), e.children.rend());
+    }
+  } else {
+    os << "{" << std::endl
+       << "  \"ranks\": " << n_ranks << "," << std::endl
+       << "  \"timers\": [" << std::endl;
+    const auto& top = entries[n_paths].children;
+    for (int i = 0; i != top.size(); ++i) {
+      writeJSON(os, entries, top[i], 2);
+      if (i + 1 != top.size()) os << "    ," << std::endl;
+    }
+    os << "  ]" << std::endl << "}" << std::endl;
+  }
+}
+
+} // namespace Amanzi
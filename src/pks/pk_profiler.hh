@@ -0,0 +1,97 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Hierarchical wallclock timers for PK methods.
+/*!
+
+PKProfiler accumulates wallclock time and call counts in a tree of named
+scopes.  Each scope is labeled by the name of the PK (or evaluator key) and
+the method being timed, e.g. `"flow::FunctionalResidual"`, and is nested
+inside whichever scope was open on the calling thread when it was entered.
+A scope with the same label as its parent is merged into the parent, so a
+method that is timed both by its caller (e.g. an MPC timing its sub-PKs) and
+by itself is only counted once.
+
+PK methods time themselves, including their linear solves as
+`"PK::LinearSolve`".  Evaluator updates requested by PKs go through
+updateEvaluator() and updateEvaluatorDerivative() (see pk_helpers.hh), which
+time them as `"KEY::Update`" and `"KEY::UpdateDerivative`"; the time of an
+evaluator's dependencies is included in that of the evaluator that requested
+them.
+
+Timing is disabled by default, and a disabled scope costs only a branch.  It
+is enabled by the `"profile filename`" option of the coordinator, and the
+report is written in `finalize()`: as CSV if the filename ends in `".csv`",
+otherwise as JSON.  For each scope, the report gives the mean number of calls
+and the min, mean, and max time over ranks; a rank that never entered a
+scope counts as zero time.
+
+Scopes entered on worker threads nest under the scope passed to Attach, and
+their times are summed over threads, so children of a threaded region may sum
+to more than the region's wallclock time.
+
+*/
+
+#ifndef ATS_PK_PROFILER_HH_
+#define ATS_PK_PROFILER_HH_
+
+#include <chrono>
+#include <string>
+
+#include "AmanziComm.hh"
+
+namespace Amanzi {
+
+class PKProfiler {
+ public:
+  static void setEnabled(bool enabled) { enabled_ = enabled; }
+  static bool enabled() { return enabled_; }
+
+  // Times the enclosing block.
+  class Scope {
+   public:
+    Scope(const std::string& name, const char* method);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    int node_;
+    int parent_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  // Nests scopes entered on this thread under a given scope, typically the
+  // current() scope of the thread that launched this one.
+  class Attach {
+   public:
+    explicit Attach(int node);
+    ~Attach();
+
+    Attach(const Attach&) = delete;
+    Attach& operator=(const Attach&) = delete;
+
+   private:
+    int parent_;
+  };
+
+  // The innermost open scope on this thread.
+  static int current();
+
+  // Reduces the timers over all ranks and writes the report from rank 0.
+  static void Write(const Comm_type& comm, const std::string& filename);
+
+ private:
+  static bool enabled_;
+};
+
+} // namespace Amanzi
+
+#endif
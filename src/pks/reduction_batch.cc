@@ -0,0 +1,167 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Combines many scalar global reductions into a single collective.
+#include <algorithm>
+#include <mutex>
+
+#include "errors.hh"
+#include "reduction_batch.hh"
+
+namespace Amanzi {
+
+namespace {
+
+// MPI op combining (kind, value, location) triples elementwise.
+void
+combineEntries(void* in, void* inout, int* len, MPI_Datatype* dtype)
+{
+  const double* a = static_cast<const double*>(in);
+  double* b = static_cast<double*>(inout);
+  for (int i = 0; i != *len; ++i, a += 3, b += 3) {
+    switch ((int)a[0]) {
+    case 0: // MIN
+      b[1] = std::min(a[1], b[1]);
+      break;
+    case 1: // MAX
+      b[1] = std::max(a[1], b[1]);
+      break;
+    case 2: // SUM
+      b[1] += a[1];
+      break;
+    case 3: // MINLOC, ties go to the lowest location as in MPI_MINLOC
+      if (a[1] < b[1] || (a[1] == b[1] && a[2] < b[2])) {
+        b[1] = a[1];
+        b[2] = a[2];
+      }
+      break;
+    default: // MAXLOC, ties go to the lowest location as in MPI_MAXLOC
+      if (a[1] > b[1] || (a[1] == b[1] && a[2] < b[2])) {
+        b[1] = a[1];
+        b[2] = a[2];
+      }
+    }
+  }
+}
+
+
+// The MPI datatype and op of entries, created once by whichever thread first
+// flushes a batch, and freed at the start of MPI_Finalize(), which deletes
+// the attributes of MPI_COMM_SELF before anything else.
+struct EntryTypes {
+  MPI_Datatype type = MPI_DATATYPE_NULL;
+  MPI_Op op = MPI_OP_NULL;
+};
+
+EntryTypes entry_types;
+std::once_flag entry_types_flag;
+
+int
+freeEntryTypes(MPI_Comm comm, int keyval, void* attr, void* extra)
+{
+  MPI_Op_free(&entry_types.op);
+  MPI_Type_free(&entry_types.type);
+  return MPI_SUCCESS;
+}
+
+const EntryTypes&
+entryTypes()
+{
+  std::call_once(entry_types_flag, []() {
+    MPI_Type_contiguous(3, MPI_DOUBLE, &entry_types.type);
+    MPI_Type_commit(&entry_types.type);
+    MPI_Op_create(&combineEntries, 1, &entry_types.op);
+
+    int keyval;
+    MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, &freeEntryTypes, &keyval, nullptr);
+    MPI_Comm_set_attr(MPI_COMM_SELF, keyval, nullptr);
+    MPI_Comm_free_keyval(&keyval);
+  });
+  return entry_types;
+}
+
+} // namespace
+
+
+ReductionBatch::ReductionBatch(const Comm_type& comm)
+  : comm_(comm), flushed_(false)
+{}
+
+
+int
+ReductionBatch::Add_(Kind kind, double value, double loc)
+{
+  if (flushed_) {
+    Errors::Message msg("ReductionBatch: cannot register a reduction after Flush().");
+    Exceptions::amanzi_throw(msg);
+  }
+  entries_.push_back((double)kind);
+  entries_.push_back(value);
+  entries_.push_back(loc);
+  return size() - 1;
+}
+
+
+void
+ReductionBatch::Flush()
+{
+  if (flushed_) return;
+  reduced_ = entries_;
+
+  auto mpi_comm = dynamic_cast<const MpiComm_type*>(&comm_);
+  if (mpi_comm && size() > 0) {
+    const auto& types = entryTypes();
+    int ierr = MPI_Allreduce(
+      entries_.data(), reduced_.data(), size(), types.type, types.op, mpi_comm->Comm());
+    AMANZI_ASSERT(!ierr);
+  }
+  flushed_ = true;
+
+  for (const auto& func : callbacks_) func(*this);
+}
+
+
+double
+ReductionBatch::get(int handle) const
+{
+  AMANZI_ASSERT(flushed_ && handle >= 0 && handle < size());
+  return reduced_[3 * handle + 1];
+}
+
+
+int
+ReductionBatch::getLoc(int handle) const
+{
+  AMANZI_ASSERT(flushed_ && handle >= 0 && handle < size());
+  return (int)reduced_[3 * handle + 2];
+}
+
+
+double
+ReductionBatch::getLocal(int handle) const
+{
+  AMANZI_ASSERT(handle >= 0 && handle < size());
+  return entries_[3 * handle + 1];
+}
+
+
+bool
+ReductionBatch::isCompatible(const Comm_type& comm) const
+{
+  if (&comm == &comm_) return true;
+  auto mpi_comm = dynamic_cast<const MpiComm_type*>(&comm_);
+  auto other = dynamic_cast<const MpiComm_type*>(&comm);
+  if (!mpi_comm || !other) return comm.NumProc() == 1 && comm_.NumProc() == 1;
+
+  int result;
+  MPI_Comm_compare(mpi_comm->Comm(), other->Comm(), &result);
+  return result == MPI_IDENT || result == MPI_CONGRUENT;
+}
+
+} // namespace Amanzi
@@ -0,0 +1,89 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Combines many scalar global reductions into a single collective.
+/*!
+
+On many ranks, each `MinAll`, `SumAll`, or `MPI_Allreduce` is latency bound,
+and a step through an MPC tree may do many of them, one per sub-PK for each
+of the error norm, timestep size, and so on.  A ReductionBatch collects
+pending scalar reductions -- min, max, sum, or min or max with location --
+from any number of callers, and Flush() reduces all of them in one
+`MPI_Allreduce`.
+
+Each registration returns a handle; the global value is available from get()
+(and, for MinLoc and MaxLoc, the location from getLoc()) only after Flush().
+A coupler may combine the pending local values of its children, from
+getLocal(), into one entry of its own.  Callbacks registered with OnFlush()
+are called, in order, after the reduction, e.g. to write reports that need
+the global values.
+
+All ranks of the communicator must register the same reductions in the same
+order.  A caller whose own communicator differs from the batch's, e.g. a PK
+on a subdomain, must reduce on its own and register the global result,
+which is unchanged by a further max or min; see isCompatible().
+
+*/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "AmanziComm.hh"
+
+namespace Amanzi {
+
+class ReductionBatch {
+ public:
+  explicit ReductionBatch(const Comm_type& comm);
+
+  // Register a local value, returning a handle to its global reduction.
+  int Min(double value) { return Add_(MIN, value, 0.); }
+  int Max(double value) { return Add_(MAX, value, 0.); }
+  int Sum(double value) { return Add_(SUM, value, 0.); }
+  int MinLoc(double value, int loc) { return Add_(MINLOC, value, loc); }
+  int MaxLoc(double value, int loc) { return Add_(MAXLOC, value, loc); }
+
+  // Called after the reduction, in the order registered.
+  void OnFlush(const std::function<void(const ReductionBatch&)>& func)
+  {
+    callbacks_.emplace_back(func);
+  }
+
+  // Reduces all pending values in one collective and runs the callbacks.
+  void Flush();
+
+  double get(int handle) const;
+  int getLoc(int handle) const;
+
+  // The local value registered with handle, before or after Flush().
+  double getLocal(int handle) const;
+
+  int size() const { return entries_.size() / 3; }
+  bool flushed() const { return flushed_; }
+
+  // Does a reduction over comm mean the same thing as one over this batch?
+  bool isCompatible(const Comm_type& comm) const;
+
+ private:
+  enum Kind { MIN = 0, MAX, SUM, MINLOC, MAXLOC };
+
+  // Entries are (kind, value, location) triples of doubles, so that all
+  // kinds share one MPI datatype and op.
+  int Add_(Kind kind, double value, double loc);
+
+  const Comm_type& comm_;
+  std::vector<double> entries_;
+  std::vector<double> reduced_;
+  std::vector<std::function<void(const ReductionBatch&)>> callbacks_;
+  bool flushed_;
+};
+
+} // namespace Amanzi
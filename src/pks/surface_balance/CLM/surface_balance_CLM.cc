@@ -297,17 +297,17 @@ SurfaceBalanceCLM::InitializeCLM_(const Tag& tag)
   }
 
   // soil properties
-  S_->GetEvaluator(sand_frac_key_, tag).Update(*S_, name_);
+  updateEvaluator(sand_frac_key_, tag, *S_, name_);
   auto& sand = *S_->Get<CompositeVector>(sand_frac_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(silt_frac_key_, tag).Update(*S_, name_);
+  updateEvaluator(silt_frac_key_, tag, *S_, name_);
   auto& silt = *S_->Get<CompositeVector>(silt_frac_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(clay_frac_key_, tag).Update(*S_, name_);
+  updateEvaluator(clay_frac_key_, tag, *S_, name_);
   auto& clay = *S_->Get<CompositeVector>(clay_frac_key_, tag).ViewComponent("cell", false);
 
-  S_->GetEvaluator(color_index_key_, tag).Update(*S_, name_);
+  updateEvaluator(color_index_key_, tag, *S_, name_);
   auto& color_index_tmp =
     *S_->Get<CompositeVector>(color_index_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(pft_index_key_, tag).Update(*S_, name_);
+  updateEvaluator(pft_index_key_, tag, *S_, name_);
   auto& pft_index_tmp = *S_->Get<CompositeVector>(pft_index_key_, tag).ViewComponent("cell", false);
 
   std::vector<int> color_index(ncols);
@@ -384,13 +384,13 @@ SurfaceBalanceCLM::AdvanceStep(double t_old, double t_new, bool reinit)
   Tag tag = tag_current_;
 
   // Set the state
-  S_->GetEvaluator(pres_key_, tag).Update(*S_, name_);
+  updateEvaluator(pres_key_, tag, *S_, name_);
   const Epetra_MultiVector& pres =
     *S_->Get<CompositeVector>(pres_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(poro_key_, tag).Update(*S_, name_);
+  updateEvaluator(poro_key_, tag, *S_, name_);
   const Epetra_MultiVector& poro =
     *S_->Get<CompositeVector>(poro_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(sl_key_, tag).Update(*S_, name_);
+  updateEvaluator(sl_key_, tag, *S_, name_);
   const Epetra_MultiVector& sl =
     *S_->Get<CompositeVector>(sl_key_, tag).ViewComponent("cell", false);
 
@@ -401,25 +401,25 @@ SurfaceBalanceCLM::AdvanceStep(double t_old, double t_new, bool reinit)
   ATS::CLM::set_pressure(pres, patm);
 
   // set the forcing
-  S_->GetEvaluator(met_sw_key_, tag).Update(*S_, name_);
+  updateEvaluator(met_sw_key_, tag, *S_, name_);
   const Epetra_MultiVector& met_sw =
     *S_->Get<CompositeVector>(met_sw_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(met_lw_key_, tag).Update(*S_, name_);
+  updateEvaluator(met_lw_key_, tag, *S_, name_);
   const Epetra_MultiVector& met_lw =
     *S_->Get<CompositeVector>(met_lw_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(met_air_temp_key_, tag).Update(*S_, name_);
+  updateEvaluator(met_air_temp_key_, tag, *S_, name_);
   const Epetra_MultiVector& met_air_temp =
     *S_->Get<CompositeVector>(met_air_temp_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(met_vp_air_key_, tag).Update(*S_, name_);
+  updateEvaluator(met_vp_air_key_, tag, *S_, name_);
   const Epetra_MultiVector& met_vp_air =
     *S_->Get<CompositeVector>(met_vp_air_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(met_wind_speed_key_, tag).Update(*S_, name_);
+  updateEvaluator(met_wind_speed_key_, tag, *S_, name_);
   const Epetra_MultiVector& met_wind_speed =
     *S_->Get<CompositeVector>(met_wind_speed_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(met_prain_key_, tag).Update(*S_, name_);
+  updateEvaluator(met_prain_key_, tag, *S_, name_);
   const Epetra_MultiVector& met_prain =
     *S_->Get<CompositeVector>(met_prain_key_, tag).ViewComponent("cell", false);
-  S_->GetEvaluator(met_psnow_key_, tag).Update(*S_, name_);
+  updateEvaluator(met_psnow_key_, tag, *S_, name_);
   const Epetra_MultiVector& met_psnow =
     *S_->Get<CompositeVector>(met_psnow_key_, tag).ViewComponent("cell", false);
 
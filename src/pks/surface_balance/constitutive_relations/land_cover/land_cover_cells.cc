@@ -0,0 +1,60 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Cached cell lists of land cover regions, for column-wise surface models.
+#include "errors.hh"
+#include "land_cover_cells.hh"
+
+namespace Amanzi {
+namespace SurfaceBalance {
+
+void
+LandCoverCells::UpdateAreaToVolume(const AmanziMesh::Mesh& mesh, const AmanziMesh::Mesh& mesh_ss)
+{
+  area_to_volume.resize(cells.size());
+  for (int i = 0; i != cells.size(); ++i) {
+    area_to_volume[i] = mesh.cell_volume(cells[i]) / mesh_ss.cell_volume(top_cells[i]);
+  }
+}
+
+
+std::vector<LandCoverCells>
+getLandCoverCells(const LandCoverMap& land_cover,
+                  const AmanziMesh::Mesh& mesh,
+                  const AmanziMesh::Mesh& mesh_ss)
+{
+  std::vector<LandCoverCells> lc_cells;
+  lc_cells.reserve(land_cover.size());
+  for (const auto& lc : land_cover) {
+    AmanziMesh::Entity_ID_List lc_ids;
+    mesh.get_set_entities(
+      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED, &lc_ids);
+
+    LandCoverCells entry;
+    entry.cells.assign(lc_ids.begin(), lc_ids.end());
+    entry.top_cells.resize(lc_ids.size());
+    for (int i = 0; i != lc_ids.size(); ++i) {
+      AmanziMesh::Entity_ID subsurf_f = mesh.entity_get_parent(AmanziMesh::CELL, lc_ids[i]);
+      AmanziMesh::Entity_ID_List cells;
+      mesh_ss.face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
+      if (cells.size() != 1) {
+        Errors::Message msg;
+        msg << "Land cover \"" << lc.first << "\": surface cell " << lc_ids[i]
+            << " does not have exactly one owned subsurface cell below it.";
+        Exceptions::amanzi_throw(msg);
+      }
+      entry.top_cells[i] = cells[0];
+    }
+    lc_cells.emplace_back(std::move(entry));
+  }
+  return lc_cells;
+}
+
+} // namespace SurfaceBalance
+} // namespace Amanzi
@@ -0,0 +1,50 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Cached cell lists of land cover regions, for column-wise surface models.
+/*!
+
+Surface balance evaluators loop over the owned surface cells of each land
+cover region, and need the subsurface cell directly below each surface cell.
+Neither the regions nor the mesh topology change through a run, so these are
+found once and stored as flat, parallel arrays, one entry per land cover in
+the iteration order of the LandCoverMap.
+
+The ratio of surface cell area to top cell volume does change if the mesh
+deforms, so it is stored alongside but must be refreshed by
+UpdateAreaToVolume() before use.
+
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Mesh.hh"
+#include "LandCover.hh"
+
+namespace Amanzi {
+namespace SurfaceBalance {
+
+struct LandCoverCells {
+  std::vector<AmanziMesh::Entity_ID> cells;     // owned surface cells
+  std::vector<AmanziMesh::Entity_ID> top_cells; // subsurface cell below each
+  std::vector<double> area_to_volume;           // surface cell area / top cell volume
+
+  void UpdateAreaToVolume(const AmanziMesh::Mesh& mesh, const AmanziMesh::Mesh& mesh_ss);
+};
+
+
+std::vector<LandCoverCells>
+getLandCoverCells(const LandCoverMap& land_cover,
+                  const AmanziMesh::Mesh& mesh,
+                  const AmanziMesh::Mesh& mesh_ss);
+
+} // namespace SurfaceBalance
+} // namespace Amanzi
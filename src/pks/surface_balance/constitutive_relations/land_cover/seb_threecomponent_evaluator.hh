@@ -28,6 +28,11 @@ gravity- and wind-driven redistributions, respectively.
    * `"minimum wind speed [m s^-1]`" ``[double]`` **1.0** Sets a floor on wind speed for
      potential wierd data.  Models have trouble with no wind.
 
+   * `"column threads`" ``[int]`` **1** Number of threads used to evaluate the
+     balance on each rank.  The cells of each land cover are split into
+     contiguous blocks, one per thread.  Verbose per-cell output at the
+     "extreme" level forces a single thread.
+
    * `"save diagnostic data`" ``[bool]`` **false** Saves a suite of diagnostic variables to vis.
 
    * `"surface domain name`" ``[string]`` **DEFAULT** Default set by parameterlist name.
@@ -102,6 +107,7 @@ gravity- and wind-driven redistributions, respectively.
 #include "Debugger.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 #include "LandCover.hh"
+#include "land_cover_cells.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -162,6 +168,8 @@ class SEBThreeComponentEvaluator : public EvaluatorSecondaryMonotypeCV {
   double wind_speed_ref_ht_; // reference height of the met data
 
   LandCoverMap land_cover_;
+  std::vector<LandCoverCells> lc_cells_;
+  int n_threads_;
 
   bool compatible_;
   bool diagnostics_;
@@ -25,6 +25,7 @@ respectively.
 #include "seb_twocomponent_evaluator.hh"
 #include "seb_physics_defs.hh"
 #include "seb_physics_funcs.hh"
+#include "thread_pool.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -166,6 +167,13 @@ SEBTwoComponentEvaluator::SEBTwoComponentEvaluator(Teuchos::ParameterList& plist
   min_wind_speed_ = plist.get<double>("minimum wind speed [m s^-1]", 1.0);
   wind_speed_ref_ht_ = plist.get<double>("wind speed reference height [m]", 2.0);
   AMANZI_ASSERT(wind_speed_ref_ht_ > 0.);
+
+  n_threads_ = plist.get<int>("column threads", 1);
+  if (n_threads_ < 1) {
+    Errors::Message msg;
+    msg << "SEBTwoComponentEvaluator: \"column threads\" must be a positive integer.";
+    Exceptions::amanzi_throw(msg);
+  }
 }
 
 void
@@ -255,190 +263,198 @@ SEBTwoComponentEvaluator::Evaluate_(const State& S, const std::vector<CompositeV
     qE_cond->PutScalar(0.);
   }
 
-  for (const auto& lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    mesh.get_set_entities(
-      lc.first, AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED, &lc_ids);
-
-    for (auto c : lc_ids) {
-      // get the top cell
-      AmanziMesh::Entity_ID subsurf_f = mesh.entity_get_parent(AmanziMesh::CELL, c);
-      AmanziMesh::Entity_ID_List cells;
-      mesh_ss.face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      // met data structure
-      Relations::MetData met;
-      met.Z_Us = wind_speed_ref_ht_;
-      met.Us = std::max(wind_speed[0][c], min_wind_speed_);
-      met.QswIn = qSW_in[0][c];
-      met.QlwIn = qLW_in[0][c];
-      met.air_temp = air_temp[0][c];
-      met.vp_air = vp_air[0][c];
-      met.Pr = Prain[0][c];
-
-      // non-snow covered column
-      if (area_fracs[0][c] > 0) {
-        Relations::GroundProperties surf;
-        surf.temp = surf_temp[0][c];
-        surf.water_transition_depth = lc.second.water_transition_depth;
-        if (ponded_depth[0][c] > lc.second.water_transition_depth) {
-          surf.pressure = surf_pres[0][c];
-          surf.porosity = 1.;
-          surf.saturation_gas = 0.;
-          surf.saturation_liq = sat_liq[0][cells[0]];
-        } else {
-          double factor = std::max(ponded_depth[0][c], 0.) / lc.second.water_transition_depth;
-          surf.pressure = factor * surf_pres[0][c] + (1 - factor) * ss_pres[0][cells[0]];
-          surf.porosity = factor + (1 - factor) * poro[0][cells[0]];
-          surf.saturation_gas = (1 - factor) * sat_gas[0][cells[0]];
-          surf.saturation_liq = factor + (1 - factor) * sat_liq[0][cells[0]];
-        }
-        if (model_1p1_) surf.pressure = surf_pres[0][c];
-        surf.ponded_depth = ponded_depth[0][c];
-        surf.unfrozen_fraction = unfrozen_fraction[0][c];
-        surf.roughness = lc.second.roughness_ground;
-        if (model_1p1_)
-          surf.density_w = 1000.;
-        else
-          surf.density_w = mass_dens[0][c];
-        surf.dz = lc.second.dessicated_zone_thickness;
-        surf.clapp_horn_b = lc.second.clapp_horn_b;
-        surf.rs_method = lc.second.rs_method;
-        surf.albedo = sg_albedo[0][c];
-        surf.emissivity = emissivity[0][c];
-
-        // must ensure that energy is put into melting snow precip, even if it
-        // all melts so there is no snow column
-        if (area_fracs[1][c] == 0.) {
-          met.Ps = Psnow[0][c];
-          surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
-        } else {
-          met.Ps = 0.;
-          surf.snow_death_rate = 0.;
-        }
+  // the cells of each land cover, and the subsurface cell below each, are
+  // found once; the area-to-volume ratio changes if the mesh deforms
+  if (lc_cells_.empty()) lc_cells_ = getLandCoverCells(land_cover_, mesh, mesh_ss);
 
-        // calculate the surface balance
-        const Relations::EnergyBalance eb =
-          Relations::UpdateEnergyBalanceWithoutSnow(surf, met, params);
-        Relations::MassBalance mb = Relations::UpdateMassBalanceWithoutSnow(surf, params, eb);
-        Relations::FluxBalance flux =
-          Relations::UpdateFluxesWithoutSnow(surf, met, params, eb, mb, model_1p1_);
-
-        // fQe, Me positive is condensation, water flux positive to surface
-        water_source[0][c] += area_fracs[0][c] * flux.M_surf;
-        energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
-
-        double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
-        double ss_water_source_l;
-        if (model_1p1_)
-          ss_water_source_l = flux.M_subsurf * area_to_volume * surf.density_w /
-                              0.0180153; // convert from m/s to mol/m^3/s
-        else
-          ss_water_source_l =
-            flux.M_subsurf * area_to_volume * mol_dens[0][c]; // convert from m/s to mol/m^3/s
-        ss_water_source[0][cells[0]] += area_fracs[0][c] * ss_water_source_l;
-        double ss_energy_source_l =
-          flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-        ss_energy_source[0][cells[0]] += area_fracs[0][c] * ss_energy_source_l;
-
-        snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
-        new_snow[0][c] += area_fracs[0][c] * met.Ps;
-
-        if (vo_.os_OK(Teuchos::VERB_EXTREME))
-          *vo_.os() << "CELL " << c << " NO_SNOW"
-                    << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
-                    << ", Mss = " << ss_water_source_l << ", Ess = " << ss_energy_source_l
-                    << ", Sn = " << flux.M_snow << std::endl;
-
-        // diagnostics
-        if (diagnostics_) {
-          (*evap_rate)[0][c] -= area_fracs[0][c] * mb.Me;
-          (*qE_sh)[0][c] += area_fracs[0][c] * eb.fQh;
-          (*qE_lh)[0][c] += area_fracs[0][c] * eb.fQe;
-          (*qE_lw_out)[0][c] += area_fracs[0][c] * eb.fQlwOut;
-          (*qE_cond)[0][c] += area_fracs[0][c] * eb.fQc;
-          (*albedo)[0][c] += area_fracs[0][c] * surf.albedo;
+  // verbose output is per-cell and not thread-safe
+  int n_threads = vo_.os_OK(Teuchos::VERB_EXTREME) ? 1 : n_threads_;
 
+  auto lc_cells_iter = lc_cells_.begin();
+  for (const auto& lc : land_cover_) {
+    auto& lc_cells = *lc_cells_iter++;
+    lc_cells.UpdateAreaToVolume(mesh, mesh_ss);
+
+    // cells of a land cover are distinct, as are the top cells below them, so
+    // blocks write to disjoint entries
+    Utils::forEachBlock(n_threads, lc_cells.cells.size(), [&](int, int begin, int end) {
+      for (int i = begin; i != end; ++i) {
+        AmanziMesh::Entity_ID c = lc_cells.cells[i];
+        AmanziMesh::Entity_ID top_c = lc_cells.top_cells[i];
+
+        // met data structure
+        Relations::MetData met;
+        met.Z_Us = wind_speed_ref_ht_;
+        met.Us = std::max(wind_speed[0][c], min_wind_speed_);
+        met.QswIn = qSW_in[0][c];
+        met.QlwIn = qLW_in[0][c];
+        met.air_temp = air_temp[0][c];
+        met.vp_air = vp_air[0][c];
+        met.Pr = Prain[0][c];
+
+        // non-snow covered column
+        if (area_fracs[0][c] > 0) {
+          Relations::GroundProperties surf;
+          surf.temp = surf_temp[0][c];
+          surf.water_transition_depth = lc.second.water_transition_depth;
+          if (ponded_depth[0][c] > lc.second.water_transition_depth) {
+            surf.pressure = surf_pres[0][c];
+            surf.porosity = 1.;
+            surf.saturation_gas = 0.;
+            surf.saturation_liq = sat_liq[0][top_c];
+          } else {
+            double factor = std::max(ponded_depth[0][c], 0.) / lc.second.water_transition_depth;
+            surf.pressure = factor * surf_pres[0][c] + (1 - factor) * ss_pres[0][top_c];
+            surf.porosity = factor + (1 - factor) * poro[0][top_c];
+            surf.saturation_gas = (1 - factor) * sat_gas[0][top_c];
+            surf.saturation_liq = factor + (1 - factor) * sat_liq[0][top_c];
+          }
+          if (model_1p1_) surf.pressure = surf_pres[0][c];
+          surf.ponded_depth = ponded_depth[0][c];
+          surf.unfrozen_fraction = unfrozen_fraction[0][c];
+          surf.roughness = lc.second.roughness_ground;
+          if (model_1p1_)
+            surf.density_w = 1000.;
+          else
+            surf.density_w = mass_dens[0][c];
+          surf.dz = lc.second.dessicated_zone_thickness;
+          surf.clapp_horn_b = lc.second.clapp_horn_b;
+          surf.rs_method = lc.second.rs_method;
+          surf.albedo = sg_albedo[0][c];
+          surf.emissivity = emissivity[0][c];
+
+          // must ensure that energy is put into melting snow precip, even if it
+          // all melts so there is no snow column
           if (area_fracs[1][c] == 0.) {
-            (*qE_sm)[0][c] = eb.fQm;
-            (*melt_rate)[0][c] = mb.Mm;
-            (*snow_temp)[0][c] = 273.15;
+            met.Ps = Psnow[0][c];
+            surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
+          } else {
+            met.Ps = 0.;
+            surf.snow_death_rate = 0.;
+          }
+
+          // calculate the surface balance
+          const Relations::EnergyBalance eb =
+            Relations::UpdateEnergyBalanceWithoutSnow(surf, met, params);
+          Relations::MassBalance mb = Relations::UpdateMassBalanceWithoutSnow(surf, params, eb);
+          Relations::FluxBalance flux =
+            Relations::UpdateFluxesWithoutSnow(surf, met, params, eb, mb, model_1p1_);
+
+          // fQe, Me positive is condensation, water flux positive to surface
+          water_source[0][c] += area_fracs[0][c] * flux.M_surf;
+          energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
+
+          double area_to_volume = lc_cells.area_to_volume[i];
+          double ss_water_source_l;
+          if (model_1p1_)
+            ss_water_source_l = flux.M_subsurf * area_to_volume * surf.density_w /
+                                0.0180153; // convert from m/s to mol/m^3/s
+          else
+            ss_water_source_l =
+              flux.M_subsurf * area_to_volume * mol_dens[0][c]; // convert from m/s to mol/m^3/s
+          ss_water_source[0][top_c] += area_fracs[0][c] * ss_water_source_l;
+          double ss_energy_source_l =
+            flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
+          ss_energy_source[0][top_c] += area_fracs[0][c] * ss_energy_source_l;
+
+          snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
+          new_snow[0][c] += area_fracs[0][c] * met.Ps;
+
+          if (vo_.os_OK(Teuchos::VERB_EXTREME))
+            *vo_.os() << "CELL " << c << " NO_SNOW"
+                      << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
+                      << ", Mss = " << ss_water_source_l << ", Ess = " << ss_energy_source_l
+                      << ", Sn = " << flux.M_snow << std::endl;
+
+          // diagnostics
+          if (diagnostics_) {
+            (*evap_rate)[0][c] -= area_fracs[0][c] * mb.Me;
+            (*qE_sh)[0][c] += area_fracs[0][c] * eb.fQh;
+            (*qE_lh)[0][c] += area_fracs[0][c] * eb.fQe;
+            (*qE_lw_out)[0][c] += area_fracs[0][c] * eb.fQlwOut;
+            (*qE_cond)[0][c] += area_fracs[0][c] * eb.fQc;
+            (*albedo)[0][c] += area_fracs[0][c] * surf.albedo;
+
+            if (area_fracs[1][c] == 0.) {
+              (*qE_sm)[0][c] = eb.fQm;
+              (*melt_rate)[0][c] = mb.Mm;
+              (*snow_temp)[0][c] = 273.15;
+            }
           }
         }
-      }
 
-      // snow column
-      if (area_fracs[1][c] > 0.) {
-        Relations::GroundProperties surf;
-        surf.temp = surf_temp[0][c];
-        surf.pressure = surf_pres[0][c];
-        surf.ponded_depth = ponded_depth[0][c];
-        surf.porosity = 1.;
-        surf.saturation_gas = 0.;
-        surf.saturation_liq = sat_liq[0][cells[0]];
-        surf.unfrozen_fraction = unfrozen_fraction[0][c];
-        surf.roughness = lc.second.roughness_ground;
-        if (model_1p1_)
-          surf.density_w = 1000;
-        else
-          surf.density_w = mass_dens[0][c];
-        surf.dz = lc.second.dessicated_zone_thickness;
-        surf.clapp_horn_b = lc.second.clapp_horn_b;
-        surf.rs_method = lc.second.rs_method;
-        surf.albedo = sg_albedo[1][c];
-        surf.emissivity = emissivity[1][c];
-        surf.water_transition_depth = lc.second.water_transition_depth;
-
-        met.Ps = Psnow[0][c] / area_fracs[1][c];
-
-        Relations::SnowProperties snow;
-        snow.height = snow_depth[0][c] / area_fracs[1][c]; // all snow on this patch
-        AMANZI_ASSERT(snow.height >= lc.second.snow_transition_depth - 1.e-6);
-        // area_fracs may have been set to 1 for snow depth < snow_ground_trans
-        // due to min fractional area option in area_fractions evaluator.
-        // Decreasing the tol by 1e-6 is about equivalent to a min fractional
-        // area of 1e-5 (the default)
-        snow.density = snow_dens[0][c];
-        snow.albedo = surf.albedo;
-        snow.emissivity = surf.emissivity;
-        snow.roughness = lc.second.roughness_snow;
-
-        const Relations::EnergyBalance eb =
-          Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
-        const Relations::MassBalance mb = Relations::UpdateMassBalanceWithSnow(surf, params, eb);
-        Relations::FluxBalance flux =
-          Relations::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
-
-        // fQe, Me positive is condensation, water flux positive to surface.  No
-        // need for subsurf as there is snow present.
-        water_source[0][c] += area_fracs[1][c] * flux.M_surf;
-        energy_source[0][c] +=
-          area_fracs[1][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
-        snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
-        new_snow[0][c] += std::max(met.Ps + mb.Me, 0.) * area_fracs[1][c];
-
-        if (vo_.os_OK(Teuchos::VERB_EXTREME))
-          *vo_.os() << "CELL " << c << " SNOW"
-                    << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
-                    << ", Mss = " << 0. << ", Ess = " << 0. << ", Sn = " << flux.M_snow
-                    << std::endl;
-
-        // diagnostics
-        if (diagnostics_) {
-          (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
-          (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
-          (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
-          (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
-          (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
-
-          (*qE_sm)[0][c] = area_fracs[1][c] * eb.fQm;
-          (*melt_rate)[0][c] = area_fracs[1][c] * mb.Mm;
-          (*snow_temp)[0][c] = snow.temp;
-          (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
+        // snow column
+        if (area_fracs[1][c] > 0.) {
+          Relations::GroundProperties surf;
+          surf.temp = surf_temp[0][c];
+          surf.pressure = surf_pres[0][c];
+          surf.ponded_depth = ponded_depth[0][c];
+          surf.porosity = 1.;
+          surf.saturation_gas = 0.;
+          surf.saturation_liq = sat_liq[0][top_c];
+          surf.unfrozen_fraction = unfrozen_fraction[0][c];
+          surf.roughness = lc.second.roughness_ground;
+          if (model_1p1_)
+            surf.density_w = 1000;
+          else
+            surf.density_w = mass_dens[0][c];
+          surf.dz = lc.second.dessicated_zone_thickness;
+          surf.clapp_horn_b = lc.second.clapp_horn_b;
+          surf.rs_method = lc.second.rs_method;
+          surf.albedo = sg_albedo[1][c];
+          surf.emissivity = emissivity[1][c];
+          surf.water_transition_depth = lc.second.water_transition_depth;
+
+          met.Ps = Psnow[0][c] / area_fracs[1][c];
+
+          Relations::SnowProperties snow;
+          snow.height = snow_depth[0][c] / area_fracs[1][c]; // all snow on this patch
+          AMANZI_ASSERT(snow.height >= lc.second.snow_transition_depth - 1.e-6);
+          // area_fracs may have been set to 1 for snow depth < snow_ground_trans
+          // due to min fractional area option in area_fractions evaluator.
+          // Decreasing the tol by 1e-6 is about equivalent to a min fractional
+          // area of 1e-5 (the default)
+          snow.density = snow_dens[0][c];
+          snow.albedo = surf.albedo;
+          snow.emissivity = surf.emissivity;
+          snow.roughness = lc.second.roughness_snow;
+
+          const Relations::EnergyBalance eb =
+            Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
+          const Relations::MassBalance mb = Relations::UpdateMassBalanceWithSnow(surf, params, eb);
+          Relations::FluxBalance flux =
+            Relations::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
+
+          // fQe, Me positive is condensation, water flux positive to surface.  No
+          // need for subsurf as there is snow present.
+          water_source[0][c] += area_fracs[1][c] * flux.M_surf;
+          energy_source[0][c] +=
+            area_fracs[1][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
+          snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
+          new_snow[0][c] += std::max(met.Ps + mb.Me, 0.) * area_fracs[1][c];
+
+          if (vo_.os_OK(Teuchos::VERB_EXTREME))
+            *vo_.os() << "CELL " << c << " SNOW"
+                      << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
+                      << ", Mss = " << 0. << ", Ess = " << 0. << ", Sn = " << flux.M_snow
+                      << std::endl;
+
+          // diagnostics
+          if (diagnostics_) {
+            (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
+            (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
+            (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
+            (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
+            (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
+
+            (*qE_sm)[0][c] = area_fracs[1][c] * eb.fQm;
+            (*melt_rate)[0][c] = area_fracs[1][c] * mb.Mm;
+            (*snow_temp)[0][c] = snow.temp;
+            (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
+          }
         }
       }
-    }
+    });
   }
 
   // debugging
@@ -24,6 +24,11 @@ the ground from the atmosphere.
    * `"minimum wind speed [m s^-1]`" ``[double]`` **1.0** Sets a floor on wind speed for
      potential wierd data.  Models have trouble with no wind.
 
+   * `"column threads`" ``[int]`` **1** Number of threads used to evaluate the
+     balance on each rank.  The cells of each land cover are split into
+     contiguous blocks, one per thread.  Verbose per-cell output at the
+     "extreme" level forces a single thread.
+
    * `"save diagnostic data`" ``[bool]`` **false** Saves a suite of diagnostic variables to vis.
 
    * `"surface domain name`" ``[string]`` **DEFAULT** Default set by parameterlist name.
@@ -104,6 +109,7 @@ the ground from the atmosphere.
 #include "Debugger.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 #include "LandCover.hh"
+#include "land_cover_cells.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -165,6 +171,8 @@ class SEBTwoComponentEvaluator : public EvaluatorSecondaryMonotypeCV {
   double wind_speed_ref_ht_; // reference height of the met data
 
   LandCoverMap land_cover_;
+  std::vector<LandCoverCells> lc_cells_;
+  int n_threads_;
 
   bool diagnostics_;
   Teuchos::RCP<Debugger> db_;
@@ -0,0 +1,147 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "seb_physics_defs.hh"
+#include "seb_physics_funcs.hh"
+#include "thread_pool.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::SurfaceBalance;
+
+namespace {
+
+// Synthetic surface cells, each above its own subsurface cell, partially
+// covered in snow as in the two-component SEB evaluator.
+struct Cells {
+  explicit Cells(int n)
+    : n(n),
+      top_cell(n),
+      snow_frac(n),
+      water_source(n, 0.),
+      energy_source(n, 0.),
+      snow_source(n, 0.),
+      ss_water_source(n, 0.),
+      ss_energy_source(n, 0.),
+      snow_temp(n, 0.)
+  {
+    // top cells in reverse order, so that blocks of surface cells write to
+    // subsurface cells outside their own range
+    for (int i = 0; i != n; ++i) {
+      top_cell[i] = n - 1 - i;
+      snow_frac[i] = (i % 3 == 0) ? 0. : 0.25 * (i % 4);
+    }
+  }
+
+  void evaluate(int begin, int end)
+  {
+    for (int i = begin; i != end; ++i) {
+      int top_c = top_cell[i];
+
+      Relations::MetData met;
+      met.Z_Us = 2.;
+      met.Us = 1. + 0.1 * (i % 7);
+      met.QswIn = 150. + 3. * (i % 11);
+      met.QlwIn = 280.;
+      met.air_temp = 268. + 0.5 * (i % 13);
+      met.vp_air = 400. + 5. * (i % 5);
+      met.Pr = 1.e-8;
+      met.Ps = 0.;
+
+      Relations::GroundProperties surf;
+      surf.temp = 270. + 0.3 * (i % 17);
+      surf.pressure = 101325. - 500. * (i % 3);
+      surf.ponded_depth = 0.;
+      surf.porosity = 0.5;
+      surf.saturation_gas = 0.4;
+      surf.saturation_liq = 0.6;
+      surf.unfrozen_fraction = surf.temp > 273.15 ? 1. : 0.;
+      surf.roughness = 0.04;
+      surf.density_w = 1000.;
+      surf.dz = 0.1;
+      surf.albedo = 0.2;
+      surf.emissivity = 0.95;
+
+      double f_ground = 1. - snow_frac[i];
+      if (f_ground > 0.) {
+        auto eb = Relations::UpdateEnergyBalanceWithoutSnow(surf, met, params);
+        auto mb = Relations::UpdateMassBalanceWithoutSnow(surf, params, eb);
+        auto flux = Relations::UpdateFluxesWithoutSnow(surf, met, params, eb, mb);
+        water_source[i] += f_ground * flux.M_surf;
+        energy_source[i] += f_ground * flux.E_surf;
+        snow_source[i] += f_ground * flux.M_snow;
+        ss_water_source[top_c] += f_ground * flux.M_subsurf;
+        ss_energy_source[top_c] += f_ground * flux.E_subsurf;
+      }
+
+      if (snow_frac[i] > 0.) {
+        met.Ps = 1.e-8 / snow_frac[i];
+        surf.pressure = 101325.;
+        surf.porosity = 1.;
+        surf.saturation_gas = 0.;
+        surf.albedo = 0.8;
+        surf.emissivity = 0.98;
+
+        Relations::SnowProperties snow;
+        snow.height = 0.2 + 0.01 * (i % 9);
+        snow.density = 200.;
+        snow.albedo = surf.albedo;
+        snow.emissivity = surf.emissivity;
+        snow.roughness = 0.005;
+
+        auto eb = Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
+        auto mb = Relations::UpdateMassBalanceWithSnow(surf, params, eb);
+        auto flux = Relations::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
+        water_source[i] += snow_frac[i] * flux.M_surf;
+        energy_source[i] += snow_frac[i] * flux.E_surf;
+        snow_source[i] += snow_frac[i] * flux.M_snow;
+        ss_water_source[top_c] += snow_frac[i] * flux.M_subsurf;
+        ss_energy_source[top_c] += snow_frac[i] * flux.E_subsurf;
+        snow_temp[i] = snow.temp;
+      }
+    }
+  }
+
+  int n;
+  Relations::ModelParams params;
+  std::vector<int> top_cell;
+  std::vector<double> snow_frac;
+  std::vector<double> water_source, energy_source, snow_source;
+  std::vector<double> ss_water_source, ss_energy_source, snow_temp;
+};
+
+} // namespace
+
+
+// cells evaluated in blocks on the thread pool match a serial sweep bit for
+// bit, including the snow temperature root solve
+TEST(SEB_THREADED_MATCHES_SERIAL)
+{
+  int n = 101;
+  Cells serial(n);
+  serial.evaluate(0, n);
+
+  for (int n_threads : { 2, 4, 7 }) {
+    Cells threaded(n);
+    Utils::forEachBlock(
+      n_threads, n, [&](int, int begin, int end) { threaded.evaluate(begin, end); });
+
+    for (int i = 0; i != n; ++i) {
+      CHECK_EQUAL(serial.water_source[i], threaded.water_source[i]);
+      CHECK_EQUAL(serial.energy_source[i], threaded.energy_source[i]);
+      CHECK_EQUAL(serial.snow_source[i], threaded.snow_source[i]);
+      CHECK_EQUAL(serial.ss_water_source[i], threaded.ss_water_source[i]);
+      CHECK_EQUAL(serial.ss_energy_source[i], threaded.ss_energy_source[i]);
+      CHECK_EQUAL(serial.snow_temp[i], threaded.snow_temp[i]);
+    }
+  }
+}
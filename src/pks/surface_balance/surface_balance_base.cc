@@ -8,6 +8,7 @@
 */
 
 #include "pk_helpers.hh"
+#include "pk_profiler.hh"
 
 #include "surface_balance_base.hh"
 
@@ -136,6 +137,7 @@ SurfaceBalanceBase::FunctionalResidual(double t_old,
                                        Teuchos::RCP<TreeVector> u_new,
                                        Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   Teuchos::OSTab tab = vo_->getOSTab();
   double dt = t_new - t_old;
 
@@ -159,7 +161,7 @@ SurfaceBalanceBase::FunctionalResidual(double t_old,
   }
 
   if (conserved_quantity_) {
-    S_->GetEvaluator(conserved_key_, tag_next_).Update(*S_, name_);
+    updateEvaluator(conserved_key_, tag_next_, *S_, name_);
     // S_->GetEvaluator(conserved_key_, tag_current_).Update(*S_, name_);
     auto& conserved1 = S_->Get<CompositeVector>(conserved_key_, tag_next_);
     auto& conserved0 = S_->Get<CompositeVector>(conserved_key_, tag_current_);
@@ -181,7 +183,7 @@ SurfaceBalanceBase::FunctionalResidual(double t_old,
   db_->WriteDivider();
   db_->WriteVector("res(acc)", g->Data().ptr());
 
-  S_->GetEvaluator(cell_vol_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(cell_vol_key_, tag_next_, *S_, name_);
   auto& cv = S_->Get<CompositeVector>(cell_vol_key_, tag_next_);
 
   if (is_source_) {
@@ -196,7 +198,7 @@ SurfaceBalanceBase::FunctionalResidual(double t_old,
     }
 
     if (theta_ > 0.0) {
-      S_->GetEvaluator(source_key_, tag_next_).Update(*S_, name_);
+      updateEvaluator(source_key_, tag_next_, *S_, name_);
       g->Data()->Multiply(-theta_, S_->Get<CompositeVector>(source_key_, tag_next_), cv, 1.);
       if (vo_->os_OK(Teuchos::VERB_HIGH)) {
         db_->WriteVector(
@@ -212,6 +214,7 @@ SurfaceBalanceBase::FunctionalResidual(double t_old,
 void
 SurfaceBalanceBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h)
 {
+  PKProfiler::Scope profile(name(), "UpdatePreconditioner");
   // update state with the solution up.
   AMANZI_ASSERT(std::abs(S_->get_time(tag_next_) - t) <= 1.e-4 * t);
   PK_Physical_Default::Solution_to_State(*up, tag_next_);
@@ -220,7 +223,7 @@ SurfaceBalanceBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
     preconditioner_->Init();
 
     // add derivative of conserved quantity wrt primary
-    S_->GetEvaluator(conserved_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+    updateEvaluatorDerivative(conserved_key_, tag_next_, *S_, name_, key_, tag_next_);
     auto dconserved_dT =
       S_->GetDerivativePtr<CompositeVector>(conserved_key_, tag_next_, key_, tag_next_);
     db_->WriteVector("d(cons)/d(prim)", dconserved_dT.ptr());
@@ -232,19 +235,19 @@ SurfaceBalanceBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
       Teuchos::RCP<const CompositeVector> dsource_dT;
       if (!source_finite_difference_) {
         // evaluate the derivative through chain rule and the DAG
-        S_->GetEvaluator(source_key_, tag_next_).UpdateDerivative(*S_, name_, key_, tag_next_);
+        updateEvaluatorDerivative(source_key_, tag_next_, *S_, name_, key_, tag_next_);
         dsource_dT = S_->GetDerivativePtr<CompositeVector>(source_key_, tag_next_, key_, tag_next_);
       } else {
         // evaluate the derivative through finite differences
         S_->GetW<CompositeVector>(key_, tag_next_, name_).Shift(eps_);
         ChangedSolution();
-        S_->GetEvaluator(source_key_, tag_next_).Update(*S_, name_);
+        updateEvaluator(source_key_, tag_next_, *S_, name_);
         auto dsource_dT_nc =
           Teuchos::rcp(new CompositeVector(S_->Get<CompositeVector>(source_key_, tag_next_)));
 
         S_->GetW<CompositeVector>(key_, tag_next_, name_).Shift(-eps_);
         ChangedSolution();
-        S_->GetEvaluator(source_key_, tag_next_).Update(*S_, name_);
+        updateEvaluator(source_key_, tag_next_, *S_, name_);
 
         dsource_dT_nc->Update(
           -1 / eps_, S_->Get<CompositeVector>(source_key_, tag_next_), 1 / eps_);
@@ -263,12 +266,16 @@ int
 SurfaceBalanceBase::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
                                         Teuchos::RCP<TreeVector> Pu)
 {
+  PKProfiler::Scope profile(name(), "ApplyPreconditioner");
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH)) *vo_->os() << "Precon application:" << std::endl;
 
   if (conserved_quantity_) {
     db_->WriteVector("seb_res", u->Data().ptr(), true);
-    preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+    {
+      PKProfiler::Scope profile_ls(name(), "LinearSolve");
+      preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
+    }
     db_->WriteVector("PC*p_res", Pu->Data().ptr(), true);
   } else {
     *Pu = *u;
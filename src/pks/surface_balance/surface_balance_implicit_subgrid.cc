@@ -21,6 +21,7 @@
 #include <algorithm>
 
 #include "pk_helpers.hh"
+#include "pk_profiler.hh"
 #include "seb_physics_defs.hh"
 #include "surface_balance_implicit_subgrid.hh"
 
@@ -168,19 +169,20 @@ ImplicitSubgrid::FunctionalResidual(double t_old,
                                     Teuchos::RCP<TreeVector> u_new,
                                     Teuchos::RCP<TreeVector> g)
 {
+  PKProfiler::Scope profile(name(), "FunctionalResidual");
   int cycle = S_->get_cycle(tag_next_);
 
   // first calculate the "snow death rate", or rate of snow SWE that must melt over this
   // timestep if the snow is to go to zero.
   auto& snow_death_rate =
     *S_->GetW<CompositeVector>(snow_death_rate_key_, tag_next_, name_).ViewComponent("cell", false);
-  S_->GetEvaluator(cell_vol_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(cell_vol_key_, tag_next_, *S_, name_);
   const auto& cell_volume =
     *S_->Get<CompositeVector>(cell_vol_key_, tag_next_).ViewComponent("cell", false);
   snow_death_rate.PutScalar(0.);
 
   //S_->GetEvaluator(conserved_key_, tag_current_).Update(*S_, name_);
-  S_->GetEvaluator(conserved_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(conserved_key_, tag_next_, *S_, name_);
   const auto& swe_old_v =
     *S_->Get<CompositeVector>(conserved_key_, tag_current_).ViewComponent("cell", false);
   const auto& swe_new_v =
@@ -209,11 +211,11 @@ ImplicitSubgrid::FunctionalResidual(double t_old,
   auto& snow_dens_new =
     *S_->GetW<CompositeVector>(snow_dens_key_, tag_next_, name_).ViewComponent("cell", false);
 
-  S_->GetEvaluator(new_snow_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(new_snow_key_, tag_next_, *S_, name_);
   const auto& new_snow =
     *S_->Get<CompositeVector>(new_snow_key_, tag_next_).ViewComponent("cell", false);
 
-  S_->GetEvaluator(source_key_, tag_next_).Update(*S_, name_);
+  updateEvaluator(source_key_, tag_next_, *S_, name_);
   const auto& source =
     *S_->Get<CompositeVector>(source_key_, tag_next_).ViewComponent("cell", false);
 
@@ -34,6 +34,9 @@
 #include "PDE_Accumulation.hh"
 #include "PK_DomainFunctionFactory.hh"
 #include "PK_Utils.hh"
+#include "pk_helpers.hh"
+#include "pk_profiler.hh"
+#include "upwind_topology.hh"
 
 #include "sediment_transport_pk.hh"
 #include "TransportDomainFunction.hh"
@@ -539,7 +542,7 @@ SedimentTransport_PK::InitializeFieldFromField_(const std::string& field0,
   if (S->HasRecordSet(field0)) {
     if (S->GetRecord(field0, tag0).owner() == passwd_) {
       if ((!S->GetRecord(field0, tag0).initialized()) || (overwrite)) {
-        if (call_evaluator) S->GetEvaluator(field1, tag1).Update(*S, passwd_);
+        if (call_evaluator) updateEvaluator(field1, tag1, *S, passwd_);
 
         const CompositeVector& f1 = *S->GetPtr<CompositeVector>(field1, tag1);
         CompositeVector& f0 = *S->GetPtrW<CompositeVector>(field0, tag0, passwd_);
@@ -712,15 +715,15 @@ SedimentTransport_PK::AdvanceStep(double t_old, double t_new, bool reinit)
   Teuchos::OSTab tab = vo_->getOSTab();
 
   if (S_->HasEvaluator(saturation_key_, tag_current_)) {
-    S_->GetEvaluator(saturation_key_, tag_next_).Update(*S_, saturation_key_);
-    S_->GetEvaluator(saturation_key_, tag_current_).Update(*S_, saturation_key_);
+    updateEvaluator(saturation_key_, tag_next_, *S_, saturation_key_);
+    updateEvaluator(saturation_key_, tag_current_, *S_, saturation_key_);
   }
   ws_ = S_->Get<CompositeVector>(saturation_key_, tag_next_).ViewComponent("cell", false);
   ws_prev_ = S_->Get<CompositeVector>(saturation_key_, tag_current_).ViewComponent("cell", false);
 
 
   if (S_->HasEvaluator(molar_density_key_, tag_next_)) {
-    S_->GetEvaluator(molar_density_key_, tag_next_).Update(*S_, molar_density_key_);
+    updateEvaluator(molar_density_key_, tag_next_, *S_, molar_density_key_);
   }
   mol_dens_ = S_->Get<CompositeVector>(molar_density_key_, tag_next_).ViewComponent("cell", false);
 
@@ -901,7 +904,7 @@ SedimentTransport_PK ::Advance_Diffusion(double t_old, double t_new)
 
     // instantiate solver
 
-    S_->GetEvaluator(horiz_mixing_key_, tag_current_).Update(*S_, horiz_mixing_key_);
+    updateEvaluator(horiz_mixing_key_, tag_current_, *S_, horiz_mixing_key_);
 
     CalculateDiffusionTensor_(*km_, *ws_, *mol_dens_);
 
@@ -929,7 +932,11 @@ SedimentTransport_PK ::Advance_Diffusion(double t_old, double t_new)
       op1->ApplyBCs(true, true, true);
 
       CompositeVector& rhs = *op->rhs();
-      int ierr = op->ApplyInverse(rhs, sol);
+      int ierr = 0;
+      {
+        PKProfiler::Scope profile_ls(name(), "LinearSolve");
+        ierr = op->ApplyInverse(rhs, sol);
+      }
 
       if (ierr < 0) {
         Errors::Message msg("SedimentTransport_PK solver failed with message: \"");
@@ -1358,19 +1365,19 @@ SedimentTransport_PK::ComputeAddSourceTerms(double tp,
   double mass1 = 0., mass2 = 0., add_mass = 0., tmp1;
   bool chg;
 
-  chg = S_->GetEvaluator(sd_trapping_key_, tag_next_).Update(*S_, sd_trapping_key_);
+  chg = updateEvaluator(sd_trapping_key_, tag_next_, *S_, sd_trapping_key_);
   const Epetra_MultiVector& Q_dt =
     *S_->GetPtr<CompositeVector>(sd_trapping_key_, tag_next_)->ViewComponent("cell", false);
 
-  chg = S_->GetEvaluator(sd_settling_key_, tag_next_).Update(*S_, sd_settling_key_);
+  chg = updateEvaluator(sd_settling_key_, tag_next_, *S_, sd_settling_key_);
   const Epetra_MultiVector& Q_ds =
     *S_->GetPtr<CompositeVector>(sd_settling_key_, tag_next_)->ViewComponent("cell", false);
 
-  chg = S_->GetEvaluator(sd_erosion_key_, tag_next_).Update(*S_, sd_erosion_key_);
+  chg = updateEvaluator(sd_erosion_key_, tag_next_, *S_, sd_erosion_key_);
   const Epetra_MultiVector& Q_e =
     *S_->GetPtr<CompositeVector>(sd_erosion_key_, tag_next_)->ViewComponent("cell", false);
 
-  chg = S_->GetEvaluator(sd_organic_key_, tag_next_).Update(*S_, sd_organic_key_);
+  chg = updateEvaluator(sd_organic_key_, tag_next_, *S_, sd_organic_key_);
   const Epetra_MultiVector& Q_db =
     *S_->GetPtr<CompositeVector>(sd_organic_key_, tag_next_)->ViewComponent("cell", false);
 
@@ -1514,37 +1521,29 @@ SedimentTransport_PK::PopulateBoundaryData(std::vector<int>& bc_model,
 
 /* *******************************************************************
 * Identify flux direction based on orientation of the face normal
-* and sign of the  Darcy velocity.
+* and sign of the  Darcy velocity.  The cells of each face and their
+* orientations are those of the topology shared on the mesh; a face
+* with no flux is upwinded to the cell it points out of.
 ******************************************************************* */
 void
 SedimentTransport_PK::IdentifyUpwindCells()
 {
+  const auto& topology = Operators::getUpwindTopology(mesh_);
+
+  const double* flux = (*flux_)[0];
+  int* upwind = upwind_cell_->Values();
+  int* downwind = downwind_cell_->Values();
   for (int f = 0; f < nfaces_wghost; f++) {
-    (*upwind_cell_)[f] = -1; // negative value indicates boundary
-    (*downwind_cell_)[f] = -1;
-  }
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> dirs;
-
-  for (int c = 0; c < ncells_wghost; c++) {
-    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
-
-    for (int i = 0; i < faces.size(); i++) {
-      int f = faces[i];
-      double tmp = (*flux_)[0][f] * dirs[i];
-      if (tmp > 0.0) {
-        (*upwind_cell_)[f] = c;
-      } else if (tmp < 0.0) {
-        (*downwind_cell_)[f] = c;
-      } else if (dirs[i] > 0) {
-        (*upwind_cell_)[f] = c;
-      } else {
-        (*downwind_cell_)[f] = c;
-      }
-    }
+    int c1 = topology.face_cells[2 * f];
+    int c2 = topology.face_cells[2 * f + 1];
+    double tmp = flux[f] * topology.face_dirs[f];
+    bool c1_upwind = tmp > 0.0 || (tmp == 0.0 && topology.face_dirs[f] > 0);
+    upwind[f] = c1_upwind ? c1 : c2;
+    downwind[f] = c1_upwind ? c2 : c1;
   }
 }
 
+
 // void SedimentTransport_PK::ComputeVolumeDarcyFlux(Teuchos::RCP<const Epetra_MultiVector> flux,
 //                                               Teuchos::RCP<const Epetra_MultiVector> molar_density,
 //                                               Teuchos::RCP<Epetra_MultiVector>& vol_darcy_flux){
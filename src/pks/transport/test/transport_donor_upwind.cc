@@ -0,0 +1,277 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "transport_donor_upwind.hh"
+
+using namespace Amanzi::Transport;
+
+namespace {
+
+// Donor upwind data on an nx x ny grid of cells, numbered row by row, whose
+// last n_ghost_rows rows are ghosts.  Fluxes are arbitrary, so the field is
+// not divergence free, and faces are ordered as Transport_ATS orders them.
+struct Grid {
+  Grid(int nx, int ny, int n_ghost_rows) : ncells(nx * ny), ncells_owned(nx * (ny - n_ghost_rows))
+  {
+    auto add_face = [&](int left, int right) {
+      int f = upwind.size();
+      flux.push_back(std::sin(1.7 * f + 0.3) + 0.1);
+      upwind.push_back(flux[f] > 0 ? left : right);
+      downwind.push_back(flux[f] > 0 ? right : left);
+      for (int c : { left, right }) {
+        if (c >= 0) cell_faces_all[c].push_back(f);
+      }
+    };
+
+    cell_faces_all.resize(ncells);
+    for (int j = 0; j < ny; j++) {
+      for (int i = 0; i <= nx; i++) {
+        add_face(i > 0 ? j * nx + i - 1 : -1, i < nx ? j * nx + i : -1);
+      }
+    }
+    for (int j = 0; j <= ny; j++) {
+      for (int i = 0; i < nx; i++) {
+        add_face(j > 0 ? (j - 1) * nx + i : -1, j < ny ? j * nx + i : -1);
+      }
+    }
+
+    std::vector<bool> visited(flux.size(), false);
+    cell_face_offsets.push_back(0);
+    for (int c = 0; c < ncells_owned; c++) {
+      for (int f : cell_faces_all[c]) {
+        cell_faces.push_back(f);
+        if (visited[f]) continue;
+        visited[f] = true;
+        bool interior = upwind[f] >= 0 && upwind[f] < ncells_owned && downwind[f] >= 0 &&
+                        downwind[f] < ncells_owned;
+        (interior ? interior_faces : boundary_faces).push_back(f);
+      }
+      cell_face_offsets.push_back(cell_faces.size());
+    }
+  }
+
+  DonorUpwindTopology topology() const
+  {
+    return DonorUpwindTopology{ ncells_owned,   upwind.data(),     downwind.data(),
+                                flux.data(),    interior_faces,    boundary_faces,
+                                cell_face_offsets, cell_faces };
+  }
+
+  int ncells, ncells_owned;
+  std::vector<int> upwind, downwind;
+  std::vector<double> flux;
+  std::vector<std::vector<int>> cell_faces_all;
+  std::vector<int> interior_faces, boundary_faces, cell_face_offsets, cell_faces;
+};
+
+
+struct Fields {
+  Fields(const Grid& grid, int n) : n(n), mass_bc(n, 0.)
+  {
+    for (int c = 0; c < grid.ncells; c++) {
+      for (int i = 0; i < n; i++) tcc.push_back(1. + 0.5 * std::cos(0.9 * c + i));
+    }
+    for (int c = 0; c < grid.ncells_owned; c++) {
+      water.push_back(10. + std::sin(0.4 * c));
+      for (int i = 0; i < n; i++) cons.push_back(water[c] * tcc[c * n + i]);
+    }
+  }
+
+  void advect(const Grid& grid, double dt, int n_threads)
+  {
+    advectDonorUpwind(
+      grid.topology(), dt, n, n_threads, tcc.data(), cons.data(), water.data(), mass_bc.data());
+  }
+
+  int n;
+  std::vector<double> tcc, cons, water, mass_bc;
+};
+
+} // namespace
+
+
+// the threaded cell gather gives the same result as the serial face loop, up
+// to the order in which each cell sums its fluxes
+TEST(DONOR_UPWIND_THREADED_MATCHES_SERIAL)
+{
+  Grid grid(17, 13, 2);
+  int n = 3;
+  double dt = 0.2;
+
+  Fields serial(grid, n);
+  serial.advect(grid, dt, 1);
+
+  for (int n_threads : { 2, 3, 8 }) {
+    Fields threaded(grid, n);
+    threaded.advect(grid, dt, n_threads);
+
+    for (int k = 0; k < serial.cons.size(); k++) {
+      CHECK_CLOSE(serial.cons[k], threaded.cons[k], 1.e-12);
+    }
+    for (int c = 0; c < grid.ncells_owned; c++) {
+      CHECK_CLOSE(serial.water[c], threaded.water[c], 1.e-12);
+    }
+    for (int i = 0; i < n; i++) CHECK_CLOSE(serial.mass_bc[i], threaded.mass_bc[i], 1.e-12);
+  }
+}
+
+
+// with no ghost cells, the only change in total mass is the boundary outflow
+TEST(DONOR_UPWIND_CONSERVATION)
+{
+  Grid grid(9, 7, 0);
+  int n = 2;
+
+  for (int n_threads : { 1, 4 }) {
+    Fields state(grid, n);
+    std::vector<double> total0(n, 0.);
+    for (int c = 0; c < grid.ncells_owned; c++) {
+      for (int i = 0; i < n; i++) total0[i] += state.cons[c * n + i];
+    }
+
+    state.advect(grid, 0.1, n_threads);
+
+    for (int i = 0; i < n; i++) {
+      double total = 0.;
+      for (int c = 0; c < grid.ncells_owned; c++) total += state.cons[c * n + i];
+      CHECK_CLOSE(total0[i] + state.mass_bc[i], total, 1.e-12);
+      CHECK(state.mass_bc[i] < 0.);
+    }
+  }
+}
+
+
+namespace {
+
+// three levels, mixed so that many faces join cells of different levels
+std::vector<int>
+mixedLevels(const Grid& grid)
+{
+  std::vector<int> level(grid.ncells);
+  for (int c = 0; c < grid.ncells; c++) level[c] = (c % 5 == 0) ? 2 : (c % 3 == 0) ? 1 : 0;
+  return level;
+}
+
+// inflow of every component through every domain boundary inflow face
+std::vector<std::vector<DonorInflow>>
+boundaryInflows(const Grid& grid, const std::vector<int>& level, int n_levels, int n, double value)
+{
+  std::vector<std::vector<DonorInflow>> level_inflows(n_levels);
+  for (int f : grid.boundary_faces) {
+    int c2 = grid.downwind[f];
+    if (grid.upwind[f] >= 0 || c2 < 0 || c2 >= grid.ncells_owned) continue;
+    for (int k = 0; k < n; k++) {
+      level_inflows[level[c2]].push_back(DonorInflow{ c2, k, std::fabs(grid.flux[f]), value });
+    }
+  }
+  return level_inflows;
+}
+
+} // namespace
+
+
+// with a single level, the multirate kernel is the single rate kernel
+TEST(DONOR_UPWIND_MULTIRATE_SINGLE_LEVEL)
+{
+  Grid grid(9, 7, 1);
+  int n = 2;
+  double dt = 0.1;
+  std::vector<int> level(grid.ncells, 0);
+  std::vector<std::vector<DonorInflow>> no_inflows(1);
+
+  Fields single(grid, n);
+  single.advect(grid, dt, 1);
+
+  Fields multi(grid, n);
+  int n_updates = 0;
+  advectDonorUpwindMultirate(grid.topology(), dt, n, 1, level, no_inflows, 1.e-12,
+                             multi.tcc.data(), multi.cons.data(), multi.water.data(),
+                             multi.mass_bc.data(), [&](double*) { n_updates++; });
+
+  CHECK_EQUAL(0, n_updates);
+  for (int k = 0; k < single.cons.size(); k++) CHECK_CLOSE(single.cons[k], multi.cons[k], 1.e-12);
+  for (int c = 0; c < grid.ncells_owned; c++) CHECK_CLOSE(single.water[c], multi.water[c], 1.e-12);
+  for (int i = 0; i < n; i++) CHECK_CLOSE(single.mass_bc[i], multi.mass_bc[i], 1.e-12);
+}
+
+
+// with no ghost cells, the only change in total mass is the boundary inflow
+// and outflow, and the water moved sums to the net boundary flux
+TEST(DONOR_UPWIND_MULTIRATE_CONSERVATION)
+{
+  Grid grid(9, 7, 0);
+  int n = 2, n_levels = 3;
+  auto level = mixedLevels(grid);
+  auto level_inflows = boundaryInflows(grid, level, n_levels, n, 0.7);
+
+  Fields state(grid, n);
+  std::vector<double> total0(n, 0.);
+  double water0 = 0.;
+  for (int c = 0; c < grid.ncells_owned; c++) {
+    for (int i = 0; i < n; i++) total0[i] += state.cons[c * n + i];
+    water0 += state.water[c];
+  }
+
+  double dt = 0.1;
+  int n_updates = 0;
+  advectDonorUpwindMultirate(grid.topology(), dt, n, n_levels, level, level_inflows, 1.e-12,
+                             state.tcc.data(), state.cons.data(), state.water.data(),
+                             state.mass_bc.data(), [&](double*) { n_updates++; });
+  CHECK_EQUAL((1 << (n_levels - 1)) - 1, n_updates);
+
+  for (int i = 0; i < n; i++) {
+    double total = 0.;
+    for (int c = 0; c < grid.ncells_owned; c++) total += state.cons[c * n + i];
+    CHECK_CLOSE(total0[i] + state.mass_bc[i], total, 1.e-12);
+  }
+
+  double water = 0., water_bc = 0.;
+  for (int c = 0; c < grid.ncells_owned; c++) water += state.water[c];
+  for (int f : grid.boundary_faces) {
+    water_bc += (grid.upwind[f] < 0 ? 1. : -1.) * dt * std::fabs(grid.flux[f]);
+  }
+  CHECK_CLOSE(water0 + water_bc, water, 1.e-12);
+}
+
+
+// A uniform concentration, with the same concentration flowing in, stays
+// uniform at every intermediate step, which needs the water content of each
+// cell to be that moved by the fluxes applied to it.
+TEST(DONOR_UPWIND_MULTIRATE_UNIFORM_CONCENTRATION)
+{
+  Grid grid(11, 9, 2);
+  int n = 3, n_levels = 3;
+  double value = 0.7;
+  auto level = mixedLevels(grid);
+  auto level_inflows = boundaryInflows(grid, level, n_levels, n, value);
+
+  Fields state(grid, n);
+  for (double& tcc : state.tcc) tcc = value;
+  for (int c = 0; c < grid.ncells_owned; c++) {
+    for (int i = 0; i < n; i++) state.cons[c * n + i] = state.water[c] * value;
+  }
+
+  int n_updates = 0;
+  auto update_ghosts = [&](double* tcc) {
+    for (int k = 0; k < grid.ncells_owned * n; k++) CHECK_CLOSE(value, tcc[k], 1.e-12);
+    n_updates++;
+  };
+  advectDonorUpwindMultirate(grid.topology(), 0.1, n, n_levels, level, level_inflows, 1.e-12,
+                             state.tcc.data(), state.cons.data(), state.water.data(),
+                             state.mass_bc.data(), update_ghosts);
+
+  CHECK_EQUAL((1 << (n_levels - 1)) - 1, n_updates);
+  for (int c = 0; c < grid.ncells_owned; c++) {
+    for (int i = 0; i < n; i++) CHECK_CLOSE(value, state.cons[c * n + i] / state.water[c], 1.e-12);
+  }
+}
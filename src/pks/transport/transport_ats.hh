@@ -100,6 +100,25 @@ The advection-diffusion equation for component *i* in the surface may be written
     * `"transport subcycling`" ``[bool]`` **true** The code will default to
       subcycling for transport within the master PK if there is one.
 
+    * `"advection threads`" ``[int]`` **1** Number of threads used, within
+      each rank, by the advection kernels.  When greater than 1, the face
+      loops are replaced by cell-centric gathers over owned cells, which are
+      split into contiguous blocks, one per thread, so that no two threads
+      update the same cell.  Threads are taken from the process-wide pool
+      shared by all threaded kernels.  Cell values do not depend on the
+      number of threads; boundary mass totals agree to round-off.
+
+    * `"local time stepping levels`" ``[int]`` **1** Number of levels L of
+      multirate local time stepping, used by the first-order scheme.  When
+      greater than 1, the stable transport step is 2^(L-1) times the step
+      limited by the fastest cell, and each cell is advanced with the largest
+      step dt/2^l, l < L, that is stable for that cell.  Each face is advanced
+      at the rate of the finer of its two cells, so that mass is conserved
+      exactly, and the water content of a cell at the end of each of its
+      steps is that moved by the fluxes applied to it, so that a uniform
+      concentration stays uniform.  Sources are applied over the full step.  Requires
+      `"spatial discretization order`" 1, and is not threaded.
+
 
     Developer parameters:
 
@@ -286,6 +305,7 @@ The advection-diffusion equation for component *i* in the surface may be written
 #include "MultiscaleTransportPorosityPartition.hh"
 #include "TransportDomainFunction.hh"
 #include "TransportDefs.hh"
+#include "transport_donor_upwind.hh"
 
 
 /* ******************************************************************
@@ -405,6 +425,11 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   //  void FunctionalTimeDerivative(const double t, const Epetra_Vector& component, TreeVector& f_component);
 
   void IdentifyUpwindCells();
+  void InitializeDonorFaceOrder_();
+  void AdvectDonorUpwind_(const Epetra_MultiVector& tcc_prev);
+  void AdvectDonorUpwindMultirate_(const Epetra_MultiVector& tcc_prev,
+                                   Epetra_MultiVector& tcc_next);
+  DonorUpwindTopology DonorUpwindTopology_() const;
 
   void InterpolateCellVector(const Epetra_MultiVector& v0,
                              const Epetra_MultiVector& v1,
@@ -484,6 +509,7 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
 
  private:
   bool subcycling_;
+  int n_threads_;
   int dim;
   int saturation_name_;
   bool vol_flux_conversion_;
@@ -506,6 +532,19 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   Teuchos::RCP<Epetra_IntVector> upwind_cell_;
   Teuchos::RCP<Epetra_IntVector> downwind_cell_;
 
+  // Donor upwind kernel data: faces touching an owned cell, ordered by that
+  // cell and split into those between two owned cells and the rest, the
+  // faces of each owned cell (CSR), and advected components interleaved by
+  // cell (cell-major).
+  std::vector<int> donor_interior_faces_, donor_boundary_faces_;
+  std::vector<int> cell_face_offsets_, cell_faces_;
+  std::vector<double> tcc_interleaved_, cons_interleaved_;
+
+  // Multirate local time stepping: the number of levels and the stable
+  // step of each owned cell, from the last StableTimeStep().
+  int lts_levels_;
+  std::vector<double> lts_dt_cell_;
+
   Teuchos::RCP<const Epetra_MultiVector> ws_current, ws_next;             // data for subcycling
   Teuchos::RCP<const Epetra_MultiVector> mol_dens_current, mol_dens_next; // data for subcycling
   Teuchos::RCP<Epetra_MultiVector> ws_subcycle_current, ws_subcycle_next;
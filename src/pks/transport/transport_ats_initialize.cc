@@ -43,6 +43,26 @@ Transport_ATS::InitializeAll_()
   temporal_disc_order = plist_->get<int>("temporal discretization order", 1);
   if (temporal_disc_order < 1 || temporal_disc_order > 2) temporal_disc_order = 1;
 
+  n_threads_ = plist_->get<int>("advection threads", 1);
+  if (n_threads_ < 1) {
+    Errors::Message msg;
+    msg << "Transport_ATS: \"advection threads\" must be a positive integer.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  lts_levels_ = plist_->get<int>("local time stepping levels", 1);
+  if (lts_levels_ < 1 || lts_levels_ > 16) {
+    Errors::Message msg;
+    msg << "Transport_ATS: \"local time stepping levels\" must be between 1 and 16.";
+    Exceptions::amanzi_throw(msg);
+  }
+  if (lts_levels_ > 1 && spatial_disc_order != 1) {
+    Errors::Message msg;
+    msg << "Transport_ATS: \"local time stepping levels\" requires \"spatial discretization "
+           "order\" 1.";
+    Exceptions::amanzi_throw(msg);
+  }
+
   num_aqueous = plist_->get<int>("number of aqueous components", component_names_.size());
   num_advect = plist_->get<int>("number of aqueous components advected", num_aqueous);
   num_gaseous = plist_->get<int>("number of gaseous components", 0);
@@ -13,6 +13,7 @@
 */
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "boost/algorithm/string.hpp"
@@ -35,6 +36,9 @@
 #include "PK_DomainFunctionFactory.hh"
 #include "PK_Utils.hh"
 #include "pk_helpers.hh"
+#include "pk_profiler.hh"
+#include "reduction_batch.hh"
+#include "upwind_topology.hh"
 
 #include "TransportDomainFunction.hh"
 #include "TransportBoundaryFunction_Alquimia.hh"
@@ -603,7 +607,7 @@ Transport_ATS::Initialize()
         new TransportSourceFunction_Alquimia_Units(spec, mesh_, chem_pk_, chem_engine_));
 
       if (S_->HasEvaluator(geochem_src_factor_key_, Tags::NEXT)) {
-        S_->GetEvaluator(geochem_src_factor_key_, Tags::NEXT).Update(*S_, name_);
+        updateEvaluator(geochem_src_factor_key_, Tags::NEXT, *S_, name_);
       }
 
       auto src_factor =
@@ -661,7 +665,7 @@ Transport_ATS::InitializeFieldFromField_(const Key& field0,
   if (S_->HasRecord(field0, tag0)) {
     if (S_->GetRecord(field0, tag0).owner() == name_) {
       if ((!S_->GetRecord(field0, tag0).initialized()) || overwrite) {
-        if (call_evaluator) S_->GetEvaluator(field1, tag0).Update(*S_, name_);
+        if (call_evaluator) updateEvaluator(field1, tag0, *S_, name_);
 
         const CompositeVector& f1 = S_->Get<CompositeVector>(field1, tag1);
         CompositeVector& f0 = S_->GetW<CompositeVector>(field0, tag0, name_);
@@ -716,6 +720,7 @@ Transport_ATS::StableTimeStep()
   dt_ = TRANSPORT_LARGE_TIME_STEP;
   double dt_cell = TRANSPORT_LARGE_TIME_STEP;
   int cmin_dt = 0;
+  if (lts_levels_ > 1) lts_dt_cell_.assign(ncells_owned, TRANSPORT_LARGE_TIME_STEP);
   for (int c = 0; c < ncells_owned; c++) {
     double outflux = total_outflux[c];
 
@@ -723,6 +728,7 @@ Transport_ATS::StableTimeStep()
       vol = mesh_->cell_volume(c);
       dt_cell = vol * (*mol_dens_)[0][c] * (*phi_)[0][c] *
                 std::min((*ws_prev_)[0][c], (*ws_)[0][c]) / outflux;
+      if (lts_levels_ > 1) lts_dt_cell_[c] = std::min(dt_cell, dt_debug_) * cfl_;
     }
     if (dt_cell < dt_) {
       dt_ = dt_cell;
@@ -734,28 +740,26 @@ Transport_ATS::StableTimeStep()
 
   if (spatial_disc_order == 2) dt_ /= 2;
 
-  // communicate global time step
-  double dt_tmp = dt_;
+  // communicate global time step, and the cell that limits it, in one
+  // collective; ties go to the lowest global cell id
   const Epetra_Comm& comm = ws_prev_->Comm();
-  comm.MinAll(&dt_tmp, &dt_, 1);
+  int cmin_dt_gid = ncells_owned > 0 ? cell_map->GID(cmin_dt) : std::numeric_limits<int>::max();
+  ReductionBatch dt_batch(comm);
+  int h_dt = dt_batch.MinLoc(dt_, cmin_dt_gid);
+  dt_batch.Flush();
+  dt_ = dt_batch.get(h_dt);
+  int cmin_dt_unique = dt_batch.getLoc(h_dt);
 
   // incorporate developers and CFL constraints
   dt_ = std::min(dt_, dt_debug_);
   dt_ *= cfl_;
 
-  // print optional diagnostics using maximum cell id as the filter
+  // print optional diagnostics of the limiting cell, which only its owner
+  // contributes to the sums
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-    int cmin_dt_unique = (std::abs(dt_tmp * cfl_ - dt_) < 1e-6 * dt_) ? cell_map->GID(cmin_dt) : -2;
-
-    int cmin_dt_tmp = cmin_dt_unique;
-    comm.MaxAll(&cmin_dt_tmp, &cmin_dt_unique, 1);
-    int min_pid = -1;
-
-    double tmp_package[6];
-    if (cell_map->GID(cmin_dt) == cmin_dt_unique) {
+    double tmp_package[6] = { 0., 0., 0., 0., 0., 0. };
+    if (ncells_owned > 0 && cell_map->GID(cmin_dt) == cmin_dt_unique) {
       const AmanziGeometry::Point& p = mesh_->cell_centroid(cmin_dt);
-
-      min_pid = comm.MyPID();
       tmp_package[0] = ws_min_dt;
       tmp_package[1] = outflux_min_dt;
       tmp_package[2] = p[0];
@@ -767,9 +771,11 @@ Transport_ATS::StableTimeStep()
       tmp_package[5] = p.dim();
     }
 
-    int min_pid_tmp = min_pid;
-    comm.MaxAll(&min_pid_tmp, &min_pid, 1);
-    comm.Broadcast(tmp_package, 6, min_pid);
+    ReductionBatch package_batch(comm);
+    int h_package[6];
+    for (int i = 0; i != 6; ++i) h_package[i] = package_batch.Sum(tmp_package[i]);
+    package_batch.Flush();
+    for (int i = 0; i != 6; ++i) tmp_package[i] = package_batch.get(h_package[i]);
 
     Teuchos::OSTab tab = vo_->getOSTab();
     *vo_->os() << "Stable time step " << dt_ << " is computed at (" << tmp_package[2] << ", "
@@ -780,6 +786,11 @@ Transport_ATS::StableTimeStep()
                << tmp_package[0] << " and "
                << "output flux " << tmp_package[1] << std::endl;
   }
+
+  // with local time stepping, only the finest level is limited by dt_
+  if (lts_levels_ > 1) {
+    dt_ = std::min(dt_ * (1 << (lts_levels_ - 1)), dt_debug_ * cfl_);
+  }
   return dt_;
 }
 
@@ -823,21 +834,21 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
   // subcycled current + next.  This would be fixed by having evaluators that
   // interpolate in time, allowing transport to not have to know how flow is
   // being integrated... FIXME --etc
-  S_->GetEvaluator(flux_key_, Tags::NEXT).Update(*S_, name_);
+  updateEvaluator(flux_key_, Tags::NEXT, *S_, name_);
 
   // why are we re-assigning all of these?  The previous pointers shouldn't have changed... --ETC
   flux_ = S_->Get<CompositeVector>(flux_key_, Tags::NEXT).ViewComponent("face", true);
   // why are we copying this?  This should result in constant flux, no need to copy? --ETC
   *flux_copy_ = *flux_; // copy flux vector from S_next_ to S_;
 
-  S_->GetEvaluator(saturation_key_, Tags::NEXT).Update(*S_, name_);
+  updateEvaluator(saturation_key_, Tags::NEXT, *S_, name_);
   ws_ = S_->Get<CompositeVector>(saturation_key_, Tags::NEXT).ViewComponent("cell", false);
-  S_->GetEvaluator(saturation_key_, Tags::CURRENT).Update(*S_, name_);
+  updateEvaluator(saturation_key_, Tags::CURRENT, *S_, name_);
   ws_prev_ = S_->Get<CompositeVector>(saturation_key_, Tags::CURRENT).ViewComponent("cell", false);
 
-  S_->GetEvaluator(molar_density_key_, Tags::NEXT).Update(*S_, name_);
+  updateEvaluator(molar_density_key_, Tags::NEXT, *S_, name_);
   mol_dens_ = S_->Get<CompositeVector>(molar_density_key_, Tags::NEXT).ViewComponent("cell", false);
-  S_->GetEvaluator(molar_density_key_, Tags::CURRENT).Update(*S_, name_);
+  updateEvaluator(molar_density_key_, Tags::CURRENT, *S_, name_);
   mol_dens_prev_ =
     S_->Get<CompositeVector>(molar_density_key_, Tags::CURRENT).ViewComponent("cell", false);
 
@@ -854,7 +865,7 @@ Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
       if (src->name() == "alquimia source") {
         // src_factor = water_source / molar_density_liquid, both flow
         // quantities, see note above.
-        S_->GetEvaluator(geochem_src_factor_key_, Tags::NEXT).Update(*S_, name_);
+        updateEvaluator(geochem_src_factor_key_, Tags::NEXT, *S_, name_);
         auto src_factor = S_->Get<CompositeVector>(geochem_src_factor_key_, Tags::NEXT)
                             .ViewComponent("cell", false);
         Teuchos::RCP<TransportSourceFunction_Alquimia_Units> src_alq =
@@ -1123,7 +1134,11 @@ Transport_ATS ::Advance_Dispersion_Diffusion(double t_old, double t_new)
       }
 
       CompositeVector& rhs = *op->rhs();
-      int ierr = op->ApplyInverse(rhs, sol);
+      int ierr = 0;
+      {
+        PKProfiler::Scope profile_ls(name(), "LinearSolve");
+        ierr = op->ApplyInverse(rhs, sol);
+      }
 
       if (ierr < 0) {
         Errors::Message msg("TransportExplicit_PK solver failed with message: \"");
@@ -1193,7 +1208,11 @@ Transport_ATS ::Advance_Dispersion_Diffusion(double t_old, double t_new)
       op2->AddAccumulationDelta(sol, factor0, factor, dt_MPC, "cell");
 
       CompositeVector& rhs = *op->rhs();
-      int ierr = op->ApplyInverse(rhs, sol);
+      int ierr = 0;
+      {
+        PKProfiler::Scope profile_ls(name(), "LinearSolve");
+        ierr = op->ApplyInverse(rhs, sol);
+      }
       if (ierr < 0) {
         Errors::Message msg("Transport_PK solver failed with message: \"");
         msg << op->returned_code_string() << "\"";
@@ -1253,7 +1272,7 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
 
   // prepare conservative state in master and slave cells
-  double mass_current = 0., tmp1, mass;
+  double mass_current = 0.;
 
   int num_components = tcc_next.NumVectors();
   conserve_qty_->PutScalar(0.);
@@ -1281,79 +1300,11 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
   }
 
   db_->WriteCellVector("cons (start)", *conserve_qty_);
-  tmp1 = mass_current;
-  mesh_->get_comm()->SumAll(&tmp1, &mass_current, 1);
-
-  // advance all components at once
-  for (int f = 0; f < nfaces_wghost; f++) { // loop over master and slave faces
-    int c1 = (*upwind_cell_)[f];
-    int c2 = (*downwind_cell_)[f];
-    double u = fabs((*flux_)[0][f]);
-
-    if (c1 >= 0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        (*conserve_qty_)[i][c2] += tcc_flux;
-      }
-      (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
-      (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
-    } else if (c1 >= 0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        if (c2 < 0) mass_solutes_bc_[i] -= tcc_flux;
-        //AmanziGeometry::Point normal = mesh_->face_normal(f);
-      }
-      (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
-
-    } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c2] += tcc_flux;
-      }
-      (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
-
-    } else if (c2 < 0 && c1 >= 0 && c1 < ncells_owned) {
-      (*conserve_qty_)[num_components + 1][c1] -= dt_ * u;
-
-    } else if (c1 < 0 && c2 >= 0 && c2 < ncells_owned) {
-      (*conserve_qty_)[num_components + 1][c2] += dt_ * u;
-    }
-  }
-
-  Epetra_MultiVector* tcc_tmp_bf = nullptr;
-  if (tcc_tmp->HasComponent("boundary_face")) {
-    tcc_tmp_bf = &(*tcc_tmp->ViewComponent("boundary_face", false));
-  }
 
-  // loop over exterior boundary sets
-  for (int m = 0; m < bcs_.size(); m++) {
-    std::vector<int>& tcc_index = bcs_[m]->tcc_index();
-    int ncomp = tcc_index.size();
-
-    for (auto it = bcs_[m]->begin(); it != bcs_[m]->end(); ++it) {
-      int f = it->first;
-      int bf = tcc_tmp_bf ? AmanziMesh::getFaceOnBoundaryBoundaryFace(*mesh_, f) : -1;
-
-      std::vector<double>& values = it->second;
-      int c2 = (*downwind_cell_)[f];
-      int c1 = (*upwind_cell_)[f];
-
-      double u = fabs((*flux_)[0][f]);
-      if (c2 >= 0) {
-        for (int i = 0; i < ncomp; i++) {
-          int k = tcc_index[i];
-          if (k < num_advect) {
-            double tcc_flux = dt_ * u * values[i];
-            (*conserve_qty_)[k][c2] += tcc_flux;
-            mass_solutes_bc_[k] += tcc_flux;
-
-            if (tcc_tmp_bf) (*tcc_tmp_bf)[i][bf] = values[i];
-          }
-        }
-      }
-    }
+  if (lts_levels_ > 1) {
+    AdvectDonorUpwindMultirate_(tcc_prev, tcc_next);
+  } else {
+    AdvectDonorUpwind_(tcc_prev);
   }
   db_->WriteCellVector("cons (adv)", *conserve_qty_);
 
@@ -1408,8 +1359,13 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
     for (int i = 0; i < num_advect; i++) { mass_final += (*conserve_qty_)[i][c]; }
   }
 
-  tmp1 = mass_final;
-  mesh_->get_comm()->SumAll(&tmp1, &mass_final, 1);
+  // both totals are reduced together
+  ReductionBatch mass_batch(*mesh_->get_comm());
+  int h_current = mass_batch.Sum(mass_current);
+  int h_final = mass_batch.Sum(mass_final);
+  mass_batch.Flush();
+  mass_current = mass_batch.get(h_current);
+  mass_final = mass_batch.get(h_final);
 
   // update mass balance
   for (int i = 0; i < mass_solutes_exact_.size(); i++) {
@@ -1420,6 +1376,185 @@ Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
 }
 
 
+/* *******************************************************************
+ * Donor upwind fluxes through all faces, including boundary inflow,
+ * over the step dt_.
+ ****************************************************************** */
+void
+Transport_ATS::AdvectDonorUpwind_(const Epetra_MultiVector& tcc_prev)
+{
+  int num_components = tcc_prev.NumVectors();
+
+  // Advance all components at once.  The component state is interleaved by
+  // cell so that each face updates contiguous memory, and faces are visited
+  // in order of their owned cell so that consecutive faces share cells.  The
+  // threaded path gathers over the faces of each cell instead.
+  if (cell_face_offsets_.empty()) InitializeDonorFaceOrder_();
+
+  int n = num_advect;
+  tcc_interleaved_.resize(ncells_wghost * n);
+  cons_interleaved_.resize(ncells_owned * n);
+  for (int i = 0; i < n; i++) {
+    const double* tcc_prev_i = tcc_prev[i];
+    for (int c = 0; c < ncells_wghost; c++) tcc_interleaved_[c * n + i] = tcc_prev_i[c];
+    const double* cons_i = (*conserve_qty_)[i];
+    for (int c = 0; c < ncells_owned; c++) cons_interleaved_[c * n + i] = cons_i[c];
+  }
+  double* water_cons = (*conserve_qty_)[num_components + 1];
+
+  advectDonorUpwind(DonorUpwindTopology_(), dt_, n, n_threads_,
+                    tcc_interleaved_.data(), cons_interleaved_.data(), water_cons,
+                    mass_solutes_bc_.data());
+
+  for (int i = 0; i < n; i++) {
+    double* cons_i = (*conserve_qty_)[i];
+    for (int c = 0; c < ncells_owned; c++) cons_i[c] = cons_interleaved_[c * n + i];
+  }
+
+  Epetra_MultiVector* tcc_tmp_bf = nullptr;
+  if (tcc_tmp->HasComponent("boundary_face")) {
+    tcc_tmp_bf = &(*tcc_tmp->ViewComponent("boundary_face", false));
+  }
+
+  // loop over exterior boundary sets
+  for (int m = 0; m < bcs_.size(); m++) {
+    std::vector<int>& tcc_index = bcs_[m]->tcc_index();
+    int ncomp = tcc_index.size();
+
+    for (auto it = bcs_[m]->begin(); it != bcs_[m]->end(); ++it) {
+      int f = it->first;
+      int bf = tcc_tmp_bf ? AmanziMesh::getFaceOnBoundaryBoundaryFace(*mesh_, f) : -1;
+
+      std::vector<double>& values = it->second;
+      int c2 = (*downwind_cell_)[f];
+      int c1 = (*upwind_cell_)[f];
+
+      double u = fabs((*flux_)[0][f]);
+      if (c2 >= 0) {
+        for (int i = 0; i < ncomp; i++) {
+          int k = tcc_index[i];
+          if (k < num_advect) {
+            double tcc_flux = dt_ * u * values[i];
+            (*conserve_qty_)[k][c2] += tcc_flux;
+            mass_solutes_bc_[k] += tcc_flux;
+
+            if (tcc_tmp_bf) (*tcc_tmp_bf)[i][bf] = values[i];
+          }
+        }
+      }
+    }
+  }
+}
+
+
+/* *******************************************************************
+ * Multirate donor upwind.  Each cell is given a level l and advanced
+ * with steps dt_ / 2^l, the largest such step not exceeding its own
+ * stable step.  Each face is advanced at the level of the finer of its
+ * cells, so every face of a cell is updated at least as often as the
+ * cell.  A face moves conserved quantity and water from one cell to the
+ * other, so mass is conserved exactly across levels, and the
+ * concentrations of a cell at the end of each of its steps are those of
+ * its conserved quantity in the water moved so far.
+ ****************************************************************** */
+void
+Transport_ATS::AdvectDonorUpwindMultirate_(const Epetra_MultiVector& tcc_prev,
+                                           Epetra_MultiVector& tcc_next)
+{
+  int num_components = tcc_prev.NumVectors();
+  int top = lts_levels_ - 1;
+  AMANZI_ASSERT(lts_dt_cell_.size() == ncells_owned);
+
+  // cell levels, made consistent on ghost cells so that both ranks agree
+  // on the level of a face on the partition boundary
+  Epetra_Vector level_owned(mesh_->cell_map(false));
+  for (int c = 0; c < ncells_owned; c++) {
+    int l = 0;
+    while (l < top && dt_ / (1 << l) > lts_dt_cell_[c]) l++;
+    level_owned[c] = l;
+  }
+  if (cell_importer == Teuchos::null) {
+    cell_importer =
+      Teuchos::rcp(new Epetra_Import(mesh_->cell_map(true), mesh_->cell_map(false)));
+  }
+  Epetra_Vector level_wghost(mesh_->cell_map(true));
+  level_wghost.Import(level_owned, *cell_importer, Insert);
+  std::vector<int> level(ncells_wghost);
+  for (int c = 0; c < ncells_wghost; c++) level[c] = (int)level_wghost[c];
+
+  // boundary inflow, at the level of the cell it flows into
+  std::vector<std::vector<DonorInflow>> level_inflows(lts_levels_);
+
+  Epetra_MultiVector* tcc_tmp_bf = nullptr;
+  if (tcc_tmp->HasComponent("boundary_face")) {
+    tcc_tmp_bf = &(*tcc_tmp->ViewComponent("boundary_face", false));
+  }
+
+  for (int m = 0; m < bcs_.size(); m++) {
+    std::vector<int>& tcc_index = bcs_[m]->tcc_index();
+    for (auto it = bcs_[m]->begin(); it != bcs_[m]->end(); ++it) {
+      int f = it->first;
+      int c2 = (*downwind_cell_)[f];
+      if (c2 < 0 || c2 >= ncells_owned) continue;
+      double u = fabs((*flux_)[0][f]);
+      for (int i = 0; i < tcc_index.size(); i++) {
+        int k = tcc_index[i];
+        if (k < num_advect) {
+          level_inflows[level[c2]].push_back(DonorInflow{ c2, k, u, it->second[i] });
+        }
+      }
+
+      if (tcc_tmp_bf) {
+        int bf = AmanziMesh::getFaceOnBoundaryBoundaryFace(*mesh_, f);
+        for (int i = 0; i < tcc_index.size(); i++) {
+          if (tcc_index[i] < num_advect) (*tcc_tmp_bf)[i][bf] = it->second[i];
+        }
+      }
+    }
+  }
+
+  // interleaved state, as in AdvectDonorUpwind_()
+  if (cell_face_offsets_.empty()) InitializeDonorFaceOrder_();
+  int n = num_advect;
+  tcc_interleaved_.resize(ncells_wghost * n);
+  cons_interleaved_.resize(ncells_owned * n);
+  for (int i = 0; i < n; i++) {
+    const double* tcc_prev_i = tcc_prev[i];
+    double* tcc_next_i = tcc_next[i];
+    for (int c = 0; c < ncells_wghost; c++) {
+      tcc_next_i[c] = tcc_prev_i[c];
+      tcc_interleaved_[c * n + i] = tcc_prev_i[c];
+    }
+    const double* cons_i = (*conserve_qty_)[i];
+    for (int c = 0; c < ncells_owned; c++) cons_interleaved_[c * n + i] = cons_i[c];
+  }
+  double* water_cons = (*conserve_qty_)[num_components + 1];
+
+  // intermediate concentrations are communicated through tcc_next
+  auto update_ghosts = [&](double* tcc) {
+    for (int i = 0; i < n; i++) {
+      double* tcc_next_i = tcc_next[i];
+      for (int c = 0; c < ncells_owned; c++) tcc_next_i[c] = tcc[c * n + i];
+    }
+    tcc_tmp->ScatterMasterToGhosted("cell", true);
+    for (int i = 0; i < n; i++) {
+      const double* tcc_next_i = tcc_next[i];
+      for (int c = ncells_owned; c < ncells_wghost; c++) tcc[c * n + i] = tcc_next_i[c];
+    }
+  };
+
+  advectDonorUpwindMultirate(DonorUpwindTopology_(), dt_, n, lts_levels_, level, level_inflows,
+                             water_tolerance_, tcc_interleaved_.data(), cons_interleaved_.data(),
+                             water_cons, mass_solutes_bc_.data(), update_ghosts);
+
+  // the final recovery is done by the caller
+  for (int i = 0; i < n; i++) {
+    double* cons_i = (*conserve_qty_)[i];
+    for (int c = 0; c < ncells_owned; c++) cons_i[c] = cons_interleaved_[c * n + i];
+  }
+}
+
+
 /* *******************************************************************
  * We have to advance each component independently due to different
  * reconstructions. We use tcc when only owned data are needed and
@@ -1728,38 +1863,77 @@ Transport_ATS::PopulateBoundaryData(std::vector<int>& bc_model,
 
 /* *******************************************************************
 * Identify flux direction based on orientation of the face normal
-* and sign of the  Darcy velocity.
+* and sign of the  Darcy velocity.  The cells of each face and their
+* orientations are those of the topology shared on the mesh; a face
+* with no flux is upwinded to the cell it points out of.
 ******************************************************************* */
 void
 Transport_ATS::IdentifyUpwindCells()
 {
+  const auto& topology = Operators::getUpwindTopology(mesh_);
+
+  const double* flux = (*flux_)[0];
+  int* upwind = upwind_cell_->Values();
+  int* downwind = downwind_cell_->Values();
   for (int f = 0; f < nfaces_wghost; f++) {
-    (*upwind_cell_)[f] = -1; // negative value indicates boundary
-    (*downwind_cell_)[f] = -1;
+    int c1 = topology.face_cells[2 * f];
+    int c2 = topology.face_cells[2 * f + 1];
+    double tmp = flux[f] * topology.face_dirs[f];
+    bool c1_upwind = tmp > 0.0 || (tmp == 0.0 && topology.face_dirs[f] > 0);
+    upwind[f] = c1_upwind ? c1 : c2;
+    downwind[f] = c1_upwind ? c2 : c1;
   }
+}
+
+
+/* *******************************************************************
+ * Order the faces used by the donor upwind scheme by owned cell, split
+ * into faces between two owned cells and all others.  Faces touching no
+ * owned cell do not contribute and are skipped.  Also store the faces of
+ * each owned cell, used by the cell-centric kernels.
+ ****************************************************************** */
+void
+Transport_ATS::InitializeDonorFaceOrder_()
+{
+  const auto& topology = Operators::getUpwindTopology(mesh_);
+
+  std::vector<bool> visited(nfaces_wghost, false);
+  donor_interior_faces_.clear();
+  donor_boundary_faces_.clear();
+  cell_face_offsets_.assign(1, 0);
+  cell_face_offsets_.reserve(ncells_owned + 1);
+  cell_faces_.clear();
 
   AmanziMesh::Entity_ID_List faces;
-  std::vector<int> dirs;
-  for (int c = 0; c < ncells_wghost; c++) {
-    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
-
-    for (int i = 0; i < faces.size(); i++) {
-      int f = faces[i];
-      double tmp = (*flux_)[0][f] * dirs[i];
-      if (tmp > 0.0) {
-        (*upwind_cell_)[f] = c;
-      } else if (tmp < 0.0) {
-        (*downwind_cell_)[f] = c;
-      } else if (dirs[i] > 0) {
-        (*upwind_cell_)[f] = c;
-      } else {
-        (*downwind_cell_)[f] = c;
+  for (int c = 0; c < ncells_owned; c++) {
+    mesh_->cell_get_faces(c, &faces);
+    for (int f : faces) {
+      cell_faces_.push_back(f);
+      if (!visited[f]) {
+        visited[f] = true;
+        int c2 = topology.face_cells[2 * f + 1];
+        bool interior = topology.face_cells[2 * f] < ncells_owned && c2 >= 0 && c2 < ncells_owned;
+        (interior ? donor_interior_faces_ : donor_boundary_faces_).push_back(f);
       }
     }
+    cell_face_offsets_.push_back(cell_faces_.size());
   }
 }
 
 
+/* *******************************************************************
+ * View of the donor upwind data for the kernels.
+ ****************************************************************** */
+DonorUpwindTopology
+Transport_ATS::DonorUpwindTopology_() const
+{
+  return DonorUpwindTopology{ ncells_owned,         upwind_cell_->Values(),
+                              downwind_cell_->Values(), (*flux_)[0],
+                              donor_interior_faces_, donor_boundary_faces_,
+                              cell_face_offsets_,    cell_faces_ };
+}
+
+
 void
 Transport_ATS::ComputeVolumeDarcyFlux(Teuchos::RCP<const Epetra_MultiVector> flux,
                                       Teuchos::RCP<const Epetra_MultiVector> molar_density,
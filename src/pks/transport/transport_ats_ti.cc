@@ -15,6 +15,7 @@
 #include <algorithm>
 
 #include "OperatorDefs.hh"
+#include "thread_pool.hh"
 #include "transport_ats.hh"
 
 namespace Amanzi {
@@ -67,58 +68,96 @@ Transport_ATS::FunctionalTimeDerivative(double t,
   // Min-max condition will enforce robustness w.r.t. these errors.
 
   f_component.PutScalar(0.0);
-  for (int f = 0; f < nfaces_wghost; f++) { // loop over master and slave faces
-    int c1 = (*upwind_cell_)[f];
-    int c2 = (*downwind_cell_)[f];
-
-    double u1, u2, umin, umax;
-    if (c1 >= 0 && c2 >= 0) {
-      u1 = (*component_tmp)[c1];
-      u2 = (*component_tmp)[c2];
-      umin = std::min(u1, u2);
-      umax = std::max(u1, u2);
-    } else if (c1 >= 0) {
-      u1 = u2 = umin = umax = (*component_tmp)[c1];
-    } else if (c2 >= 0) {
-      u1 = u2 = umin = umax = (*component_tmp)[c2];
-    }
+  if (n_threads_ > 1) {
+    // Cell-centric gather over the faces of each owned cell, so that threads
+    // working on disjoint blocks of cells never write to the same entry.
+    if (cell_face_offsets_.empty()) InitializeDonorFaceOrder_();
+
+    Utils::forEachBlock(n_threads_, ncells_owned, [&](int t, int c_begin, int c_end) {
+      for (int c = c_begin; c < c_end; c++) {
+        for (int k = cell_face_offsets_[c]; k < cell_face_offsets_[c + 1]; k++) {
+          int f = cell_faces_[k];
+          int c1 = (*upwind_cell_)[f];
+          int c2 = (*downwind_cell_)[f];
+          if (c1 < 0) continue;
+
+          double umin, umax;
+          if (c2 >= 0) {
+            umin = std::min((*component_tmp)[c1], (*component_tmp)[c2]);
+            umax = std::max((*component_tmp)[c1], (*component_tmp)[c2]);
+          } else {
+            umin = umax = (*component_tmp)[c1];
+          }
+
+          const AmanziGeometry::Point& xf = mesh_->face_centroid(f);
+          double upwind_tcc = limiter_->getValue(c1, xf);
+          upwind_tcc = std::max(upwind_tcc, umin);
+          upwind_tcc = std::min(upwind_tcc, umax);
+
+          double tcc_flux = fabs((*flux_)[0][f]) * upwind_tcc;
+          if (c1 == c) {
+            f_component[c] -= tcc_flux;
+          } else {
+            f_component[c] += tcc_flux;
+          }
+        }
+      }
+    });
+
+  } else {
+    for (int f = 0; f < nfaces_wghost; f++) { // loop over master and slave faces
+      int c1 = (*upwind_cell_)[f];
+      int c2 = (*downwind_cell_)[f];
+
+      double u1, u2, umin, umax;
+      if (c1 >= 0 && c2 >= 0) {
+        u1 = (*component_tmp)[c1];
+        u2 = (*component_tmp)[c2];
+        umin = std::min(u1, u2);
+        umax = std::max(u1, u2);
+      } else if (c1 >= 0) {
+        u1 = u2 = umin = umax = (*component_tmp)[c1];
+      } else if (c2 >= 0) {
+        u1 = u2 = umin = umax = (*component_tmp)[c2];
+      }
 
-    double u = fabs((*flux_)[0][f]);
-    const AmanziGeometry::Point& xf = mesh_->face_centroid(f);
+      double u = fabs((*flux_)[0][f]);
+      const AmanziGeometry::Point& xf = mesh_->face_centroid(f);
 
-    double upwind_tcc, tcc_flux;
-    if (c1 >= 0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      upwind_tcc = limiter_->getValue(c1, xf);
-      upwind_tcc = std::max(upwind_tcc, umin);
-      upwind_tcc = std::min(upwind_tcc, umax);
+      double upwind_tcc, tcc_flux;
+      if (c1 >= 0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+        upwind_tcc = limiter_->getValue(c1, xf);
+        upwind_tcc = std::max(upwind_tcc, umin);
+        upwind_tcc = std::min(upwind_tcc, umax);
 
-      tcc_flux = u * upwind_tcc;
-      f_component[c1] -= tcc_flux;
-      f_component[c2] += tcc_flux;
+        tcc_flux = u * upwind_tcc;
+        f_component[c1] -= tcc_flux;
+        f_component[c2] += tcc_flux;
 
-    } else if (c1 >= 0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
-      upwind_tcc = limiter_->getValue(c1, xf);
-      upwind_tcc = std::max(upwind_tcc, umin);
-      upwind_tcc = std::min(upwind_tcc, umax);
+      } else if (c1 >= 0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
+        upwind_tcc = limiter_->getValue(c1, xf);
+        upwind_tcc = std::max(upwind_tcc, umin);
+        upwind_tcc = std::min(upwind_tcc, umax);
 
-      tcc_flux = u * upwind_tcc;
-      f_component[c1] -= tcc_flux;
+        tcc_flux = u * upwind_tcc;
+        f_component[c1] -= tcc_flux;
 
-    } else if (c1 >= 0 && c1 < ncells_owned && (c2 < 0)) {
-      upwind_tcc = component[c1];
-      upwind_tcc = std::max(upwind_tcc, umin);
-      upwind_tcc = std::min(upwind_tcc, umax);
+      } else if (c1 >= 0 && c1 < ncells_owned && (c2 < 0)) {
+        upwind_tcc = component[c1];
+        upwind_tcc = std::max(upwind_tcc, umin);
+        upwind_tcc = std::min(upwind_tcc, umax);
 
-      tcc_flux = u * upwind_tcc;
-      f_component[c1] -= tcc_flux;
+        tcc_flux = u * upwind_tcc;
+        f_component[c1] -= tcc_flux;
 
-    } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      upwind_tcc = limiter_->getValue(c1, xf);
-      upwind_tcc = std::max(upwind_tcc, umin);
-      upwind_tcc = std::min(upwind_tcc, umax);
+      } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+        upwind_tcc = limiter_->getValue(c1, xf);
+        upwind_tcc = std::max(upwind_tcc, umin);
+        upwind_tcc = std::min(upwind_tcc, umax);
 
-      tcc_flux = u * upwind_tcc;
-      f_component[c2] += tcc_flux;
+        tcc_flux = u * upwind_tcc;
+        f_component[c2] += tcc_flux;
+      }
     }
   }
 
@@ -0,0 +1,189 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Donor upwind advection kernels on interleaved component arrays.
+#include <algorithm>
+#include <cmath>
+
+#include "thread_pool.hh"
+#include "transport_donor_upwind.hh"
+
+namespace Amanzi {
+namespace Transport {
+
+namespace {
+
+// Flux through face f over dt, for any pair of owned, ghost, or missing cells.
+inline void
+donorFace(const DonorUpwindTopology& topo,
+          int f,
+          double dt,
+          int n,
+          const double* tcc,
+          double* cons,
+          double* water,
+          double* mass_bc)
+{
+  int c1 = topo.upwind[f];
+  int c2 = topo.downwind[f];
+  double dtu = dt * std::fabs(topo.flux[f]);
+
+  if (c1 >= 0 && c1 < topo.ncells_owned) {
+    const double* tcc_up = &tcc[c1 * n];
+    double* cons_up = &cons[c1 * n];
+    for (int i = 0; i < n; i++) cons_up[i] -= dtu * tcc_up[i];
+    if (c2 < 0) {
+      for (int i = 0; i < n; i++) mass_bc[i] -= dtu * tcc_up[i];
+    }
+    water[c1] -= dtu;
+  }
+  if (c2 >= 0 && c2 < topo.ncells_owned) {
+    if (c1 >= 0) {
+      const double* tcc_up = &tcc[c1 * n];
+      double* cons_down = &cons[c2 * n];
+      for (int i = 0; i < n; i++) cons_down[i] += dtu * tcc_up[i];
+    }
+    water[c2] += dtu;
+  }
+}
+
+} // namespace
+
+
+void
+advectDonorUpwind(const DonorUpwindTopology& topo,
+                  double dt,
+                  int n,
+                  int n_threads,
+                  const double* tcc,
+                  double* cons,
+                  double* water,
+                  double* mass_bc)
+{
+  if (n_threads > 1) {
+    // Cell-centric gather: each owned cell collects the fluxes through its
+    // own faces, so blocks of cells never write to the same cell.  Boundary
+    // outflow is summed per block, then reduced in block order.
+    std::vector<double> mass_bc_block(n_threads * n, 0.);
+    Utils::forEachBlock(n_threads, topo.ncells_owned, [&](int t, int c_begin, int c_end) {
+      double* mass_bc_t = &mass_bc_block[t * n];
+      for (int c = c_begin; c < c_end; c++) {
+        const double* tcc_c = &tcc[c * n];
+        double* cons_c = &cons[c * n];
+
+        for (int k = topo.cell_face_offsets[c]; k < topo.cell_face_offsets[c + 1]; k++) {
+          int f = topo.cell_faces[k];
+          int c1 = topo.upwind[f];
+          int c2 = topo.downwind[f];
+          double dtu = dt * std::fabs(topo.flux[f]);
+
+          if (c1 == c) {
+            for (int i = 0; i < n; i++) cons_c[i] -= dtu * tcc_c[i];
+            if (c2 < 0) {
+              for (int i = 0; i < n; i++) mass_bc_t[i] -= dtu * tcc_c[i];
+            }
+            water[c] -= dtu;
+          } else {
+            if (c1 >= 0) {
+              const double* tcc_up = &tcc[c1 * n];
+              for (int i = 0; i < n; i++) cons_c[i] += dtu * tcc_up[i];
+            }
+            water[c] += dtu;
+          }
+        }
+      }
+    });
+    for (int t = 0; t < n_threads; t++) {
+      for (int i = 0; i < n; i++) mass_bc[i] += mass_bc_block[t * n + i];
+    }
+    return;
+  }
+
+  // faces between two owned cells, whatever the flux direction
+  for (int f : topo.interior_faces) {
+    int c1 = topo.upwind[f];
+    int c2 = topo.downwind[f];
+    double dtu = dt * std::fabs(topo.flux[f]);
+
+    const double* tcc_up = &tcc[c1 * n];
+    double* cons_up = &cons[c1 * n];
+    double* cons_down = &cons[c2 * n];
+    for (int i = 0; i < n; i++) {
+      double tcc_flux = dtu * tcc_up[i];
+      cons_up[i] -= tcc_flux;
+      cons_down[i] += tcc_flux;
+    }
+    water[c1] -= dtu;
+    water[c2] += dtu;
+  }
+
+  // domain and partition boundary faces
+  for (int f : topo.boundary_faces) donorFace(topo, f, dt, n, tcc, cons, water, mass_bc);
+}
+
+
+void
+advectDonorUpwindMultirate(const DonorUpwindTopology& topo,
+                           double dt,
+                           int n,
+                           int n_levels,
+                           const std::vector<int>& level,
+                           const std::vector<std::vector<DonorInflow>>& level_inflows,
+                           double water_tolerance,
+                           double* tcc,
+                           double* cons,
+                           double* water,
+                           double* mass_bc,
+                           const std::function<void(double*)>& update_ghosts)
+{
+  int top = n_levels - 1;
+  int nsteps = 1 << top; // steps of the finest level
+
+  // faces grouped by the level of the finer of their cells
+  std::vector<std::vector<int>> level_faces(n_levels);
+  for (const auto* faces : { &topo.interior_faces, &topo.boundary_faces }) {
+    for (int f : *faces) {
+      int c1 = topo.upwind[f];
+      int c2 = topo.downwind[f];
+      int l = std::max(c1 >= 0 ? level[c1] : 0, c2 >= 0 ? level[c2] : 0);
+      level_faces[l].push_back(f);
+    }
+  }
+
+  for (int step = 0; step < nsteps; step++) {
+    // fluxes of every level whose step starts now
+    for (int l = 0; l <= top; l++) {
+      if (step % (1 << (top - l))) continue;
+      double dt_l = dt / (1 << l);
+
+      for (int f : level_faces[l]) donorFace(topo, f, dt_l, n, tcc, cons, water, mass_bc);
+
+      for (const auto& inflow : level_inflows[l]) {
+        double tcc_flux = dt_l * inflow.u * inflow.value;
+        cons[inflow.c * n + inflow.k] += tcc_flux;
+        mass_bc[inflow.k] += tcc_flux;
+      }
+    }
+
+    // recover concentrations of every level whose step ends now, from the
+    // water moved by the fluxes applied so far
+    if (step == nsteps - 1) break;
+    for (int c = 0; c < topo.ncells_owned; c++) {
+      if ((step + 1) % (1 << (top - level[c]))) continue;
+      for (int i = 0; i < n; i++) {
+        double cons_i = cons[c * n + i];
+        tcc[c * n + i] = (water[c] > water_tolerance && cons_i > 0.) ? cons_i / water[c] : 0.;
+      }
+    }
+    update_ghosts(tcc);
+  }
+}
+
+} // namespace Transport
+} // namespace Amanzi
@@ -0,0 +1,96 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Donor upwind advection kernels on interleaved component arrays.
+/*!
+
+These kernels advance the conserved quantity of all advected components at
+once.  Component state is interleaved by cell, i.e. entry i of cell c is at
+c * n + i, and only owned cells, c < ncells_owned, are updated; ghost cells
+provide upwind concentrations only.  Water moved through each face is
+accumulated in the same way, so that the water content of a cell is always
+consistent with the fluxes applied to it.
+
+Boundary inflow is not included in advectDonorUpwind(), which leaves it to
+the caller; advectDonorUpwindMultirate() applies it at the level of the cell
+it flows into.
+
+*/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+namespace Amanzi {
+namespace Transport {
+
+// Upwind topology and fluxes of the faces touching an owned cell, ordered by
+// owned cell.  upwind and downwind are -1 outside the domain.
+struct DonorUpwindTopology {
+  int ncells_owned;
+  const int* upwind;
+  const int* downwind;
+  const double* flux; // only the magnitude is used
+
+  const std::vector<int>& interior_faces; // faces between two owned cells
+  const std::vector<int>& boundary_faces; // all other faces
+  const std::vector<int>& cell_face_offsets; // faces of owned cell c are
+  const std::vector<int>& cell_faces;        // cell_faces[offsets[c]:offsets[c+1]]
+};
+
+// Boundary inflow of component k into owned cell c.
+struct DonorInflow {
+  int c;
+  int k;
+  double u;
+  double value;
+};
+
+
+//
+// Donor upwind fluxes of n components over dt.  Uses a face loop when
+// n_threads <= 1, and otherwise a gather over the faces of each owned cell so
+// that blocks of cells can be advanced concurrently.  Outflow through the
+// domain boundary is subtracted from mass_bc.
+//
+void
+advectDonorUpwind(const DonorUpwindTopology& topo,
+                  double dt,
+                  int n,
+                  int n_threads,
+                  const double* tcc,
+                  double* cons,
+                  double* water,
+                  double* mass_bc);
+
+//
+// Multirate donor upwind over dt.  Cell c, owned or ghost, is advanced with
+// steps dt / 2^level[c], and each face at the level of the finer of its
+// cells.  At the end of each intermediate step of a cell its concentrations
+// are recovered from its conserved quantity and its accumulated water, then
+// update_ghosts(tcc) is called to refresh ghost concentrations.  The final
+// recovery is left to the caller.
+//
+void
+advectDonorUpwindMultirate(const DonorUpwindTopology& topo,
+                           double dt,
+                           int n,
+                           int n_levels,
+                           const std::vector<int>& level,
+                           const std::vector<std::vector<DonorInflow>>& level_inflows,
+                           double water_tolerance,
+                           double* tcc,
+                           double* cons,
+                           double* water,
+                           double* mass_bc,
+                           const std::function<void(double*)>& update_ghosts);
+
+} // namespace Transport
+} // namespace Amanzi
@@ -0,0 +1,79 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Per-subdomain costs, and their use to assign subdomains to ranks.
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+
+#include "errors.hh"
+#include "subdomain_costs.hh"
+
+namespace Amanzi {
+namespace Utils {
+
+std::map<std::string, double>
+readSubdomainCosts(const std::string& filename)
+{
+  std::ifstream file(filename);
+  if (!file.good()) {
+    Errors::Message msg;
+    msg << "Cannot open subdomain cost file \"" << filename << "\".";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  std::map<std::string, double> costs;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream line_stream(line);
+    std::string subdomain;
+    double cost;
+    if (!(line_stream >> subdomain >> cost)) {
+      Errors::Message msg;
+      msg << "Invalid line \"" << line << "\" in subdomain cost file \"" << filename
+          << "\", expected \"SUBDOMAIN COST\".";
+      Exceptions::amanzi_throw(msg);
+    }
+    costs[subdomain] = cost;
+  }
+  return costs;
+}
+
+
+std::vector<int>
+assignByCost(const std::vector<double>& costs,
+             const std::vector<int>& owners,
+             const std::vector<std::vector<int>>& candidates,
+             int n_ranks)
+{
+  int n = costs.size();
+  std::vector<int> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(
+    order.begin(), order.end(), [&](int a, int b) { return costs[a] > costs[b]; });
+
+  std::vector<double> load(n_ranks, 0.);
+  std::vector<int> ranks(n);
+  for (int i : order) {
+    int best = owners[i];
+    for (int p : candidates[i]) {
+      if (load[p] < load[best] || (load[p] == load[best] && best != owners[i] && p < best)) {
+        best = p;
+      }
+    }
+    ranks[i] = best;
+    load[best] += costs[i];
+  }
+  return ranks;
+}
+
+} // namespace Utils
+} // namespace Amanzi
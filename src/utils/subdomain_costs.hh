@@ -0,0 +1,48 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Per-subdomain costs, and their use to assign subdomains to ranks.
+/*!
+
+Subdomain cost files hold one `"SUBDOMAIN COST`" line per subdomain, where
+SUBDOMAIN is the full subdomain name (e.g. `"column:12`") and COST is the
+wallclock time of its most recent advance.  Lines starting with `"#`" are
+comments.  These files are written by the weak subdomain MPC and read both by
+it, to order its threaded schedule, and by indexed domain sets, to assign
+subdomains to ranks.
+
+assignByCost() is greedy longest-processing-time bin packing: items are
+taken most expensive first, each going to the least loaded of the ranks on
+which it may be placed.  Ties go to the item's current owner, so that equal
+costs move nothing, and then to the lowest rank.  The result depends only on
+its arguments, so every rank computes the same assignment.
+
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Amanzi {
+namespace Utils {
+
+// Read a subdomain cost file into a map from subdomain name to cost.
+std::map<std::string, double> readSubdomainCosts(const std::string& filename);
+
+// Assign each item i, of the given cost, to one of candidates[i], which must
+// include owners[i].  Returns the rank of each item.
+std::vector<int> assignByCost(const std::vector<double>& costs,
+                              const std::vector<int>& owners,
+                              const std::vector<std::vector<int>>& candidates,
+                              int n_ranks);
+
+} // namespace Utils
+} // namespace Amanzi
@@ -0,0 +1,111 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "errors.hh"
+#include "subdomain_costs.hh"
+
+using namespace Amanzi::Utils;
+
+namespace {
+
+std::vector<double>
+loads(const std::vector<double>& costs, const std::vector<int>& ranks, int n_ranks)
+{
+  std::vector<double> load(n_ranks, 0.);
+  for (int i = 0; i != costs.size(); ++i) load[ranks[i]] += costs[i];
+  return load;
+}
+
+} // namespace
+
+
+// With every rank a candidate, all the expensive items start on rank 0 and
+// are spread so that no rank carries more than the mean plus one item.
+TEST(ASSIGN_BY_COST_BALANCES)
+{
+  int n_ranks = 4;
+  std::vector<double> costs;
+  for (int i = 0; i != 40; ++i) costs.push_back(i < 10 ? 10. + i : 1.);
+  std::vector<int> owners(costs.size(), 0);
+  std::vector<std::vector<int>> candidates(costs.size(), { 0, 1, 2, 3 });
+
+  auto ranks = assignByCost(costs, owners, candidates, n_ranks);
+  auto load = loads(costs, ranks, n_ranks);
+
+  double total = 0., max_cost = 0.;
+  for (double c : costs) {
+    total += c;
+    max_cost = std::max(max_cost, c);
+  }
+  for (double l : load) CHECK(l <= total / n_ranks + max_cost);
+  double max_load = *std::max_element(load.begin(), load.end());
+  double min_load = *std::min_element(load.begin(), load.end());
+  CHECK(max_load - min_load <= max_cost);
+}
+
+
+// Items only move to their candidates, and equal costs stay with their owners.
+TEST(ASSIGN_BY_COST_CANDIDATES_AND_TIES)
+{
+  std::vector<double> costs = { 5., 5., 5., 5., 1., 1. };
+  std::vector<int> owners = { 0, 1, 2, 0, 1, 2 };
+  std::vector<std::vector<int>> candidates = { { 0, 1 }, { 0, 1, 2 }, { 1, 2 },
+                                               { 0 },    { 1 },       { 1, 2 } };
+
+  auto ranks = assignByCost(costs, owners, candidates, 3);
+  for (int i = 0; i != costs.size(); ++i) {
+    CHECK(std::find(candidates[i].begin(), candidates[i].end(), ranks[i]) !=
+          candidates[i].end());
+  }
+
+  // each of the first three takes its owner, as all loads are equal
+  CHECK_EQUAL(0, ranks[0]);
+  CHECK_EQUAL(1, ranks[1]);
+  CHECK_EQUAL(2, ranks[2]);
+  CHECK_EQUAL(0, ranks[3]);
+
+  // uniform costs and owners already balanced move nothing
+  std::vector<double> uniform(6, 2.);
+  std::vector<int> balanced = { 0, 1, 2, 0, 1, 2 };
+  std::vector<std::vector<int>> all(6, { 0, 1, 2 });
+  auto same = assignByCost(uniform, balanced, all, 3);
+  for (int i = 0; i != 6; ++i) CHECK_EQUAL(balanced[i], same[i]);
+}
+
+
+TEST(READ_SUBDOMAIN_COSTS)
+{
+  std::string filename = "test_subdomain_costs.txt";
+  {
+    std::ofstream file(filename);
+    file << "# subdomain advance cost [s]\n"
+         << "column:3 1.5\n"
+         << "\n"
+         << "column:12 0.25\n";
+  }
+  auto costs = readSubdomainCosts(filename);
+  CHECK_EQUAL(2, costs.size());
+  CHECK_EQUAL(1.5, costs["column:3"]);
+  CHECK_EQUAL(0.25, costs["column:12"]);
+
+  {
+    std::ofstream file(filename);
+    file << "column:3\n";
+  }
+  CHECK_THROW(readSubdomainCosts(filename), Errors::Message);
+  std::remove(filename.c_str());
+
+  CHECK_THROW(readSubdomainCosts("no_such_subdomain_cost_file.txt"), Errors::Message);
+}
@@ -0,0 +1,144 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "thread_pool.hh"
+
+using namespace Amanzi::Utils;
+
+namespace {
+
+double
+kernel(int i)
+{
+  return std::sin(0.001 * i) * std::exp(-1.e-6 * i);
+}
+
+} // namespace
+
+
+// blocks cover the range exactly once, and per-block partial sums combine to
+// the same bits regardless of which thread ran which block
+TEST(THREAD_POOL_BLOCKS_MATCH_SERIAL)
+{
+  int n = 100003;
+  std::vector<double> serial(n), threaded(n, -1.);
+  for (int i = 0; i != n; ++i) serial[i] = kernel(i);
+
+  for (int n_threads : { 1, 2, 3, 8 }) {
+    std::vector<int> count(n, 0);
+    std::vector<double> partial(n_threads, 0.);
+    forEachBlock(n_threads, n, [&](int t, int begin, int end) {
+      for (int i = begin; i != end; ++i) {
+        threaded[i] = kernel(i);
+        count[i]++;
+        partial[t] += threaded[i];
+      }
+    });
+    for (int i = 0; i != n; ++i) {
+      CHECK_EQUAL(1, count[i]);
+      CHECK_EQUAL(serial[i], threaded[i]);
+    }
+
+    // same partition, serially
+    std::vector<double> partial_serial(n_threads, 0.);
+    for (int t = 0; t != n_threads; ++t) {
+      int begin = (int)(((long long)n * t) / n_threads);
+      int end = (int)(((long long)n * (t + 1)) / n_threads);
+      for (int i = begin; i != end; ++i) partial_serial[t] += serial[i];
+    }
+    for (int t = 0; t != n_threads; ++t) CHECK_EQUAL(partial_serial[t], partial[t]);
+  }
+}
+
+
+// more blocks than entries leaves some blocks empty
+TEST(THREAD_POOL_EMPTY_BLOCKS)
+{
+  std::vector<int> count(3, 0);
+  forEachBlock(8, 3, [&](int t, int begin, int end) {
+    for (int i = begin; i != end; ++i) count[i]++;
+  });
+  for (int c : count) CHECK_EQUAL(1, c);
+}
+
+
+TEST(THREAD_POOL_DYNAMIC_MATCHES_SERIAL)
+{
+  int n = 1000;
+  std::vector<double> result(n, -1.);
+  int n_fail = forEachDynamic(4, n, [&](int i) {
+    result[i] = kernel(i);
+    return false;
+  });
+  CHECK_EQUAL(0, n_fail);
+  for (int i = 0; i != n; ++i) CHECK_EQUAL(kernel(i), result[i]);
+}
+
+
+// a failure stops new indices from being started
+TEST(THREAD_POOL_DYNAMIC_FAILURE)
+{
+  int n = 1000;
+  std::vector<int> started(n, 0);
+  int n_fail = forEachDynamic(1, n, [&](int i) {
+    started[i] = 1;
+    return i == 10;
+  });
+  CHECK_EQUAL(1, n_fail);
+  for (int i = 0; i != n; ++i) CHECK_EQUAL(i <= 10 ? 1 : 0, started[i]);
+
+  n_fail = forEachDynamic(4, n, [&](int i) { return i == 10; });
+  CHECK(n_fail >= 1);
+}
+
+
+TEST(THREAD_POOL_EXCEPTIONS)
+{
+  bool caught = false;
+  try {
+    forEachBlock(4, 100, [&](int t, int begin, int end) {
+      if (t == 2) throw std::runtime_error("block failed");
+    });
+  } catch (const std::runtime_error& e) {
+    caught = true;
+  }
+  CHECK(caught);
+
+  // the pool is still usable afterwards
+  std::vector<int> count(100, 0);
+  forEachBlock(4, 100, [&](int t, int begin, int end) {
+    for (int i = begin; i != end; ++i) count[i]++;
+  });
+  for (int c : count) CHECK_EQUAL(1, c);
+}
+
+
+// regions started inside a region run serially on the calling thread
+TEST(THREAD_POOL_NESTED)
+{
+  int n = 64;
+  std::vector<double> result(n * n, 0.);
+  std::vector<int> nested(4, 0);
+  forEachBlock(4, n, [&](int t, int begin, int end) {
+    nested[t] = ThreadPool::inParallelRegion();
+    for (int i = begin; i != end; ++i) {
+      forEachBlock(4, n, [&](int, int b2, int e2) {
+        for (int j = b2; j != e2; ++j) result[i * n + j] = kernel(i * n + j);
+      });
+    }
+  });
+  for (int t : nested) CHECK_EQUAL(1, t);
+  CHECK(!ThreadPool::inParallelRegion());
+  for (int k = 0; k != n * n; ++k) CHECK_EQUAL(kernel(k), result[k]);
+}
@@ -0,0 +1,164 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Shared-memory parallel loops on a persistent pool of threads.
+#include <algorithm>
+#include <atomic>
+
+#include "thread_pool.hh"
+
+namespace Amanzi {
+namespace Utils {
+
+namespace {
+
+// true on pool workers, and on the calling thread while it runs a region
+thread_local bool in_region = false;
+
+struct RegionGuard {
+  RegionGuard() { in_region = true; }
+  ~RegionGuard() { in_region = false; }
+};
+
+} // namespace
+
+
+ThreadPool&
+ThreadPool::get()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_start_.notify_all();
+  for (auto& th : threads_) th.join();
+}
+
+
+bool
+ThreadPool::inParallelRegion()
+{
+  return in_region;
+}
+
+
+void
+ThreadPool::Run(int n_tasks, const std::function<void(int)>& task)
+{
+  if (n_tasks <= 1 || in_region) {
+    for (int t = 0; t < n_tasks; ++t) task(t);
+    return;
+  }
+
+  RegionGuard guard;
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  std::unique_lock<std::mutex> lock(mutex_);
+  while ((int)threads_.size() < n_tasks - 1) threads_.emplace_back(&ThreadPool::Worker_, this);
+
+  task_ = &task;
+  n_tasks_ = n_tasks;
+  next_ = 0;
+  n_done_ = 0;
+  eptr_ = nullptr;
+  cv_start_.notify_all();
+
+  Drain_(lock);
+  cv_done_.wait(lock, [this] { return n_done_ == n_tasks_; });
+  task_ = nullptr;
+
+  std::exception_ptr eptr = eptr_;
+  eptr_ = nullptr;
+  lock.unlock();
+  if (eptr) std::rethrow_exception(eptr);
+}
+
+
+void
+ThreadPool::Worker_()
+{
+  in_region = true;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_start_.wait(lock, [this] { return stop_ || (task_ && next_ < n_tasks_); });
+    if (stop_) return;
+    Drain_(lock);
+  }
+}
+
+
+// Claim and run tasks of the current region until none are left.  Called,
+// and returns, with lock held.
+void
+ThreadPool::Drain_(std::unique_lock<std::mutex>& lock)
+{
+  while (task_ && next_ < n_tasks_) {
+    int t = next_++;
+    const auto& task = *task_;
+    lock.unlock();
+
+    // exceptions cannot cross the thread boundary, keep the first for Run()
+    std::exception_ptr eptr;
+    try {
+      task(t);
+    } catch (...) {
+      eptr = std::current_exception();
+    }
+
+    lock.lock();
+    if (eptr && !eptr_) eptr_ = eptr;
+    if (++n_done_ == n_tasks_) cv_done_.notify_all();
+  }
+}
+
+
+void
+forEachBlock(int n_threads, int n, const std::function<void(int, int, int)>& func)
+{
+  int n_blocks = std::max(n_threads, 1);
+  auto block_begin = [n, n_blocks](int t) { return (int)(((long long)n * t) / n_blocks); };
+  ThreadPool::get().Run(n_blocks, [&](int t) { func(t, block_begin(t), block_begin(t + 1)); });
+}
+
+
+int
+forEachDynamic(int n_threads, int n, const std::function<bool(int)>& func)
+{
+  std::atomic<int> next(0);
+  std::atomic<int> n_fail(0);
+  std::atomic<bool> stop(false);
+
+  int n_workers = std::max(1, std::min(n_threads, n));
+  ThreadPool::get().Run(n_workers, [&](int) {
+    int i;
+    while (!stop.load() && (i = next++) < n) {
+      bool fail;
+      try {
+        fail = func(i);
+      } catch (...) {
+        stop = true;
+        throw;
+      }
+      if (fail) {
+        ++n_fail;
+        stop = true;
+      }
+    }
+  });
+  return n_fail.load();
+}
+
+} // namespace Utils
+} // namespace Amanzi
@@ -0,0 +1,97 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+//! Shared-memory parallel loops on a persistent pool of threads.
+/*!
+
+Kernels that are called every step or every nonlinear iteration cannot afford
+to create and join threads on each call, so all threaded loops in ATS run on a
+single, process-wide pool whose workers are created on first use and then
+sleep between parallel regions.
+
+forEachBlock() splits a range into one contiguous block per thread; the
+partition depends only on the range and the thread count, so per-block
+partial results (e.g. mass balance sums) combine in a reproducible order.
+forEachDynamic() instead lets each thread claim the next index as it becomes
+free, which balances work items of very uneven cost.
+
+Exceptions thrown on a worker are rethrown on the calling thread once the
+region completes.  A parallel region started from within another one runs
+serially on the calling thread, so threaded kernels may be nested inside
+threaded drivers without oversubscribing or deadlocking the pool.
+
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Amanzi {
+namespace Utils {
+
+class ThreadPool {
+ public:
+  // The process-wide pool.
+  static ThreadPool& get();
+
+  ~ThreadPool();
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Calls task(t) for each t in [0, n_tasks), using the calling thread and
+  // up to n_tasks - 1 workers, and returns once all calls are complete.
+  void Run(int n_tasks, const std::function<void(int)>& task);
+
+  // Is the calling thread already inside a parallel region?
+  static bool inParallelRegion();
+
+  int size() const { return threads_.size(); }
+
+ private:
+  ThreadPool() = default;
+
+  void Worker_();
+  void Drain_(std::unique_lock<std::mutex>& lock);
+
+  std::vector<std::thread> threads_;
+  std::mutex run_mutex_; // one region at a time
+  std::mutex mutex_;     // guards everything below
+  std::condition_variable cv_start_, cv_done_;
+  const std::function<void(int)>* task_ = nullptr;
+  int n_tasks_ = 0;
+  int next_ = 0;
+  int n_done_ = 0;
+  bool stop_ = false;
+  std::exception_ptr eptr_;
+};
+
+
+//
+// Calls func(block, begin, end) on n_threads contiguous blocks of [0, n),
+// some of which may be empty.  func must only write to entries owned by its
+// block.
+//
+void
+forEachBlock(int n_threads, int n, const std::function<void(int, int, int)>& func);
+
+//
+// Calls func(i) for each i in [0, n), each claimed by the next free thread.
+// func returns true on failure; once any call has failed or thrown, no new
+// indices are started.  Returns the number of failed calls.
+//
+int
+forEachDynamic(int n_threads, int n, const std::function<bool(int)>& func);
+
+} // namespace Utils
+} // namespace Amanzi
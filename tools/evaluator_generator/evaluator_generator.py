@@ -1,4 +1,5 @@
 import sys,os
+import sympy
 from sympy.printing import ccode
 
 _template_directory = os.path.dirname(os.path.abspath(__file__))
@@ -98,55 +99,68 @@ class EvalGen(object):
     def renderMyMethodDeclarationArgs(self):
         return ", ".join(["double %s"%var for var in self.vars])
 
+    def renderMyBatchedMethodArgs(self):
+        return ", ".join(["%s_v[0]"%var for var in self.vars])
+
+    def renderMyBatchedDeclarationArgs(self):
+        return ", ".join(["const double* %s"%var for var in self.vars])
+
+    def renderMyBatchedCallArgs(self):
+        return ", ".join(["%s[i]"%var for var in self.vars])
+
+    def wrtMethod(self, arg):
+        return ''.join([word[0].upper()+word[1:] for word in arg.split("_")])
+
+    def derivMethod(self, arg):
+        return "D%sD%s"%(self.d['myKeyMethod'], self.wrtMethod(arg))
+
+    def renderCSE(self, exprs, outputs, indent):
+        """C statements evaluating exprs into outputs, with common
+        subexpressions hoisted into temporaries."""
+        replacements, reduced = sympy.cse(exprs)
+        lines = ["%sconst double %s = %s;"%(indent, ccode(sym), ccode(sub)) for sym, sub in replacements]
+        lines.extend(["%s%s;"%(indent, out.format(ccode(expr))) for out, expr in zip(outputs, reduced)])
+        return '\n'.join(lines)
+
     def renderEvaluateModel(self):
         d = dict()
         d['keyEpetraVectorList'] = self.renderKeyEpetraVector()
         d['myKeyMethod'] = self.d['myKeyMethod']
-        d['myMethodArgs'] = self.renderMyMethodArgs()
+        d['myBatchedMethodArgs'] = self.renderMyBatchedMethodArgs()
         return render('evaluator_evaluateModel.cc', d)
 
     def renderEvaluateDerivs(self):
+        """Derivatives are computed together by the fused kernel and cached,
+        then copied out for the requested dependency."""
         wrt_list = []
+        for i, (arg, var) in enumerate(zip(self.args, self.vars)):
+            tname = 'evaluator_ifWRT.cc' if i == 0 else 'evaluator_elseifWRT.cc'
+            wrt_list.append(render(tname, dict(var=var)))
+            wrt_list.append("    wrt_index = %d;"%i)
+
+        d = dict()
+        d['keyEpetraVectorList'] = self.renderKeyEpetraVectorIndented()
+        d['myKeyMethod'] = self.d['myKeyMethod']
+        d['myBatchedMethodArgs'] = self.renderMyBatchedMethodArgs()
+        d['nDerivs'] = len(self.args)
+        d['derivArgs'] = ", ".join(["derivs[%d].data()"%i for i in range(len(self.args))])
+        d['wrtIndexList'] = '\n'.join(wrt_list)
+        return render('evaluator_evaluateDerivs.cc', d)
 
-        def getDict(arg,var):
-            d = dict(arg=arg,var=var)
-            d['keyEpetraVectorList'] = self.renderKeyEpetraVectorIndented()
-            d['myKeyMethod'] = self.d['myKeyMethod']
-            d['wrtMethod'] = ''.join([word[0].upper()+word[1:] for word in arg.split("_")])
-            d['myMethodArgs'] = self.renderMyMethodArgs()
-            return d
-        
-        if len(self.args) > 0:
-            d = getDict(self.args[0], self.vars[0])
-            d['if_elseif'] = render('evaluator_ifWRT.cc', d)
-            wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
-
-        if len(self.args) > 1:
-            for arg,var in zip(self.args[1:],self.vars[1:]):
-                d = getDict(arg,var)
-                d['if_elseif'] = render('evaluator_elseifWRT.cc', d)
-                wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
-
-        wrt_list.append('\n'.join(["  } else {",
-                                   "    ASSERT(0);",
-                                   "  }"]))
-
-        return "\n\n".join(wrt_list)
-                            
     def renderModelMethodDeclaration(self):
         return render('model_declaration.hh', dict(myMethod=self.d['myKeyMethod'],
                                                    myMethodDeclarationArgs=self.d['myMethodDeclarationArgs']))
 
     def renderModelDerivDeclarations(self):
         return '\n'.join([render('model_declaration.hh',
-                                 dict(myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
+                                 dict(myMethod=self.derivMethod(arg),
                                       myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'])) for arg in self.args])
 
     def renderModelMethodImplementation(self):
         if self.expression is not None:
-            implementation = ccode(self.expression)
+            implementation = self.renderCSE([self.expression], ["return {}"], "  ")
         else:
-            implementation = "ASSERT(False)"
+            implementation = "  AMANZI_ASSERT(false);\n  return 0.;"
         return render('model_methodImplementation.cc', dict(evalClassName=self.d['evalClassName'],
                                                             myMethod=self.d['myKeyMethod'],
                                                             myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
@@ -158,15 +172,56 @@ class EvalGen(object):
         for arg,var in zip(self.args,self.vars):
             if self.expression is not None:
                 print("differentiation of", self.expression, "with respect to", var)
-                implementation = ccode(self.expression.diff(var))
+                implementation = self.renderCSE([self.expression.diff(var)], ["return {}"], "  ")
             else:
-                implementation = "ASSERT(False)"
+                implementation = "  AMANZI_ASSERT(false);\n  return 0.;"
             impls.append(render('model_methodImplementation.cc',
                                 dict(evalClassName=self.d['evalClassName'],
-                                     myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
+                                     myMethod=self.derivMethod(arg),
                                      myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
                                      myMethodImplementation=implementation)))
         return '\n\n'.join(impls)
+
+    def renderModelBatchedDeclarations(self):
+        """Array-in/array-out versions of the value and each derivative, and a
+        fused kernel computing the value and any of the derivatives."""
+        methods = [self.d['myKeyMethod'],] + [self.derivMethod(arg) for arg in self.args]
+        decls = [render('model_batchedDeclaration.hh',
+                        dict(myMethod=m, myBatchedDeclarationArgs=self.d['myBatchedDeclarationArgs']))
+                 for m in methods]
+        decls.append('')
+        decls.append(render('model_fusedDeclaration.hh',
+                            dict(myMethod=self.d['myKeyMethod'],
+                                 myBatchedDeclarationArgs=self.d['myBatchedDeclarationArgs'],
+                                 myFusedDerivDeclarationArgs=self.d['myFusedDerivDeclarationArgs'])))
+        return '\n'.join(decls)
+
+    def renderModelBatchedImplementations(self):
+        methods = [self.d['myKeyMethod'],] + [self.derivMethod(arg) for arg in self.args]
+        impls = [render('model_batchedImplementation.cc',
+                        dict(evalClassName=self.d['evalClassName'],
+                             myMethod=m,
+                             myBatchedDeclarationArgs=self.d['myBatchedDeclarationArgs'],
+                             myBatchedCallArgs=self.renderMyBatchedCallArgs()))
+                 for m in methods]
+
+        # the fused kernel shares subexpressions across the value and all
+        # derivatives, evaluated entry by entry
+        outputs = ["result"] + ["dresult_d%s"%var for var in self.vars]
+        if self.expression is not None:
+            at_i = dict([(sympy.Symbol(var), sympy.Symbol("%s[i]"%var)) for var in self.vars])
+            expr = self.expression.subs(at_i)
+            exprs = [expr,] + [self.expression.diff(var).subs(at_i) for var in self.vars]
+            implementation = self.renderCSE(exprs, ["if (%s) %s[i] = {}"%(out,out) for out in outputs], "    ")
+        else:
+            implementation = "    AMANZI_ASSERT(false);"
+        impls.append(render('model_fusedImplementation.cc',
+                            dict(evalClassName=self.d['evalClassName'],
+                                 myMethod=self.d['myKeyMethod'],
+                                 myBatchedDeclarationArgs=self.d['myBatchedDeclarationArgs'],
+                                 myFusedDerivDeclarationArgs=self.d['myFusedDerivDeclarationArgs'],
+                                 myFusedImplementation=implementation)))
+        return '\n\n'.join(impls)
     
     def renderModelParamDeclarations(self):
         return '\n'.join(['  %s %s;'%p for p in self.pars])
@@ -190,6 +245,8 @@ class EvalGen(object):
         self.d['keyCompositeVectorList'] = self.renderKeyCompositeVector()
         self.d['myMethodArgs'] = self.renderMyMethodArgs()
         self.d['myMethodDeclarationArgs'] = self.renderMyMethodDeclarationArgs()
+        self.d['myBatchedDeclarationArgs'] = self.renderMyBatchedDeclarationArgs()
+        self.d['myFusedDerivDeclarationArgs'] = ", ".join(["double* dresult_d%s"%var for var in self.vars])
         self.d['evaluateModel'] = self.renderEvaluateModel()
         self.d['evaluateDerivs'] = self.renderEvaluateDerivs()
 
@@ -199,6 +256,8 @@ class EvalGen(object):
 
         self.d['modelMethodImplementation'] = self.renderModelMethodImplementation()
         self.d['modelDerivImplementationList'] = self.renderModelDerivImplementations()
+        self.d['modelBatchedDeclarationList'] = self.renderModelBatchedDeclarations()
+        self.d['modelBatchedImplementationList'] = self.renderModelBatchedImplementations()
         self.d['modelInitializeParamsList'] = self.renderModelParamInitializations()
 
 def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parameters, **kwargs):
@@ -1,24 +1,26 @@
-/*
-  Copyright 2010-202x held jointly by participating institutions.
-  ATS is released under the three-clause BSD License.
-  The terms of use and "as is" disclaimer for this license are
-  provided in the top-level COPYRIGHT file.
+  // the fused kernel finds all derivatives in one pass over the dependencies
+  if (!derivs_valid_) {{
+    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
+         ++comp) {{
+{keyEpetraVectorList}
 
-  Authors:
-*/
+      int ncomp = result[0]->size(*comp, false);
+      auto& derivs = derivs_[*comp];
+      derivs.resize({nDerivs});
+      for (auto& deriv : derivs) deriv.resize(ncomp);
+      model_->{myKeyMethod}AndDerivatives(ncomp, {myBatchedMethodArgs}, nullptr, {derivArgs});
+    }}
+    derivs_valid_ = true;
+  }}
 
-{
-  if_elseif
-}
-for (CompositeVector::name_iterator comp = result->begin(); comp != result->end(); ++comp) {
-  {
-    { keyEpetraVectorList } Epetra_MultiVector& result_v = *result->ViewComponent(*comp, false);
+  int wrt_index = -1;
+{wrtIndexList}
+  }} else {{
+    AMANZI_ASSERT(0);
+  }}
 
-    int ncomp = result->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      {
-        result_v[0][i] = model_->D{ myKeyMethod } D{ wrtMethod }({ myMethodArgs });
-      }
-    }
-  }
-}
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {{
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    const std::vector<double>& deriv = derivs_.at(*comp)[wrt_index];
+    std::copy(deriv.begin(), deriv.end(), result_v[0]);
+  }}
@@ -1,10 +1 @@
-/*
-  Copyright 2010-202x held jointly by participating institutions.
-  ATS is released under the three-clause BSD License.
-  The terms of use and "as is" disclaimer for this license are
-  provided in the top-level COPYRIGHT file.
-
-  Authors:
-*/
-
-Teuchos::RCP<const CompositeVector>{ var } = S->GetFieldData({ var } _key_);
+  Teuchos::RCP<const CompositeVector> {var} = S.GetPtr<CompositeVector>({var}_key_, tag);
@@ -1,13 +1 @@
-/*
-  Copyright 2010-202x held jointly by participating institutions.
-  ATS is released under the three-clause BSD License.
-  The terms of use and "as is" disclaimer for this license are
-  provided in the top-level COPYRIGHT file.
-
-  Authors:
-*/
-
-const Epetra_MultiVector& { var } _v = *
-{
-  var
-} -> ViewComponent(*comp, false);
+      const Epetra_MultiVector& {var}_v = *{var}->ViewComponent(*comp, false);
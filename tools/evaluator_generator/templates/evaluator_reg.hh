@@ -9,20 +9,13 @@
 
 #include "{evalName}_evaluator.hh"
 
-namespace Amanzi {
-{
-  namespace {namespace}
-  {
-    {
-      namespace Relations {
-      {
-        Utils::RegisteredFactory<Evaluator, { evalClassName } Evaluator>{
-          evalClassName
-        } Evaluator::reg_("{evalNameString}");
+namespace Amanzi {{
+namespace {namespace} {{
+namespace Relations {{
 
-      }
-      } // namespace Relations
-    }
-  } // namespace }
-} // namespace Amanzi
-} // namespace Amanzi
+Utils::RegisteredFactory<Evaluator, {evalClassName}Evaluator>
+  {evalClassName}Evaluator::reg_("{evalNameString}");
+
+}} // namespace Relations
+}} // namespace {namespace}
+}} // namespace Amanzi
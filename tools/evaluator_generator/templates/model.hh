@@ -15,45 +15,32 @@
 
 */
 
-#ifndef AMANZI_{ namespaceCaps } _{ evalNameCaps } _MODEL_HH_
-#define AMANZI_ { namespaceCaps } _{ evalNameCaps } _MODEL_HH_
-
-namespace Amanzi {
-{
-  namespace {namespace}
-  {
-    {
-      namespace Relations {
-      {
-        class {
-          evalClassName
-        } Model{ {
-
-          public : explicit { evalClassName } Model(Teuchos::ParameterList & plist);
-
-        {
-          modelMethodDeclaration
-        }
-
-        {
-          modelDerivDeclarationList
-        }
-
-       protected:
-        void InitializeFromPlist_(Teuchos::ParameterList & plist);
-
-       protected:
-        {
-          paramDeclarationList
-        }
-
-      }  // namespace Relations
-      }; // namespace Relations
-    }
-  } // namespace }
-} // namespace Amanzi
-} // namespace Amanzi
-}
-} //namespace
+#ifndef AMANZI_{namespaceCaps}_{evalNameCaps}_MODEL_HH_
+#define AMANZI_{namespaceCaps}_{evalNameCaps}_MODEL_HH_
+
+namespace Amanzi {{
+namespace {namespace} {{
+namespace Relations {{
+
+class {evalClassName}Model {{
+ public:
+  explicit {evalClassName}Model(Teuchos::ParameterList& plist);
+
+{modelMethodDeclaration}
+
+{modelDerivDeclarationList}
+
+{modelBatchedDeclarationList}
+
+ protected:
+  void InitializeFromPlist_(Teuchos::ParameterList& plist);
+
+ protected:
+{paramDeclarationList}
+}};
+
+}} // namespace Relations
+}} // namespace {namespace}
+}} // namespace Amanzi
 
 #endif
@@ -0,0 +1 @@
+  void {myMethod}(int n, {myBatchedDeclarationArgs}, double* result) const;
@@ -0,0 +1,5 @@
+void
+{evalClassName}Model::{myMethod}(int n, {myBatchedDeclarationArgs}, double* result) const
+{{
+  for (int i = 0; i != n; ++i) result[i] = {myMethod}({myBatchedCallArgs});
+}}
@@ -0,0 +1,6 @@
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void {myMethod}AndDerivatives(int n,
+                                {myBatchedDeclarationArgs},
+                                double* result,
+                                {myFusedDerivDeclarationArgs}) const;
@@ -0,0 +1,10 @@
+void
+{evalClassName}Model::{myMethod}AndDerivatives(int n,
+                                               {myBatchedDeclarationArgs},
+                                               double* result,
+                                               {myFusedDerivDeclarationArgs}) const
+{{
+  for (int i = 0; i != n; ++i) {{
+{myFusedImplementation}
+  }}
+}}
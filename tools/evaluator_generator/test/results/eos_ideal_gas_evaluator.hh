@@ -11,26 +11,17 @@
   The ideal gas equation of state evaluator is an algebraic evaluator of a given model.
 
   Generated via evaluator_generator with:
-    modelInitializeParamsList =   cv_ = plist.get<double>("heat capacity");
-    evalName = eos_ideal_gas
-    modelMethodDeclaration =   double Density(double temp, double pres) const;
-    namespaceCaps = GENERAL
-    namespace = General
-    paramDeclarationList =   double cv_;
-    evalNameCaps = EOS_IDEAL_GAS
-    myMethodArgs = temp_v[0][i], pres_v[0][i]
-    myKeyMethod = Density
-    myKeyFirst = density
-    evalNameString = ideal gas equation of state
-    myMethodDeclarationArgs = double temp, double pres
-    evalClassName = EosIdealGas
-    myKey = density
+
 
 */
 
 #ifndef AMANZI_GENERAL_EOS_IDEAL_GAS_EVALUATOR_HH_
 #define AMANZI_GENERAL_EOS_IDEAL_GAS_EVALUATOR_HH_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -43,27 +34,32 @@ class EosIdealGasModel;
 class EosIdealGasEvaluator : public EvaluatorSecondaryMonotypeCV {
  public:
   explicit EosIdealGasEvaluator(Teuchos::ParameterList& plist);
-  EosIdealGasEvaluator(const EosIdealGasEvaluator& other);
-
-  virtual Teuchos::RCP<Evaluator> Clone() const;
-
-  // Required methods from EvaluatorSecondaryMonotypeCV
-  virtual void
-  EvaluateField_(const Teuchos::Ptr<State>& S, const Teuchos::Ptr<CompositeVector>& result);
-  virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
-                                               Key wrt_key,
-                                               const Teuchos::Ptr<CompositeVector>& result);
+  EosIdealGasEvaluator(const EosIdealGasEvaluator& other) = default;
+  virtual Teuchos::RCP<Evaluator> Clone() const override;
 
   Teuchos::RCP<EosIdealGasModel> get_model() { return model_; }
 
  protected:
+  // Required methods from EvaluatorSecondaryMonotypeCV
+  virtual void Evaluate_(const State& S, const std::vector<CompositeVector*>& result) override;
+  virtual void EvaluatePartialDerivative_(const State& S,
+                                          const Key& wrt_key,
+                                          const Tag& wrt_tag,
+                                          const std::vector<CompositeVector*>& result) override;
+
   void InitializeFromPlist_();
 
+ protected:
   Key temp_key_;
   Key pres_key_;
 
   Teuchos::RCP<EosIdealGasModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, EosIdealGasEvaluator> reg_;
 };
@@ -72,4 +68,4 @@ class EosIdealGasEvaluator : public EvaluatorSecondaryMonotypeCV {
 } // namespace General
 } // namespace Amanzi
 
-#endif
+#endif
\ No newline at end of file
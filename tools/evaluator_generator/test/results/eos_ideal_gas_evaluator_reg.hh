@@ -18,4 +18,4 @@ Utils::RegisteredFactory<Evaluator, EosIdealGasEvaluator>
 
 } // namespace Relations
 } // namespace General
-} // namespace Amanzi
+} // namespace Amanzi
\ No newline at end of file
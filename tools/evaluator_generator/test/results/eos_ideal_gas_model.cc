@@ -11,20 +11,7 @@
   The ideal gas equation of state model is an algebraic model with dependencies.
 
   Generated via evaluator_generator with:
-    modelInitializeParamsList =   cv_ = plist.get<double>("heat capacity");
-    evalName = eos_ideal_gas
-    modelMethodDeclaration =   double Density(double temp, double pres) const;
-    namespaceCaps = GENERAL
-    namespace = General
-    paramDeclarationList =   double cv_;
-    evalNameCaps = EOS_IDEAL_GAS
-    myMethodArgs = temp_v[0][i], pres_v[0][i]
-    myKeyMethod = Density
-    myKeyFirst = density
-    evalNameString = ideal gas equation of state
-    myMethodDeclarationArgs = double temp, double pres
-    evalClassName = EosIdealGas
-    myKey = density
+
 
 */
 
@@ -55,21 +42,55 @@ EosIdealGasModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 double
 EosIdealGasModel::Density(double temp, double pres) const
 {
-  return AMANZI_ASSERT(False);
+  AMANZI_ASSERT(false);
+  return 0.;
 }
 
 double
 EosIdealGasModel::DDensityDTemperature(double temp, double pres) const
 {
-  return AMANZI_ASSERT(False);
+  AMANZI_ASSERT(false);
+  return 0.;
 }
 
 double
 EosIdealGasModel::DDensityDPressure(double temp, double pres) const
 {
-  return AMANZI_ASSERT(False);
+  AMANZI_ASSERT(false);
+  return 0.;
+}
+
+
+// batched methods
+void
+EosIdealGasModel::Density(int n, const double* temp, const double* pres, double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = Density(temp[i], pres[i]);
+}
+
+void
+EosIdealGasModel::DDensityDTemperature(int n, const double* temp, const double* pres, double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DDensityDTemperature(temp[i], pres[i]);
+}
+
+void
+EosIdealGasModel::DDensityDPressure(int n, const double* temp, const double* pres, double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DDensityDPressure(temp[i], pres[i]);
+}
+
+void
+EosIdealGasModel::DensityAndDerivatives(int n,
+                                               const double* temp, const double* pres,
+                                               double* result,
+                                               double* dresult_dtemp, double* dresult_dpres) const
+{
+  for (int i = 0; i != n; ++i) {
+    AMANZI_ASSERT(false);
+  }
 }
 
 } // namespace Relations
 } // namespace General
-} // namespace Amanzi
+} // namespace Amanzi
\ No newline at end of file
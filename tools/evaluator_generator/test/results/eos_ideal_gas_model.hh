@@ -11,20 +11,7 @@
   The ideal gas equation of state model is an algebraic model with dependencies.
 
   Generated via evaluator_generator with:
-    modelInitializeParamsList =   cv_ = plist.get<double>("heat capacity");
-    evalName = eos_ideal_gas
-    modelMethodDeclaration =   double Density(double temp, double pres) const;
-    namespaceCaps = GENERAL
-    namespace = General
-    paramDeclarationList =   double cv_;
-    evalNameCaps = EOS_IDEAL_GAS
-    myMethodArgs = temp_v[0][i], pres_v[0][i]
-    myKeyMethod = Density
-    myKeyFirst = density
-    evalNameString = ideal gas equation of state
-    myMethodDeclarationArgs = double temp, double pres
-    evalClassName = EosIdealGas
-    myKey = density
+
 
 */
 
@@ -44,6 +31,17 @@ class EosIdealGasModel {
   double DDensityDTemperature(double temp, double pres) const;
   double DDensityDPressure(double temp, double pres) const;
 
+  void Density(int n, const double* temp, const double* pres, double* result) const;
+  void DDensityDTemperature(int n, const double* temp, const double* pres, double* result) const;
+  void DDensityDPressure(int n, const double* temp, const double* pres, double* result) const;
+
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void DensityAndDerivatives(int n,
+                                const double* temp, const double* pres,
+                                double* result,
+                                double* dresult_dtemp, double* dresult_dpres) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
@@ -55,4 +53,4 @@ class EosIdealGasModel {
 } // namespace General
 } // namespace Amanzi
 
-#endif
+#endif
\ No newline at end of file
@@ -13,6 +13,8 @@
   Generated via evaluator_generator.
 */
 
+#include <algorithm>
+
 #include "eos_ideal_gas_evaluator.hh"
 #include "eos_ideal_gas_model.hh"
 
@@ -30,15 +32,6 @@ EosIdealGasEvaluator::EosIdealGasEvaluator(Teuchos::ParameterList& plist)
 }
 
 
-// Copy constructor
-EosIdealGasEvaluator::EosIdealGasEvaluator(const EosIdealGasEvaluator& other)
-  : EvaluatorSecondaryMonotypeCV(other),
-    temp_key_(other.temp_key_),
-    pres_key_(other.pres_key_),
-    model_(other.model_)
-{}
-
-
 // Virtual copy constructor
 Teuchos::RCP<Evaluator>
 EosIdealGasEvaluator::Clone() const
@@ -53,77 +46,82 @@ EosIdealGasEvaluator::InitializeFromPlist_()
 {
   // Set up my dependencies
   // - defaults to prefixed via domain
-  Key domain_name = Keys::getDomainPrefix(my_key_);
+  Key domain_name = Keys::getDomain(my_keys_.front().first);
+  Tag tag = my_keys_.front().second;
 
   // - pull Keys from plist
   // dependency: temperature
-  temp_key_ = plist_.get<std::string>("temperature key", domain_name + "temperature");
-  dependencies_.insert(temp_key_);
+  temp_key_ = Keys::readKey(plist_, domain_name, "temperature", "temperature");
+  dependencies_.insert(KeyTag{ temp_key_, tag });
 
   // dependency: pressure
-  pres_key_ = plist_.get<std::string>("pressure key", domain_name + "pressure");
-  dependencies_.insert(pres_key_);
+  pres_key_ = Keys::readKey(plist_, domain_name, "pressure", "pressure");
+  dependencies_.insert(KeyTag{ pres_key_, tag });
 }
 
 
 void
-EosIdealGasEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
-                                     const Teuchos::Ptr<CompositeVector>& result)
+EosIdealGasEvaluator::Evaluate_(const State& S, const std::vector<CompositeVector*>& result)
 {
-  Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
-  Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
+  derivs_valid_ = false;
+  Tag tag = my_keys_.front().second;
+  Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
+  Teuchos::RCP<const CompositeVector> pres = S.GetPtr<CompositeVector>(pres_key_, tag);
 
-  for (CompositeVector::name_iterator comp = result->begin(); comp != result->end(); ++comp) {
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
     const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
     const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp, false);
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
 
-    int ncomp = result->size(*comp, false);
-    for (int i = 0; i != ncomp; ++i) {
-      result_v[0][i] = model_->Density(temp_v[0][i], pres_v[0][i]);
-    }
+    int ncomp = result[0]->size(*comp, false);
+    model_->Density(ncomp, temp_v[0], pres_v[0], result_v[0]);
   }
 }
 
 
 void
-EosIdealGasEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
-                                                      Key wrt_key,
-                                                      const Teuchos::Ptr<CompositeVector>& result)
+EosIdealGasEvaluator::EvaluatePartialDerivative_(const State& S,
+                                                     const Key& wrt_key,
+                                                     const Tag& wrt_tag,
+                                                     const std::vector<CompositeVector*>& result)
 {
-  Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
-  Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
-
-  if (wrt_key == temp_key_) {
-    for (CompositeVector::name_iterator comp = result->begin(); comp != result->end(); ++comp) {
+  Tag tag = my_keys_.front().second;
+  Teuchos::RCP<const CompositeVector> temp = S.GetPtr<CompositeVector>(temp_key_, tag);
+  Teuchos::RCP<const CompositeVector> pres = S.GetPtr<CompositeVector>(pres_key_, tag);
+
+  // the fused kernel finds all derivatives in one pass over the dependencies
+  if (!derivs_valid_) {
+    for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end();
+         ++comp) {
       const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
       const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp, false);
 
-      int ncomp = result->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDensityDTemperature(temp_v[0][i], pres_v[0][i]);
-      }
+      int ncomp = result[0]->size(*comp, false);
+      auto& derivs = derivs_[*comp];
+      derivs.resize(2);
+      for (auto& deriv : derivs) deriv.resize(ncomp);
+      model_->DensityAndDerivatives(ncomp, temp_v[0], pres_v[0], nullptr, derivs[0].data(), derivs[1].data());
     }
+    derivs_valid_ = true;
+  }
 
+  int wrt_index = -1;
+  if (wrt_key == temp_key_) {
+    wrt_index = 0;
   } else if (wrt_key == pres_key_) {
-    for (CompositeVector::name_iterator comp = result->begin(); comp != result->end(); ++comp) {
-      const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp, false);
-
-      int ncomp = result->size(*comp, false);
-      for (int i = 0; i != ncomp; ++i) {
-        result_v[0][i] = model_->DDensityDPressure(temp_v[0][i], pres_v[0][i]);
-      }
-    }
-
+    wrt_index = 1;
   } else {
     AMANZI_ASSERT(0);
   }
+
+  for (CompositeVector::name_iterator comp = result[0]->begin(); comp != result[0]->end(); ++comp) {
+    Epetra_MultiVector& result_v = *result[0]->ViewComponent(*comp, false);
+    const std::vector<double>& deriv = derivs_.at(*comp)[wrt_index];
+    std::copy(deriv.begin(), deriv.end(), result_v[0]);
+  }
 }
 
 
 } // namespace Relations
 } // namespace General
-} // namespace Amanzi
+} // namespace Amanzi
\ No newline at end of file
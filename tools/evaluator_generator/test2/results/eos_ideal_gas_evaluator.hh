@@ -18,6 +18,10 @@
 #ifndef AMANZI_GENERAL_EOS_IDEAL_GAS_EVALUATOR_HH_
 #define AMANZI_GENERAL_EOS_IDEAL_GAS_EVALUATOR_HH_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Factory.hh"
 #include "EvaluatorSecondaryMonotype.hh"
 
@@ -30,27 +34,32 @@ class EosIdealGasModel;
 class EosIdealGasEvaluator : public EvaluatorSecondaryMonotypeCV {
  public:
   explicit EosIdealGasEvaluator(Teuchos::ParameterList& plist);
-  EosIdealGasEvaluator(const EosIdealGasEvaluator& other);
-
-  virtual Teuchos::RCP<Evaluator> Clone() const;
-
-  // Required methods from EvaluatorSecondaryMonotypeCV
-  virtual void
-  EvaluateField_(const Teuchos::Ptr<State>& S, const Teuchos::Ptr<CompositeVector>& result);
-  virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
-                                               Key wrt_key,
-                                               const Teuchos::Ptr<CompositeVector>& result);
+  EosIdealGasEvaluator(const EosIdealGasEvaluator& other) = default;
+  virtual Teuchos::RCP<Evaluator> Clone() const override;
 
   Teuchos::RCP<EosIdealGasModel> get_model() { return model_; }
 
  protected:
+  // Required methods from EvaluatorSecondaryMonotypeCV
+  virtual void Evaluate_(const State& S, const std::vector<CompositeVector*>& result) override;
+  virtual void EvaluatePartialDerivative_(const State& S,
+                                          const Key& wrt_key,
+                                          const Tag& wrt_tag,
+                                          const std::vector<CompositeVector*>& result) override;
+
   void InitializeFromPlist_();
 
+ protected:
   Key temp_key_;
   Key pres_key_;
 
   Teuchos::RCP<EosIdealGasModel> model_;
 
+  // Derivatives with respect to each dependency, in order, by component.  All
+  // are computed together on the first request after an evaluation.
+  std::map<std::string, std::vector<std::vector<double>>> derivs_;
+  bool derivs_valid_ = false;
+
  private:
   static Utils::RegisteredFactory<Evaluator, EosIdealGasEvaluator> reg_;
 };
@@ -59,4 +68,4 @@ class EosIdealGasEvaluator : public EvaluatorSecondaryMonotypeCV {
 } // namespace General
 } // namespace Amanzi
 
-#endif
+#endif
\ No newline at end of file
@@ -43,7 +43,7 @@ EosIdealGasModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 double
 EosIdealGasModel::Density(double temp, double pres) const
 {
-  return cv_ * (-T0_ + temp);
+  return cv_*(-T0_ + temp);
 }
 
 double
@@ -58,6 +58,39 @@ EosIdealGasModel::DDensityDPressure(double temp, double pres) const
   return 0;
 }
 
+
+// batched methods
+void
+EosIdealGasModel::Density(int n, const double* temp, const double* pres, double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = Density(temp[i], pres[i]);
+}
+
+void
+EosIdealGasModel::DDensityDTemperature(int n, const double* temp, const double* pres, double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DDensityDTemperature(temp[i], pres[i]);
+}
+
+void
+EosIdealGasModel::DDensityDPressure(int n, const double* temp, const double* pres, double* result) const
+{
+  for (int i = 0; i != n; ++i) result[i] = DDensityDPressure(temp[i], pres[i]);
+}
+
+void
+EosIdealGasModel::DensityAndDerivatives(int n,
+                                               const double* temp, const double* pres,
+                                               double* result,
+                                               double* dresult_dtemp, double* dresult_dpres) const
+{
+  for (int i = 0; i != n; ++i) {
+    if (result) result[i] = cv_*(-T0_ + temp[i]);
+    if (dresult_dtemp) dresult_dtemp[i] = cv_;
+    if (dresult_dpres) dresult_dpres[i] = 0;
+  }
+}
+
 } // namespace Relations
 } // namespace General
-} // namespace Amanzi
+} // namespace Amanzi
\ No newline at end of file
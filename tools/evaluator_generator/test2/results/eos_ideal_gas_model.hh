@@ -31,6 +31,17 @@ class EosIdealGasModel {
   double DDensityDTemperature(double temp, double pres) const;
   double DDensityDPressure(double temp, double pres) const;
 
+  void Density(int n, const double* temp, const double* pres, double* result) const;
+  void DDensityDTemperature(int n, const double* temp, const double* pres, double* result) const;
+  void DDensityDPressure(int n, const double* temp, const double* pres, double* result) const;
+
+  // Value and derivatives in one pass, sharing subexpressions; any of the
+  // outputs may be null.
+  void DensityAndDerivatives(int n,
+                                const double* temp, const double* pres,
+                                double* result,
+                                double* dresult_dtemp, double* dresult_dpres) const;
+
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
 
@@ -43,4 +54,4 @@ class EosIdealGasModel {
 } // namespace General
 } // namespace Amanzi
 
-#endif
+#endif
\ No newline at end of file
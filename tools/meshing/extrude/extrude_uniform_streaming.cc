@@ -0,0 +1,58 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Same as extrude_uniform, but generates and writes the mesh one layer at a
+// time, so that the full 3D mesh is never held in memory.  Takes an optional
+// number of threads used to generate layers, and an optional output file.
+#include <cstdlib>
+
+#include "Mesh3DStream.hh"
+#include "writeMesh3D.hh"
+#include "readMesh2D.hh"
+
+
+int
+main(int argc, char** argv)
+{
+  using namespace Amanzi::AmanziGeometry;
+
+  std::string mesh_in = "Mesh.txt";
+  int n_threads = argc > 1 ? std::atoi(argv[1]) : 1;
+  std::string mesh_out = argc > 2 ? argv[2] : "Mesh3D_2mSoil.exo";
+
+  std::vector<double> ref_soil_mlay_dz = { 0.02, 0.03, 0.05, 0.15, 0.25, 0.5, 1.0 };
+  std::vector<double> ref_bedrock_mlay_dz = { 10., 10. };
+
+  int nsoil_lay = ref_soil_mlay_dz.size();
+  int nbedrock_lay = ref_bedrock_mlay_dz.size();
+
+  std::cout << "Extruding: " << mesh_in << " and writing to: " << mesh_out << std::endl;
+
+  std::vector<int> soil_type;
+  std::vector<int> bedrock_type;
+  std::vector<double> depths;
+
+  auto m = readMesh2D_text(mesh_in, soil_type, bedrock_type, depths, 630497, 4.04083e+06);
+
+  Mesh3DStream m3(&m, n_threads);
+  for (int ilay = 0; ilay != nsoil_lay; ++ilay) { m3.extrude(ref_soil_mlay_dz[ilay], soil_type); }
+  for (int ilay = 0; ilay != nbedrock_lay; ++ilay) {
+    m3.extrude(ref_bedrock_mlay_dz[ilay], bedrock_type);
+  }
+
+  m3.finish();
+
+  std::cout << "NNodes on the surf = " << m.coords.size() << std::endl;
+  std::cout << "Ncells on the surf = " << m.cell2node.size() << std::endl;
+  std::cout << "NNodes on 3D = " << m3.nnodes << std::endl;
+  std::cout << "Ncells on 3D = " << m3.ncells << std::endl;
+
+  writeMesh3D_exodus(m3, mesh_out);
+  return 0;
+}
@@ -0,0 +1,524 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+#include <set>
+#include <algorithm>
+#include <numeric>
+#include <fstream>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "Mesh2D.hh"
+#include "Mesh3DStream.hh"
+
+namespace Amanzi {
+namespace AmanziGeometry {
+
+Mesh3DStream::Mesh3DStream(const Mesh2D* const m_, int n_threads_)
+  : m(m_),
+    n_threads(std::max(n_threads_, 1)),
+    nnodes(0),
+    nfaces(0),
+    nface_nodes(0),
+    ncells(0),
+    nsides(0),
+    finished_(false)
+{}
+
+
+void
+Mesh3DStream::extrude(double dz, const std::vector<int>& cell_set, bool squash_zero_edges)
+{
+  AMANZI_ASSERT(!finished_);
+  AMANZI_ASSERT(cell_set.size() == m->cell2node.size());
+
+  Mesh3DLayer layer;
+  layer.dz_uniform = dz;
+  layer.block_id_uniform = -1;
+  if (!layers.empty() && layers.back().block_ids && *layers.back().block_ids == cell_set) {
+    layer.block_ids = layers.back().block_ids;
+  } else {
+    layer.block_ids = std::make_shared<const std::vector<int>>(cell_set);
+  }
+  layer.squash_zero_edges = squash_zero_edges;
+  layers.emplace_back(std::move(layer));
+}
+
+void
+Mesh3DStream::extrude(const std::vector<double>& dzs, int my_cell_set, bool squash_zero_edges)
+{
+  AMANZI_ASSERT(!finished_);
+  AMANZI_ASSERT(dzs.size() == m->coords.size());
+
+  Mesh3DLayer layer;
+  layer.dz_uniform = 0.;
+  if (!layers.empty() && layers.back().dzs && *layers.back().dzs == dzs) {
+    layer.dzs = layers.back().dzs;
+  } else {
+    layer.dzs = std::make_shared<const std::vector<double>>(dzs);
+  }
+  layer.block_id_uniform = my_cell_set;
+  layer.squash_zero_edges = squash_zero_edges;
+  layers.emplace_back(std::move(layer));
+}
+
+void
+Mesh3DStream::extrude(double dz, int my_cell_set, bool squash_zero_edges)
+{
+  AMANZI_ASSERT(!finished_);
+
+  Mesh3DLayer layer;
+  layer.dz_uniform = dz;
+  layer.block_id_uniform = my_cell_set;
+  layer.squash_zero_edges = squash_zero_edges;
+  layers.emplace_back(std::move(layer));
+}
+
+void
+Mesh3DStream::extrude(const std::vector<double>& dzs,
+                      const std::vector<int>& cell_set,
+                      bool squash_zero_edges)
+{
+  AMANZI_ASSERT(!finished_);
+  AMANZI_ASSERT(dzs.size() == m->coords.size());
+  AMANZI_ASSERT(cell_set.size() == m->cell2node.size());
+
+  Mesh3DLayer layer;
+  layer.dz_uniform = 0.;
+  if (!layers.empty() && layers.back().dzs && *layers.back().dzs == dzs) {
+    layer.dzs = layers.back().dzs;
+  } else {
+    layer.dzs = std::make_shared<const std::vector<double>>(dzs);
+  }
+  layer.block_id_uniform = -1;
+  if (!layers.empty() && layers.back().block_ids && *layers.back().block_ids == cell_set) {
+    layer.block_ids = layers.back().block_ids;
+  } else {
+    layer.block_ids = std::make_shared<const std::vector<int>>(cell_set);
+  }
+  layer.squash_zero_edges = squash_zero_edges;
+  layers.emplace_back(std::move(layer));
+}
+
+
+void
+Mesh3DStream::finish()
+{
+  AMANZI_ASSERT(!finished_);
+
+  // collect the block ids
+  std::set<int> set_ids;
+  const std::vector<int>* last_ids = nullptr;
+  for (const auto& layer : layers) {
+    if (!layer.block_ids) {
+      set_ids.insert(layer.block_id_uniform);
+    } else if (layer.block_ids.get() != last_ids) {
+      set_ids.insert(layer.block_ids->begin(), layer.block_ids->end());
+      last_ids = layer.block_ids.get();
+    }
+  }
+  block_ids.assign(set_ids.begin(), set_ids.end());
+  int n_blocks = block_ids.size();
+
+  // count the mesh, layer by layer, tracking the top and bottom cell of each
+  // column as (block ordinal, index within block)
+  cells_in_col.assign(m->ncells, 0);
+  last_layer.assign(m->ncells, -1);
+  std::vector<std::pair<int, int>> top_cells(m->ncells, std::make_pair(-1, -1));
+  std::vector<std::pair<int, int>> bottom_cells(m->ncells, std::make_pair(-1, -1));
+
+  nnodes = m->nnodes;
+  nfaces = m->ncells;
+  nface_nodes = 0;
+  for (const auto& nodes : m->cell2node) nface_nodes += nodes.size();
+  block_ncells.assign(n_blocks, 0);
+  block_ncell_faces.assign(n_blocks, 0);
+  nsides = 0;
+
+  Frame f, next;
+  Counts counts;
+  std::vector<int> block_local(n_blocks);
+  initialFrame_(f);
+  for (int k = 0; k != layers.size(); ++k) {
+    count_(f, counts);
+
+    std::fill(block_local.begin(), block_local.end(), 0);
+    for (int c = 0; c != m->ncells; ++c) {
+      if (f.dn_faces[c] != f.up_faces[c]) {
+        int b = blockOrdinal_(layers[k].block_id(c));
+        auto my_c = std::make_pair(b, f.block_cell_begin[b] + block_local[b]++);
+        if (top_cells[c].first < 0) top_cells[c] = my_c;
+        bottom_cells[c] = my_c;
+        cells_in_col[c]++;
+        last_layer[c] = k;
+      }
+    }
+
+    nnodes += counts.nnodes;
+    nfaces += counts.nfaces;
+    nface_nodes += counts.nface_nodes;
+    for (int b = 0; b != n_blocks; ++b) {
+      block_ncells[b] += counts.block_ncells[b];
+      block_ncell_faces[b] += counts.block_ncell_faces[b];
+    }
+    nsides += counts.nsides;
+
+    nextFrame_(f, counts, next);
+    std::swap(f, next);
+  }
+
+  block_offsets_.assign(n_blocks, 0);
+  for (int b = 1; b < n_blocks; ++b) block_offsets_[b] = block_offsets_[b - 1] + block_ncells[b - 1];
+  ncells = std::accumulate(block_ncells.begin(), block_ncells.end(), 0);
+
+  auto cell_id = [this](const std::pair<int, int>& bc) {
+    return block_offsets_[bc.first] + bc.second;
+  };
+
+  // the "bottom", "surface", and (still empty) "sides" side sets
+  side_sets.clear();
+  side_sets_id.clear();
+  side_sets.resize(3);
+  for (int c = 0; c != m->ncells; ++c) {
+    if (cells_in_col[c] > 0) {
+      side_sets[0].first.push_back(cell_id(bottom_cells[c]));
+      side_sets[0].second.push_back(1);
+      side_sets[1].first.push_back(cell_id(top_cells[c]));
+      side_sets[1].second.push_back(0);
+    }
+  }
+  side_sets_id = { 1, 2, 3 };
+
+  // move the 2d cell sets to face sets on the surface
+  std::set<int> cell_set_ids;
+  for (auto& part : m->cell_sets) { cell_set_ids.insert(part.begin(), part.end()); }
+
+  for (int sid : cell_set_ids) {
+    std::vector<int> set_cells;
+    for (auto& part : m->cell_sets) {
+      for (int c = 0; c != part.size(); ++c) {
+        if (part[c] == sid && cells_in_col[c] > 0) { set_cells.push_back(cell_id(top_cells[c])); }
+      }
+    }
+    std::vector<int> set_faces(set_cells.size(), 0);
+    side_sets.emplace_back(std::make_pair(std::move(set_cells), std::move(set_faces)));
+    side_sets_id.push_back(sid);
+  }
+
+  std::ofstream fid;
+  fid.open("col_counts.txt");
+  for (auto c : cells_in_col) fid << c << std::endl;
+  fid.close();
+
+  finished_ = true;
+  std::cout << "POST-Extruding: " << layers.size() << " layers, " << ncells << " cells and "
+            << nfaces << " faces." << std::endl;
+}
+
+
+void
+Mesh3DStream::generate(const std::function<void(Mesh3DChunk&)>& consumer) const
+{
+  AMANZI_ASSERT(finished_);
+
+  Mesh3DChunk top;
+  buildTop_(top);
+  consumer(top);
+
+  // layers are generated in windows of up to n_threads layers, each built by
+  // its own thread, then consumed in order
+  int n_layers = layers.size();
+  int n_window = std::max(std::min(n_threads, n_layers), 1);
+  std::vector<Frame> frames(n_window);
+  std::vector<Mesh3DChunk> chunks(n_window);
+  std::vector<std::vector<int>> side_face_ids(n_window, std::vector<int>(m->nfaces, -1));
+
+  Frame next;
+  Counts counts;
+  initialFrame_(next);
+
+  for (int k = 0; k < n_layers; k += n_window) {
+    int n = std::min(n_window, n_layers - k);
+
+    // the entity offsets of each layer depend on the layers above it, so
+    // these are counted in order
+    for (int i = 0; i != n; ++i) {
+      frames[i] = next;
+      count_(frames[i], counts);
+      nextFrame_(frames[i], counts, next);
+    }
+
+    std::exception_ptr eptr;
+    std::mutex eptr_mutex;
+    auto worker = [&](int i) {
+      try {
+        build_(frames[i], chunks[i], side_face_ids[i]);
+      } catch (...) {
+        // exceptions cannot cross the thread boundary, rethrow below
+        std::lock_guard<std::mutex> lock(eptr_mutex);
+        if (!eptr) eptr = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(n - 1);
+    for (int i = 1; i < n; ++i) pool.emplace_back(worker, i);
+    worker(0);
+    for (auto& th : pool) th.join();
+
+    if (eptr) std::rethrow_exception(eptr);
+
+    for (int i = 0; i != n; ++i) consumer(chunks[i]);
+  }
+}
+
+
+int
+Mesh3DStream::blockOrdinal_(int block_id) const
+{
+  auto b = std::lower_bound(block_ids.begin(), block_ids.end(), block_id);
+  AMANZI_ASSERT(b != block_ids.end() && *b == block_id);
+  return b - block_ids.begin();
+}
+
+
+void
+Mesh3DStream::initialFrame_(Frame& f) const
+{
+  f.layer = 0;
+  f.up_nodes.resize(m->nnodes);
+  std::iota(f.up_nodes.begin(), f.up_nodes.end(), 0);
+  f.dn_nodes = f.up_nodes;
+  f.up_faces.resize(m->ncells);
+  std::iota(f.up_faces.begin(), f.up_faces.end(), 0);
+  f.dn_faces = f.up_faces;
+  f.z_up.resize(m->nnodes);
+  for (int n = 0; n != m->nnodes; ++n) f.z_up[n] = m->coords[n][2];
+  f.node_begin = m->nnodes;
+  f.face_begin = m->ncells;
+  f.block_cell_begin.assign(block_ids.size(), 0);
+}
+
+
+void
+Mesh3DStream::nextFrame_(const Frame& f, const Counts& counts, Frame& next) const
+{
+  const auto& layer = layers[f.layer];
+
+  next.layer = f.layer + 1;
+  next.up_nodes = f.dn_nodes;
+  next.dn_nodes = f.dn_nodes;
+  next.up_faces = f.dn_faces;
+  next.dn_faces = f.dn_faces;
+  next.z_up = f.z_up;
+  for (int n = 0; n != m->nnodes; ++n) {
+    if (f.dn_nodes[n] != f.up_nodes[n]) next.z_up[n] -= layer.dz(n);
+  }
+  next.node_begin = f.node_begin + counts.nnodes;
+  next.face_begin = f.face_begin + counts.nfaces;
+  next.block_cell_begin = f.block_cell_begin;
+  for (int b = 0; b != block_ids.size(); ++b) next.block_cell_begin[b] += counts.block_ncells[b];
+}
+
+
+// Numbers the new nodes and bottom faces of the layer, exactly as
+// Mesh3D::extrude() does, and counts what the layer creates.  A side face is
+// created, by the first cell containing it, whenever either of its nodes
+// moves, and then both cells containing it are in the layer.
+void
+Mesh3DStream::count_(Frame& f, Counts& counts) const
+{
+  const auto& layer = layers[f.layer];
+  int n_blocks = block_ids.size();
+
+  int node = f.node_begin;
+  for (int n = 0; n != m->nnodes; ++n) {
+    if (!layer.squash_zero_edges || layer.dz(n) > 0.) {
+      f.dn_nodes[n] = node++;
+    } else {
+      f.dn_nodes[n] = f.up_nodes[n];
+    }
+  }
+  counts.nnodes = node - f.node_begin;
+
+  auto node_differs = [&f](int n) { return f.dn_nodes[n] != f.up_nodes[n]; };
+
+  int face = f.face_begin;
+  counts.nface_nodes = 0;
+  counts.block_ncells.assign(n_blocks, 0);
+  counts.block_ncell_faces.assign(n_blocks, 0);
+  counts.nsides = 0;
+  for (int c = 0; c != m->ncells; ++c) {
+    if (std::any_of(m->cell2node[c].begin(), m->cell2node[c].end(), node_differs)) {
+      f.dn_faces[c] = face++;
+      counts.nface_nodes += m->cell2node[c].size();
+
+      int b = blockOrdinal_(layer.block_id(c));
+      counts.block_ncells[b]++;
+      int n_cell_faces = 2;
+      for (auto sf : m->cell2face[c]) {
+        bool differs0 = node_differs(m->face2node[sf][0]);
+        bool differs1 = node_differs(m->face2node[sf][1]);
+        if (differs0 || differs1) {
+          n_cell_faces++;
+          if (m->face_cell_when_created[sf] == c) {
+            face++;
+            counts.nface_nodes += 2 + differs0 + differs1;
+            if (m->side_face_counts[sf] == 1) counts.nsides++;
+          }
+        }
+      }
+      counts.block_ncell_faces[b] += n_cell_faces;
+    } else {
+      f.dn_faces[c] = f.up_faces[c];
+    }
+  }
+  counts.nfaces = face - f.face_begin;
+}
+
+
+void
+Mesh3DStream::buildTop_(Mesh3DChunk& chunk) const
+{
+  int n_blocks = block_ids.size();
+  chunk.layer = -1;
+
+  chunk.node_begin = 0;
+  chunk.x.resize(m->nnodes);
+  chunk.y.resize(m->nnodes);
+  chunk.z.resize(m->nnodes);
+  for (int n = 0; n != m->nnodes; ++n) {
+    chunk.x[n] = m->coords[n][0];
+    chunk.y[n] = m->coords[n][1];
+    chunk.z[n] = m->coords[n][2];
+  }
+
+  // a column with no cells keeps its top face as its bottom face, which is
+  // flipped like any other
+  chunk.face_begin = 0;
+  chunk.face_counts.clear();
+  chunk.face_nodes.clear();
+  for (int c = 0; c != m->ncells; ++c) {
+    const auto& nodes = m->cell2node[c];
+    chunk.face_counts.push_back(nodes.size());
+    if (cells_in_col[c] > 0) {
+      chunk.face_nodes.insert(chunk.face_nodes.end(), nodes.begin(), nodes.end());
+    } else {
+      chunk.face_nodes.insert(chunk.face_nodes.end(), nodes.rbegin(), nodes.rend());
+    }
+  }
+
+  chunk.block_cell_begin.assign(n_blocks, 0);
+  chunk.block_cell_counts.assign(n_blocks, std::vector<int>());
+  chunk.block_cell_faces.assign(n_blocks, std::vector<int>());
+  chunk.side_elems.clear();
+  chunk.side_faces.clear();
+}
+
+
+// Builds the entities of one layer.  Requires count_() to have been called
+// on the frame.  side_face_ids is workspace of size m->nfaces.
+void
+Mesh3DStream::build_(const Frame& f, Mesh3DChunk& chunk, std::vector<int>& side_face_ids) const
+{
+  const auto& layer = layers[f.layer];
+  int n_blocks = block_ids.size();
+  auto node_differs = [&f](int n) { return f.dn_nodes[n] != f.up_nodes[n]; };
+
+  chunk.layer = f.layer;
+
+  // new nodes
+  chunk.node_begin = f.node_begin;
+  chunk.x.clear();
+  chunk.y.clear();
+  chunk.z.clear();
+  for (int n = 0; n != m->nnodes; ++n) {
+    if (node_differs(n)) {
+      chunk.x.push_back(m->coords[n][0]);
+      chunk.y.push_back(m->coords[n][1]);
+      chunk.z.push_back(f.z_up[n] - layer.dz(n));
+    }
+  }
+
+  // new faces and cells
+  chunk.face_begin = f.face_begin;
+  chunk.face_counts.clear();
+  chunk.face_nodes.clear();
+  chunk.block_cell_begin = f.block_cell_begin;
+  chunk.block_cell_counts.resize(n_blocks);
+  chunk.block_cell_faces.resize(n_blocks);
+  for (int b = 0; b != n_blocks; ++b) {
+    chunk.block_cell_counts[b].clear();
+    chunk.block_cell_faces[b].clear();
+  }
+  chunk.side_elems.clear();
+  chunk.side_faces.clear();
+
+  int face = f.face_begin;
+  for (int c = 0; c != m->ncells; ++c) {
+    if (f.dn_faces[c] == f.up_faces[c]) continue;
+    AMANZI_ASSERT(f.dn_faces[c] == face);
+
+    // add the bottom face, flipped for outward orientation if it is the
+    // bottom of the column
+    const auto& nodes = m->cell2node[c];
+    chunk.face_counts.push_back(nodes.size());
+    if (last_layer[c] == f.layer) {
+      for (auto n = nodes.rbegin(); n != nodes.rend(); ++n) chunk.face_nodes.push_back(f.dn_nodes[*n]);
+    } else {
+      for (auto n : nodes) chunk.face_nodes.push_back(f.dn_nodes[n]);
+    }
+    face++;
+
+    // the cell contains the up, dn faces
+    int b = blockOrdinal_(layer.block_id(c));
+    auto& cell_counts = chunk.block_cell_counts[b];
+    auto& cell_faces = chunk.block_cell_faces[b];
+    int my_c = block_offsets_[b] + f.block_cell_begin[b] + cell_counts.size();
+    int n_cell_faces = 2;
+    cell_faces.push_back(f.up_faces[c]);
+    cell_faces.push_back(f.dn_faces[c]);
+
+    // add faces for the sides as needed
+    for (auto sf : m->cell2face[c]) {
+      int n0 = m->face2node[sf][0];
+      int n1 = m->face2node[sf][1];
+      if (node_differs(n0) || node_differs(n1)) {
+        if (m->face_cell_when_created[sf] == c) {
+          side_face_ids[sf] = face++;
+          chunk.face_nodes.push_back(f.up_nodes[n1]);
+          chunk.face_nodes.push_back(f.up_nodes[n0]);
+          int n_face_nodes = 2;
+          if (node_differs(n0)) {
+            chunk.face_nodes.push_back(f.dn_nodes[n0]);
+            n_face_nodes++;
+          }
+          if (node_differs(n1)) {
+            chunk.face_nodes.push_back(f.dn_nodes[n1]);
+            n_face_nodes++;
+          }
+          chunk.face_counts.push_back(n_face_nodes);
+
+          // check if this is a boundary side, and add it to the side_set if so
+          if (m->side_face_counts[sf] == 1) {
+            chunk.side_elems.push_back(my_c);
+            chunk.side_faces.push_back(n_cell_faces);
+          }
+        }
+        cell_faces.push_back(side_face_ids[sf]);
+        n_cell_faces++;
+      }
+    }
+    cell_counts.push_back(n_cell_faces);
+  }
+}
+
+} // namespace AmanziGeometry
+} // namespace Amanzi
@@ -0,0 +1,154 @@
+/*
+  Copyright 2010-202x held jointly by participating institutions.
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors:
+*/
+
+// Streaming extrusion of a 2D mesh.
+//
+// Mesh3D holds the full 3D mesh in memory before it is written.  Mesh3DStream
+// instead only records the description of each layer.  finish() counts the
+// mesh, then generate() builds it one layer at a time, as flat (CSR)
+// connectivity, handing each layer to a consumer (e.g. the Exodus writer) in
+// order.  Peak memory is a few layers rather than the full mesh.
+//
+// Layers are independent once the entity counts of the layers above them are
+// known, so generate() may build up to n_threads layers at once.
+//
+// Node, face, and side numbering are identical to Mesh3D followed by
+// Mesh3D::finish(); cells are numbered as writeMesh3D_exodus() numbers them,
+// i.e. by block in increasing block id, then in order of creation.
+
+#ifndef MESH_3D_STREAM_HH_
+#define MESH_3D_STREAM_HH_
+
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include "Point.hh"
+#include "Mesh2D.hh"
+
+
+namespace Amanzi {
+namespace AmanziGeometry {
+
+// Description of one extruded layer.  Vectors shared with the previous layer
+// are stored once.
+struct Mesh3DLayer {
+  double dz(int n) const { return dzs ? (*dzs)[n] : dz_uniform; }
+  int block_id(int c) const { return block_ids ? (*block_ids)[c] : block_id_uniform; }
+
+  double dz_uniform;
+  std::shared_ptr<const std::vector<double>> dzs;
+  int block_id_uniform;
+  std::shared_ptr<const std::vector<int>> block_ids;
+  bool squash_zero_edges;
+};
+
+
+// Entities created by one layer, in flat (CSR) form.  All ids are 0-based
+// and global.  Per-block data is indexed by block ordinal, see
+// Mesh3DStream::block_ids.
+struct Mesh3DChunk {
+  int layer; // -1 for the top surface
+
+  int node_begin;
+  std::vector<double> x, y, z;
+
+  int face_begin;
+  std::vector<int> face_counts; // number of nodes in each face
+  std::vector<int> face_nodes;
+
+  std::vector<int> block_cell_begin;              // index within the block
+  std::vector<std::vector<int>> block_cell_counts; // number of faces in each cell
+  std::vector<std::vector<int>> block_cell_faces;
+
+  // entries of the "sides" side set
+  std::vector<int> side_elems;
+  std::vector<int> side_faces;
+};
+
+
+struct Mesh3DStream {
+  Mesh3DStream(const Mesh2D* const m_, int n_threads_ = 1);
+
+  void extrude(double dz, const std::vector<int>& cell_set, bool squash_zero_edges = true);
+  void extrude(const std::vector<double>& dzs, int my_cell_set, bool squash_zero_edges = true);
+  void extrude(double dz, int my_cell_set, bool squash_zero_edges = true);
+  void extrude(const std::vector<double>& dzs,
+               const std::vector<int>& cell_set,
+               bool squash_zero_edges = true);
+
+  // Counts the mesh and forms the side sets.  Must be called after the last
+  // extrude() and before generate().
+  void finish();
+
+  // Builds the top surface and then each layer in order, passing each to the
+  // consumer.  The consumer may modify the chunk.
+  void generate(const std::function<void(Mesh3DChunk&)>& consumer) const;
+
+  const Mesh2D* const m;
+  int n_threads;
+  std::vector<Mesh3DLayer> layers;
+
+  // totals, valid after finish()
+  int nnodes;
+  int nfaces;
+  int nface_nodes;
+  int ncells;
+  std::vector<int> block_ids; // sorted
+  std::vector<int> block_ncells;
+  std::vector<int> block_ncell_faces;
+  int nsides;
+
+  // side sets, valid after finish().  The "sides" side set (id 3) is only
+  // sized here; its entries are generated with the layers.  Elements are
+  // 0-based global cell ids, faces 0-based indices into the cell.
+  std::vector<std::pair<std::vector<int>, std::vector<int>>> side_sets;
+  std::vector<int> side_sets_id;
+
+  // number of cells in, and last layer of, each column
+  std::vector<int> cells_in_col;
+  std::vector<int> last_layer;
+
+ private:
+  // State of the extrusion at the top of one layer.
+  struct Frame {
+    int layer;
+    std::vector<int> up_nodes, dn_nodes;
+    std::vector<int> up_faces, dn_faces;
+    std::vector<double> z_up;
+    int node_begin;
+    int face_begin;
+    std::vector<int> block_cell_begin;
+  };
+
+  // Entity counts of one layer.
+  struct Counts {
+    int nnodes;
+    int nfaces;
+    int nface_nodes;
+    std::vector<int> block_ncells;
+    std::vector<int> block_ncell_faces;
+    int nsides;
+  };
+
+  int blockOrdinal_(int block_id) const;
+  void initialFrame_(Frame& f) const;
+  void nextFrame_(const Frame& f, const Counts& counts, Frame& next) const;
+  void count_(Frame& f, Counts& counts) const;
+  void buildTop_(Mesh3DChunk& chunk) const;
+  void build_(const Frame& f, Mesh3DChunk& chunk, std::vector<int>& side_face_ids) const;
+
+  bool finished_;
+  std::vector<int> block_offsets_;
+};
+
+} // namespace AmanziGeometry
+} // namespace Amanzi
+
+#endif
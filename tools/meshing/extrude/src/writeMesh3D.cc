@@ -10,7 +10,9 @@
 #include <set>
 #include <vector>
 #include <algorithm>
+#include <string>
 #include "exodusII.h"
+#include "netcdf.h"
 
 #include "dbc.hh"
 
@@ -20,6 +22,30 @@
 namespace Amanzi {
 namespace AmanziGeometry {
 
+namespace {
+
+// Writes data to entries [start, start + data.size()) of a 1D variable.
+//
+// Exodus has no partial writers for the connectivity of polyhedral (NSIDED,
+// NFACED) blocks, so the streaming writer goes through netCDF, using Exodus'
+// variable names: "fbconn<i>" and "fbepecnt<i>" for face block i, and
+// "facconn<i>" and "ebepecnt<i>" for element block i, both 1-based in order
+// of definition.
+void
+putPartial(int fid, const std::string& varname, std::size_t start, const std::vector<int>& data)
+{
+  if (data.empty()) return;
+  int varid;
+  int ierr = nc_inq_varid(fid, varname.c_str(), &varid);
+  AMANZI_ASSERT(!ierr);
+  std::size_t count = data.size();
+  ierr = nc_put_vara_int(fid, varid, &start, &count, &data[0]);
+  AMANZI_ASSERT(!ierr);
+}
+
+} // namespace
+
+
 void
 writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
 {
@@ -188,5 +214,164 @@ writeMesh3D_exodus(const Mesh3D& m, const std::string& filename)
   std::cout << std::endl;
 }
 
+
+
+void
+writeMesh3D_exodus(const Mesh3DStream& m, const std::string& filename)
+{
+  // create the exodus file
+  int CPU_word_size = sizeof(float);
+  int IO_Word_size = 8;
+  int fid = ex_create(filename.c_str(), EX_NOCLOBBER, &CPU_word_size, &IO_Word_size);
+  if (fid < 0) {
+    std::cerr << "Cowardly not clobbering: \"" << filename << "\" already exists." << std::endl;
+    return;
+  }
+
+  // create the params
+  ex_init_params params;
+  sprintf(params.title, "my_mesh");
+  params.num_dim = 3;
+  params.num_nodes = m.nnodes;
+  params.num_edge = 0;
+  params.num_edge_blk = 0;
+  params.num_face = m.nfaces;
+  params.num_face_blk = 1;
+  params.num_elem = m.ncells;
+  params.num_elem_blk = m.block_ids.size();
+  params.num_node_maps = 0;
+  params.num_edge_maps = 0;
+  params.num_face_maps = 0;
+  params.num_elem_maps = 0;
+  params.num_side_sets = m.side_sets.size();
+  params.num_elem_sets = 0;
+  params.num_node_sets = 0;
+  params.num_face_sets = 0;
+  params.num_edge_sets = 0;
+
+  int ierr = ex_put_init_ext(fid, &params);
+  AMANZI_ASSERT(!ierr);
+
+  // define everything before writing any data, so that the file is laid out
+  // only once
+  ierr |= ex_put_block(fid, EX_FACE_BLOCK, 1, "NSIDED", m.nfaces, m.nface_nodes, 0, 0, 0);
+  AMANZI_ASSERT(!ierr);
+
+  for (int lcvb = 0; lcvb != m.block_ids.size(); ++lcvb) {
+    ierr |= ex_put_block(fid,
+                         EX_ELEM_BLOCK,
+                         m.block_ids[lcvb],
+                         "NFACED",
+                         m.block_ncells[lcvb],
+                         0,
+                         0,
+                         m.block_ncell_faces[lcvb],
+                         0);
+    AMANZI_ASSERT(!ierr);
+  }
+
+  for (int lcvs = 0; lcvs != m.side_sets.size(); ++lcvs) {
+    int size = m.side_sets_id[lcvs] == 3 ? m.nsides : m.side_sets[lcvs].first.size();
+    ierr |= ex_put_set_param(fid, EX_SIDE_SET, m.side_sets_id[lcvs], size, 0);
+    AMANZI_ASSERT(!ierr);
+  }
+
+  char* coord_names[3];
+  char a[10] = "xcoord";
+  char b[10] = "ycoord";
+  char c[10] = "zcoord";
+  coord_names[0] = a;
+  coord_names[1] = b;
+  coord_names[2] = c;
+
+  ierr |= ex_put_coord_names(fid, coord_names);
+  AMANZI_ASSERT(!ierr);
+
+  // add the side sets known up front
+  for (int lcvs = 0; lcvs != m.side_sets.size(); ++lcvs) {
+    auto& s = m.side_sets[lcvs];
+    if (m.side_sets_id[lcvs] == 3 || s.first.empty()) continue;
+    std::vector<int> elems_copy(s.first);
+    std::vector<int> faces_copy(s.second);
+    for (auto& e : elems_copy) e++;
+    for (auto& e : faces_copy) e++;
+    ierr |= ex_put_set(fid, EX_SIDE_SET, m.side_sets_id[lcvs], &elems_copy[0], &faces_copy[0]);
+    AMANZI_ASSERT(!ierr);
+  }
+
+  // generate and write the layers, tracking where each variable's next entry
+  // goes
+  std::size_t face_nodes_offset = 0;
+  std::vector<std::size_t> block_cells_offset(m.block_ids.size(), 0);
+  std::vector<std::size_t> block_cell_faces_offset(m.block_ids.size(), 0);
+  std::size_t sides_offset = 0;
+  std::vector<float> x, y, z;
+
+  m.generate([&](Mesh3DChunk& chunk) {
+    // NOTE: exodus seems to only deal with floats!
+    if (!chunk.x.empty()) {
+      x.assign(chunk.x.begin(), chunk.x.end());
+      y.assign(chunk.y.begin(), chunk.y.end());
+      z.assign(chunk.z.begin(), chunk.z.end());
+      ierr |= ex_put_partial_coord(fid, chunk.node_begin + 1, x.size(), &x[0], &y[0], &z[0]);
+      AMANZI_ASSERT(!ierr);
+    }
+
+    putPartial(fid, "fbepecnt1", chunk.face_begin, chunk.face_counts);
+    for (auto& e : chunk.face_nodes) e++;
+    putPartial(fid, "fbconn1", face_nodes_offset, chunk.face_nodes);
+    face_nodes_offset += chunk.face_nodes.size();
+
+    for (int lcvb = 0; lcvb != m.block_ids.size(); ++lcvb) {
+      std::string ordinal = std::to_string(lcvb + 1);
+      AMANZI_ASSERT(block_cells_offset[lcvb] == chunk.block_cell_begin[lcvb]);
+      putPartial(fid, "ebepecnt" + ordinal, block_cells_offset[lcvb], chunk.block_cell_counts[lcvb]);
+      block_cells_offset[lcvb] += chunk.block_cell_counts[lcvb].size();
+
+      for (auto& e : chunk.block_cell_faces[lcvb]) e++;
+      putPartial(
+        fid, "facconn" + ordinal, block_cell_faces_offset[lcvb], chunk.block_cell_faces[lcvb]);
+      block_cell_faces_offset[lcvb] += chunk.block_cell_faces[lcvb].size();
+    }
+
+    if (!chunk.side_elems.empty()) {
+      for (auto& e : chunk.side_elems) e++;
+      for (auto& e : chunk.side_faces) e++;
+      ierr |= ex_put_partial_set(fid,
+                                 EX_SIDE_SET,
+                                 3,
+                                 sides_offset + 1,
+                                 chunk.side_elems.size(),
+                                 &chunk.side_elems[0],
+                                 &chunk.side_faces[0]);
+      AMANZI_ASSERT(!ierr);
+      sides_offset += chunk.side_elems.size();
+    }
+  });
+
+  AMANZI_ASSERT(face_nodes_offset == m.nface_nodes);
+  AMANZI_ASSERT(sides_offset == m.nsides);
+
+  ierr |= ex_close(fid);
+  AMANZI_ASSERT(!ierr);
+
+
+  // debugging/nice output
+  std::cout << "Wrote 3D Mesh:" << std::endl
+            << "  ncells = " << m.ncells << std::endl
+            << "  nfaces = " << m.nfaces << std::endl
+            << "  nnodes = " << m.nnodes << std::endl
+            << std::endl
+            << "  side sets = " << std::endl;
+  for (int i = 0; i != m.side_sets.size(); ++i) {
+    int size = m.side_sets_id[i] == 3 ? m.nsides : m.side_sets[i].first.size();
+    std::cout << "    " << m.side_sets_id[i] << " (" << size << " faces)" << std::endl;
+  }
+  std::cout << std::endl << "  block ids = " << std::endl;
+  for (int i = 0; i != m.block_ids.size(); ++i)
+    std::cout << "    " << m.block_ids[i] << " (" << m.block_ncells[i] << " cells)" << std::endl;
+  std::cout << std::endl;
+}
+
 } // namespace AmanziGeometry
 } // namespace Amanzi
@@ -11,6 +11,7 @@
 #define MESH_WRITER_HH_
 
 #include "Mesh3D.hh"
+#include "Mesh3DStream.hh"
 
 
 namespace Amanzi {
@@ -19,6 +20,10 @@ namespace AmanziGeometry {
 void
 writeMesh3D_exodus(const Mesh3D& m, const std::string& filename);
 
+// Generates and writes the mesh one layer at a time.  m must be finished.
+void
+writeMesh3D_exodus(const Mesh3DStream& m, const std::string& filename);
+
 }
 } // namespace Amanzi
 
@@ -1,7 +1,9 @@
 import sys, os
+import filecmp
 import subprocess
 from ConfigParser import SafeConfigParser as config_parser
 import netCDF4
+import numpy
 import unittest
 
     
@@ -39,6 +41,32 @@ def runExe(dirname, exes=None):
 
 
 
+# the streaming extruder, with its thread count, writes the mesh of
+# extrude_uniform to each of these files
+_streaming_runs = [("1", "Mesh3D_2mSoil_Streaming"),
+                   ("3", "Mesh3D_2mSoil_Streaming3")]
+
+def runStreaming(dirname):
+    cwd = os.getcwd()
+    try:
+        os.chdir(dirname)
+        for n_threads, meshname in _streaming_runs:
+            exo = meshname+".exo"
+            try:
+                os.remove(exo)
+            except:
+                pass
+
+            executable = os.path.join("..", "..", "extrude_uniform_streaming")
+            print "Running: %s %s in %s"%(executable, n_threads, os.getcwd())
+
+            with open(meshname+".log", 'w') as stdout:
+                subprocess.call([executable, n_threads, exo], stdout=stdout)
+
+    finally:
+        os.chdir(cwd)
+
+
 def loadConfig(dirname):
     cp = config_parser()
     cp.read(os.path.join(dirname, "test.cfg"))
@@ -84,6 +112,44 @@ def generateMeshClass(dirname, meshname, config):
     MyMesh.__module__ = ""
     return MyMesh
 
+# The streaming writer must produce the same mesh as extrude_uniform, bit for
+# bit in every variable, and byte-identical files for any thread count.
+class StreamingMesh(unittest.TestCase):
+    def meshFile(self, meshname):
+        return os.path.join(self.dirname, meshname+".exo")
+
+    def test_matches_extrude_uniform(self):
+        ref = openMesh(self.meshFile(_filenames["extrude_uniform"]))
+        new = openMesh(self.meshFile(_streaming_runs[0][1]))
+        try:
+            ref.set_auto_mask(False)
+            new.set_auto_mask(False)
+            self.assertEqual(dict((k, len(d)) for k, d in ref.dimensions.items()),
+                             dict((k, len(d)) for k, d in new.dimensions.items()))
+            self.assertEqual(sorted(ref.variables.keys()), sorted(new.variables.keys()))
+            for vname, ref_var in ref.variables.items():
+                new_var = new.variables[vname]
+                self.assertEqual(ref_var.dtype, new_var.dtype, vname)
+                self.assertEqual(ref_var.dimensions, new_var.dimensions, vname)
+                self.assertEqual(ref_var.__dict__, new_var.__dict__, vname)
+                self.assertTrue(numpy.array_equal(ref_var[...], new_var[...]), vname)
+        finally:
+            ref.close()
+            new.close()
+
+    def test_threads_byte_identical(self):
+        self.assertTrue(filecmp.cmp(self.meshFile(_streaming_runs[0][1]),
+                                    self.meshFile(_streaming_runs[1][1]), shallow=False))
+
+def generateStreamingClass(dirname):
+    class MyStreamingMesh(StreamingMesh):
+        pass
+
+    setattr(MyStreamingMesh, "dirname", dirname)
+    MyStreamingMesh.__name__ = dirname+"_streaming"
+    MyStreamingMesh.__module__ = ""
+    return MyStreamingMesh
+
 def generateSuites(dirname):
     suites = []
     config = loadConfig(dirname)
@@ -93,6 +159,7 @@ def generateSuites(dirname):
     for meshname in meshes:
         suite = unittest.TestLoader().loadTestsFromTestCase(generateMeshClass(dirname, meshname, config))
         suites.append(suite)
+    suites.append(unittest.TestLoader().loadTestsFromTestCase(generateStreamingClass(dirname)))
     return suites
     
 
@@ -101,6 +168,7 @@ if __name__ == "__main__":
     suites = []
     for d in findDirectories():
         runExe(d)
+        runStreaming(d)
         suites.append(unittest.TestSuite(generateSuites(d)))
     suite = unittest.TestSuite(suites)
     runner = unittest.TextTestRunner(verbosity=2)